@@ -48,6 +48,7 @@
 #cmakedefine HAVE_MPI_IN_PLACE
 #cmakedefine HAVE_MPI3_NONBLOCKING_COLLECTIVES
 #cmakedefine HAVE_MPIX_NONBLOCKING_COLLECTIVES
+#cmakedefine HAVE_PREAD
 #cmakedefine REDUCE_SCATTER_BLOCK_VIA_ALL_REDUCE
 #cmakedefine USE_BYTE_ALLGATHERS
 
@@ -55,7 +56,6 @@
 #cmakedefine CACHE_WARNINGS
 #cmakedefine UNALIGNED_WARNINGS
 #cmakedefine VECTOR_WARNINGS
-#cmakedefine POOL_MEMORY
 #cmakedefine AVOID_OMP_FMA
 
 #endif // ELEMENTAL_CONFIG_H
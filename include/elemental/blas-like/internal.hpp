@@ -811,6 +811,8 @@ inline void LocalGemm
             throw std::logic_error( msg.str().c_str() );
         }
     }
+#else
+    PushProfileRegion("internal::LocalGemm");
 #endif
     Gemm
     ( orientationOfA , orientationOfB, 
@@ -818,6 +820,8 @@ inline void LocalGemm
       beta, C.LocalMatrix() );
 #ifndef RELEASE
     PopCallStack();
+#else
+    PopProfileRegion();
 #endif
 }
 
@@ -887,12 +891,16 @@ LocalTrsm
         (side == RIGHT && XRowDist != STAR) )
         throw std::logic_error
         ("Distribution of RHS must conform with that of triangle");
+#else
+    PushProfileRegion("internal::LocalTrsm");
 #endif
     Trsm
     ( side, uplo, orientation, diag,
       alpha, A.LockedLocalMatrix(), X.LocalMatrix(), checkIfSingular );
 #ifndef RELEASE
     PopCallStack();
+#else
+    PopProfileRegion();
 #endif
 }
 
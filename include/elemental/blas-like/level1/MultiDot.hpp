@@ -0,0 +1,80 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace elem {
+
+template<typename T>
+inline void
+MultiDot( const Matrix<T>& X, const Matrix<T>& Y, std::vector<T>& dots )
+{
+#ifndef RELEASE
+    PushCallStack("MultiDot");
+    if( X.Height() != Y.Height() || X.Width() != Y.Width() )
+        throw std::logic_error("X and Y must be the same size");
+#endif
+    const int height = X.Height();
+    const int width = X.Width();
+    dots.resize( width );
+    for( int j=0; j<width; ++j )
+        dots[j] = blas::Dot
+                  ( height, X.LockedBuffer(0,j), 1, Y.LockedBuffer(0,j), 1 );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename T>
+inline void
+MultiDot
+( const DistMatrix<T>& X, const DistMatrix<T>& Y, std::vector<T>& dots )
+{
+#ifndef RELEASE
+    PushCallStack("MultiDot");
+    if( X.Grid() != Y.Grid() )
+        throw std::logic_error("{X,Y} must be distributed over the same grid");
+    if( X.Height() != Y.Height() || X.Width() != Y.Width() )
+        throw std::logic_error("X and Y must be the same size");
+#endif
+    const Grid& g = Y.Grid();
+    const int width = Y.Width();
+
+    DistMatrix<T> XAlign(g);
+    if( X.ColAlignment() == Y.ColAlignment() &&
+        X.RowAlignment() == Y.RowAlignment() )
+        LockedView( XAlign, X );
+    else
+    {
+        XAlign.AlignWith( Y );
+        XAlign = X;
+    }
+
+    // Each column of Y is owned by a single process column, so the partial
+    // dot products of every column can be summed over the entire grid at once
+    const int localHeight = Y.LocalHeight();
+    const int localWidth = Y.LocalWidth();
+    const int rowShift = Y.RowShift();
+    const int rowStride = Y.RowStride();
+    std::vector<T> localDots( width, T(0) );
+    for( int jLocal=0; jLocal<localWidth; ++jLocal )
+    {
+        const int j = rowShift + jLocal*rowStride;
+        localDots[j] = blas::Dot
+                       ( localHeight, XAlign.LockedLocalBuffer(0,jLocal), 1,
+                                      Y.LockedLocalBuffer(0,jLocal),      1 );
+    }
+    dots.resize( width );
+    if( width > 0 )
+        mpi::AllReduce
+        ( &localDots[0], &dots[0], width, mpi::SUM, g.VCComm() );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+} // namespace elem
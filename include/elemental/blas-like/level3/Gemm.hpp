@@ -7,6 +7,7 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 
+#include "./Gemm/Select.hpp"
 #include "./Gemm/NN.hpp"
 #include "./Gemm/NT.hpp"
 #include "./Gemm/TN.hpp"
@@ -50,6 +51,8 @@ Gemm
             A.Height() != B.Width() )
             throw std::logic_error("Nonconformal Gemm(T/C)(T/C)");
     }
+#else
+    PushProfileRegion("Gemm");
 #endif
     const char transA = OrientationToChar( orientationOfA );
     const char transB = OrientationToChar( orientationOfB );
@@ -69,6 +72,8 @@ Gemm
     }
 #ifndef RELEASE
     PopCallStack();
+#else
+    PopProfileRegion();
 #endif
 }
 
@@ -152,7 +157,19 @@ GemmC
 #ifndef RELEASE
     PushCallStack("internal::GemmC");
 #endif
-    if( orientationOfA == NORMAL && orientationOfB == NORMAL )
+    if( GemmPipelining() )
+    {
+        if( orientationOfA == NORMAL && orientationOfB == NORMAL )
+            GemmNNCPipelined( alpha, A, B, beta, C );
+        else if( orientationOfA == NORMAL )
+            GemmNTCPipelined( orientationOfB, alpha, A, B, beta, C );
+        else if( orientationOfB == NORMAL )
+            GemmTNCPipelined( orientationOfA, alpha, A, B, beta, C );
+        else
+            GemmTTCPipelined
+            ( orientationOfA, orientationOfB, alpha, A, B, beta, C );
+    }
+    else if( orientationOfA == NORMAL && orientationOfB == NORMAL )
     {
         GemmNNC( alpha, A, B, beta, C );
     }
@@ -210,6 +227,86 @@ GemmDot
 #endif
 }
 
+template<typename T>
+inline void
+GemmWithAlgorithm
+( GemmAlgorithm alg,
+  Orientation orientationOfA, 
+  Orientation orientationOfB,
+  T alpha, const DistMatrix<T>& A,
+           const DistMatrix<T>& B,
+  T beta,        DistMatrix<T>& C )
+{
+    if( alg == GEMM_SUMMA_A )
+        GemmA( orientationOfA, orientationOfB, alpha, A, B, beta, C );
+    else if( alg == GEMM_SUMMA_B )
+        GemmB( orientationOfA, orientationOfB, alpha, A, B, beta, C );
+    else if( alg == GEMM_SUMMA_DOT )
+        GemmDot( orientationOfA, orientationOfB, alpha, A, B, beta, C );
+    else
+        GemmC( orientationOfA, orientationOfB, alpha, A, B, beta, C );
+}
+
+// Times each of the candidate algorithms on a copy of C, records the fastest
+// for this class of shapes, and then applies it to C
+template<typename T>
+inline void
+AutotuneGemm
+( Orientation orientationOfA, 
+  Orientation orientationOfB,
+  T alpha, const DistMatrix<T>& A,
+           const DistMatrix<T>& B,
+  T beta,        DistMatrix<T>& C )
+{
+#ifndef RELEASE
+    PushCallStack("internal::AutotuneGemm");
+#endif
+    const Grid& g = C.Grid();
+    const int m = C.Height();
+    const int n = C.Width();
+    const int k = ( orientationOfA == NORMAL ? A.Width() : A.Height() );
+
+    std::vector<GemmAlgorithm> candidates;
+    candidates.push_back( GEMM_SUMMA_A );
+    candidates.push_back( GEMM_SUMMA_B );
+    candidates.push_back( GEMM_SUMMA_C );
+    if( orientationOfA == NORMAL && orientationOfB == NORMAL )
+        candidates.push_back( GEMM_SUMMA_DOT );
+
+    GemmAlgorithm bestAlg = GEMM_SUMMA_C;
+    double bestTime = 0;
+    DistMatrix<T> CTrial(g);
+    for( std::size_t j=0; j<candidates.size(); ++j )
+    {
+        CTrial = C;
+        mpi::Barrier( g.Comm() );
+        const double startTime = mpi::Time();
+        GemmWithAlgorithm
+        ( candidates[j], orientationOfA, orientationOfB,
+          alpha, A, B, beta, CTrial );
+        const double localTime = mpi::Time() - startTime;
+
+        // Every process must agree on the winner
+        double runTime;
+        mpi::AllReduce( &localTime, &runTime, 1, mpi::MAX, g.Comm() );
+        if( j == 0 || runTime < bestTime )
+        {
+            bestAlg = candidates[j];
+            bestTime = runTime;
+        }
+    }
+    CTrial.Empty();
+
+    RecordGemmTuning
+    ( GemmTuningKey<T>(orientationOfA,orientationOfB,m,n,k,g), bestAlg,
+      g.Rank() == 0 );
+    GemmWithAlgorithm
+    ( bestAlg, orientationOfA, orientationOfB, alpha, A, B, beta, C );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
 } // namespace internal
 
 template<typename T>
@@ -219,12 +316,34 @@ Gemm
   Orientation orientationOfB,
   T alpha, const DistMatrix<T>& A,
            const DistMatrix<T>& B,
-  T beta,        DistMatrix<T>& C )
+  T beta,        DistMatrix<T>& C, GemmAlgorithm alg )
 {
 #ifndef RELEASE
     PushCallStack("Gemm");
+#else
+    PushProfileRegion("Gemm");
 #endif
-    if( orientationOfA == NORMAL && orientationOfB == NORMAL )
+    PushBlocksizeStack<T>( "Gemm", C.Grid() );
+    const int m = C.Height();
+    const int n = C.Width();
+    const int k = ( orientationOfA == NORMAL ? A.Width() : A.Height() );
+    GemmAlgorithm tunedAlg;
+    if( alg != GEMM_DEFAULT )
+    {
+        internal::GemmWithAlgorithm
+        ( alg, orientationOfA, orientationOfB, alpha, A, B, beta, C );
+    }
+    else if( GemmAutotuning() )
+    {
+        if( internal::FindGemmTuningCollectively<T>
+            ( orientationOfA, orientationOfB, m, n, k, C.Grid(), tunedAlg ) )
+            internal::GemmWithAlgorithm
+            ( tunedAlg, orientationOfA, orientationOfB, alpha, A, B, beta, C );
+        else
+            internal::AutotuneGemm
+            ( orientationOfA, orientationOfB, alpha, A, B, beta, C );
+    }
+    else if( orientationOfA == NORMAL && orientationOfB == NORMAL )
     {
         internal::GemmNN( alpha, A, B, beta, C );
     }
@@ -241,8 +360,11 @@ Gemm
         internal::GemmTT
         ( orientationOfA, orientationOfB, alpha, A, B, beta, C );
     }
+    PopBlocksizeStack( "Gemm" );
 #ifndef RELEASE
     PopCallStack();
+#else
+    PopProfileRegion();
 #endif
 }
 
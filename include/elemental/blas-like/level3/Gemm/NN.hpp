@@ -264,6 +264,98 @@ GemmNNC
 #endif
 }
 
+// Normal Normal Gemm that avoids communicating the matrix C, and which 
+// overlaps the AllGathers of the next panels of A and B with the local update
+// from the current panels.
+template<typename T>
+inline void 
+GemmNNCPipelined
+( T alpha, const DistMatrix<T>& A,
+           const DistMatrix<T>& B,
+  T beta,        DistMatrix<T>& C )
+{
+#ifndef RELEASE
+    PushCallStack("internal::GemmNNCPipelined");
+    if( A.Grid() != B.Grid() || B.Grid() != C.Grid() )
+        throw std::logic_error
+        ("{A,B,C} must be distributed over the same grid");
+    if( A.Height() != C.Height() ||
+        B.Width()  != C.Width()  ||
+        A.Width()  != B.Height() )
+    {
+        std::ostringstream msg;
+        msg << "Nonconformal GemmNNCPipelined: \n"
+            << "  A ~ " << A.Height() << " x " << A.Width() << "\n"
+            << "  B ~ " << B.Height() << " x " << B.Width() << "\n"
+            << "  C ~ " << C.Height() << " x " << C.Width() << "\n";
+        throw std::logic_error( msg.str().c_str() );
+    }
+#endif
+    // The panels may only be redistributed with a single AllGather if they
+    // are aligned with C
+    if( A.ColAlignment() != C.ColAlignment() || 
+        B.RowAlignment() != C.RowAlignment() )
+    {
+        GemmNNC( alpha, A, B, beta, C );
+#ifndef RELEASE
+        PopCallStack();
+#endif
+        return;
+    }
+    const Grid& g = A.Grid();
+    const int m = C.Height();
+    const int n = C.Width();
+    const int k = A.Width();
+    const int bsize = Blocksize();
+
+    // Matrix views
+    DistMatrix<T> A1(g), B1(g);
+
+    // Temporary distributions
+    DistMatrix<T,MC,STAR> A1_MC_STAR(g);
+    DistMatrix<T,STAR,MR> B1_STAR_MR(g);
+
+    A1_MC_STAR.AlignWith( C );
+    B1_STAR_MR.AlignWith( C );
+
+    // Start the algorithm
+    Scale( beta, C );
+    if( k > 0 )
+    {
+        const int nb = std::min(bsize,k);
+        LockedView( A1, A, 0, 0, m, nb );
+        LockedView( B1, B, 0, 0, nb, n );
+        A1_MC_STAR.BeginRedistribute( A1 );
+        B1_STAR_MR.BeginRedistribute( B1 );
+    }
+    for( int j=0; j<k; j+=bsize )
+    {
+        const int nb = std::min(bsize,k-j);
+
+        //--------------------------------------------------------------------//
+        A1_MC_STAR.FinishRedistribute();
+        B1_STAR_MR.FinishRedistribute();
+
+        // Start gathering the next panels before updating with these ones
+        if( j+nb < k )
+        {
+            const int nbNext = std::min(bsize,k-(j+nb));
+            LockedView( A1, A, 0, j+nb, m, nbNext );
+            LockedView( B1, B, j+nb, 0, nbNext, n );
+            A1_MC_STAR.BeginRedistribute( A1 );
+            B1_STAR_MR.BeginRedistribute( B1 );
+        }
+
+        // C[MC,MR] += alpha A1[MC,*] B1[*,MR]
+        LocalGemm
+        ( NORMAL, NORMAL, alpha, A1_MC_STAR, B1_STAR_MR, T(1), C );
+        //--------------------------------------------------------------------//
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
 // Normal Normal Gemm for panel-panel dot products. 
 template<typename T>
 inline void 
@@ -485,21 +577,25 @@ GemmNN
     const int m = C.Height();
     const int n = C.Width();
     const int k = A.Width();
-    const float weightTowardsC = 2.0;
-    const float weightAwayFromDot = 10.0;
+    const GemmAlgorithm alg =
+        SelectGemmAlgorithm<T>( NORMAL, NORMAL, m, n, k, A.Grid() );
 
-    if( weightAwayFromDot*m <= k && weightAwayFromDot*n <= k )
+    if( alg == GEMM_SUMMA_DOT )
     {
         GemmNNDot( alpha, A, B, beta, C );
     }
-    else if( m <= n && weightTowardsC*m <= k )
+    else if( alg == GEMM_SUMMA_B )
     {
         GemmNNB( alpha, A, B, beta, C );    
     }
-    else if( n <= m && weightTowardsC*n <= k )
+    else if( alg == GEMM_SUMMA_A )
     {
         GemmNNA( alpha, A, B, beta, C );
     }
+    else if( GemmPipelining() )
+    {
+        GemmNNCPipelined( alpha, A, B, beta, C );
+    }
     else
     {
         GemmNNC( alpha, A, B, beta, C );
@@ -294,6 +294,106 @@ GemmNTC
 #endif
 }
 
+// Normal Transpose Gemm that avoids communicating the matrix C, and which
+// overlaps the AllGathers of the next panels of A and B with the local update
+// from the current panels.
+template<typename T>
+inline void
+GemmNTCPipelined
+( Orientation orientationOfB,
+ 
+  T alpha, const DistMatrix<T>& A,
+           const DistMatrix<T>& B,
+  T beta,        DistMatrix<T>& C )
+{
+#ifndef RELEASE
+    PushCallStack("internal::GemmNTCPipelined");
+    if( A.Grid() != B.Grid() || B.Grid() != C.Grid() )
+        throw std::logic_error
+        ("{A,B,C} must be distributed over the same grid");
+    if( orientationOfB == NORMAL )
+        throw std::logic_error
+        ("GemmNTCPipelined requires that B be (Conjugate)Transposed");
+    if( A.Height() != C.Height() ||
+        B.Height() != C.Width()  ||
+        A.Width()  != B.Width() )
+    {
+        std::ostringstream msg;
+        msg << "Nonconformal GemmNTCPipelined: \n"
+            << "  A ~ " << A.Height() << " x " << A.Width() << "\n"
+            << "  B ~ " << B.Height() << " x " << B.Width() << "\n"
+            << "  C ~ " << C.Height() << " x " << C.Width() << "\n";
+        throw std::logic_error( msg.str().c_str() );
+    }
+#endif
+    // The panels of A may only be redistributed with a single AllGather if 
+    // they are aligned with C
+    if( A.ColAlignment() != C.ColAlignment() )
+    {
+        GemmNTC( orientationOfB, alpha, A, B, beta, C );
+#ifndef RELEASE
+        PopCallStack();
+#endif
+        return;
+    }
+    const Grid& g = A.Grid();
+    const int m = C.Height();
+    const int n = C.Width();
+    const int k = A.Width();
+    const int bsize = Blocksize();
+
+    // Matrix views
+    DistMatrix<T> A1(g), B1(g);
+
+    // Temporary distributions
+    DistMatrix<T,MC,STAR> A1_MC_STAR(g);
+    DistMatrix<T,MR,MC  > B1_MR_MC(g);
+    DistMatrix<T,MR,STAR> B1_MR_STAR(g);
+
+    A1_MC_STAR.AlignWith( C );
+    B1_MR_MC.AlignWith( C );
+    B1_MR_STAR.AlignWith( C );
+
+    // Start the algorithm
+    Scale( beta, C );
+    if( k > 0 )
+    {
+        const int nb = std::min(bsize,k);
+        LockedView( A1, A, 0, 0, m, nb );
+        LockedView( B1, B, 0, 0, n, nb );
+        A1_MC_STAR.BeginRedistribute( A1 );
+        B1_MR_MC = B1;
+        B1_MR_STAR.BeginRedistribute( B1_MR_MC );
+    }
+    for( int j=0; j<k; j+=bsize )
+    {
+        const int nb = std::min(bsize,k-j);
+
+        //--------------------------------------------------------------------//
+        A1_MC_STAR.FinishRedistribute();
+        B1_MR_STAR.FinishRedistribute();
+
+        // Start gathering the next panels before updating with these ones
+        if( j+nb < k )
+        {
+            const int nbNext = std::min(bsize,k-(j+nb));
+            LockedView( A1, A, 0, j+nb, m, nbNext );
+            LockedView( B1, B, 0, j+nb, n, nbNext );
+            A1_MC_STAR.BeginRedistribute( A1 );
+            B1_MR_MC = B1;
+            B1_MR_STAR.BeginRedistribute( B1_MR_MC );
+        }
+
+        // C[MC,MR] += alpha A1[MC,*] (B1[MR,*])^[T/H]
+        LocalGemm
+        ( NORMAL, orientationOfB, alpha, A1_MC_STAR, B1_MR_STAR, T(1), C );
+        //--------------------------------------------------------------------//
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
 template<typename T>
 inline void
 GemmNT
@@ -314,16 +414,21 @@ GemmNT
     const int m = C.Height();
     const int n = C.Width();
     const int k = A.Width();
-    const float weightTowardsC = 2.0;
+    const GemmAlgorithm alg = SelectGemmAlgorithm<T>
+        ( NORMAL, orientationOfB, m, n, k, A.Grid() );
 
-    if( m <= n && weightTowardsC*m <= k )
+    if( alg == GEMM_SUMMA_B )
     {
         GemmNTB( orientationOfB, alpha, A, B, beta, C );
     }
-    else if( n <= m && weightTowardsC*n <= k )
+    else if( alg == GEMM_SUMMA_A )
     {
         GemmNTA( orientationOfB, alpha, A, B, beta, C );
     }
+    else if( GemmPipelining() )
+    {
+        GemmNTCPipelined( orientationOfB, alpha, A, B, beta, C );
+    }
     else
     {
         GemmNTC( orientationOfB, alpha, A, B, beta, C );
@@ -0,0 +1,167 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace elem {
+namespace internal {
+
+// Implemented in src/gemm_tuning.cpp
+bool FindGemmTuning( const std::string& key, GemmAlgorithm& alg );
+void RecordGemmTuning( const std::string& key, GemmAlgorithm alg, bool root );
+
+inline int
+GemmLog2( double alpha )
+{
+    int exponent = 0;
+    for( double beta=2; beta<=alpha; beta*=2 )
+        ++exponent;
+    return exponent;
+}
+
+// Products whose dimensions lie within the same powers of two, over the same
+// grid shape and with the same blocksize, share an autotuned algorithm
+template<typename T>
+inline std::string
+GemmTuningKey
+( Orientation orientationOfA, Orientation orientationOfB,
+  int m, int n, int k, const Grid& g )
+{
+    std::ostringstream key;
+    key << OrientationToChar(orientationOfA)
+        << OrientationToChar(orientationOfB) << " " << DataTypeChar<T>() << " "
+        << g.Height() << "x" << g.Width() << " " << Blocksize() << " "
+        << GemmLog2(m) << " " << GemmLog2(n) << " " << GemmLog2(k);
+    return key.str();
+}
+
+// The tuning cache is local to each process, and Gemms over different 
+// subgrids fill the caches of different processes, so the processes of g
+// agree on whether the key was found, and on its winner, before using it
+template<typename T>
+inline bool
+FindGemmTuningCollectively
+( Orientation orientationOfA, Orientation orientationOfB,
+  int m, int n, int k, const Grid& g, GemmAlgorithm& alg )
+{
+#ifndef RELEASE
+    PushCallStack("internal::FindGemmTuningCollectively");
+#endif
+    GemmAlgorithm localAlg;
+    const bool found = FindGemmTuning
+        ( GemmTuningKey<T>(orientationOfA,orientationOfB,m,n,k,g), localAlg );
+    const int localValue = ( found ? int(localAlg) : -1 );
+    int localExtremes[2] = { localValue, -localValue };
+    int extremes[2];
+    mpi::AllReduce( localExtremes, extremes, 2, mpi::MIN, g.Comm() );
+    const bool agreed = ( extremes[0] >= 0 && extremes[0] == -extremes[1] );
+    if( agreed )
+        alg = static_cast<GemmAlgorithm>( extremes[0] );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+    return agreed;
+}
+
+// The alpha-beta-gamma estimate of the runtime of each of the algorithms for
+// C := alpha A B + beta C over an r x c grid, with p = r c. The stationary
+// A and B algorithms respectively move B and A once and reduce-scatter each
+// panel of the result, the stationary C algorithm gathers a panel of A and
+// of B for every panel of the inner dimension, and the dot-product algorithm
+// reduces each block of C over the entire grid. The transposed variants move
+// the same volumes of data.
+template<typename T>
+inline double
+GemmCost( GemmAlgorithm alg, int m, int n, int k, const Grid& g )
+{
+    const GemmCostModel model = GetGemmCostModel( g );
+    const double r = g.Height();
+    const double c = g.Width();
+    const double p = g.Size();
+    const double logR = GemmLog2( 2*r-1 );
+    const double logC = GemmLog2( 2*c-1 );
+    const double logP = GemmLog2( 2*p-1 );
+    const int nb = Blocksize();
+
+    double numMessages, numWords;
+    if( alg == GEMM_SUMMA_A )
+    {
+        numMessages = ((n+nb-1)/nb)*(1+logR+logC);
+        numWords = double(n)*k/c + double(n)*m*(c-1)/p;
+    }
+    else if( alg == GEMM_SUMMA_B )
+    {
+        numMessages = ((m+nb-1)/nb)*(1+logR+logC);
+        numWords = double(m)*k/r + double(m)*n*(r-1)/p;
+    }
+    else if( alg == GEMM_SUMMA_DOT )
+    {
+        const int outer = std::max(m,n);
+        const int inner = std::min(m,n);
+        const int numOuterPanels = (outer+nb-1)/nb;
+        const int numInnerPanels = (inner+nb-1)/nb;
+        numMessages = numOuterPanels*(1+numInnerPanels*(1+logP));
+        numWords = double(outer)*k/p + double(numOuterPanels)*inner*k/p +
+                   double(m)*n*(p-1)/p;
+    }
+    else
+    {
+        numMessages = ((k+nb-1)/nb)*(logR+logC);
+        numWords = double(k)*(double(m)*(c-1)+double(n)*(r-1))/p;
+    }
+    const double numFlops =
+        ( IsComplex<T>::val ? 8. : 2. )*double(m)*double(n)*double(k)/p;
+    return numMessages*model.latency +
+           numWords*sizeof(T)*model.secondsPerByte +
+           numFlops*model.secondsPerFlop;
+}
+
+// Returns the autotuned winner for this class of shapes if there is one,
+// and otherwise the algorithm with the lowest modeled cost
+template<typename T>
+inline GemmAlgorithm
+SelectGemmAlgorithm
+( Orientation orientationOfA, Orientation orientationOfB,
+  int m, int n, int k, const Grid& g )
+{
+#ifndef RELEASE
+    PushCallStack("internal::SelectGemmAlgorithm");
+#endif
+    GemmAlgorithm alg;
+    if( !GemmAutotuning() ||
+        !FindGemmTuningCollectively<T>
+         ( orientationOfA, orientationOfB, m, n, k, g, alg ) )
+    {
+        alg = GEMM_SUMMA_C;
+        double minCost = GemmCost<T>( GEMM_SUMMA_C, m, n, k, g );
+        const double costA = GemmCost<T>( GEMM_SUMMA_A, m, n, k, g );
+        if( costA < minCost )
+        {
+            alg = GEMM_SUMMA_A;
+            minCost = costA;
+        }
+        const double costB = GemmCost<T>( GEMM_SUMMA_B, m, n, k, g );
+        if( costB < minCost )
+        {
+            alg = GEMM_SUMMA_B;
+            minCost = costB;
+        }
+        if( orientationOfA == NORMAL && orientationOfB == NORMAL )
+        {
+            const double costDot = GemmCost<T>( GEMM_SUMMA_DOT, m, n, k, g );
+            if( costDot < minCost )
+                alg = GEMM_SUMMA_DOT;
+        }
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+    return alg;
+}
+
+} // namespace internal
+} // namespace elem
@@ -293,6 +293,106 @@ GemmTNC
 #endif
 }
 
+// Transpose Normal Gemm that avoids communicating the matrix C, and which
+// overlaps the AllGathers of the next panels of A and B with the local update
+// from the current panels.
+template<typename T>
+inline void
+GemmTNCPipelined
+( Orientation orientationOfA,
+ 
+  T alpha, const DistMatrix<T>& A,
+           const DistMatrix<T>& B,
+  T beta,        DistMatrix<T>& C )
+{
+#ifndef RELEASE
+    PushCallStack("internal::GemmTNCPipelined");
+    if( A.Grid() != B.Grid() || B.Grid() != C.Grid() )
+        throw std::logic_error
+        ("{A,B,C} must be distributed over the same grid");
+    if( orientationOfA == NORMAL )
+        throw std::logic_error
+        ("GemmTNCPipelined assumes A is (Conjugate)Transposed");
+    if( A.Width()  != C.Height() ||
+        B.Width()  != C.Width()  ||
+        A.Height() != B.Height() )
+    {
+        std::ostringstream msg;
+        msg << "Nonconformal GemmTNCPipelined: \n"
+            << "  A ~ " << A.Height() << " x " << A.Width() << "\n"
+            << "  B ~ " << B.Height() << " x " << B.Width() << "\n"
+            << "  C ~ " << C.Height() << " x " << C.Width() << "\n";
+        throw std::logic_error( msg.str().c_str() );
+    }
+#endif
+    // The panels of B may only be redistributed with a single AllGather if 
+    // they are aligned with C
+    if( B.RowAlignment() != C.RowAlignment() )
+    {
+        GemmTNC( orientationOfA, alpha, A, B, beta, C );
+#ifndef RELEASE
+        PopCallStack();
+#endif
+        return;
+    }
+    const Grid& g = A.Grid();
+    const int m = C.Height();
+    const int n = C.Width();
+    const int k = A.Height();
+    const int bsize = Blocksize();
+
+    // Matrix views
+    DistMatrix<T> A1(g), B1(g);
+
+    // Temporary distributions
+    DistMatrix<T,MR,  MC> A1_MR_MC(g);
+    DistMatrix<T,STAR,MC> A1_STAR_MC(g);
+    DistMatrix<T,STAR,MR> B1_STAR_MR(g);
+
+    A1_MR_MC.AlignWith( C );
+    A1_STAR_MC.AlignWith( C );
+    B1_STAR_MR.AlignWith( C );
+
+    // Start the algorithm
+    Scale( beta, C );
+    if( k > 0 )
+    {
+        const int nb = std::min(bsize,k);
+        LockedView( A1, A, 0, 0, nb, m );
+        LockedView( B1, B, 0, 0, nb, n );
+        A1_MR_MC = A1;
+        A1_STAR_MC.BeginRedistribute( A1_MR_MC );
+        B1_STAR_MR.BeginRedistribute( B1 );
+    }
+    for( int j=0; j<k; j+=bsize )
+    {
+        const int nb = std::min(bsize,k-j);
+
+        //--------------------------------------------------------------------//
+        A1_STAR_MC.FinishRedistribute();
+        B1_STAR_MR.FinishRedistribute();
+
+        // Start gathering the next panels before updating with these ones
+        if( j+nb < k )
+        {
+            const int nbNext = std::min(bsize,k-(j+nb));
+            LockedView( A1, A, j+nb, 0, nbNext, m );
+            LockedView( B1, B, j+nb, 0, nbNext, n );
+            A1_MR_MC = A1;
+            A1_STAR_MC.BeginRedistribute( A1_MR_MC );
+            B1_STAR_MR.BeginRedistribute( B1 );
+        }
+
+        // C[MC,MR] += alpha (A1[*,MC])^[T/H] B1[*,MR]
+        LocalGemm
+        ( orientationOfA, NORMAL, alpha, A1_STAR_MC, B1_STAR_MR, T(1), C );
+        //--------------------------------------------------------------------//
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
 template<typename T>
 inline void
 GemmTN
@@ -312,16 +412,21 @@ GemmTN
     const int m = C.Height();
     const int n = C.Width();
     const int k = A.Height();
-    const float weightTowardsC = 2.0;
+    const GemmAlgorithm alg = SelectGemmAlgorithm<T>
+        ( orientationOfA, NORMAL, m, n, k, A.Grid() );
 
-    if( m <= n && weightTowardsC*m <= k )
+    if( alg == GEMM_SUMMA_B )
     {
         GemmTNB( orientationOfA, alpha, A, B, beta, C );
     }
-    else if( n <= m && weightTowardsC*n <= k )
+    else if( alg == GEMM_SUMMA_A )
     {
         GemmTNA( orientationOfA, alpha, A, B, beta, C );
     }
+    else if( GemmPipelining() )
+    {
+        GemmTNCPipelined( orientationOfA, alpha, A, B, beta, C );
+    }
     else
     {
         GemmTNC( orientationOfA, alpha, A, B, beta, C );
@@ -310,6 +310,102 @@ GemmTTC
 #endif
 }
 
+// Transpose Transpose Gemm that avoids communicating the matrix C, and which
+// overlaps the AllGathers of the next panels of A and B with the local update
+// from the current panels.
+template<typename T>
+inline void
+GemmTTCPipelined
+( Orientation orientationOfA,
+  Orientation orientationOfB,
+ 
+  T alpha, const DistMatrix<T>& A,
+           const DistMatrix<T>& B,
+  T beta,        DistMatrix<T>& C )
+{
+#ifndef RELEASE
+    PushCallStack("internal::GemmTTCPipelined");
+    if( A.Grid() != B.Grid() || B.Grid() != C.Grid() )
+        throw std::logic_error
+        ("{A,B,C} must be distributed over the same grid");
+    if( orientationOfA == NORMAL || orientationOfB == NORMAL )
+        throw std::logic_error
+        ("GemmTTCPipelined expects A and B to be (Conjugate)Transposed");
+    if( A.Width()  != C.Height() ||
+        B.Height() != C.Width()  ||
+        A.Height() != B.Width() )
+    {
+        std::ostringstream msg;
+        msg << "Nonconformal GemmTTCPipelined: \n"
+            << "  A ~ " << A.Height() << " x " << A.Width() << "\n"
+            << "  B ~ " << B.Height() << " x " << B.Width() << "\n"
+            << "  C ~ " << C.Height() << " x " << C.Width() << "\n";
+        throw std::logic_error( msg.str().c_str() );
+    }
+#endif
+    const Grid& g = A.Grid();
+    const int m = C.Height();
+    const int n = C.Width();
+    const int k = A.Height();
+    const int bsize = Blocksize();
+
+    // Matrix views
+    DistMatrix<T> A1(g), B1(g);
+
+    // Temporary distributions
+    DistMatrix<T,MR,  MC  > A1_MR_MC(g);
+    DistMatrix<T,STAR,MC  > A1_STAR_MC(g);
+    DistMatrix<T,MR,  MC  > B1_MR_MC(g);
+    DistMatrix<T,MR,  STAR> B1_MR_STAR(g);
+
+    A1_MR_MC.AlignWith( C );
+    A1_STAR_MC.AlignWith( C );
+    B1_MR_MC.AlignWith( C );
+    B1_MR_STAR.AlignWith( C );
+
+    // Start the algorithm
+    Scale( beta, C );
+    if( k > 0 )
+    {
+        const int nb = std::min(bsize,k);
+        LockedView( A1, A, 0, 0, nb, m );
+        LockedView( B1, B, 0, 0, n, nb );
+        A1_MR_MC = A1;
+        A1_STAR_MC.BeginRedistribute( A1_MR_MC );
+        B1_MR_MC = B1;
+        B1_MR_STAR.BeginRedistribute( B1_MR_MC );
+    }
+    for( int j=0; j<k; j+=bsize )
+    {
+        const int nb = std::min(bsize,k-j);
+
+        //--------------------------------------------------------------------//
+        A1_STAR_MC.FinishRedistribute();
+        B1_MR_STAR.FinishRedistribute();
+
+        // Start gathering the next panels before updating with these ones
+        if( j+nb < k )
+        {
+            const int nbNext = std::min(bsize,k-(j+nb));
+            LockedView( A1, A, j+nb, 0, nbNext, m );
+            LockedView( B1, B, 0, j+nb, n, nbNext );
+            A1_MR_MC = A1;
+            A1_STAR_MC.BeginRedistribute( A1_MR_MC );
+            B1_MR_MC = B1;
+            B1_MR_STAR.BeginRedistribute( B1_MR_MC );
+        }
+
+        // C[MC,MR] += alpha (A1[*,MC])^[T/H] (B1[MR,*])^[T/H]
+        LocalGemm
+        ( orientationOfA, orientationOfB, 
+          alpha, A1_STAR_MC, B1_MR_STAR, T(1), C );
+        //--------------------------------------------------------------------//
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
 template<typename T>
 inline void
 GemmTT
@@ -330,16 +426,22 @@ GemmTT
     const int m = C.Height();
     const int n = C.Width();
     const int k = A.Height();
-    const float weightTowardsC = 2.0;
+    const GemmAlgorithm alg = SelectGemmAlgorithm<T>
+        ( orientationOfA, orientationOfB, m, n, k, A.Grid() );
 
-    if( m <= n && weightTowardsC*m <= k )
+    if( alg == GEMM_SUMMA_B )
     {
         GemmTTB( orientationOfA, orientationOfB, alpha, A, B, beta, C );
     }
-    else if( n <= m && weightTowardsC*n <= k )
+    else if( alg == GEMM_SUMMA_A )
     {
         GemmTTA( orientationOfA, orientationOfB, alpha, A, B, beta, C );
     }
+    else if( GemmPipelining() )
+    {
+        GemmTTCPipelined
+        ( orientationOfA, orientationOfB, alpha, A, B, beta, C );
+    }
     else
     {
         GemmTTC( orientationOfA, orientationOfB, alpha, A, B, beta, C );
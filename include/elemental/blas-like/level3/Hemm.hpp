@@ -22,6 +22,8 @@ Hemm
 {
 #ifndef RELEASE
     PushCallStack("Hemm");
+#else
+    PushProfileRegion("Hemm");
 #endif
     const char sideChar = LeftOrRightToChar( side );
     const char uploChar = UpperOrLowerToChar( uplo );
@@ -32,6 +34,8 @@ Hemm
       beta,  C.Buffer(),       C.LDim() );
 #ifndef RELEASE
     PopCallStack();
+#else
+    PopProfileRegion();
 #endif
 }
 
@@ -45,6 +49,8 @@ Hemm
 {
 #ifndef RELEASE
     PushCallStack("Hemm");
+#else
+    PushProfileRegion("Hemm");
 #endif
     if( side == LEFT && uplo == LOWER )
     {
@@ -64,6 +70,8 @@ Hemm
     }
 #ifndef RELEASE
     PopCallStack();
+#else
+    PopProfileRegion();
 #endif
 }
 
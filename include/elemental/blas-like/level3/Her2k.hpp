@@ -37,6 +37,8 @@ Her2k
     else
         throw std::logic_error
         ("Her2k only accepts NORMAL and ADJOINT options");
+#else
+    PushProfileRegion("Her2k");
 #endif
     const char uploChar = UpperOrLowerToChar( uplo );
     const char transChar = OrientationToChar( orientation );
@@ -48,6 +50,8 @@ Her2k
       beta,  C.Buffer(),       C.LDim() );
 #ifndef RELEASE
     PopCallStack();
+#else
+    PopProfileRegion();
 #endif
 }
 
@@ -62,6 +66,8 @@ Her2k
     PushCallStack("Her2k");
     if( orientation == TRANSPOSE )
         throw std::logic_error("Her2k accepts NORMAL and ADJOINT options");
+#else
+    PushProfileRegion("Her2k");
 #endif
     if( uplo == LOWER && orientation == NORMAL )
         internal::Her2kLN( alpha, A, B, beta, C );
@@ -73,6 +79,8 @@ Her2k
         internal::Her2kUC( alpha, A, B, beta, C );
 #ifndef RELEASE
     PopCallStack();
+#else
+    PopProfileRegion();
 #endif
 }
 
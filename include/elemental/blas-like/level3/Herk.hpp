@@ -34,6 +34,8 @@ Herk
     }
     else
         throw std::logic_error("Herk only accepts NORMAL and ADJOINT options.");
+#else
+    PushProfileRegion("Herk");
 #endif
     const char uploChar = UpperOrLowerToChar( uplo );
     const char transChar = OrientationToChar( orientation );
@@ -44,6 +46,8 @@ Herk
       beta,  C.Buffer(),       C.LDim() );
 #ifndef RELEASE
     PopCallStack();
+#else
+    PopProfileRegion();
 #endif
 }
 
@@ -61,6 +65,8 @@ Herk
     if( orientation == TRANSPOSE )
         throw std::logic_error
         ("Herk accepts NORMAL and ADJOINT options");
+#else
+    PushProfileRegion("Herk");
 #endif
     if( uplo == LOWER && orientation == NORMAL )
         internal::HerkLN( alpha, A, beta, C );
@@ -72,6 +78,8 @@ Herk
         internal::HerkUC( alpha, A, beta, C );
 #ifndef RELEASE
     PopCallStack();
+#else
+    PopProfileRegion();
 #endif
 }
 
@@ -22,6 +22,8 @@ Symm
 {
 #ifndef RELEASE
     PushCallStack("Symm");
+#else
+    PushProfileRegion("Symm");
 #endif
     const char sideChar = LeftOrRightToChar( side );
     const char uploChar = UpperOrLowerToChar( uplo );
@@ -32,6 +34,8 @@ Symm
       beta,  C.Buffer(),       C.LDim() );
 #ifndef RELEASE
     PopCallStack();
+#else
+    PopProfileRegion();
 #endif
 }
 
@@ -44,6 +48,8 @@ Symm
 {
 #ifndef RELEASE
     PushCallStack("Symm");
+#else
+    PushProfileRegion("Symm");
 #endif
     if( side == LEFT && uplo == LOWER )
     {
@@ -63,6 +69,8 @@ Symm
     }
 #ifndef RELEASE
     PopCallStack();
+#else
+    PopProfileRegion();
 #endif
 }
 
@@ -35,6 +35,8 @@ Syrk
     else
         throw std::logic_error
         ("Syrk only accepts NORMAL and TRANSPOSE options");
+#else
+    PushProfileRegion("Syrk");
 #endif
     const char uploChar = UpperOrLowerToChar( uplo );
     const char transChar = OrientationToChar( orientation );
@@ -45,6 +47,8 @@ Syrk
       beta,  C.Buffer(),       C.LDim() );
 #ifndef RELEASE
     PopCallStack();
+#else
+    PopProfileRegion();
 #endif
 }
 
@@ -58,6 +62,8 @@ Syrk
     PushCallStack("Syrk");
     if( orientation == ADJOINT )
         throw std::logic_error("Syrk accepts NORMAL and TRANSPOSE options");
+#else
+    PushProfileRegion("Syrk");
 #endif
     if( uplo == LOWER && orientation == NORMAL )
         internal::SyrkLN( alpha, A, beta, C );
@@ -69,6 +75,8 @@ Syrk
         internal::SyrkUT( alpha, A, beta, C );
 #ifndef RELEASE
     PopCallStack();
+#else
+    PopProfileRegion();
 #endif
 }
 
@@ -40,6 +40,8 @@ Trmm
         if( A.Height() != B.Width() )
             throw std::logic_error("Nonconformal Trmm");
     }
+#else
+    PushProfileRegion("Trmm");
 #endif
     const char sideChar = LeftOrRightToChar( side );
     const char uploChar = UpperOrLowerToChar( uplo );
@@ -50,6 +52,8 @@ Trmm
       alpha, A.LockedBuffer(), A.LDim(), B.Buffer(), B.LDim() );
 #ifndef RELEASE
     PopCallStack();
+#else
+    PopProfileRegion();
 #endif
 }
 
@@ -62,6 +66,8 @@ Trmm
 {
 #ifndef RELEASE
     PushCallStack("Trmm");
+#else
+    PushProfileRegion("Trmm");
 #endif
     if( side == LEFT && uplo == LOWER )
     {
@@ -93,6 +99,8 @@ Trmm
     }
 #ifndef RELEASE
     PopCallStack();
+#else
+    PopProfileRegion();
 #endif
 }
 
@@ -40,6 +40,8 @@ Trsm
         if( A.Height() != B.Width() )
             throw std::logic_error("Nonconformal Trsm");
     }
+#else
+    PushProfileRegion("Trsm");
 #endif
     const char sideChar = LeftOrRightToChar( side );
     const char uploChar = UpperOrLowerToChar( uplo );
@@ -57,6 +59,8 @@ Trsm
       alpha, A.LockedBuffer(), A.LDim(), B.Buffer(), B.LDim() );
 #ifndef RELEASE
     PopCallStack();
+#else
+    PopProfileRegion();
 #endif
 }
 
@@ -84,6 +88,8 @@ Trsm
         if( A.Height() != B.Width() )
             throw std::logic_error("Nonconformal Trsm");
     }
+#else
+    PushProfileRegion("Trsm");
 #endif
     const int p = B.Grid().Size();
     if( side == LEFT && uplo == LOWER )
@@ -142,6 +148,8 @@ Trsm
     }
 #ifndef RELEASE
     PopCallStack();
+#else
+    PopProfileRegion();
 #endif
 }
 
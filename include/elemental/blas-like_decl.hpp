@@ -63,6 +63,47 @@ template<> int LocalTrr2kBlocksize<double>();
 template<> int LocalTrr2kBlocksize<scomplex>();
 template<> int LocalTrr2kBlocksize<dcomplex>();
 
+// If enabled, the stationary-C Gemm algorithms overlap the AllGather of the 
+// next panels of A and B with the local update from the current panels 
+// (this requires nonblocking collectives, otherwise it has no effect)
+void SetGemmPipelining( bool pipelining );
+bool GemmPipelining();
+
+// The algorithms which the distributed Gemm may choose between
+enum GemmAlgorithm
+{
+    GEMM_DEFAULT,  // Autotuned winner if available, otherwise the cost model
+    GEMM_SUMMA_A,  // Keep A stationary
+    GEMM_SUMMA_B,  // Keep B stationary
+    GEMM_SUMMA_C,  // Keep C stationary (pipelined if GemmPipelining())
+    GEMM_SUMMA_DOT // Panel dot products (only for C := alpha A B + beta C)
+};
+
+// The parameters of the alpha-beta-gamma model used to estimate the cost of
+// each Gemm algorithm over a particular grid shape
+struct GemmCostModel
+{
+    double latency;        // seconds per message
+    double secondsPerByte; // inverse of the bandwidth
+    double secondsPerFlop; // inverse of the flop rate of the local Gemm
+};
+void SetGemmCostModel( const Grid& g, const GemmCostModel& model );
+GemmCostModel GetGemmCostModel( const Grid& g );
+// Measures the parameters over the given grid and stores the result
+// (all processes in the grid must call this routine)
+GemmCostModel CalibrateGemmCostModel( const Grid& g );
+
+// If enabled, the first distributed Gemm of each class of shapes times each
+// of the candidate algorithms and the fastest is used from then on
+void SetGemmAutotuning( bool autotune );
+bool GemmAutotuning();
+// Loads the winners recorded in the given file and appends each new winner
+// to it (all processes in mpi::COMM_WORLD must call this routine)
+void SetGemmTuningFile( std::string filename );
+std::string GemmTuningFile();
+// Forgets the winners which are cached in memory, but not those in the file
+void ClearGemmTuning();
+
 //----------------------------------------------------------------------------//
 // Level 1 BLAS-like functionality                                            //
 //----------------------------------------------------------------------------//
@@ -261,6 +302,26 @@ template<typename T, Distribution U, Distribution V,
 T
 Dotu( const DistMatrix<T,U,V>& x, const DistMatrix<T,W,Z>& y );
 
+//
+// MultiDot:
+//
+// Returns dots[j] = (X(:,j),Y(:,j)) = X(:,j)^H Y(:,j) for every column j.
+//
+// The distributed version sums the local contributions to all of the inner
+// products with a single AllReduce, rather than one per column.
+//
+
+// Serial version
+template<typename T>
+void
+MultiDot( const Matrix<T>& X, const Matrix<T>& Y, std::vector<T>& dots );
+
+// Parallel version
+template<typename T>
+void
+MultiDot
+( const DistMatrix<T>& X, const DistMatrix<T>& Y, std::vector<T>& dots );
+
 //
 // Nrm2 (2-norm):
 //
@@ -716,7 +777,7 @@ template<typename T>
 void Gemm
 ( Orientation orientationOfA, Orientation orientationOfB,
   T alpha, const DistMatrix<T>& A, const DistMatrix<T>& B,
-  T beta,        DistMatrix<T>& C );
+  T beta,        DistMatrix<T>& C, GemmAlgorithm alg=GEMM_DEFAULT );
 
 //
 // Hemm (HErmitian Matrix-Matrix multiplication):
@@ -17,6 +17,7 @@
 #include <ctime>
 #include <fstream>
 #include <iostream>
+#include <map>
 #include <memory>
 #include <sstream>
 #include <stack>
@@ -32,6 +33,10 @@
 # else
 #  define COLLAPSE(N) 
 # endif
+// Task dependencies were introduced in OpenMP 4.0
+# if _OPENMP >= 201307
+#  define HAVE_OMP_TASK_DEPEND
+# endif
 #endif
 
 #if defined(BLAS_POST)
@@ -59,6 +64,9 @@
 #include "elemental/core/grid_decl.hpp"
 #include "elemental/core/dist_matrix_decl.hpp"
 #include "elemental/core/environment_decl.hpp"
+#include "elemental/core/pack_decl.hpp"
+#include "elemental/core/binary_io_decl.hpp"
+#include "elemental/core/disk_matrix_decl.hpp"
 #include "elemental/core/indexing_decl.hpp"
 
 #include "elemental/core/imports/blas.hpp"
@@ -80,6 +88,9 @@
 #include "elemental/core/grid_impl.hpp"
 #include "elemental/core/dist_matrix_impl.hpp"
 #include "elemental/core/environment_impl.hpp"
+#include "elemental/core/pack_impl.hpp"
+#include "elemental/core/binary_io_impl.hpp"
+#include "elemental/core/disk_matrix_impl.hpp"
 #include "elemental/core/indexing_impl.hpp"
 
 // Declare and implement the decoupled parts of the core of the library
@@ -0,0 +1,108 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace elem {
+
+//
+// Binary matrix files, as written by Matrix::WriteBinary and 
+// AbstractDistMatrix::WriteBinary, consist of a fixed-size header followed by 
+// the entries of the full matrix in column-major order. Since the layout does
+// not depend upon the distribution, a file may be read into any distribution 
+// over any grid. The header is laid out as
+//
+//   bytes  0- 7: the string "ELEMBIN" (null-terminated)
+//   bytes  8-11: the format version (currently 1)
+//   bytes 12-15: 0x01020304, so that the byte order may be checked
+//   bytes 16-19: the size of each entry in bytes
+//   byte     20: the datatype ('s', 'd', 'c', 'z', or 'i' for int)
+//   bytes 24-31: the height, as a 64-bit integer
+//   bytes 32-39: the width, as a 64-bit integer
+//
+// and the remaining bytes are reserved and zeroed. Entries are stored in the 
+// native byte order.
+//
+
+const std::size_t BINARY_HEADER_SIZE = 64;
+const unsigned BINARY_VERSION = 1;
+
+template<typename T>
+char BinaryTypeChar();
+
+template<typename T,typename Int>
+void FormBinaryHeader( Int height, Int width, byte* header );
+
+// Throws std::runtime_error if the header is not that of a file of type T
+template<typename T,typename Int>
+void ParseBinaryHeader
+( const byte* header, Int& height, Int& width, std::string filename );
+
+namespace binary_io {
+
+// Writes the local data of a distributed matrix, starting 'offset' bytes 
+// into the file, where 'comm' holds exactly one owner of each row of the 
+// local columns (e.g., a column of the grid for [MC,MR]). Rows are exchanged
+// within 'comm' so that each process writes contiguous segments of columns.
+template<typename T,typename Int>
+void WriteShared
+( mpi::File file, long long offset, mpi::Comm comm, Int height, 
+  Int localWidth, Int colShift, Int rowShift, Int colStride, Int rowStride, 
+  const T* buffer, Int ldim );
+
+} // namespace binary_io
+
+//
+// Raw column-major files, e.g., as produced by other applications, may be 
+// read without any process holding the full matrix. When the owned entries 
+// of each column are at most a cache line apart, each process sieves them out
+// of the portions of the file which hold its columns, in blocks, and no 
+// communication is required; otherwise, the processes which own the same 
+// columns each read a contiguous share of their rows and exchange them, so 
+// that each part of the file is read only once. The distributed version must
+// therefore be called by every process in the viewing communicator. The 
+// entries are assumed to begin 'offset' bytes into the file 
+// (BINARY_HEADER_SIZE skips the header of a file from WriteBinary) and to be
+// stored in the native byte order.
+//
+
+template<typename T,typename Int>
+void ReadColumnMajor
+( Matrix<T,Int>& A, std::string filename, Int height, Int width, 
+  long long offset=0 );
+template<typename T,typename Int>
+void ReadColumnMajor
+( AbstractDistMatrix<T,Int>& A, std::string filename, Int height, Int width,
+  long long offset=0 );
+
+// A read-only file which supports positioned reads, through pread when it is
+// available, so that the reads of different blocks need not seek
+class BinaryFile
+{
+public:
+    BinaryFile( std::string filename );
+    ~BinaryFile();
+
+    long long Size() const;
+    // Reads numBytes bytes, starting offset bytes into the file, into buffer
+    void Read( byte* buffer, std::size_t numBytes, long long offset );
+
+private:
+    std::string filename_;
+    long long size_;
+#ifdef HAVE_PREAD
+    int descriptor_;
+#else
+    std::ifstream stream_;
+#endif
+
+    // Disallow copies
+    BinaryFile( const BinaryFile& );
+    const BinaryFile& operator=( const BinaryFile& );
+};
+
+} // namespace elem
@@ -0,0 +1,527 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace elem {
+
+template<typename T>
+inline char
+BinaryTypeChar()
+{
+    typedef typename Base<T>::type R;
+    if( sizeof(R) == sizeof(float) )
+        return ( IsComplex<T>::val ? 'c' : 's' );
+    else
+        return ( IsComplex<T>::val ? 'z' : 'd' );
+}
+
+template<>
+inline char
+BinaryTypeChar<int>()
+{ return 'i'; }
+
+template<typename T,typename Int>
+inline void
+FormBinaryHeader( Int height, Int width, byte* header )
+{
+    const unsigned version = BINARY_VERSION;
+    const unsigned byteOrder = 0x01020304;
+    const unsigned entrySize = sizeof(T);
+    const char typeChar = BinaryTypeChar<T>();
+    const long long height64 = height;
+    const long long width64 = width;
+
+    MemZero( header, BINARY_HEADER_SIZE );
+    std::memcpy( &header[0], "ELEMBIN", 8 );
+    std::memcpy( &header[8], &version, 4 );
+    std::memcpy( &header[12], &byteOrder, 4 );
+    std::memcpy( &header[16], &entrySize, 4 );
+    header[20] = typeChar;
+    std::memcpy( &header[24], &height64, 8 );
+    std::memcpy( &header[32], &width64, 8 );
+}
+
+template<typename T,typename Int>
+inline void
+ParseBinaryHeader
+( const byte* header, Int& height, Int& width, std::string filename )
+{
+    unsigned version, byteOrder, entrySize;
+    long long height64, width64;
+    std::memcpy( &version, &header[8], 4 );
+    std::memcpy( &byteOrder, &header[12], 4 );
+    std::memcpy( &entrySize, &header[16], 4 );
+    const char typeChar = header[20];
+    std::memcpy( &height64, &header[24], 8 );
+    std::memcpy( &width64, &header[32], 8 );
+
+    if( std::memcmp( &header[0], "ELEMBIN", 8 ) != 0 )
+        throw std::runtime_error(filename+" is not a binary matrix file");
+    if( version != BINARY_VERSION )
+    {
+        std::ostringstream msg;
+        msg << filename << " has unsupported format version " << version;
+        throw std::runtime_error( msg.str() );
+    }
+    if( byteOrder != 0x01020304 )
+        throw std::runtime_error
+        (filename+" was written with a different byte order");
+    if( entrySize != sizeof(T) || typeChar != BinaryTypeChar<T>() )
+    {
+        std::ostringstream msg;
+        msg << filename << " holds entries of type '" << typeChar << "' ("
+            << entrySize << " bytes), not '" << BinaryTypeChar<T>() << "' ("
+            << sizeof(T) << " bytes)";
+        throw std::runtime_error( msg.str() );
+    }
+    if( height64 < 0 || width64 < 0 )
+        throw std::runtime_error(filename+" has invalid dimensions");
+    height = height64;
+    width = width64;
+    if( height != height64 || width != width64 )
+        throw std::runtime_error(filename+" is too large for the index type");
+}
+
+namespace binary_io {
+
+// The staging buffer for each block of columns is limited to about 16 MB
+const std::size_t READ_BLOCK_BYTES = std::size_t(1)<<24;
+
+// Owned entries are sieved out of the spans of their columns only when the 
+// stride between them is at most a cache line, so that no more than a cache 
+// line is read per owned entry. Otherwise, the processes which own the same 
+// columns each read a contiguous share of their rows and exchange them.
+const std::size_t SIEVE_BYTES = 64;
+
+template<typename T,typename Int>
+inline void
+ReadLocal
+( BinaryFile& file, long long offset, Int height, 
+  Int localHeight, Int localWidth, 
+  Int colShift, Int rowShift, Int colStride, Int rowStride, 
+  T* buffer, Int ldim )
+{
+    if( localHeight == 0 || localWidth == 0 )
+        return;
+    const std::size_t entrySize = sizeof(T);
+    const Int span = (localHeight-1)*colStride + 1;
+    const Int segmentHeight = 
+        std::max
+        ( Int(1), 
+          std::min
+          ( localHeight, Int(READ_BLOCK_BYTES/(colStride*entrySize)) ) );
+
+    if( colStride == 1 )
+    {
+        // Each local column is contiguous in the file
+        for( Int jLocal=0; jLocal<localWidth; ++jLocal )
+        {
+            const long long j = rowShift + jLocal*rowStride;
+            file.Read
+            ( (byte*)&buffer[jLocal*ldim], localHeight*entrySize, 
+              offset + (colShift+j*height)*entrySize );
+        }
+    }
+    else if( segmentHeight < localHeight )
+    {
+        // The span of a single column does not fit in a block, so each local
+        // column is read in segments of at most about READ_BLOCK_BYTES, from 
+        // which the owned entries are picked out
+        std::vector<T> staging( (segmentHeight-1)*colStride + 1 );
+        for( Int jLocal=0; jLocal<localWidth; ++jLocal )
+        {
+            const long long j = rowShift + jLocal*rowStride;
+            for( Int iStart=0; iStart<localHeight; iStart+=segmentHeight )
+            {
+                const Int thisHeight = 
+                    std::min( segmentHeight, localHeight-iStart );
+                const long long i = colShift + (long long)iStart*colStride;
+                file.Read
+                ( (byte*)&staging[0], ((thisHeight-1)*colStride+1)*entrySize,
+                  offset + (i+j*height)*entrySize );
+                StridedMemCopy
+                ( &buffer[iStart+jLocal*ldim], 1, &staging[0], colStride, 
+                  thisHeight );
+            }
+        }
+    }
+    else
+    {
+        // Read the span of rows holding each local column, in blocks of 
+        // columns, and pick out the owned entries. When every column is 
+        // owned and whole columns fit in a block, each block is read at once.
+        const bool contiguousColumns = 
+            ( rowStride == 1 && height*entrySize <= READ_BLOCK_BYTES );
+        const Int stagingLDim = ( contiguousColumns ? height : span );
+        const Int blockWidth = 
+            std::max
+            ( Int(1), 
+              std::min
+              ( localWidth, Int(READ_BLOCK_BYTES/(stagingLDim*entrySize)) ) );
+        std::vector<T> staging( (blockWidth-1)*stagingLDim + span );
+        for( Int jStart=0; jStart<localWidth; jStart+=blockWidth )
+        {
+            const Int width = std::min( blockWidth, localWidth-jStart );
+            const long long first = 
+                colShift + (rowShift+(long long)jStart*rowStride)*height;
+            if( contiguousColumns )
+                file.Read
+                ( (byte*)&staging[0], ((width-1)*stagingLDim+span)*entrySize,
+                  offset + first*entrySize );
+            else
+                for( Int j=0; j<width; ++j )
+                {
+                    const long long jFirst = 
+                        first + (long long)j*rowStride*height;
+                    file.Read
+                    ( (byte*)&staging[j*stagingLDim], span*entrySize,
+                      offset + jFirst*entrySize );
+                }
+            InterleaveMatrix
+            ( localHeight, width, &staging[0], colStride, stagingLDim, 
+              &buffer[jStart*ldim], 1, ldim );
+        }
+    }
+}
+
+// The processes in 'comm', which must own the same columns and together own
+// every row, each read or write a contiguous share of the rows of those 
+// columns. The columns are handled in blocks, and the rows in chunks, so 
+// that each share is at most about READ_BLOCK_BYTES.
+template<typename Int>
+class RowShares
+{
+public:
+    RowShares
+    ( mpi::Comm comm, Int height, Int localWidth, Int colShift, 
+      std::size_t entrySize )
+    : numShares_(mpi::CommSize(comm)), share_(mpi::CommRank(comm)), 
+      colShifts_(numShares_)
+    {
+        const int shift = colShift;
+        mpi::AllGather( &shift, 1, &colShifts_[0], 1, comm );
+
+        const long long maxShare = 
+            std::max( std::size_t(1), READ_BLOCK_BYTES/entrySize );
+        chunkHeight_ = 
+            std::max( 1LL, std::min<long long>( height, maxShare*numShares_ ) );
+        blockWidth_ = 
+            std::max
+            ( 1LL, 
+              std::min<long long>
+              ( localWidth, maxShare*numShares_/chunkHeight_ ) );
+    }
+
+    int NumShares() const { return numShares_; }
+    int Share() const { return share_; }
+    Int ColShift( int k ) const { return colShifts_[k]; }
+    Int ChunkHeight() const { return chunkHeight_; }
+    Int BlockWidth() const { return blockWidth_; }
+
+    // The rows [iBeg,iEnd) of the share k of the chunk of thisHeight rows 
+    // starting at row iStart
+    void Rows
+    ( int k, Int iStart, Int thisHeight, Int& iBeg, Int& iEnd ) const
+    {
+        iBeg = iStart + ((long long)k*thisHeight)/numShares_;
+        iEnd = iStart + ((long long)(k+1)*thisHeight)/numShares_;
+    }
+
+private:
+    int numShares_, share_;
+    std::vector<int> colShifts_;
+    Int chunkHeight_, blockWidth_;
+};
+
+// The number of the rows [iBeg,iEnd) congruent to colShift modulo colStride,
+// and the first of them
+template<typename Int>
+inline Int
+NumOwnedRows( Int iBeg, Int iEnd, Int colShift, Int colStride )
+{ 
+    return RawLocalLength( iEnd, colShift, colStride ) - 
+           RawLocalLength( iBeg, colShift, colStride ); 
+}
+
+template<typename Int>
+inline Int
+FirstOwnedRow( Int iBeg, Int colShift, Int colStride )
+{ return iBeg + ((colShift-iBeg%colStride)+colStride) % colStride; }
+
+template<typename T,typename Int>
+inline void
+ReadShared
+( BinaryFile& file, long long offset, mpi::Comm comm, Int height, 
+  Int localWidth, Int colShift, Int rowShift, Int colStride, Int rowStride, 
+  T* buffer, Int ldim )
+{
+    const std::size_t entrySize = sizeof(T);
+    const RowShares<Int> shares
+    ( comm, height, localWidth, colShift, entrySize );
+    const int numShares = shares.NumShares();
+    std::vector<int> sendCounts(numShares), sendDispls(numShares),
+                     recvCounts(numShares), recvDispls(numShares);
+    std::vector<T> staging, sendBuf, recvBuf;
+    for( Int jStart=0; jStart<localWidth; jStart+=shares.BlockWidth() )
+    {
+        const Int width = std::min( shares.BlockWidth(), localWidth-jStart );
+        for( Int iStart=0; iStart<height; iStart+=shares.ChunkHeight() )
+        {
+            const Int thisHeight = 
+                std::min( shares.ChunkHeight(), height-iStart );
+
+            // Read our share of the rows of each column of the block
+            Int iBeg, iEnd;
+            shares.Rows( shares.Share(), iStart, thisHeight, iBeg, iEnd );
+            const Int shareHeight = iEnd - iBeg;
+            staging.resize( std::max( shareHeight*width, Int(1) ) );
+            if( shareHeight > 0 )
+                for( Int j=0; j<width; ++j )
+                {
+                    const long long jGlobal = 
+                        rowShift + (long long)(jStart+j)*rowStride;
+                    file.Read
+                    ( (byte*)&staging[j*shareHeight], shareHeight*entrySize,
+                      offset + (iBeg+jGlobal*height)*entrySize );
+                }
+
+            // Send each process the rows of our share which it owns
+            int sendSize=0, recvSize=0;
+            for( int k=0; k<numShares; ++k )
+            {
+                Int kBeg, kEnd;
+                shares.Rows( k, iStart, thisHeight, kBeg, kEnd );
+                sendCounts[k] = width*
+                    NumOwnedRows( iBeg, iEnd, shares.ColShift(k), colStride );
+                recvCounts[k] = width*
+                    NumOwnedRows( kBeg, kEnd, colShift, colStride );
+                sendDispls[k] = sendSize;
+                recvDispls[k] = recvSize;
+                sendSize += sendCounts[k];
+                recvSize += recvCounts[k];
+            }
+            sendBuf.resize( std::max( sendSize, 1 ) );
+            recvBuf.resize( std::max( recvSize, 1 ) );
+            for( int k=0; k<numShares; ++k )
+            {
+                const Int count = sendCounts[k] / width;
+                if( count == 0 )
+                    continue;
+                const Int first = 
+                    FirstOwnedRow( iBeg, shares.ColShift(k), colStride );
+                for( Int j=0; j<width; ++j )
+                    StridedMemCopy
+                    ( &sendBuf[sendDispls[k]+j*count], 1, 
+                      &staging[(first-iBeg)+j*shareHeight], colStride, 
+                      count );
+            }
+            mpi::AllToAll
+            ( &sendBuf[0], &sendCounts[0], &sendDispls[0],
+              &recvBuf[0], &recvCounts[0], &recvDispls[0], comm );
+            for( int k=0; k<numShares; ++k )
+            {
+                const Int count = recvCounts[k] / width;
+                if( count == 0 )
+                    continue;
+                Int kBeg, kEnd;
+                shares.Rows( k, iStart, thisHeight, kBeg, kEnd );
+                const Int iLocal = 
+                    RawLocalLength( kBeg, colShift, colStride );
+                for( Int j=0; j<width; ++j )
+                    MemCopy
+                    ( &buffer[iLocal+(jStart+j)*ldim], 
+                      &recvBuf[recvDispls[k]+j*count], count );
+            }
+        }
+    }
+}
+
+template<typename T,typename Int>
+inline void
+WriteShared
+( mpi::File file, long long offset, mpi::Comm comm, Int height, 
+  Int localWidth, Int colShift, Int rowShift, Int colStride, Int rowStride, 
+  const T* buffer, Int ldim )
+{
+    const std::size_t entrySize = sizeof(T);
+    const RowShares<Int> shares
+    ( comm, height, localWidth, colShift, entrySize );
+    const int numShares = shares.NumShares();
+    std::vector<int> sendCounts(numShares), sendDispls(numShares),
+                     recvCounts(numShares), recvDispls(numShares);
+    std::vector<T> staging, sendBuf, recvBuf;
+    for( Int jStart=0; jStart<localWidth; jStart+=shares.BlockWidth() )
+    {
+        const Int width = std::min( shares.BlockWidth(), localWidth-jStart );
+        for( Int iStart=0; iStart<height; iStart+=shares.ChunkHeight() )
+        {
+            const Int thisHeight = 
+                std::min( shares.ChunkHeight(), height-iStart );
+            Int iBeg, iEnd;
+            shares.Rows( shares.Share(), iStart, thisHeight, iBeg, iEnd );
+            const Int shareHeight = iEnd - iBeg;
+
+            // Send each process the rows of its share which we own
+            int sendSize=0, recvSize=0;
+            for( int k=0; k<numShares; ++k )
+            {
+                Int kBeg, kEnd;
+                shares.Rows( k, iStart, thisHeight, kBeg, kEnd );
+                sendCounts[k] = width*
+                    NumOwnedRows( kBeg, kEnd, colShift, colStride );
+                recvCounts[k] = width*
+                    NumOwnedRows( iBeg, iEnd, shares.ColShift(k), colStride );
+                sendDispls[k] = sendSize;
+                recvDispls[k] = recvSize;
+                sendSize += sendCounts[k];
+                recvSize += recvCounts[k];
+            }
+            sendBuf.resize( std::max( sendSize, 1 ) );
+            recvBuf.resize( std::max( recvSize, 1 ) );
+            for( int k=0; k<numShares; ++k )
+            {
+                const Int count = sendCounts[k] / width;
+                if( count == 0 )
+                    continue;
+                Int kBeg, kEnd;
+                shares.Rows( k, iStart, thisHeight, kBeg, kEnd );
+                const Int iLocal = 
+                    RawLocalLength( kBeg, colShift, colStride );
+                for( Int j=0; j<width; ++j )
+                    MemCopy
+                    ( &sendBuf[sendDispls[k]+j*count], 
+                      &buffer[iLocal+(jStart+j)*ldim], count );
+            }
+            mpi::AllToAll
+            ( &sendBuf[0], &sendCounts[0], &sendDispls[0],
+              &recvBuf[0], &recvCounts[0], &recvDispls[0], comm );
+
+            // Interleave the received rows and write our share of the rows
+            // of each column of the block
+            staging.resize( std::max( shareHeight*width, Int(1) ) );
+            for( int k=0; k<numShares; ++k )
+            {
+                const Int count = recvCounts[k] / width;
+                if( count == 0 )
+                    continue;
+                const Int first = 
+                    FirstOwnedRow( iBeg, shares.ColShift(k), colStride );
+                for( Int j=0; j<width; ++j )
+                    StridedMemCopy
+                    ( &staging[(first-iBeg)+j*shareHeight], colStride,
+                      &recvBuf[recvDispls[k]+j*count], 1, count );
+            }
+            if( shareHeight > 0 )
+                for( Int j=0; j<width; ++j )
+                {
+                    const long long jGlobal = 
+                        rowShift + (long long)(jStart+j)*rowStride;
+                    mpi::FileWriteAt
+                    ( file, offset + (iBeg+jGlobal*height)*entrySize,
+                      (const byte*)&staging[j*shareHeight], 
+                      shareHeight*entrySize );
+                }
+        }
+    }
+}
+
+inline void
+CheckFileSize
+( const BinaryFile& file, std::string filename, long long offset, 
+  long long numBytes )
+{
+    if( file.Size() < offset+numBytes )
+    {
+        std::ostringstream msg;
+        msg << filename << " holds " << file.Size() << " bytes, but "
+            << offset+numBytes << " were expected";
+        throw std::runtime_error( msg.str() );
+    }
+}
+
+} // namespace binary_io
+
+template<typename T,typename Int>
+inline void
+ReadColumnMajor
+( Matrix<T,Int>& A, std::string filename, Int height, Int width, 
+  long long offset )
+{
+#ifndef RELEASE
+    PushCallStack("ReadColumnMajor");
+#endif
+    BinaryFile file( filename );
+    binary_io::CheckFileSize
+    ( file, filename, offset, (long long)height*width*sizeof(T) );
+    A.ResizeTo( height, width );
+    binary_io::ReadLocal
+    ( file, offset, height, height, width, Int(0), Int(0), Int(1), Int(1), 
+      A.Buffer(), A.LDim() );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename T,typename Int>
+inline void
+ReadColumnMajor
+( AbstractDistMatrix<T,Int>& A, std::string filename, Int height, Int width,
+  long long offset )
+{
+#ifndef RELEASE
+    PushCallStack("ReadColumnMajor");
+#endif
+    A.ResizeTo( height, width );
+    if( A.ColStride()*sizeof(T) <= binary_io::SIEVE_BYTES )
+    {
+        if( A.Participating() )
+        {
+            BinaryFile file( filename );
+            binary_io::CheckFileSize
+            ( file, filename, offset, (long long)height*width*sizeof(T) );
+            binary_io::ReadLocal
+            ( file, offset, height, A.LocalHeight(), A.LocalWidth(), 
+              A.ColShift(), A.RowShift(), A.ColStride(), A.RowStride(), 
+              A.LocalBuffer(), A.LocalLDim() );
+        }
+    }
+    else
+    {
+        // The processes which own the same columns (e.g., a column of the 
+        // grid for [MC,MR]) share the reading of them
+        const elem::Grid& g = A.Grid();
+        const int color = 
+            ( A.Participating() ? A.RowRank() : mpi::UNDEFINED );
+        mpi::Comm shareComm;
+        mpi::CommSplit( g.ViewingComm(), color, g.ViewingRank(), shareComm );
+        if( A.Participating() )
+        {
+            try 
+            {
+                BinaryFile file( filename );
+                binary_io::CheckFileSize
+                ( file, filename, offset, (long long)height*width*sizeof(T) );
+                binary_io::ReadShared
+                ( file, offset, shareComm, height, A.LocalWidth(), 
+                  A.ColShift(), A.RowShift(), A.ColStride(), A.RowStride(), 
+                  A.LocalBuffer(), A.LocalLDim() );
+            }
+            catch( std::exception& e )
+            {
+                mpi::CommFree( shareComm );
+                throw;
+            }
+            mpi::CommFree( shareComm );
+        }
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+} // namespace elem
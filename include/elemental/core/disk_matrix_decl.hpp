@@ -0,0 +1,121 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace elem {
+
+template<typename T,typename Int=int> class DiskMatrix;
+template<typename T,typename Int=int> class DiskRead;
+
+//
+// A matrix which is kept in a file, rather than in memory, for out-of-core 
+// algorithms. The file holds tileSize x tileSize tiles (smaller along the 
+// bottom and right edges), each contiguous and column-major, with the tiles 
+// in column-major order and no header. Blocks of any shape are read into, 
+// and written from, distributed matrices; the I/O is spread over the 
+// processes by moving whole columns through a [* ,VR] buffer.
+//
+// Every routine is collective over the viewing communicator of the grid. 
+// BeginRead only starts nonblocking reads, so that the next block may be 
+// read while the current one is being used. Writes are only synchronized 
+// with the reads of other processes (by Flush) when a block which overlaps 
+// them is read, and a read of such a block may not be begun while other 
+// reads are unfinished.
+//
+template<typename T,typename Int>
+class DiskMatrix
+{
+public:
+    // If the file already exists with the same size (e.g., from a previous 
+    // DiskMatrix with the same dimensions and tile size), its contents are 
+    // kept; otherwise it is resized, and a newly created file is zero.
+    DiskMatrix
+    ( std::string filename, Int height, Int width, Int tileSize,
+      const elem::Grid& g=DefaultGrid() );
+    // The file is closed, but not removed
+    ~DiskMatrix();
+
+    Int Height() const;
+    Int Width() const;
+    Int TileSize() const;
+    const elem::Grid& Grid() const;
+    std::string Filename() const;
+
+    // Read the height x width block whose top-left entry is (i,j) into A
+    template<Distribution U,Distribution V>
+    void Read
+    ( Int i, Int j, Int height, Int width, DistMatrix<T,U,V,Int>& A ) const;
+    // Start reading the block in the background; see DiskRead::Finish
+    void BeginRead
+    ( Int i, Int j, Int height, Int width, DiskRead<T,Int>& read ) const;
+
+    // Overwrite the block whose top-left entry is (i,j) with A. The block 
+    // may not overlap any read which has been begun but not finished.
+    template<Distribution U,Distribution V>
+    void Write( Int i, Int j, const DistMatrix<T,U,V,Int>& A );
+
+    // Make all previous writes visible to every process. As some MPI 
+    // implementations cannot sync a file while any nonblocking I/O is 
+    // pending, no reads from any DiskMatrix may be unfinished.
+    void Flush() const;
+
+private:
+    friend class DiskRead<T,Int>;
+
+    std::string filename_;
+    Int height_, width_, tileSize_;
+    const elem::Grid* grid_;
+    mpi::File file_;
+
+    // The blocks written since the last Flush, as (i,j,height,width) 
+    // quadruples, and the number of unfinished reads
+    mutable std::vector<Int> unflushedBlocks_;
+    mutable Int numPendingReads_;
+
+    void AssertValidBlock( Int i, Int j, Int height, Int width ) const;
+    bool Unflushed( Int i, Int j, Int height, Int width ) const;
+    // The number of entries from the start of the file to entry (i,j)
+    mpi::Offset EntryOffset( Int i, Int j ) const;
+    // Start moving the local columns of the [* ,VR] buffer, which holds the
+    // block with top-left entry (i,j), to or from the file
+    void StartTransfers
+    ( Int i, Int j, DistMatrix<T,STAR,VR,Int>& buffer, bool write,
+      std::vector<mpi::Request>& requests ) const;
+
+    // Disallow copies
+    DiskMatrix( const DiskMatrix& );
+    const DiskMatrix& operator=( const DiskMatrix& );
+};
+
+// A read from a DiskMatrix which proceeds in the background
+template<typename T,typename Int>
+class DiskRead
+{
+public:
+    DiskRead( const elem::Grid& g=DefaultGrid() );
+    // Any unfinished read is waited upon
+    ~DiskRead();
+
+    bool Active() const;
+    // Wait for the read to complete and redistribute the block into A
+    template<Distribution U,Distribution V>
+    void Finish( DistMatrix<T,U,V,Int>& A );
+
+private:
+    friend class DiskMatrix<T,Int>;
+
+    DistMatrix<T,STAR,VR,Int> buffer_;
+    std::vector<mpi::Request> requests_;
+    const DiskMatrix<T,Int>* source_;
+
+    // Disallow copies
+    DiskRead( const DiskRead& );
+    const DiskRead& operator=( const DiskRead& );
+};
+
+} // namespace elem
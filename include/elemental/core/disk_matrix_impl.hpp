@@ -0,0 +1,290 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace elem {
+
+template<typename T,typename Int>
+inline
+DiskMatrix<T,Int>::DiskMatrix
+( std::string filename, Int height, Int width, Int tileSize, 
+  const elem::Grid& g )
+: filename_(filename), height_(height), width_(width), tileSize_(tileSize), 
+  grid_(&g), numPendingReads_(0)
+{
+#ifndef RELEASE
+    PushCallStack("DiskMatrix::DiskMatrix");
+#endif
+    if( height < 0 || width < 0 )
+        throw std::logic_error("Height and width must be non-negative");
+    if( tileSize < 1 )
+        throw std::logic_error("Tile size must be positive");
+    mpi::FileOpen
+    ( g.ViewingComm(), filename, mpi::MODE_CREATE | mpi::MODE_RDWR, file_ );
+    mpi::FileSetSize( file_, mpi::Offset(height)*width*sizeof(T) );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename T,typename Int>
+inline
+DiskMatrix<T,Int>::~DiskMatrix()
+{ 
+    if( !mpi::Finalized() )
+        mpi::FileClose( file_ ); 
+}
+
+template<typename T,typename Int>
+inline Int
+DiskMatrix<T,Int>::Height() const
+{ return height_; }
+
+template<typename T,typename Int>
+inline Int
+DiskMatrix<T,Int>::Width() const
+{ return width_; }
+
+template<typename T,typename Int>
+inline Int
+DiskMatrix<T,Int>::TileSize() const
+{ return tileSize_; }
+
+template<typename T,typename Int>
+inline const elem::Grid&
+DiskMatrix<T,Int>::Grid() const
+{ return *grid_; }
+
+template<typename T,typename Int>
+inline std::string
+DiskMatrix<T,Int>::Filename() const
+{ return filename_; }
+
+template<typename T,typename Int>
+inline void
+DiskMatrix<T,Int>::AssertValidBlock
+( Int i, Int j, Int height, Int width ) const
+{
+    if( i < 0 || j < 0 || height < 0 || width < 0 || 
+        i+height > height_ || j+width > width_ )
+    {
+        std::ostringstream msg;
+        msg << "Block of size " << height << " x " << width << " at ("
+            << i << "," << j << ") is out of bounds of the " 
+            << height_ << " x " << width_ << " matrix in " << filename_;
+        throw std::logic_error( msg.str() );
+    }
+}
+
+template<typename T,typename Int>
+inline bool
+DiskMatrix<T,Int>::Unflushed( Int i, Int j, Int height, Int width ) const
+{
+    const Int numBlocks = unflushedBlocks_.size() / 4;
+    for( Int k=0; k<numBlocks; ++k )
+    {
+        const Int* block = &unflushedBlocks_[4*k];
+        if( i < block[0]+block[2] && block[0] < i+height &&
+            j < block[1]+block[3] && block[1] < j+width )
+            return true;
+    }
+    return false;
+}
+
+template<typename T,typename Int>
+inline mpi::Offset
+DiskMatrix<T,Int>::EntryOffset( Int i, Int j ) const
+{
+    // Every tile in the tile column of entry (i,j) has the same width
+    const Int tileRow = i / tileSize_;
+    const Int tileCol = j / tileSize_;
+    const Int tileHeight = std::min( tileSize_, height_-tileRow*tileSize_ );
+    const Int tileWidth = std::min( tileSize_, width_-tileCol*tileSize_ );
+    return mpi::Offset(tileCol)*tileSize_*height_ + 
+           mpi::Offset(tileRow)*tileSize_*tileWidth + 
+           (i-tileRow*tileSize_) + 
+           mpi::Offset(j-tileCol*tileSize_)*tileHeight;
+}
+
+template<typename T,typename Int>
+inline void
+DiskMatrix<T,Int>::StartTransfers
+( Int i, Int j, DistMatrix<T,STAR,VR,Int>& buffer, bool write,
+  std::vector<mpi::Request>& requests ) const
+{
+    const Int height = buffer.Height();
+    const Int localWidth = buffer.LocalWidth();
+    const Int rowShift = buffer.RowShift();
+    const Int rowStride = buffer.RowStride();
+    T* localBuffer = buffer.LocalBuffer();
+    const Int ldim = buffer.LocalLDim();
+    for( Int jLocal=0; jLocal<localWidth; ++jLocal )
+    {
+        const Int jCol = j + rowShift + jLocal*rowStride;
+        // Each column of the block is contiguous within each tile
+        for( Int iOffset=0; iOffset<height; )
+        {
+            const Int iRow = i + iOffset;
+            const Int tileEnd = 
+                std::min( (iRow/tileSize_+1)*tileSize_, height_ );
+            const Int length = std::min( tileEnd-iRow, height-iOffset );
+            const mpi::Offset offset = EntryOffset(iRow,jCol)*sizeof(T);
+            byte* data = (byte*)&localBuffer[iOffset+jLocal*ldim];
+            requests.push_back( mpi::REQUEST_NULL );
+            if( write )
+                mpi::FileIWriteAt
+                ( file_, offset, data, length*sizeof(T), requests.back() );
+            else
+                mpi::FileIReadAt
+                ( file_, offset, data, length*sizeof(T), requests.back() );
+            iOffset += length;
+        }
+    }
+}
+
+template<typename T,typename Int>
+inline void
+DiskMatrix<T,Int>::BeginRead
+( Int i, Int j, Int height, Int width, DiskRead<T,Int>& read ) const
+{
+#ifndef RELEASE
+    PushCallStack("DiskMatrix::BeginRead");
+#endif
+    AssertValidBlock( i, j, height, width );
+    if( read.source_ != 0 )
+        throw std::logic_error("The previous read has not been finished");
+    if( read.buffer_.Grid() != *grid_ )
+        throw std::logic_error("The read must be over the same grid");
+    if( Unflushed( i, j, height, width ) )
+        Flush();
+    read.buffer_.ResizeTo( height, width );
+    read.requests_.clear();
+    StartTransfers( i, j, read.buffer_, false, read.requests_ );
+    read.source_ = this;
+    ++numPendingReads_;
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename T,typename Int>
+template<Distribution U,Distribution V>
+inline void
+DiskMatrix<T,Int>::Read
+( Int i, Int j, Int height, Int width, DistMatrix<T,U,V,Int>& A ) const
+{
+#ifndef RELEASE
+    PushCallStack("DiskMatrix::Read");
+#endif
+    DiskRead<T,Int> read( *grid_ );
+    BeginRead( i, j, height, width, read );
+    read.Finish( A );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename T,typename Int>
+template<Distribution U,Distribution V>
+inline void
+DiskMatrix<T,Int>::Write( Int i, Int j, const DistMatrix<T,U,V,Int>& A )
+{
+#ifndef RELEASE
+    PushCallStack("DiskMatrix::Write");
+#endif
+    AssertValidBlock( i, j, A.Height(), A.Width() );
+    if( A.Grid() != *grid_ )
+        throw std::logic_error("A must be over the same grid");
+    DistMatrix<T,STAR,VR,Int> buffer( *grid_ );
+    buffer = A;
+    std::vector<mpi::Request> requests;
+    StartTransfers( i, j, buffer, true, requests );
+    if( !requests.empty() )
+        mpi::WaitAll( requests.size(), &requests[0] );
+    unflushedBlocks_.push_back( i );
+    unflushedBlocks_.push_back( j );
+    unflushedBlocks_.push_back( A.Height() );
+    unflushedBlocks_.push_back( A.Width() );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename T,typename Int>
+inline void
+DiskMatrix<T,Int>::Flush() const
+{
+#ifndef RELEASE
+    PushCallStack("DiskMatrix::Flush");
+#endif
+    if( unflushedBlocks_.empty() )
+    {
+#ifndef RELEASE
+        PopCallStack();
+#endif
+        return;
+    }
+    if( numPendingReads_ > 0 )
+        throw std::logic_error
+        ("Cannot read written data while other reads are unfinished");
+    // The writes of each process are only guaranteed to be visible to the 
+    // other processes after a sync, a barrier, and another sync
+    mpi::FileSync( file_ );
+    mpi::Barrier( grid_->ViewingComm() );
+    mpi::FileSync( file_ );
+    unflushedBlocks_.clear();
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename T,typename Int>
+inline
+DiskRead<T,Int>::DiskRead( const elem::Grid& g )
+: buffer_(g), source_(0)
+{ }
+
+template<typename T,typename Int>
+inline
+DiskRead<T,Int>::~DiskRead()
+{
+    if( source_ != 0 )
+    {
+        if( !requests_.empty() && !mpi::Finalized() )
+            mpi::WaitAll( requests_.size(), &requests_[0] );
+        --source_->numPendingReads_;
+    }
+}
+
+template<typename T,typename Int>
+inline bool
+DiskRead<T,Int>::Active() const
+{ return source_ != 0; }
+
+template<typename T,typename Int>
+template<Distribution U,Distribution V>
+inline void
+DiskRead<T,Int>::Finish( DistMatrix<T,U,V,Int>& A )
+{
+#ifndef RELEASE
+    PushCallStack("DiskRead::Finish");
+#endif
+    if( source_ == 0 )
+        throw std::logic_error("No read has been begun");
+    if( !requests_.empty() )
+        mpi::WaitAll( requests_.size(), &requests_[0] );
+    requests_.clear();
+    --source_->numPendingReads_;
+    source_ = 0;
+    A = buffer_;
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+} // namespace elem
@@ -89,6 +89,12 @@ public:
     void Print( const std::string msg="" ) const;
     void Print( std::ostream& os, const std::string msg="" ) const;
     void Write( const std::string filename, const std::string msg="" ) const;
+    // Binary checkpoints, written and read in parallel (see ReadColumnMajor
+    // for how the reads are shared). The file format (see binary_io_decl.hpp)
+    // is independent of the distribution, so a matrix may be restored into 
+    // any distribution over any grid.
+    void WriteBinary( const std::string filename ) const;
+    void ReadBinary( const std::string filename );
 
     //
     // Alignments
@@ -134,6 +140,17 @@ public:
     bool Viewing() const;
     bool LockedView() const;
 
+    //
+    // Asynchronous redistribution
+    //
+
+    // Whether or not a redistribution into this matrix was started with 
+    // BeginRedistribute and has not yet been finished. The matrix should not
+    // be otherwise modified until FinishRedistribute is called.
+    bool Redistributing() const;
+    // Wait for the pending redistribution (if any) and unpack its result
+    void FinishRedistribute();
+
     //
     // Utilities
     //
@@ -199,6 +216,8 @@ protected:
     Int height_, width_;
     Memory<T> auxMemory_;
     Matrix<T,Int> localMatrix_;
+    GatherPlan<T,Int> gatherPlan_;
+    PendingGather<T,Int> pendingGather_;
     
     bool constrainedColAlignment_, constrainedRowAlignment_;
     Int colAlignment_, rowAlignment_;
@@ -294,6 +313,7 @@ protected:
 
     template<typename S,Distribution U,Distribution V,typename Ord>
     friend class DistMatrix;
+    friend class PendingGather<T,Int>;
 };
 
 } // elem
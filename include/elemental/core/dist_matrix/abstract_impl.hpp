@@ -390,6 +390,25 @@ inline const Matrix<T,Int>&
 AbstractDistMatrix<T,Int>::LockedLocalMatrix() const
 { return localMatrix_; }
 
+template<typename T,typename Int>
+inline bool
+AbstractDistMatrix<T,Int>::Redistributing() const
+{ return pendingGather_.Active(); }
+
+template<typename T,typename Int>
+inline void
+AbstractDistMatrix<T,Int>::FinishRedistribute()
+{
+#ifndef RELEASE
+    PushCallStack("AbstractDistMatrix::FinishRedistribute");
+#endif
+    if( pendingGather_.Active() )
+        pendingGather_.Finish( *this );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
 template<typename T,typename Int>
 inline void
 AbstractDistMatrix<T,Int>::Empty()
@@ -447,6 +466,95 @@ AbstractDistMatrix<T,Int>::Write
 #endif
 }
 
+template<typename T,typename Int>
+inline void
+AbstractDistMatrix<T,Int>::WriteBinary( const std::string filename ) const
+{
+#ifndef RELEASE
+    PushCallStack("AbstractDistMatrix::WriteBinary");
+#endif
+    const elem::Grid& g = Grid();
+    mpi::Comm comm = g.ViewingComm();
+    const Int height = Height();
+    const Int width = Width();
+
+    // Of each set of processes which hold copies of the same local data 
+    // (e.g., the processes in a row of the grid for [MC,* ]), only the first
+    // writes it
+    const int owner = 
+        ( Participating() ? ColRank()+ColStride()*RowRank() : mpi::UNDEFINED );
+    mpi::Comm replicaComm;
+    mpi::CommSplit( comm, owner, g.ViewingRank(), replicaComm );
+    bool writer = false;
+    if( owner != mpi::UNDEFINED )
+    {
+        writer = ( mpi::CommRank( replicaComm ) == 0 );
+        mpi::CommFree( replicaComm );
+    }
+
+    // The writers which own the same columns (e.g., a column of the grid for
+    // [MC,MR]) exchange rows so that each writes contiguous segments of them
+    mpi::Comm shareComm;
+    mpi::CommSplit
+    ( comm, ( writer ? RowRank() : mpi::UNDEFINED ), g.ViewingRank(), 
+      shareComm );
+
+    mpi::File file;
+    mpi::FileOpen
+    ( comm, filename, mpi::MODE_CREATE | mpi::MODE_WRONLY, file );
+    mpi::FileSetSize
+    ( file, BINARY_HEADER_SIZE + mpi::Offset(height)*width*sizeof(T) );
+    if( mpi::CommRank( comm ) == 0 )
+    {
+        byte header[BINARY_HEADER_SIZE];
+        FormBinaryHeader<T>( height, width, header );
+        mpi::FileWriteAt( file, 0, header, BINARY_HEADER_SIZE );
+    }
+    if( writer )
+    {
+        binary_io::WriteShared
+        ( file, BINARY_HEADER_SIZE, shareComm, height, LocalWidth(), 
+          ColShift(), RowShift(), ColStride(), RowStride(), 
+          LockedLocalBuffer(), LocalLDim() );
+        mpi::CommFree( shareComm );
+    }
+    mpi::FileClose( file );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename T,typename Int>
+inline void
+AbstractDistMatrix<T,Int>::ReadBinary( const std::string filename )
+{
+#ifndef RELEASE
+    PushCallStack("AbstractDistMatrix::ReadBinary");
+#endif
+    const elem::Grid& g = Grid();
+    mpi::Comm comm = g.ViewingComm();
+
+    mpi::File file;
+    mpi::FileOpen( comm, filename, mpi::MODE_RDONLY, file );
+    byte header[BINARY_HEADER_SIZE];
+    mpi::FileReadAtAll( file, 0, header, BINARY_HEADER_SIZE );
+    Int height, width;
+    try { ParseBinaryHeader<T>( header, height, width, filename ); }
+    catch( std::exception& e )
+    {
+        mpi::FileClose( file );
+        throw;
+    }
+    mpi::FileClose( file );
+
+    // The payload is read just as a raw column-major file
+    ReadColumnMajor( *this, filename, height, width, 
+                     (long long)BINARY_HEADER_SIZE );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
 //
 // Complex-only specializations
 //
@@ -0,0 +1,66 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace elem {
+
+// A persistent plan for the redistributions which are a single AllGather of
+// one distributed dimension, e.g., [MC,* ] <- [MC,MR] or [* ,* ] <- [VC,* ].
+//
+// The plan is keyed on the kind of gather, the grid, the sizes, and the 
+// alignments of the source, and it caches the shifts and local lengths 
+// needed for unpacking. Repeatedly redistributing matrices with the same key 
+// therefore does not recompute the index maps. The send/recv buffer is drawn
+// from the memory pool by Pack and returned by Unpack, so that the target 
+// does not hold it between redistributions.
+template<typename T,typename Int>
+class GatherPlan
+{
+public:
+    GatherPlan();
+
+    // B[U,* ] <- A[U,V], where comm is the communicator for distribution V
+    void ColGather
+    ( const AbstractDistMatrix<T,Int>& A, AbstractDistMatrix<T,Int>& B, 
+      mpi::Comm comm );
+    // B[* ,V] <- A[U,V], where comm is the communicator for distribution U
+    void RowGather
+    ( const AbstractDistMatrix<T,Int>& A, AbstractDistMatrix<T,Int>& B, 
+      mpi::Comm comm );
+
+    // The individual stages of the above, which allow for the AllGather to be
+    // replaced with a nonblocking one. Prepare only recomputes the plan if 
+    // its key has changed.
+    void PrepareColGather( const AbstractDistMatrix<T,Int>& A );
+    void PrepareRowGather( const AbstractDistMatrix<T,Int>& A );
+    void Pack( const AbstractDistMatrix<T,Int>& A );
+    void Unpack( AbstractDistMatrix<T,Int>& B );
+
+    T* SendBuffer();
+    T* RecvBuffer();
+    Int PortionSize() const;
+    Int Height() const;
+    Int Width() const;
+
+    // The number of times that the plan has been (re)computed
+    Int NumSetups() const;
+
+private:
+    bool gatherRows_;
+    const elem::Grid* grid_;
+    Int height_, width_, stride_, alignment_, localLength_, portionSize_;
+    Int numSetups_;
+    std::vector<Int> shifts_, lengths_;
+    Memory<T> buffer_;
+
+    void Setup
+    ( bool gatherRows, const elem::Grid& grid, 
+      Int height, Int width, Int stride, Int alignment, Int localLength );
+};
+
+} // namespace elem
@@ -0,0 +1,230 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace elem {
+
+template<typename T,typename Int>
+inline
+GatherPlan<T,Int>::GatherPlan()
+: gatherRows_(false), grid_(0), 
+  height_(-1), width_(-1), stride_(0), alignment_(0), localLength_(0), 
+  portionSize_(0), numSetups_(0)
+{ }
+
+template<typename T,typename Int>
+inline void
+GatherPlan<T,Int>::Setup
+( bool gatherRows, const elem::Grid& grid,
+  Int height, Int width, Int stride, Int alignment, Int localLength )
+{
+    if( gatherRows == gatherRows_ && &grid == grid_ && 
+        height == height_ && width == width_ && stride == stride_ && 
+        alignment == alignment_ && localLength == localLength_ )
+        return;
+
+    gatherRows_ = gatherRows;
+    grid_ = &grid;
+    height_ = height;
+    width_ = width;
+    stride_ = stride;
+    alignment_ = alignment;
+    localLength_ = localLength;
+    ++numSetups_;
+
+    // Precompute the shift and local length of each process's portion 
+    // of the gathered dimension
+    const Int gatheredLength = ( gatherRows ? height : width );
+    shifts_.resize( stride );
+    lengths_.resize( stride );
+    for( Int k=0; k<stride; ++k )
+    {
+        shifts_[k] = RawShift( k, alignment, stride );
+        lengths_[k] = RawLocalLength( gatheredLength, shifts_[k], stride );
+    }
+    const Int maxLocalLength = MaxLocalLength( gatheredLength, stride );
+    portionSize_ = std::max(maxLocalLength*localLength,mpi::MIN_COLL_MSG);
+}
+
+template<typename T,typename Int>
+inline void
+GatherPlan<T,Int>::PrepareColGather( const AbstractDistMatrix<T,Int>& A )
+{
+    Setup
+    ( false, A.Grid(), A.Height(), A.Width(), 
+      A.RowStride(), A.RowAlignment(), A.LocalHeight() );
+}
+
+template<typename T,typename Int>
+inline void
+GatherPlan<T,Int>::PrepareRowGather( const AbstractDistMatrix<T,Int>& A )
+{
+    Setup
+    ( true, A.Grid(), A.Height(), A.Width(), 
+      A.ColStride(), A.ColAlignment(), A.LocalWidth() );
+}
+
+template<typename T,typename Int>
+inline void
+GatherPlan<T,Int>::Pack( const AbstractDistMatrix<T,Int>& A )
+{
+    const Int localHeight = A.LocalHeight();
+    const Int localWidth = A.LocalWidth();
+    const T* ALocalBuffer = A.LockedLocalBuffer();
+    const Int ALDim = A.LocalLDim();
+    buffer_.Require( (stride_+1)*portionSize_ );
+    T* sendBuffer = buffer_.Buffer();
+#ifdef HAVE_OPENMP
+    #pragma omp parallel for
+#endif
+    for( Int jLocal=0; jLocal<localWidth; ++jLocal )
+    {
+        const T* ACol = &ALocalBuffer[jLocal*ALDim];
+        T* sendBufferCol = &sendBuffer[jLocal*localHeight];
+        MemCopy( sendBufferCol, ACol, localHeight );
+    }
+}
+
+template<typename T,typename Int>
+inline void
+GatherPlan<T,Int>::Unpack( AbstractDistMatrix<T,Int>& B )
+{
+    const T* recvBuffer = &buffer_.Buffer()[portionSize_];
+    T* BLocalBuffer = B.LocalBuffer();
+    const Int BLDim = B.LocalLDim();
+    if( gatherRows_ )
+    {
+        const Int localWidth = localLength_;
+#if defined(HAVE_OPENMP) && !defined(PARALLELIZE_INNER_LOOPS)
+        #pragma omp parallel for
+#endif
+        for( Int k=0; k<stride_; ++k )
+        {
+            const T* data = &recvBuffer[k*portionSize_];
+            const Int colShift = shifts_[k];
+            const Int localHeight = lengths_[k];
+#if defined(HAVE_OPENMP) && defined(PARALLELIZE_INNER_LOOPS)
+            #pragma omp parallel for
+#endif
+            for( Int jLocal=0; jLocal<localWidth; ++jLocal )
+            {
+                const T* dataCol = &data[jLocal*localHeight];
+                T* BCol = &BLocalBuffer[colShift+jLocal*BLDim];
+                StridedMemCopy( BCol, stride_, dataCol, 1, localHeight );
+            }
+        }
+    }
+    else
+    {
+        const Int localHeight = localLength_;
+#if defined(HAVE_OPENMP) && !defined(PARALLELIZE_INNER_LOOPS)
+        #pragma omp parallel for
+#endif
+        for( Int k=0; k<stride_; ++k )
+        {
+            const T* data = &recvBuffer[k*portionSize_];
+            const Int rowShift = shifts_[k];
+            const Int localWidth = lengths_[k];
+#if defined(HAVE_OPENMP) && defined(PARALLELIZE_INNER_LOOPS)
+            #pragma omp parallel for
+#endif
+            for( Int jLocal=0; jLocal<localWidth; ++jLocal )
+            {
+                const T* dataCol = &data[jLocal*localHeight];
+                T* BCol = &BLocalBuffer[(rowShift+jLocal*stride_)*BLDim];
+                MemCopy( BCol, dataCol, localHeight );
+            }
+        }
+    }
+
+    // Return the buffer to the memory pool so that the target does not hold 
+    // a second copy of its data between redistributions
+    buffer_.Release();
+}
+
+template<typename T,typename Int>
+inline void
+GatherPlan<T,Int>::ColGather
+( const AbstractDistMatrix<T,Int>& A, AbstractDistMatrix<T,Int>& B, 
+  mpi::Comm comm )
+{
+#ifndef RELEASE
+    PushCallStack("GatherPlan::ColGather");
+    if( A.RowStride() != mpi::CommSize( comm ) )
+        throw std::logic_error("Communicator does not match distribution");
+#else
+    PushProfileRegion("GatherPlan::ColGather");
+#endif
+    PrepareColGather( A );
+    Pack( A );
+    mpi::AllGather
+    ( SendBuffer(), portionSize_, RecvBuffer(), portionSize_, comm );
+    Unpack( B );
+#ifndef RELEASE
+    PopCallStack();
+#else
+    PopProfileRegion();
+#endif
+}
+
+template<typename T,typename Int>
+inline void
+GatherPlan<T,Int>::RowGather
+( const AbstractDistMatrix<T,Int>& A, AbstractDistMatrix<T,Int>& B, 
+  mpi::Comm comm )
+{
+#ifndef RELEASE
+    PushCallStack("GatherPlan::RowGather");
+    if( A.ColStride() != mpi::CommSize( comm ) )
+        throw std::logic_error("Communicator does not match distribution");
+#else
+    PushProfileRegion("GatherPlan::RowGather");
+#endif
+    PrepareRowGather( A );
+    Pack( A );
+    mpi::AllGather
+    ( SendBuffer(), portionSize_, RecvBuffer(), portionSize_, comm );
+    Unpack( B );
+#ifndef RELEASE
+    PopCallStack();
+#else
+    PopProfileRegion();
+#endif
+}
+
+template<typename T,typename Int>
+inline T*
+GatherPlan<T,Int>::SendBuffer()
+{ return buffer_.Buffer(); }
+
+template<typename T,typename Int>
+inline T*
+GatherPlan<T,Int>::RecvBuffer()
+{ return &buffer_.Buffer()[portionSize_]; }
+
+template<typename T,typename Int>
+inline Int
+GatherPlan<T,Int>::PortionSize() const
+{ return portionSize_; }
+
+template<typename T,typename Int>
+inline Int
+GatherPlan<T,Int>::Height() const
+{ return height_; }
+
+template<typename T,typename Int>
+inline Int
+GatherPlan<T,Int>::Width() const
+{ return width_; }
+
+template<typename T,typename Int>
+inline Int
+GatherPlan<T,Int>::NumSetups() const
+{ return numSetups_; }
+
+} // namespace elem
@@ -730,8 +730,7 @@ DistMatrix<T,MC,MR,Int>::PrintBase
     {
         T* destCol = &sendBuf[colShift+(rowShift+jLocal*c)*height];
         const T* sourceCol = &thisLocalBuffer[jLocal*thisLDim];
-        for( Int iLocal=0; iLocal<localHeight; ++iLocal )
-            destCol[iLocal*r] = sourceCol[iLocal];
+        StridedMemCopy( destCol, r, sourceCol, 1, localHeight );
     }
 
     // If we are the root, allocate a receive buffer
@@ -1084,15 +1083,10 @@ DistMatrix<T,MC,MR,Int>::GetDiagonal
     T* dLocalBuffer = d.LocalBuffer();
     const T* localBuffer = this->LockedLocalBuffer();
     const Int ldim = this->LocalLDim();
-#ifdef HAVE_OPENMP
-    #pragma omp parallel for
-#endif
-    for( Int k=0; k<localDiagLength; ++k )
-    {
-        const Int iLocal = iLocalStart + k*(lcm/colStride);
-        const Int jLocal = jLocalStart + k*(lcm/rowStride);
-        dLocalBuffer[k] = localBuffer[iLocal+jLocal*ldim];
-    }
+    const Int diagStride = lcm/colStride + (lcm/rowStride)*ldim;
+    StridedMemCopy
+    ( dLocalBuffer, 1,
+      &localBuffer[iLocalStart+jLocalStart*ldim], diagStride, localDiagLength );
 #ifndef RELEASE
     PopCallStack();
 #endif
@@ -1165,15 +1159,10 @@ DistMatrix<T,MC,MR,Int>::GetDiagonal
     const T* localBuffer = this->LockedLocalBuffer();
     const Int ldim = this->LocalLDim();
     const Int lcm = g.LCM();
-#ifdef HAVE_OPENMP
-    #pragma omp parallel for
-#endif
-    for( Int k=0; k<localDiagLength; ++k )
-    {
-        const Int iLocal = iLocalStart + k*(lcm/colStride);
-        const Int jLocal = jLocalStart + k*(lcm/rowStride);
-        dLocalBuffer[k*dLDim] = localBuffer[iLocal+jLocal*ldim];
-    }
+    const Int diagStride = lcm/colStride + (lcm/rowStride)*ldim;
+    StridedMemCopy
+    ( dLocalBuffer, dLDim,
+      &localBuffer[iLocalStart+jLocalStart*ldim], diagStride, localDiagLength );
 #ifndef RELEASE
     PopCallStack();
 #endif
@@ -1235,15 +1224,10 @@ DistMatrix<T,MC,MR,Int>::SetDiagonal
     T* localBuffer = this->LocalBuffer();
     const Int ldim = this->LocalLDim();
     const Int lcm = this->Grid().LCM();
-#ifdef HAVE_OPENMP
-    #pragma omp parallel for
-#endif
-    for( Int k=0; k<localDiagLength; ++k )
-    {
-        const Int iLocal = iLocalStart + k*(lcm/colStride);
-        const Int jLocal = jLocalStart + k*(lcm/rowStride);
-        localBuffer[iLocal+jLocal*ldim] = dLocalBuffer[k];
-    }
+    const Int diagStride = lcm/colStride + (lcm/rowStride)*ldim;
+    StridedMemCopy
+    ( &localBuffer[iLocalStart+jLocalStart*ldim], diagStride,
+      dLocalBuffer, 1, localDiagLength );
 #ifndef RELEASE
     PopCallStack();
 #endif
@@ -1306,15 +1290,10 @@ DistMatrix<T,MC,MR,Int>::SetDiagonal
     const Int dLDim = d.LocalLDim();
     const Int ldim = this->LocalLDim();
     const Int lcm = this->Grid().LCM();
-#ifdef HAVE_OPENMP
-    #pragma omp parallel for
-#endif
-    for( Int k=0; k<localDiagLength; ++k )
-    {
-        const Int iLocal = iLocalStart + k*(lcm/colStride);
-        const Int jLocal = jLocalStart + k*(lcm/rowStride);
-        localBuffer[iLocal+jLocal*ldim] = dLocalBuffer[k*dLDim];
-    }
+    const Int diagStride = lcm/colStride + (lcm/rowStride)*ldim;
+    StridedMemCopy
+    ( &localBuffer[iLocalStart+jLocalStart*ldim], diagStride,
+      dLocalBuffer, dLDim, localDiagLength );
 #ifndef RELEASE
     PopCallStack();
 #endif
@@ -1381,31 +1360,15 @@ DistMatrix<T,MC,MR,Int>::TransposeFrom
         T* localBuffer = this->LocalBuffer();
         const Int ldim = this->LocalLDim();
         if( conjugate )
-        {
-#ifdef HAVE_OPENMP
-            #pragma omp parallel for
-#endif
-            for( Int jLocal=0; jLocal<localWidth; ++jLocal )
-            {
-                T* destCol = &localBuffer[jLocal*ldim];
-                const T* sourceCol = &ALocalBuffer[rowShift+jLocal*rowStride];
-                for( Int iLocal=0; iLocal<localHeight; ++iLocal )
-                    destCol[iLocal] = Conj( sourceCol[iLocal*ALDim] );
-            }
-        }
+            ConjInterleaveMatrix
+            ( localHeight, localWidth,
+              &ALocalBuffer[rowShift], ALDim, rowStride,
+              localBuffer, 1, ldim );
         else
-        {
-#ifdef HAVE_OPENMP
-            #pragma omp parallel for
-#endif
-            for( Int jLocal=0; jLocal<localWidth; ++jLocal )
-            {
-                T* destCol = &localBuffer[jLocal*ldim];
-                const T* sourceCol = &ALocalBuffer[rowShift+jLocal*rowStride];
-                for( Int iLocal=0; iLocal<localHeight; ++iLocal )
-                    destCol[iLocal] = sourceCol[iLocal*ALDim];
-            }
-        }
+            InterleaveMatrix
+            ( localHeight, localWidth,
+              &ALocalBuffer[rowShift], ALDim, rowStride,
+              localBuffer, 1, ldim );
     }
     else
     {
@@ -1437,31 +1400,15 @@ DistMatrix<T,MC,MR,Int>::TransposeFrom
         const T* ALocalBuffer = A.LockedLocalBuffer();
         const Int ALDim = A.LocalLDim();
         if( conjugate )
-        {
-#ifdef HAVE_OPENMP
-            #pragma omp parallel for
-#endif
-            for( Int jLocal=0; jLocal<localWidth; ++jLocal )
-            {
-                T* destCol = &sendBuffer[jLocal*localWidth];
-                const T* sourceCol = &ALocalBuffer[rowShift+jLocal*rowStride];
-                for( Int iLocal=0; iLocal<localWidthA; ++iLocal )
-                    destCol[iLocal] = Conj( sourceCol[iLocal*ALDim] );
-            }
-        }
+            ConjInterleaveMatrix
+            ( localWidthA, localWidth,
+              &ALocalBuffer[rowShift], ALDim, rowStride,
+              sendBuffer, 1, localWidth );
         else
-        {
-#ifdef HAVE_OPENMP
-            #pragma omp parallel for
-#endif
-            for( Int jLocal=0; jLocal<localWidth; ++jLocal )
-            {
-                T* destCol = &sendBuffer[jLocal*localWidth];
-                const T* sourceCol = &ALocalBuffer[rowShift+jLocal*rowStride];
-                for( Int iLocal=0; iLocal<localWidthA; ++iLocal )
-                    destCol[iLocal] = sourceCol[iLocal*ALDim];
-            }
-        }
+            InterleaveMatrix
+            ( localWidthA, localWidth,
+              &ALocalBuffer[rowShift], ALDim, rowStride,
+              sendBuffer, 1, localWidth );
 
         // Communicate
         mpi::SendRecv
@@ -1540,31 +1487,15 @@ DistMatrix<T,MC,MR,Int>::TransposeFrom
         T* localBuffer = this->LocalBuffer();
         const Int ldim = this->LocalLDim();
         if( conjugate )
-        {
-#ifdef HAVE_OPENMP
-            #pragma omp parallel for
-#endif
-            for( Int jLocal=0; jLocal<localWidth; ++jLocal )
-            {
-                T* destCol = &localBuffer[jLocal*ldim];
-                const T* sourceCol = &ALocalBuffer[jLocal+colShift*ALDim];
-                for( Int iLocal=0; iLocal<localHeight; ++iLocal )
-                    destCol[iLocal] = Conj( sourceCol[iLocal*colStride*ALDim] );
-            }
-        }
+            ConjInterleaveMatrix
+            ( localHeight, localWidth,
+              &ALocalBuffer[colShift*ALDim], colStride*ALDim, 1,
+              localBuffer, 1, ldim );
         else
-        {
-#ifdef HAVE_OPENMP
-            #pragma omp parallel for
-#endif
-            for( Int jLocal=0; jLocal<localWidth; ++jLocal )
-            {
-                T* destCol = &localBuffer[jLocal*ldim];
-                const T* sourceCol = &ALocalBuffer[jLocal+colShift*ALDim];
-                for( Int iLocal=0; iLocal<localHeight; ++iLocal )
-                    destCol[iLocal] = sourceCol[iLocal*colStride*ALDim];
-            }
-        }
+            InterleaveMatrix
+            ( localHeight, localWidth,
+              &ALocalBuffer[colShift*ALDim], colStride*ALDim, 1,
+              localBuffer, 1, ldim );
     }
 #ifndef RELEASE
     PopCallStack();
@@ -1835,18 +1766,10 @@ DistMatrix<T,MC,MR,Int>::operator=( const DistMatrix<T,MC,MR,Int>& A )
                     Int sendWidth = LocalLength( A.LocalWidth(), rowSend, numRowSends );
                     const T* ALocalBuffer = A.LockedLocalBuffer();
                     const Int ALDim = A.LocalLDim();
-#ifdef HAVE_OPENMP
-                    #pragma omp parallel for
-#endif
-                    for( Int jLocal=0; jLocal<sendWidth; ++jLocal )
-                    {
-                        const Int j = rowSend+jLocal*localRowStrideA;
-                        for( Int iLocal=0; iLocal<sendHeight; ++iLocal )
-                        {
-                            const Int i = colSend+iLocal*localColStrideA;
-                            sendBuffer[iLocal+jLocal*sendHeight] = ALocalBuffer[i+j*ALDim];
-                        }
-                    }
+                    InterleaveMatrix
+                    ( sendHeight, sendWidth,
+                      &ALocalBuffer[colSend+rowSend*ALDim], localColStrideA, localRowStrideA*ALDim,
+                      sendBuffer, 1, sendHeight );
                     // Send data
                     const Int recvVCRank = recvRow + recvCol*colStride;
                     const Int recvViewingRank = this->Grid().VCToViewingMap( recvVCRank );
@@ -1897,18 +1820,10 @@ DistMatrix<T,MC,MR,Int>::operator=( const DistMatrix<T,MC,MR,Int>& A )
                             // Unpack the data
                             T* localBuffer = this->LocalBuffer();
                             const Int ldim = this->LocalLDim();
-#ifdef HAVE_OPENMP
-                            #pragma omp parallel for
-#endif
-                            for( Int jLocal=0; jLocal<sendWidth; ++jLocal )
-                            {
-                                const Int j = localRowOffset+jLocal*localRowStride;
-                                for( Int iLocal=0; iLocal<sendHeight; ++iLocal )
-                                {
-                                    const Int i = localColOffset+iLocal*localColStride;
-                                    localBuffer[i+j*ldim] = recvBuffer[iLocal+jLocal*sendHeight];
-                                }
-                            }
+                            InterleaveMatrix
+                            ( sendHeight, sendWidth,
+                              recvBuffer, 1, sendHeight,
+                              &localBuffer[localColOffset+localRowOffset*ldim], localColStride, localRowStride*ldim );
                             // Set up the next send col
                             sendCol = (sendCol + rowStride) % rowStrideA;
                         }
@@ -2106,8 +2021,7 @@ DistMatrix<T,MC,MR,Int>::operator=( const DistMatrix<T,STAR,MR,Int>& A )
         {
             T* destCol = &thisLocalBuffer[jLocal*thisLDim];
             const T* sourceCol = &ALocalBuffer[colShift+jLocal*ALDim];
-            for( Int iLocal=0; iLocal<localHeight; ++iLocal )
-                destCol[iLocal] = sourceCol[iLocal*r];
+            StridedMemCopy( destCol, 1, sourceCol, r, localHeight );
         }
     }
     else
@@ -2149,8 +2063,7 @@ DistMatrix<T,MC,MR,Int>::operator=( const DistMatrix<T,STAR,MR,Int>& A )
         {
             T* destCol = &sendBuffer[jLocal*localHeight];
             const T* sourceCol = &ALocalBuffer[colShift+jLocal*ALDim];
-            for( Int iLocal=0; iLocal<localHeight; ++iLocal )
-                destCol[iLocal] = sourceCol[iLocal*r];
+            StridedMemCopy( destCol, 1, sourceCol, r, localHeight );
         }
 
         // Communicate
@@ -2283,8 +2196,8 @@ DistMatrix<T,MC,MR,Int>::operator=( const DistMatrix<T,MR,MC,Int>& A )
                 const Int offset = (shift-colShiftA) / c;
                 const Int thisLocalHeight = RawLocalLength(height,shift,p);
 
-                for( Int iLocal=0; iLocal<thisLocalHeight; ++iLocal )
-                    data[iLocal] = ALocalBuffer[offset+iLocal*r];
+                StridedMemCopy
+                ( data, 1, &ALocalBuffer[offset], r, thisLocalHeight );
             }
         }
 
@@ -2318,8 +2231,8 @@ DistMatrix<T,MC,MR,Int>::operator=( const DistMatrix<T,MR,MC,Int>& A )
                 const Int offset = (shift-colShift) / r;
                 const Int thisLocalHeight = RawLocalLength(height,shift,p);
 
-                for( Int iLocal=0; iLocal<thisLocalHeight; ++iLocal )
-                    thisLocalBuffer[offset+iLocal*c] = data[iLocal];
+                StridedMemCopy
+                ( &thisLocalBuffer[offset], c, data, 1, thisLocalHeight );
             }
         }
         this->auxMemory_.Release();
@@ -2372,8 +2285,9 @@ DistMatrix<T,MC,MR,Int>::operator=( const DistMatrix<T,MR,MC,Int>& A )
                 const Int offset = (shift-rowShiftA) / r;
                 const Int thisLocalWidth = RawLocalLength(width,shift,p);
 
-                for( Int jLocal=0; jLocal<thisLocalWidth; ++jLocal )
-                    data[jLocal] = ALocalBuffer[(offset+jLocal*c)*ALDim];
+                StridedMemCopy
+                ( data, 1,
+                  &ALocalBuffer[offset*ALDim], c*ALDim, thisLocalWidth );
             }
         }
 
@@ -2622,8 +2536,7 @@ DistMatrix<T,MC,MR,Int>::operator=( const DistMatrix<T,VC,STAR,Int>& A )
             {
                 T* destCol = &thisLocalBuffer[thisColOffset+jLocal*thisLDim];
                 const T* sourceCol = &data[jLocal*thisLocalHeight];
-                for( Int iLocal=0; iLocal<thisLocalHeight; ++iLocal )
-                    destCol[iLocal*c] = sourceCol[iLocal];
+                StridedMemCopy( destCol, c, sourceCol, 1, thisLocalHeight );
             }
         }
         this->auxMemory_.Release();
@@ -2718,8 +2631,7 @@ DistMatrix<T,MC,MR,Int>::operator=( const DistMatrix<T,VC,STAR,Int>& A )
             {
                 T* destCol = &thisLocalBuffer[thisColOffset+jLocal*thisLDim];
                 const T* sourceCol = &data[jLocal*thisLocalHeight];
-                for( Int iLocal=0; iLocal<thisLocalHeight; ++iLocal )
-                    destCol[iLocal*c] = sourceCol[iLocal];
+                StridedMemCopy( destCol, c, sourceCol, 1, thisLocalHeight );
             }
         }
         this->auxMemory_.Release();
@@ -2850,8 +2762,7 @@ DistMatrix<T,MC,MR,Int>::operator=( const DistMatrix<T,STAR,VR,Int>& A )
             {
                 T* destCol = &data[jLocal*thisLocalHeight];
                 const T* sourceCol = &ALocalBuffer[thisColShift+jLocal*ALDim];
-                for( Int iLocal=0; iLocal<thisLocalHeight; ++iLocal )
-                    destCol[iLocal] = sourceCol[iLocal*r];
+                StridedMemCopy( destCol, 1, sourceCol, r, thisLocalHeight );
             }
         }
 
@@ -2942,8 +2853,7 @@ DistMatrix<T,MC,MR,Int>::operator=( const DistMatrix<T,STAR,VR,Int>& A )
             {
                 T* destCol = &data[jLocal*thisLocalHeight];
                 const T* sourceCol = &ALocalBuffer[thisColShift+jLocal*ALDim];
-                for( Int iLocal=0; iLocal<thisLocalHeight; ++iLocal )
-                    destCol[iLocal] = sourceCol[iLocal*r];
+                StridedMemCopy( destCol, 1, sourceCol, r, thisLocalHeight );
             }
         }
 
@@ -3025,8 +2935,7 @@ DistMatrix<T,MC,MR,Int>::operator=( const DistMatrix<T,STAR,STAR,Int>& A )
     {
         T* destCol = &thisLocalBuffer[jLocal*thisLDim];
         const T* sourceCol = &ALocalBuffer[colShift+(rowShift+jLocal*c)*ALDim];
-        for( Int iLocal=0; iLocal<localHeight; ++iLocal )
-            destCol[iLocal] = sourceCol[iLocal*r];
+        StridedMemCopy( destCol, 1, sourceCol, r, localHeight );
     }
 #ifndef RELEASE
     PopCallStack();
@@ -3385,8 +3294,7 @@ DistMatrix<T,MC,MR,Int>::SumScatterFrom( const DistMatrix<T,STAR,MR,Int>& A )
             {
                 T* destCol = &data[jLocal*thisLocalHeight];
                 const T* sourceCol = &ALocalBuffer[thisColShift+jLocal*ALDim];
-                for( Int iLocal=0; iLocal<thisLocalHeight; ++iLocal )
-                    destCol[iLocal] = sourceCol[iLocal*r];
+                StridedMemCopy( destCol, 1, sourceCol, r, thisLocalHeight );
             }
         }
 
@@ -3463,8 +3371,7 @@ DistMatrix<T,MC,MR,Int>::SumScatterFrom( const DistMatrix<T,STAR,MR,Int>& A )
             {
                 T* destCol = &data[jLocal*thisLocalHeight];
                 const T* sourceCol = &ALocalBuffer[thisColShift+jLocal*ALDim];
-                for( Int iLocal=0; iLocal<thisLocalHeight; ++iLocal )
-                    destCol[iLocal] = sourceCol[iLocal*r];
+                StridedMemCopy( destCol, 1, sourceCol, r, thisLocalHeight );
             }
         }
 
@@ -3565,8 +3472,7 @@ DistMatrix<T,MC,MR,Int>::SumScatterFrom( const DistMatrix<T,STAR,STAR,Int>& A )
                 T* destCol = &data[jLocal*thisLocalHeight];
                 const T* sourceCol = 
                     &ALocalBuffer[thisColShift+(thisRowShift+jLocal*c)*ALDim];
-                for( Int iLocal=0; iLocal<thisLocalHeight; ++iLocal )
-                    destCol[iLocal] = sourceCol[iLocal*r];
+                StridedMemCopy( destCol, 1, sourceCol, r, thisLocalHeight );
             }
         }
     }
@@ -3934,8 +3840,7 @@ DistMatrix<T,MC,MR,Int>::SumScatterUpdate
             {
                 T* destCol = &data[jLocal*thisLocalHeight];
                 const T* sourceCol = &ALocalBuffer[thisColShift+jLocal*ALDim];
-                for( Int iLocal=0; iLocal<thisLocalHeight; ++iLocal )
-                    destCol[iLocal] = sourceCol[iLocal*r];
+                StridedMemCopy( destCol, 1, sourceCol, r, thisLocalHeight );
             }
         }
 
@@ -4015,8 +3920,7 @@ DistMatrix<T,MC,MR,Int>::SumScatterUpdate
             {
                 T* destCol = &data[jLocal*thisLocalHeight];
                 const T* sourceCol = &ALocalBuffer[thisColShift+jLocal*ALDim];
-                for( Int iLocal=0; iLocal<thisLocalHeight; ++iLocal )
-                    destCol[iLocal] = sourceCol[iLocal*r];
+                StridedMemCopy( destCol, 1, sourceCol, r, thisLocalHeight );
             }
         }
 
@@ -4120,8 +4024,7 @@ DistMatrix<T,MC,MR,Int>::SumScatterUpdate
                 T* destCol = &data[jLocal*thisLocalHeight];
                 const T* sourceCol = 
                     &ALocalBuffer[thisColShift+(thisRowShift+jLocal*c)*ALDim];
-                for( Int iLocal=0; iLocal<thisLocalHeight; ++iLocal )
-                    destCol[iLocal] = sourceCol[iLocal*r];
+                StridedMemCopy( destCol, 1, sourceCol, r, thisLocalHeight );
             }
         }
     }
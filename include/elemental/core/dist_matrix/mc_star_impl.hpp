@@ -474,8 +474,7 @@ DistMatrix<T,MC,STAR,Int>::PrintBase
         {
             T* destCol = &sendBuf[colShift+jLocal*height];
             const T* sourceCol = &thisLocalBuffer[jLocal*thisLDim];
-            for( Int iLocal=0; iLocal<localHeight; ++iLocal )
-                destCol[iLocal*r] = sourceCol[iLocal];
+            StridedMemCopy( destCol, r, sourceCol, 1, localHeight );
         }
 
         // If we are the root, allocate a receive buffer
@@ -750,15 +749,11 @@ DistMatrix<T,MC,STAR,Int>::GetDiagonal
     T* dLocalBuffer = d.LocalBuffer();
     const T* thisLocalBuffer = this->LockedLocalBuffer();
     const Int thisLDim = this->LocalLDim();
-#ifdef HAVE_OPENMP
-    #pragma omp parallel for
-#endif
-    for( Int k=0; k<localDiagLength; ++k )
-    {
-        const Int iLocal = iLocalStart+k;
-        const Int jLocal = jStart+k*r;
-        dLocalBuffer[k] = thisLocalBuffer[iLocal+jLocal*thisLDim];
-    }
+    const Int diagStride = 1 + r*thisLDim;
+    StridedMemCopy
+    ( dLocalBuffer, 1,
+      &thisLocalBuffer[iLocalStart+jStart*thisLDim], diagStride,
+      localDiagLength );
 #ifndef RELEASE
     PopCallStack();
 #endif
@@ -827,15 +822,11 @@ DistMatrix<T,MC,STAR,Int>::GetDiagonal
     const Int dLDim = d.LocalLDim();
     const T* thisLocalBuffer = this->LockedLocalBuffer();
     const Int thisLDim = this->LocalLDim();
-#ifdef HAVE_OPENMP
-    #pragma omp parallel for
-#endif
-    for( Int k=0; k<localDiagLength; ++k )
-    {
-        const Int iLocal = iLocalStart+k;
-        const Int jLocal = jStart+k*r;
-        dLocalBuffer[k*dLDim] = thisLocalBuffer[iLocal+jLocal*thisLDim];
-    }
+    const Int diagStride = 1 + r*thisLDim;
+    StridedMemCopy
+    ( dLocalBuffer, dLDim,
+      &thisLocalBuffer[iLocalStart+jStart*thisLDim], diagStride,
+      localDiagLength );
 #ifndef RELEASE
     PopCallStack();
 #endif
@@ -894,15 +885,10 @@ DistMatrix<T,MC,STAR,Int>::SetDiagonal
     const T* dLocalBuffer = d.LockedLocalBuffer();
     T* thisLocalBuffer = this->LocalBuffer();
     const Int thisLDim = this->LocalLDim();
-#ifdef HAVE_OPENMP
-    #pragma omp parallel for
-#endif
-    for( Int k=0; k<localDiagLength; ++k )
-    {
-        const Int iLocal = iLocalStart+k;
-        const Int jLocal = jStart+k*r;
-        thisLocalBuffer[iLocal+jLocal*thisLDim] = dLocalBuffer[k];
-    }
+    const Int diagStride = 1 + r*thisLDim;
+    StridedMemCopy
+    ( &thisLocalBuffer[iLocalStart+jStart*thisLDim], diagStride,
+      dLocalBuffer, 1, localDiagLength );
 #ifndef RELEASE
     PopCallStack();
 #endif
@@ -962,15 +948,10 @@ DistMatrix<T,MC,STAR,Int>::SetDiagonal
     T* thisLocalBuffer = this->LocalBuffer();
     const Int dLDim = d.LocalLDim();
     const Int thisLDim = this->LocalLDim();
-#ifdef HAVE_OPENMP
-    #pragma omp parallel for
-#endif
-    for( Int k=0; k<localDiagLength; ++k )
-    {
-        const Int iLocal = iLocalStart+k;
-        const Int jLocal = jStart+k*r;
-        thisLocalBuffer[iLocal+jLocal*thisLDim] = dLocalBuffer[k*dLDim];
-    }
+    const Int diagStride = 1 + r*thisLDim;
+    StridedMemCopy
+    ( &thisLocalBuffer[iLocalStart+jStart*thisLDim], diagStride,
+      dLocalBuffer, dLDim, localDiagLength );
 #ifndef RELEASE
     PopCallStack();
 #endif
@@ -1082,66 +1063,7 @@ DistMatrix<T,MC,STAR,Int>::operator=( const DistMatrix<T,MC,MR,Int>& A )
         }
         else
         {
-            const Int c = g.Width();
-
-            const Int width = this->Width();
-            const Int localHeight = this->LocalHeight();
-            const Int localWidthOfA = A.LocalWidth();
-            const Int maxLocalWidth = MaxLocalLength(width,c);
-
-            const Int portionSize = 
-                std::max(localHeight*maxLocalWidth,mpi::MIN_COLL_MSG);
-
-            this->auxMemory_.Require( (c+1)*portionSize );
-
-            T* buffer = this->auxMemory_.Buffer();
-            T* originalData = &buffer[0];
-            T* gatheredData = &buffer[portionSize];
-
-            // Pack
-            const T* ALocalBuffer = A.LockedLocalBuffer();
-            const Int ALDim = A.LocalLDim();
-#ifdef HAVE_OPENMP
-            #pragma omp parallel for
-#endif
-            for( Int jLocal=0; jLocal<localWidthOfA; ++jLocal )
-            {
-                const T* ACol = &ALocalBuffer[jLocal*ALDim];
-                T* originalDataCol = &originalData[jLocal*localHeight];
-                MemCopy( originalDataCol, ACol, localHeight );
-            }
-
-            // Communicate
-            mpi::AllGather
-            ( originalData, portionSize,
-              gatheredData, portionSize, g.RowComm() );
-
-            // Unpack
-            const Int rowAlignmentOfA = A.RowAlignment();
-            T* thisLocalBuffer = this->LocalBuffer();
-            const Int thisLDim = this->LocalLDim();
-#if defined(HAVE_OPENMP) && !defined(PARALLELIZE_INNER_LOOPS)
-            #pragma omp parallel for
-#endif
-            for( Int k=0; k<c; ++k )
-            {
-                const T* data = &gatheredData[k*portionSize];
-
-                const Int rowShift = RawShift( k, rowAlignmentOfA, c );
-                const Int localWidth = RawLocalLength( width, rowShift, c );
-
-#if defined(HAVE_OPENMP) && defined(PARALLELIZE_INNER_LOOPS)
-                #pragma omp parallel for
-#endif
-                for( Int jLocal=0; jLocal<localWidth; ++jLocal )
-                {
-                    const T* dataCol = &data[jLocal*localHeight];
-                    T* thisCol = 
-                        &thisLocalBuffer[(rowShift+jLocal*c)*thisLDim];
-                    MemCopy( thisCol, dataCol, localHeight );
-                }
-            }
-            this->auxMemory_.Release();
+            this->gatherPlan_.ColGather( A, *this, g.RowComm() );
         }
     }
     else
@@ -1624,8 +1546,7 @@ DistMatrix<T,MC,STAR,Int>::operator=( const DistMatrix<T,VC,STAR,Int>& A )
             {
                 T* destCol = &thisLocalBuffer[colOffset+j*thisLDim];
                 const T* sourceCol = &data[j*localHeight];
-                for( Int iLocal=0; iLocal<localHeight; ++iLocal )
-                    destCol[iLocal*c] = sourceCol[iLocal];
+                StridedMemCopy( destCol, c, sourceCol, 1, localHeight );
             }
         }
         this->auxMemory_.Release();
@@ -1708,8 +1629,7 @@ DistMatrix<T,MC,STAR,Int>::operator=( const DistMatrix<T,VC,STAR,Int>& A )
             {
                 T* destCol = &thisLocalBuffer[colOffset+j*thisLDim];
                 const T* sourceCol = &data[j*localHeight];
-                for( Int iLocal=0; iLocal<localHeight; ++iLocal )
-                    destCol[iLocal*c] = sourceCol[iLocal];
+                StridedMemCopy( destCol, c, sourceCol, 1, localHeight );
             }
         }
         this->auxMemory_.Release();
@@ -1824,8 +1744,7 @@ DistMatrix<T,MC,STAR,Int>::operator=( const DistMatrix<T,STAR,STAR,Int>& A )
     {
         T* destCol = &thisLocalBuffer[j*thisLDim];
         const T* sourceCol = &ALocalBuffer[colShift+j*ALDim];
-        for( Int iLocal=0; iLocal<localHeight; ++iLocal )
-            destCol[iLocal] = sourceCol[iLocal*r];
+        StridedMemCopy( destCol, 1, sourceCol, r, localHeight );
     }
 #ifndef RELEASE
     PopCallStack();
@@ -1833,6 +1752,30 @@ DistMatrix<T,MC,STAR,Int>::operator=( const DistMatrix<T,STAR,STAR,Int>& A )
     return *this;
 }
 
+template<typename T,typename Int>
+inline void
+DistMatrix<T,MC,STAR,Int>::BeginRedistribute( const DistMatrix<T,MC,MR,Int>& A )
+{
+#ifndef RELEASE
+    PushCallStack("[MC,* ]::BeginRedistribute( [MC,MR] )");
+    this->AssertNotLockedView();
+    this->AssertSameGrid( A );
+    if( this->Viewing() )
+        this->AssertSameSize( A );
+#endif
+    const elem::Grid& g = this->Grid();
+    // The new alignment is only applied by FinishRedistribute
+    const bool realign = 
+        !this->Viewing() && !this->ConstrainedColAlignment();
+    if( realign || this->ColAlignment() == A.ColAlignment() )
+        this->pendingGather_.BeginColGather( A, g.RowComm(), realign );
+    else
+        *this = A;
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
 //
 // Routines which explicitly work in the complex plane
 //
@@ -435,8 +435,7 @@ DistMatrix<T,MD,STAR,Int>::PrintBase
         {
             T* destCol = &sendBuf[colShift+j*height];
             const T* sourceCol = &thisLocalBuffer[j*thisLDim];
-            for( Int iLocal=0; iLocal<localHeight; ++iLocal )
-                destCol[iLocal*lcm] = sourceCol[iLocal];
+            StridedMemCopy( destCol, lcm, sourceCol, 1, localHeight );
         }
     }
 
@@ -944,8 +943,7 @@ DistMatrix<T,MD,STAR,Int>::operator=( const DistMatrix<T,STAR,STAR,Int>& A )
         {
             T* destCol = &thisLocalBuffer[j*thisLDim];
             const T* sourceCol = &ALocalBuffer[colShift+j*ALDim];
-            for( Int iLocal=0; iLocal<localHeight; ++iLocal )
-                destCol[iLocal] = sourceCol[iLocal*lcm];
+            StridedMemCopy( destCol, 1, sourceCol, lcm, localHeight );
         }
     }
 #ifndef RELEASE
@@ -726,8 +726,7 @@ DistMatrix<T,MR,MC,Int>::PrintBase
     {
         T* destCol = &sendBuf[colShift+(rowShift+jLocal*r)*height];
         const T* sourceCol = &thisLocalBuffer[jLocal*thisLDim];
-        for( Int iLocal=0; iLocal<localHeight; ++iLocal )
-            destCol[iLocal*c] = sourceCol[iLocal];
+        StridedMemCopy( destCol, c, sourceCol, 1, localHeight );
     }
 
     // If we are the root, allocate a receive buffer
@@ -1068,15 +1067,11 @@ DistMatrix<T,MR,MC,Int>::GetDiagonal
         const T* thisLocalBuffer = this->LockedLocalBuffer();
         const Int thisLDim = this->LocalLDim();
         T* dLocalBuffer = d.LocalBuffer();
-#ifdef HAVE_OPENMP
-        #pragma omp parallel for
-#endif
-        for( Int k=0; k<localDiagLength; ++k )
-        {
-            const Int iLocal = iLocalStart + k*(lcm/c);
-            const Int jLocal = jLocalStart + k*(lcm/r);
-            dLocalBuffer[k] = thisLocalBuffer[iLocal+jLocal*thisLDim]; 
-        }
+        const Int diagStride = lcm/c + (lcm/r)*thisLDim;
+        StridedMemCopy
+        ( dLocalBuffer, 1,
+          &thisLocalBuffer[iLocalStart+jLocalStart*thisLDim], diagStride,
+          localDiagLength );
     }
 #ifndef RELEASE
     PopCallStack();
@@ -1140,15 +1135,11 @@ DistMatrix<T,MR,MC,Int>::GetDiagonal
         const Int thisLDim = this->LocalLDim();
         T* dLocalBuffer = d.LocalBuffer();
         const Int dLDim = d.LocalLDim();
-#ifdef HAVE_OPENMP
-        #pragma omp parallel for
-#endif
-        for( Int k=0; k<localDiagLength; ++k )
-        {
-            const Int iLocal = iLocalStart + k*(lcm/c);
-            const Int jLocal = jLocalStart + k*(lcm/r);
-            dLocalBuffer[k*dLDim] = thisLocalBuffer[iLocal+jLocal*thisLDim];
-        }
+        const Int diagStride = lcm/c + (lcm/r)*thisLDim;
+        StridedMemCopy
+        ( dLocalBuffer, dLDim,
+          &thisLocalBuffer[iLocalStart+jLocalStart*thisLDim], diagStride,
+          localDiagLength );
     }
 #ifndef RELEASE
     PopCallStack();
@@ -1208,15 +1199,10 @@ DistMatrix<T,MR,MC,Int>::SetDiagonal
         const T* dLocalBuffer = d.LockedLocalBuffer();
         T* thisLocalBuffer = this->LocalBuffer();
         const Int thisLDim = this->LocalLDim();
-#ifdef HAVE_OPENMP
-        #pragma omp parallel for
-#endif
-        for( Int k=0; k<localDiagLength; ++k )
-        {
-            const Int iLocal = iLocalStart + k*(lcm/c);
-            const Int jLocal = jLocalStart + k*(lcm/r);
-            thisLocalBuffer[iLocal+jLocal*thisLDim] = dLocalBuffer[k];
-        }
+        const Int diagStride = lcm/c + (lcm/r)*thisLDim;
+        StridedMemCopy
+        ( &thisLocalBuffer[iLocalStart+jLocalStart*thisLDim], diagStride,
+          dLocalBuffer, 1, localDiagLength );
     }
 #ifndef RELEASE
     PopCallStack();
@@ -1277,15 +1263,10 @@ DistMatrix<T,MR,MC,Int>::SetDiagonal
         const Int dLDim = d.LocalLDim();
         T* thisLocalBuffer = this->LocalBuffer();
         const Int thisLDim = this->LocalLDim();
-#ifdef HAVE_OPENMP
-        #pragma omp parallel for
-#endif
-        for( Int k=0; k<localDiagLength; ++k )
-        {
-            const Int iLocal = iLocalStart + k*(lcm/c);
-            const Int jLocal = jLocalStart + k*(lcm/r);
-            thisLocalBuffer[iLocal+jLocal*thisLDim] = dLocalBuffer[k*dLDim];
-        }
+        const Int diagStride = lcm/c + (lcm/r)*thisLDim;
+        StridedMemCopy
+        ( &thisLocalBuffer[iLocalStart+jLocalStart*thisLDim], diagStride,
+          dLocalBuffer, dLDim, localDiagLength );
     }
 #ifndef RELEASE
     PopCallStack();
@@ -1365,8 +1346,8 @@ DistMatrix<T,MR,MC,Int>::operator=( const DistMatrix<T,MC,MR,Int>& A )
                 const Int offset = (shift-AColShift) / r;
                 const Int thisLocalHeight = RawLocalLength(height,shift,p);
 
-                for( Int iLocal=0; iLocal<thisLocalHeight; ++iLocal )
-                    data[iLocal] = ALocalBuffer[offset+iLocal*c];
+                StridedMemCopy
+                ( data, 1, &ALocalBuffer[offset], c, thisLocalHeight );
             }
         }
 
@@ -1401,8 +1382,8 @@ DistMatrix<T,MR,MC,Int>::operator=( const DistMatrix<T,MC,MR,Int>& A )
                 const Int offset = (shift-thisColShift) / c;
                 const Int thisLocalHeight = RawLocalLength(height,shift,p);
 
-                for( Int iLocal=0; iLocal<thisLocalHeight; ++iLocal )
-                    thisLocalBuffer[offset+iLocal*r] = data[iLocal];
+                StridedMemCopy
+                ( &thisLocalBuffer[offset], r, data, 1, thisLocalHeight );
             }
         }
 
@@ -1455,8 +1436,9 @@ DistMatrix<T,MR,MC,Int>::operator=( const DistMatrix<T,MC,MR,Int>& A )
                 const Int offset = (shift-ARowShift) / c;
                 const Int thisLocalWidth = RawLocalLength(width,shift,p);
 
-                for( Int jLocal=0; jLocal<thisLocalWidth; ++jLocal )
-                    data[jLocal] = ALocalBuffer[(offset+jLocal*r)*ALDim];
+                StridedMemCopy
+                ( data, 1,
+                  &ALocalBuffer[offset*ALDim], r*ALDim, thisLocalWidth );
             }
         }
 
@@ -1492,8 +1474,9 @@ DistMatrix<T,MR,MC,Int>::operator=( const DistMatrix<T,MC,MR,Int>& A )
                 const Int offset = (shift-thisRowShift) / r;
                 const Int thisLocalWidth = RawLocalLength(width,shift,p);
 
-                for( Int jLocal=0; jLocal<thisLocalWidth; ++jLocal )
-                    thisLocalBuffer[(offset+jLocal*c)*thisLDim] = data[jLocal];
+                StridedMemCopy
+                ( &thisLocalBuffer[offset*thisLDim], c*thisLDim,
+                  data, 1, thisLocalWidth );
             }
         }
         this->auxMemory_.Release();
@@ -1912,8 +1895,7 @@ DistMatrix<T,MR,MC,Int>::operator=( const DistMatrix<T,STAR,MC,Int>& A )
         {
             T* destCol = &thisLocalBuffer[jLocal*thisLDim];
             const T* sourceCol = &ALocalBuffer[colShift+jLocal*ALDim];
-            for( Int iLocal=0; iLocal<localHeight; ++iLocal )
-                destCol[iLocal] = sourceCol[iLocal*c];
+            StridedMemCopy( destCol, 1, sourceCol, c, localHeight );
         }
     }
     else
@@ -1955,8 +1937,7 @@ DistMatrix<T,MR,MC,Int>::operator=( const DistMatrix<T,STAR,MC,Int>& A )
         {
             T* destCol = &sendBuffer[jLocal*localHeight];
             const T* sourceCol = &ALocalBuffer[colShift+jLocal];
-            for( Int iLocal=0; iLocal<localHeight; ++iLocal )
-                destCol[iLocal] = sourceCol[iLocal*c];
+            StridedMemCopy( destCol, 1, sourceCol, c, localHeight );
         }
 
         // Communicate
@@ -2083,8 +2064,7 @@ DistMatrix<T,MR,MC,Int>::operator=( const DistMatrix<T,STAR,VC,Int>& A )
             {
                 T* destCol = &data[jLocal*thisLocalHeight];
                 const T* sourceCol = &ALocalBuffer[thisColShift+jLocal*ALDim];
-                for( Int iLocal=0; iLocal<thisLocalHeight; ++iLocal )
-                    destCol[iLocal] = sourceCol[iLocal*c];
+                StridedMemCopy( destCol, 1, sourceCol, c, thisLocalHeight );
             }
         }
 
@@ -2175,8 +2155,7 @@ DistMatrix<T,MR,MC,Int>::operator=( const DistMatrix<T,STAR,VC,Int>& A )
             {
                 T* destCol = &data[jLocal*thisLocalHeight];
                 const T* sourceCol = &ALocalBuffer[thisColShift+jLocal*ALDim];
-                for( Int iLocal=0; iLocal<thisLocalHeight; ++iLocal )
-                    destCol[iLocal] = sourceCol[iLocal*c];
+                StridedMemCopy( destCol, 1, sourceCol, c, thisLocalHeight );
             }
         }
 
@@ -2332,8 +2311,7 @@ DistMatrix<T,MR,MC,Int>::operator=( const DistMatrix<T,VR,STAR,Int>& A )
             {
                 T* destCol = &thisLocalBuffer[thisColOffset+jLocal*thisLDim];
                 const T* sourceCol = &data[jLocal*thisLocalHeight];
-                for( Int iLocal=0; iLocal<thisLocalHeight; ++iLocal )
-                    destCol[iLocal*r] = sourceCol[iLocal];
+                StridedMemCopy( destCol, r, sourceCol, 1, thisLocalHeight );
             }
         }
         this->auxMemory_.Release();
@@ -2428,8 +2406,7 @@ DistMatrix<T,MR,MC,Int>::operator=( const DistMatrix<T,VR,STAR,Int>& A )
             {
                 T* destCol = &thisLocalBuffer[thisColOffset+jLocal*thisLDim];
                 const T* sourceCol = &data[jLocal*thisLocalHeight];
-                for( Int iLocal=0; iLocal<thisLocalHeight; ++iLocal )
-                    destCol[iLocal*r] = sourceCol[iLocal];
+                StridedMemCopy( destCol, r, sourceCol, 1, thisLocalHeight );
             }
         }
         this->auxMemory_.Release();
@@ -2496,8 +2473,7 @@ DistMatrix<T,MR,MC,Int>::operator=( const DistMatrix<T,STAR,STAR,Int>& A )
     {
         T* destCol = &thisLocalBuffer[jLocal*thisLDim];
         const T* sourceCol = &ALocalBuffer[colShift+(rowShift+jLocal*r)*ALDim];
-        for( Int iLocal=0; iLocal<localHeight; ++iLocal )
-            destCol[iLocal] = sourceCol[iLocal*c];
+        StridedMemCopy( destCol, 1, sourceCol, c, localHeight );
     }
 #ifndef RELEASE
     PopCallStack();
@@ -2857,8 +2833,7 @@ DistMatrix<T,MR,MC,Int>::SumScatterFrom( const DistMatrix<T,STAR,MC,Int>& A )
             {
                 T* destCol = &data[jLocal*thisLocalHeight];
                 const T* sourceCol = &ALocalBuffer[thisColShift+jLocal*ALDim];
-                for( Int iLocal=0; iLocal<thisLocalHeight; ++iLocal )
-                    destCol[iLocal] = sourceCol[iLocal*c];
+                StridedMemCopy( destCol, 1, sourceCol, c, thisLocalHeight );
             }
         }
 
@@ -2935,8 +2910,7 @@ DistMatrix<T,MR,MC,Int>::SumScatterFrom( const DistMatrix<T,STAR,MC,Int>& A )
             {
                 T* destCol = &data[jLocal*thisLocalHeight];
                 const T* sourceCol = &ALocalBuffer[thisColShift+jLocal*ALDim];
-                for( Int iLocal=0; iLocal<thisLocalHeight; ++iLocal )
-                    destCol[iLocal] = sourceCol[iLocal*c];
+                StridedMemCopy( destCol, 1, sourceCol, c, thisLocalHeight );
             }
         }
 
@@ -3038,8 +3012,7 @@ DistMatrix<T,MR,MC,Int>::SumScatterFrom( const DistMatrix<T,STAR,STAR,Int>& A )
                 T* destCol = &data[jLocal*thisLocalHeight];
                 const T* sourceCol = 
                     &ALocalBuffer[thisColShift+(thisRowShift+jLocal*r)*ALDim];
-                for( Int iLocal=0; iLocal<thisLocalHeight; ++iLocal )
-                    destCol[iLocal] = sourceCol[iLocal*c];
+                StridedMemCopy( destCol, 1, sourceCol, c, thisLocalHeight );
             }
         }
     }
@@ -3402,8 +3375,7 @@ DistMatrix<T,MR,MC,Int>::SumScatterUpdate
             {
                 T* destCol = &data[jLocal*thisLocalHeight];
                 const T* sourceCol = &ALocalBuffer[thisColShift+jLocal*ALDim];
-                for( Int iLocal=0; iLocal<thisLocalHeight; ++iLocal )
-                    destCol[iLocal] = sourceCol[iLocal*c];
+                StridedMemCopy( destCol, 1, sourceCol, c, thisLocalHeight );
             }
         }
 
@@ -3481,8 +3453,7 @@ DistMatrix<T,MR,MC,Int>::SumScatterUpdate
             {
                 T* destCol = &data[jLocal*thisLocalHeight];
                 const T* sourceCol = &ALocalBuffer[thisColShift+jLocal*ALDim];
-                for( Int iLocal=0; iLocal<thisLocalHeight; ++iLocal )
-                    destCol[iLocal] = sourceCol[iLocal*c];
+                StridedMemCopy( destCol, 1, sourceCol, c, thisLocalHeight );
             }
         }
 
@@ -3586,8 +3557,7 @@ DistMatrix<T,MR,MC,Int>::SumScatterUpdate
                 T* destCol = &data[jLocal*thisLocalHeight];
                 const T* sourceCol = 
                     &ALocalBuffer[thisColShift+(thisRowShift+jLocal*r)*ALDim];
-                for( Int iLocal=0; iLocal<thisLocalHeight; ++iLocal )
-                    destCol[iLocal] = sourceCol[iLocal*c];
+                StridedMemCopy( destCol, 1, sourceCol, c, thisLocalHeight );
             }
         }
     }
@@ -343,8 +343,7 @@ DistMatrix<T,MR,STAR,Int>::PrintBase
         {
             T* destCol = &sendBuf[colShift+j*height];
             const T* sourceCol = &thisLocalBuffer[j*thisLDim];
-            for( Int iLocal=0; iLocal<localHeight; ++iLocal )
-                destCol[iLocal*c] = sourceCol[iLocal];
+            StridedMemCopy( destCol, c, sourceCol, 1, localHeight );
         }
 
         // If we are the root, allocate a receive buffer
@@ -690,31 +689,15 @@ DistMatrix<T,MR,STAR,Int>::TransposeFrom
         const T* ALocalBuffer = A.LockedLocalBuffer();
         const Int ALDim = A.LocalLDim();
         if( conjugate )
-        {
-#ifdef HAVE_OPENMP
-            #pragma omp parallel for 
-#endif
-            for( Int jLocal=0; jLocal<localHeightOfA; ++jLocal )
-            {
-                T* destCol = &originalData[jLocal*localHeight];
-                const T* sourceCol = &ALocalBuffer[jLocal];
-                for( Int iLocal=0; iLocal<localHeight; ++iLocal )
-                    destCol[iLocal] = Conj( sourceCol[iLocal*ALDim] );
-            }
-        }
+            ConjInterleaveMatrix
+            ( localHeight, localHeightOfA,
+              ALocalBuffer, ALDim, 1,
+              originalData, 1, localHeight );
         else
-        {
-#ifdef HAVE_OPENMP
-            #pragma omp parallel for 
-#endif
-            for( Int jLocal=0; jLocal<localHeightOfA; ++jLocal )
-            {
-                T* destCol = &originalData[jLocal*localHeight];
-                const T* sourceCol = &ALocalBuffer[jLocal];
-                for( Int iLocal=0; iLocal<localHeight; ++iLocal )
-                    destCol[iLocal] = sourceCol[iLocal*ALDim];
-            }
-        }
+            InterleaveMatrix
+            ( localHeight, localHeightOfA,
+              ALocalBuffer, ALDim, 1,
+              originalData, 1, localHeight );
 
         // Communicate
         mpi::AllGather
@@ -783,31 +766,15 @@ DistMatrix<T,MR,STAR,Int>::TransposeFrom
         const T* ALocalBuffer = A.LockedLocalBuffer();
         const Int ALDim = A.LocalLDim();
         if( conjugate )
-        {
-#ifdef HAVE_OPENMP
-            #pragma omp parallel for 
-#endif
-            for( Int jLocal=0; jLocal<localHeightOfA; ++jLocal )
-            {
-                T* destCol = &secondBuffer[jLocal*localWidthOfA];
-                const T* sourceCol = &ALocalBuffer[jLocal];
-                for( Int iLocal=0; iLocal<localWidthOfA; ++iLocal )
-                    destCol[iLocal] = Conj( sourceCol[iLocal*ALDim] );
-            }
-        }
+            ConjInterleaveMatrix
+            ( localWidthOfA, localHeightOfA,
+              ALocalBuffer, ALDim, 1,
+              secondBuffer, 1, localWidthOfA );
         else
-        {
- #ifdef HAVE_OPENMP
-            #pragma omp parallel for 
-#endif
-            for( Int jLocal=0; jLocal<localHeightOfA; ++jLocal )
-            {
-                T* destCol = &secondBuffer[jLocal*localWidthOfA];
-                const T* sourceCol = &ALocalBuffer[jLocal];
-                for( Int iLocal=0; iLocal<localWidthOfA; ++iLocal )
-                    destCol[iLocal] = sourceCol[iLocal*ALDim];
-            }
-        }
+            InterleaveMatrix
+            ( localWidthOfA, localHeightOfA,
+              ALocalBuffer, ALDim, 1,
+              secondBuffer, 1, localWidthOfA );
 
         // Perform the SendRecv: puts the new data into the first buffer
         mpi::SendRecv
@@ -937,11 +904,8 @@ DistMatrix<T,MR,STAR,Int>::operator=( const DistMatrix<T,MC,STAR,Int>& A )
             const Int thisLocalHeight = LocalLength(height,shift,p);
 
             const T* ALocalBuffer = A.LockedLocalBuffer();
-#ifdef HAVE_OPENMP
-            #pragma omp parallel for
-#endif
-            for( Int iLocal=0; iLocal<thisLocalHeight; ++iLocal )
-                sendBuf[iLocal] = ALocalBuffer[offset+iLocal*c];
+            StridedMemCopy
+            ( sendBuf, 1, &ALocalBuffer[offset], c, thisLocalHeight );
         }
 
         // A[VR,* ] <- A[VC,* ]
@@ -967,8 +931,8 @@ DistMatrix<T,MR,STAR,Int>::operator=( const DistMatrix<T,MC,STAR,Int>& A )
             const Int offset = (shift-colShift) / c;
             const Int thisLocalHeight = RawLocalLength(height,shift,p);
 
-            for( Int iLocal=0; iLocal<thisLocalHeight; ++iLocal )
-                thisLocalBuffer[offset+iLocal*r] = data[iLocal];
+            StridedMemCopy
+            ( &thisLocalBuffer[offset], r, data, 1, thisLocalHeight );
         }
         this->auxMemory_.Release();
     }
@@ -1093,65 +1057,7 @@ DistMatrix<T,MR,STAR,Int>::operator=( const DistMatrix<T,MR,MC,Int>& A )
 
     if( this->ColAlignment() == A.ColAlignment() )
     {
-        const Int r = g.Height();
-
-        const Int width = this->Width();
-        const Int localHeight = this->LocalHeight();
-        const Int localWidthOfA = A.LocalWidth();
-        const Int maxLocalWidth = MaxLocalLength(width,r);
-
-        const Int portionSize = 
-            std::max(localHeight*maxLocalWidth,mpi::MIN_COLL_MSG);
-
-        this->auxMemory_.Require( (r+1)*portionSize );
-
-        T* buffer = this->auxMemory_.Buffer();
-        T* originalData = &buffer[0];
-        T* gatheredData = &buffer[portionSize];
-
-        // Pack 
-        const T* ALocalBuffer = A.LockedLocalBuffer();
-        const Int ALDim = A.LocalLDim();
-#ifdef HAVE_OPENMP
-        #pragma omp parallel for
-#endif
-        for( Int jLocal=0; jLocal<localWidthOfA; ++jLocal )
-        {
-            const T* ACol = &ALocalBuffer[jLocal*ALDim];
-            T* originalDataCol = &originalData[jLocal*localHeight];
-            MemCopy( originalDataCol, ACol, localHeight );
-        }
-
-        // Communicate
-        mpi::AllGather
-        ( originalData, portionSize,
-          gatheredData, portionSize, g.ColComm() );
-
-        // Unpack
-        const Int rowAlignmentOfA = A.RowAlignment();
-        T* thisLocalBuffer = this->LocalBuffer();
-        const Int thisLDim = this->LocalLDim();
-#if defined(HAVE_OPENMP) && !defined(PARALLELIZE_INNER_LOOPS)
-        #pragma omp parallel for
-#endif
-        for( Int k=0; k<r; ++k )
-        {
-            const T* data = &gatheredData[k*portionSize];
-
-            const Int rowShift = RawShift( k, rowAlignmentOfA, r );
-            const Int localWidth = RawLocalLength( width, rowShift, r );
-
-#if defined(HAVE_OPENMP) && defined(PARALLELIZE_INNER_LOOPS)
-            #pragma omp parallel for
-#endif
-            for( Int jLocal=0; jLocal<localWidth; ++jLocal )
-            {
-                const T* dataCol = &data[jLocal*localHeight];
-                T* thisCol = &thisLocalBuffer[(rowShift+jLocal*r)*thisLDim];
-                MemCopy( thisCol, dataCol, localHeight );
-            }
-        }
-        this->auxMemory_.Release();
+        this->gatherPlan_.ColGather( A, *this, g.ColComm() );
     }
     else
     {
@@ -1509,8 +1415,7 @@ DistMatrix<T,MR,STAR,Int>::operator=( const DistMatrix<T,VR,STAR,Int>& A )
             {
                 T* destCol = &thisLocalBuffer[colOffset+j*thisLDim];
                 const T* sourceCol = &data[j*localHeight];
-                for( Int iLocal=0; iLocal<localHeight; ++iLocal )
-                    destCol[iLocal*r] = sourceCol[iLocal];
+                StridedMemCopy( destCol, r, sourceCol, 1, localHeight );
             }
         }
         this->auxMemory_.Release();
@@ -1593,8 +1498,7 @@ DistMatrix<T,MR,STAR,Int>::operator=( const DistMatrix<T,VR,STAR,Int>& A )
             {
                 T* destCol = &thisLocalBuffer[colOffset+j*thisLDim];
                 const T* sourceCol = &data[j*localHeight];
-                for( Int iLocal=0; iLocal<localHeight; ++iLocal )
-                    destCol[iLocal*r] = sourceCol[iLocal];
+                StridedMemCopy( destCol, r, sourceCol, 1, localHeight );
             }
         }
         this->auxMemory_.Release();
@@ -1665,8 +1569,7 @@ DistMatrix<T,MR,STAR,Int>::operator=( const DistMatrix<T,STAR,STAR,Int>& A )
     {
         T* destCol = &thisLocalBuffer[j*thisLDim];
         const T* sourceCol = &ALocalBuffer[colShift+j*ALDim];
-        for( Int iLocal=0; iLocal<localHeight; ++iLocal )
-            destCol[iLocal] = sourceCol[iLocal*c];
+        StridedMemCopy( destCol, 1, sourceCol, c, localHeight );
     }
 #ifndef RELEASE
     PopCallStack();
@@ -1674,6 +1577,30 @@ DistMatrix<T,MR,STAR,Int>::operator=( const DistMatrix<T,STAR,STAR,Int>& A )
     return *this;
 }
 
+template<typename T,typename Int>
+inline void
+DistMatrix<T,MR,STAR,Int>::BeginRedistribute( const DistMatrix<T,MR,MC,Int>& A )
+{
+#ifndef RELEASE
+    PushCallStack("[MR,* ]::BeginRedistribute( [MR,MC] )");
+    this->AssertNotLockedView();
+    this->AssertSameGrid( A );
+    if( this->Viewing() )
+        this->AssertSameSize( A );
+#endif
+    const elem::Grid& g = this->Grid();
+    // The new alignment is only applied by FinishRedistribute
+    const bool realign = 
+        !this->Viewing() && !this->ConstrainedColAlignment();
+    if( realign || this->ColAlignment() == A.ColAlignment() )
+        this->pendingGather_.BeginColGather( A, g.ColComm(), realign );
+    else
+        *this = A;
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
 //
 // Routines which explicitly work in the complex plane
 //
@@ -0,0 +1,52 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace elem {
+
+// The state of an AllGather-based redistribution which has been started but
+// not yet finished. The 'Begin' routines pack the local data of the source 
+// and start a nonblocking AllGather, and 'Finish' waits on the collective 
+// and unpacks into the target. The target is not modified until Finish is 
+// called. The underlying GatherPlan persists between redistributions so that
+// its index maps are reused.
+//
+// The source and target must be aligned so that the redistribution is a 
+// single AllGather. If 'realign' is passed to a 'Begin' routine, the target
+// is instead given the alignment of the source during Finish.
+template<typename T,typename Int>
+class PendingGather
+{
+public:
+    PendingGather();
+    ~PendingGather();
+
+    // [U,* ] <- [U,V], where comm is the communicator for distribution V
+    void BeginColGather
+    ( const AbstractDistMatrix<T,Int>& A, mpi::Comm comm, bool realign=false );
+
+    // [* ,V] <- [U,V], where comm is the communicator for distribution U
+    void BeginRowGather
+    ( const AbstractDistMatrix<T,Int>& A, mpi::Comm comm, bool realign=false );
+
+    // Wait for the AllGather and unpack into B, which is resized to match A
+    void Finish( AbstractDistMatrix<T,Int>& B );
+
+    bool Active() const;
+
+private:
+    bool active_;
+    bool realignCols_, realignRows_;
+    Int alignment_, shift_;
+    GatherPlan<T,Int> plan_;
+    mpi::Request request_;
+
+    void Begin( const AbstractDistMatrix<T,Int>& A, mpi::Comm comm );
+};
+
+} // namespace elem
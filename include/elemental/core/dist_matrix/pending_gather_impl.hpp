@@ -0,0 +1,148 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace elem {
+
+template<typename T,typename Int>
+inline
+PendingGather<T,Int>::PendingGather()
+: active_(false), realignCols_(false), realignRows_(false), 
+  alignment_(0), shift_(0), request_(mpi::REQUEST_NULL)
+{ }
+
+template<typename T,typename Int>
+inline
+PendingGather<T,Int>::~PendingGather()
+{
+    // Never free buffers which MPI may still be writing into. Since every 
+    // process started the AllGather in Begin, and collectives cannot be 
+    // cancelled, this waits even while the stack is being unwound.
+    if( active_ )
+        mpi::Wait( request_ );
+}
+
+template<typename T,typename Int>
+inline bool
+PendingGather<T,Int>::Active() const
+{ return active_; }
+
+template<typename T,typename Int>
+inline void
+PendingGather<T,Int>::BeginColGather
+( const AbstractDistMatrix<T,Int>& A, mpi::Comm comm, bool realign )
+{
+#ifndef RELEASE
+    PushCallStack("PendingGather::BeginColGather");
+    if( active_ )
+        throw std::logic_error("Previous gather was not finished");
+    if( A.Grid().InGrid() && A.RowStride() != mpi::CommSize( comm ) )
+        throw std::logic_error("Communicator does not match distribution");
+#else
+    PushProfileRegion("PendingGather::BeginColGather");
+#endif
+    plan_.PrepareColGather( A );
+    realignCols_ = realign;
+    realignRows_ = false;
+    alignment_ = A.ColAlignment();
+    shift_ = A.ColShift();
+    Begin( A, comm );
+#ifndef RELEASE
+    PopCallStack();
+#else
+    PopProfileRegion();
+#endif
+}
+
+template<typename T,typename Int>
+inline void
+PendingGather<T,Int>::BeginRowGather
+( const AbstractDistMatrix<T,Int>& A, mpi::Comm comm, bool realign )
+{
+#ifndef RELEASE
+    PushCallStack("PendingGather::BeginRowGather");
+    if( active_ )
+        throw std::logic_error("Previous gather was not finished");
+    if( A.Grid().InGrid() && A.ColStride() != mpi::CommSize( comm ) )
+        throw std::logic_error("Communicator does not match distribution");
+#else
+    PushProfileRegion("PendingGather::BeginRowGather");
+#endif
+    plan_.PrepareRowGather( A );
+    realignRows_ = realign;
+    realignCols_ = false;
+    alignment_ = A.RowAlignment();
+    shift_ = A.RowShift();
+    Begin( A, comm );
+#ifndef RELEASE
+    PopCallStack();
+#else
+    PopProfileRegion();
+#endif
+}
+
+template<typename T,typename Int>
+inline void
+PendingGather<T,Int>::Begin
+( const AbstractDistMatrix<T,Int>& A, mpi::Comm comm )
+{
+    if( A.Grid().InGrid() )
+    {
+        plan_.Pack( A );
+
+        // Start communicating (this completes immediately without 
+        // nonblocking collectives)
+        const Int portionSize = plan_.PortionSize();
+        mpi::IAllGather
+        ( plan_.SendBuffer(), portionSize, plan_.RecvBuffer(), portionSize, 
+          comm, request_ );
+    }
+    active_ = true;
+}
+
+template<typename T,typename Int>
+inline void
+PendingGather<T,Int>::Finish( AbstractDistMatrix<T,Int>& B )
+{
+#ifndef RELEASE
+    PushCallStack("PendingGather::Finish");
+    if( !active_ )
+        throw std::logic_error("No gather was started");
+#else
+    PushProfileRegion("PendingGather::Finish");
+#endif
+    active_ = false;
+    if( realignCols_ )
+    {
+        B.colAlignment_ = alignment_;
+        if( B.Grid().InGrid() )
+            B.colShift_ = shift_;
+    }
+    else if( realignRows_ )
+    {
+        B.rowAlignment_ = alignment_;
+        if( B.Grid().InGrid() )
+            B.rowShift_ = shift_;
+    }
+    realignCols_ = false;
+    realignRows_ = false;
+    if( !B.Viewing() )
+        B.ResizeTo( plan_.Height(), plan_.Width() );
+    if( B.Grid().InGrid() )
+    {
+        mpi::Wait( request_ );
+        plan_.Unpack( B );
+    }
+#ifndef RELEASE
+    PopCallStack();
+#else
+    PopProfileRegion();
+#endif
+}
+
+} // namespace elem
@@ -96,6 +96,13 @@ public:
     const DistMatrix<T,STAR,MC,Int>& 
     operator=( const DistMatrix<T,STAR,STAR,Int>& A );
 
+    // Start an asynchronous redistribution, which must be completed with
+    // FinishRedistribute before this matrix is otherwise used. This matrix
+    // is not modified until then unless its alignment is constrained and 
+    // does not match, in which case the redistribution is performed 
+    // immediately.
+    void BeginRedistribute( const DistMatrix<T,MR,MC,Int>& A );
+
     //------------------------------------------------------------------------//
     // Fulfillments of abstract virtual func's from AbstractDistMatrix        //
     //------------------------------------------------------------------------//
@@ -825,31 +825,15 @@ DistMatrix<T,STAR,MC,Int>::TransposeFrom
         const T* ALocalBuffer = A.LockedLocalBuffer();
         const Int ALDim = A.LocalLDim();
         if( conjugate )
-        {
-#ifdef HAVE_OPENMP
-            #pragma omp parallel for 
-#endif
-            for( Int jLocal=0; jLocal<localHeightOfA; ++jLocal )
-            {
-                T* destCol = &originalData[jLocal*height];
-                const T* sourceCol = &ALocalBuffer[jLocal];
-                for( Int i=0; i<height; ++i )
-                    destCol[i] = Conj( sourceCol[i*ALDim] );
-            }
-        }
+            ConjInterleaveMatrix
+            ( height, localHeightOfA,
+              ALocalBuffer, ALDim, 1,
+              originalData, 1, height );
         else
-        {
- #ifdef HAVE_OPENMP
-            #pragma omp parallel for 
-#endif
-            for( Int jLocal=0; jLocal<localHeightOfA; ++jLocal )
-            {
-                T* destCol = &originalData[jLocal*height];
-                const T* sourceCol = &ALocalBuffer[jLocal];
-                for( Int i=0; i<height; ++i )
-                    destCol[i] = sourceCol[i*ALDim];
-            }
-        }
+            InterleaveMatrix
+            ( height, localHeightOfA,
+              ALocalBuffer, ALDim, 1,
+              originalData, 1, height );
 
         // Communicate
         mpi::AllGather
@@ -922,31 +906,15 @@ DistMatrix<T,STAR,MC,Int>::TransposeFrom
         const T* ALocalBuffer = A.LockedLocalBuffer();
         const Int ALDim = A.LocalLDim();
         if( conjugate )
-        {
-#ifdef HAVE_OPENMP
-            #pragma omp parallel for 
-#endif
-            for( Int jLocal=0; jLocal<localHeightOfA; ++jLocal )
-            {
-                T* destCol = &secondBuffer[jLocal*height];
-                const T* sourceCol = &ALocalBuffer[jLocal];
-                for( Int i=0; i<height; ++i )
-                    destCol[i] = Conj( sourceCol[i*ALDim] );
-            }
-        }
+            ConjInterleaveMatrix
+            ( height, localHeightOfA,
+              ALocalBuffer, ALDim, 1,
+              secondBuffer, 1, height );
         else
-        {
-#ifdef HAVE_OPENMP
-            #pragma omp parallel for 
-#endif
-            for( Int jLocal=0; jLocal<localHeightOfA; ++jLocal )
-            {
-                T* destCol = &secondBuffer[jLocal*height];
-                const T* sourceCol = &ALocalBuffer[jLocal];
-                for( Int i=0; i<height; ++i )
-                    destCol[i] = sourceCol[i*ALDim];
-            }
-        }
+            InterleaveMatrix
+            ( height, localHeightOfA,
+              ALocalBuffer, ALDim, 1,
+              secondBuffer, 1, height );
 
         // Perform the SendRecv: puts the new data into the first buffer
         mpi::SendRecv
@@ -1108,11 +1076,9 @@ DistMatrix<T,STAR,MC,Int>::operator=( const DistMatrix<T,STAR,MR,Int>& A )
 
             const T* ALocalBuffer = A.LockedLocalBuffer();
             const Int ALDim = A.LocalLDim();
-#ifdef HAVE_OPENMP
-            #pragma omp parallel for
-#endif
-            for( Int jLocal=0; jLocal<thisLocalWidth; ++jLocal )
-                sendBuf[jLocal] = ALocalBuffer[(offset+jLocal*r)*ALDim];
+            StridedMemCopy
+            ( sendBuf, 1,
+              &ALocalBuffer[offset*ALDim], r*ALDim, thisLocalWidth );
         }
 
         // A[* ,VC] <- A[* ,VR]
@@ -1139,8 +1105,9 @@ DistMatrix<T,STAR,MC,Int>::operator=( const DistMatrix<T,STAR,MR,Int>& A )
             const Int offset = (shift-rowShift) / r;
             const Int thisLocalWidth = RawLocalLength(width,shift,p);
 
-            for( Int jLocal=0; jLocal<thisLocalWidth; ++jLocal )
-                thisLocalBuffer[(offset+jLocal*c)*thisLDim] = data[jLocal];
+            StridedMemCopy
+            ( &thisLocalBuffer[offset*thisLDim], c*thisLDim,
+              data, 1, thisLocalWidth );
         }
         this->auxMemory_.Release();
     }
@@ -1251,65 +1218,7 @@ DistMatrix<T,STAR,MC,Int>::operator=( const DistMatrix<T,MR,MC,Int>& A )
 
     if( this->RowAlignment() == A.RowAlignment() )
     {
-        const Int c = g.Width();
-        const Int height = this->Height();
-        const Int localWidth = this->LocalWidth();
-        const Int localHeightOfA = A.LocalHeight();
-        const Int maxLocalHeightOfA = MaxLocalLength(height,c);
-
-        const Int portionSize = 
-            std::max(maxLocalHeightOfA*localWidth,mpi::MIN_COLL_MSG);
-
-        this->auxMemory_.Require( (c+1)*portionSize );
-
-        T* buffer = this->auxMemory_.Buffer();
-        T* originalData = &buffer[0];
-        T* gatheredData = &buffer[portionSize];
-
-        // Pack
-        const T* ALocalBuffer = A.LockedLocalBuffer();
-        const Int ALDim = A.LocalLDim();
-#ifdef HAVE_OPENMP
-        #pragma omp parallel for
-#endif
-        for( Int jLocal=0; jLocal<localWidth; ++jLocal )
-        {
-            const T* ACol = &ALocalBuffer[jLocal*ALDim];
-            T* originalDataCol = &originalData[jLocal*localHeightOfA];
-            MemCopy( originalDataCol, ACol, localHeightOfA );
-        }
-
-        // Communicate
-        mpi::AllGather
-        ( originalData, portionSize,
-          gatheredData, portionSize, g.RowComm() );
-
-        // Unpack
-        const Int colAlignmentOfA = A.ColAlignment();
-        T* thisLocalBuffer = this->LocalBuffer();
-        const Int thisLDim = this->LocalLDim();
-#if defined(HAVE_OPENMP) && !defined(PARALLELIZE_INNER_LOOPS)
-        #pragma omp parallel for
-#endif
-        for( Int k=0; k<c; ++k )
-        {
-            const T* data = &gatheredData[k*portionSize];
-
-            const Int colShift = RawShift( k, colAlignmentOfA, c );
-            const Int localHeight = RawLocalLength( height, colShift, c );
-
-#if defined(HAVE_OPENMP) && defined(PARALLELIZE_INNER_LOOPS)
-            #pragma omp parallel for 
-#endif
-            for( Int jLocal=0; jLocal<localWidth; ++jLocal )
-            {
-                T* destCol = &thisLocalBuffer[colShift+jLocal*thisLDim];
-                const T* sourceCol = &data[jLocal*localHeight];
-                for( Int iLocal=0; iLocal<localHeight; ++iLocal )
-                    destCol[iLocal*c] = sourceCol[iLocal];
-            }
-        }
-        this->auxMemory_.Release();
+        this->gatherPlan_.RowGather( A, *this, g.RowComm() );
     }
     else
     {
@@ -1386,8 +1295,7 @@ DistMatrix<T,STAR,MC,Int>::operator=( const DistMatrix<T,MR,MC,Int>& A )
             {
                 T* destCol = &thisLocalBuffer[colShift+jLocal*thisLDim];
                 const T* sourceCol = &data[jLocal*localHeight];
-                for( Int iLocal=0; iLocal<localHeight; ++iLocal )
-                    destCol[iLocal*c] = sourceCol[iLocal];
+                StridedMemCopy( destCol, c, sourceCol, 1, localHeight );
             }
         }
         this->auxMemory_.Release();
@@ -1823,6 +1731,30 @@ DistMatrix<T,STAR,MC,Int>::operator=( const DistMatrix<T,STAR,STAR,Int>& A )
     return *this;
 }
 
+template<typename T,typename Int>
+inline void
+DistMatrix<T,STAR,MC,Int>::BeginRedistribute( const DistMatrix<T,MR,MC,Int>& A )
+{
+#ifndef RELEASE
+    PushCallStack("[* ,MC]::BeginRedistribute( [MR,MC] )");
+    this->AssertNotLockedView();
+    this->AssertSameGrid( A );
+    if( this->Viewing() )
+        this->AssertSameSize( A );
+#endif
+    const elem::Grid& g = this->Grid();
+    // The new alignment is only applied by FinishRedistribute
+    const bool realign = 
+        !this->Viewing() && !this->ConstrainedRowAlignment();
+    if( realign || this->RowAlignment() == A.RowAlignment() )
+        this->pendingGather_.BeginRowGather( A, g.RowComm(), realign );
+    else
+        *this = A;
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
 //
 // Routines which explicitly work in the complex plane
 //
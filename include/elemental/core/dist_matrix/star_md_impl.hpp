@@ -444,8 +444,7 @@ DistMatrix<T,STAR,MD,Int>::PrintBase
         {
             T* destCol = &sendBuf[colShift+jLocal*lcm*height];
             const T* sourceCol = &thisLocalBuffer[jLocal*thisLDim];
-            for( Int i=0; i<height; ++i )
-                destCol[i] = sourceCol[i];
+            MemCopy( destCol, sourceCol, height );
         }
     }
 
@@ -695,31 +695,15 @@ DistMatrix<T,STAR,MR,Int>::TransposeFrom
         const T* ALocalBuffer = A.LockedLocalBuffer();
         const Int ALDim = A.LocalLDim();
         if( conjugate )
-        {
-#ifdef HAVE_OPENMP
-            #pragma omp parallel for
-#endif
-            for( Int jLocal=0; jLocal<localHeightOfA; ++jLocal )
-            {
-                T* destCol = &originalData[jLocal*height];
-                const T* sourceCol = &ALocalBuffer[jLocal];
-                for( Int i=0; i<height; ++i )
-                    destCol[i] = Conj( sourceCol[i*ALDim] );
-            }
-        }
+            ConjInterleaveMatrix
+            ( height, localHeightOfA,
+              ALocalBuffer, ALDim, 1,
+              originalData, 1, height );
         else
-        {
-#ifdef HAVE_OPENMP
-            #pragma omp parallel for
-#endif
-            for( Int jLocal=0; jLocal<localHeightOfA; ++jLocal )
-            {
-                T* destCol = &originalData[jLocal*height];
-                const T* sourceCol = &ALocalBuffer[jLocal];
-                for( Int i=0; i<height; ++i )
-                    destCol[i] = sourceCol[i*ALDim];
-            }
-        }
+            InterleaveMatrix
+            ( height, localHeightOfA,
+              ALocalBuffer, ALDim, 1,
+              originalData, 1, height );
 
         // Communicate
         mpi::AllGather
@@ -792,31 +776,15 @@ DistMatrix<T,STAR,MR,Int>::TransposeFrom
         const T* ALocalBuffer = A.LockedLocalBuffer();
         const Int ALDim = A.LocalLDim();
         if( conjugate )
-        {
-#ifdef HAVE_OPENMP
-            #pragma omp parallel for
-#endif
-            for( Int jLocal=0; jLocal<localHeightOfA; ++jLocal )
-            {
-                T* destCol = &secondBuffer[jLocal*height];
-                const T* sourceCol = &ALocalBuffer[jLocal];
-                for( Int i=0; i<height; ++i )
-                    destCol[i] = Conj( sourceCol[i*ALDim] );
-            }
-        }
+            ConjInterleaveMatrix
+            ( height, localHeightOfA,
+              ALocalBuffer, ALDim, 1,
+              secondBuffer, 1, height );
         else
-        {
-#ifdef HAVE_OPENMP
-            #pragma omp parallel for
-#endif
-            for( Int jLocal=0; jLocal<localHeightOfA; ++jLocal )
-            {
-                T* destCol = &secondBuffer[jLocal*height];
-                const T* sourceCol = &ALocalBuffer[jLocal];
-                for( Int i=0; i<height; ++i )
-                    destCol[i] = sourceCol[i*ALDim];
-            }
-        }
+            InterleaveMatrix
+            ( height, localHeightOfA,
+              ALocalBuffer, ALDim, 1,
+              secondBuffer, 1, height );
 
         // Perform the SendRecv: puts the new data into the first buffer
         mpi::SendRecv
@@ -916,11 +884,8 @@ DistMatrix<T,STAR,MR,Int>::operator=( const DistMatrix<T,MC,MR,Int>& A )
                 // Pack
                 const T* thisLocalBuffer = this->LockedLocalBuffer();
                 const Int thisLDim = this->LocalLDim();
-#ifdef HAVE_OPENMP
-                #pragma omp parallel for
-#endif
-                for( Int jLocal=0; jLocal<localWidth; ++jLocal )
-                    bcastBuf[jLocal] = thisLocalBuffer[jLocal*thisLDim];
+                StridedMemCopy
+                ( bcastBuf, 1, thisLocalBuffer, thisLDim, localWidth );
             }
 
             // Communicate
@@ -930,75 +895,14 @@ DistMatrix<T,STAR,MR,Int>::operator=( const DistMatrix<T,MC,MR,Int>& A )
             // Unpack
             T* thisLocalBuffer = this->LocalBuffer();
             const Int thisLDim = this->LocalLDim();
-#ifdef HAVE_OPENMP
-            #pragma omp parallel for
-#endif
-            for( Int jLocal=0; jLocal<localWidth; ++jLocal )
-                thisLocalBuffer[jLocal*thisLDim] = bcastBuf[jLocal];
+            StridedMemCopy
+            ( thisLocalBuffer, thisLDim, bcastBuf, 1, localWidth );
 
             this->auxMemory_.Release();
         }
         else
         {
-            const Int r = g.Height();
-            const Int height = this->Height();
-            const Int localWidth = this->LocalWidth();
-            const Int localHeightOfA = A.LocalHeight();
-            const Int maxLocalHeight = MaxLocalLength(height,r);
-
-            const Int portionSize = 
-                std::max(maxLocalHeight*localWidth,mpi::MIN_COLL_MSG);
-
-            this->auxMemory_.Require( (r+1)*portionSize );
-
-            T* buffer = this->auxMemory_.Buffer();
-            T* originalData = &buffer[0];
-            T* gatheredData = &buffer[portionSize];
-
-            // Pack 
-            const T* ALocalBuffer = A.LockedLocalBuffer();
-            const Int ALDim = A.LocalLDim();
-#ifdef HAVE_OPENMP
-            #pragma omp parallel for
-#endif
-            for( Int jLocal=0; jLocal<localWidth; ++jLocal )
-            {
-                const T* ACol = &ALocalBuffer[jLocal*ALDim];
-                T* originalDataCol = &originalData[jLocal*localHeightOfA];
-                MemCopy( originalDataCol, ACol, localHeightOfA );
-            }
-
-            // Communicate
-            mpi::AllGather
-            ( originalData, portionSize,
-              gatheredData, portionSize, g.ColComm() );
-
-            // Unpack
-            const Int colAlignmentOfA = A.ColAlignment();
-            T* thisLocalBuffer = this->LocalBuffer();
-            const Int thisLDim = this->LocalLDim();
-#if defined(HAVE_OPENMP) && !defined(PARALLELIZE_INNER_LOOPS)
-            #pragma omp parallel for
-#endif
-            for( Int k=0; k<r; ++k )
-            {
-                const T* data = &gatheredData[k*portionSize];
-
-                const Int colShift = RawShift( k, colAlignmentOfA, r );
-                const Int localHeight = RawLocalLength( height, colShift, r );
-
-#if defined(HAVE_OPENMP) && defined(PARALLELIZE_INNER_LOOPS)
-                #pragma omp parallel for
-#endif
-                for( Int jLocal=0; jLocal<localWidth; ++jLocal )
-                {
-                    T* destCol = &thisLocalBuffer[colShift+jLocal*thisLDim];
-                    const T* sourceCol = &data[jLocal*localHeight];
-                    for( Int iLocal=0; iLocal<localHeight; ++iLocal )
-                        destCol[iLocal*r] = sourceCol[iLocal];
-                }
-            }
-            this->auxMemory_.Release();
+            this->gatherPlan_.RowGather( A, *this, g.ColComm() );
         }
     }
     else
@@ -1033,11 +937,8 @@ DistMatrix<T,STAR,MR,Int>::operator=( const DistMatrix<T,MC,MR,Int>& A )
                 // Pack
                 const T* ALocalBuffer = A.LockedLocalBuffer();
                 const Int ALDim = A.LocalLDim();
-#ifdef HAVE_OPENMP
-                #pragma omp parallel for
-#endif
-                for( Int jLocal=0; jLocal<localWidthOfA; ++jLocal )
-                    sendBuf[jLocal] = ALocalBuffer[jLocal*ALDim];
+                StridedMemCopy
+                ( sendBuf, 1, ALocalBuffer, ALDim, localWidthOfA );
 
                 // Communicate
                 mpi::SendRecv
@@ -1058,11 +959,8 @@ DistMatrix<T,STAR,MR,Int>::operator=( const DistMatrix<T,MC,MR,Int>& A )
             // Unpack
             T* thisLocalBuffer = this->LocalBuffer();
             const Int thisLDim = this->LocalLDim();
-#ifdef HAVE_OPENMP
-            #pragma omp parallel for
-#endif
-            for( Int jLocal=0; jLocal<localWidth; ++jLocal )
-                thisLocalBuffer[jLocal*thisLDim] = bcastBuf[jLocal];
+            StridedMemCopy
+            ( thisLocalBuffer, thisLDim, bcastBuf, 1, localWidth );
             this->auxMemory_.Release();
         }
         else
@@ -1125,8 +1023,7 @@ DistMatrix<T,STAR,MR,Int>::operator=( const DistMatrix<T,MC,MR,Int>& A )
                 {
                     T* destCol = &thisLocalBuffer[colShift+jLocal*thisLDim];
                     const T* sourceCol = &data[jLocal*localHeight];
-                    for( Int iLocal=0; iLocal<localHeight; ++iLocal )
-                        destCol[iLocal*r] = sourceCol[iLocal];
+                    StridedMemCopy( destCol, r, sourceCol, 1, localHeight );
                 }
             }
             this->auxMemory_.Release();
@@ -1696,6 +1593,30 @@ DistMatrix<T,STAR,MR,Int>::operator=( const DistMatrix<T,STAR,STAR,Int>& A )
     return *this;
 }
 
+template<typename T,typename Int>
+inline void
+DistMatrix<T,STAR,MR,Int>::BeginRedistribute( const DistMatrix<T,MC,MR,Int>& A )
+{
+#ifndef RELEASE
+    PushCallStack("[* ,MR]::BeginRedistribute( [MC,MR] )");
+    this->AssertNotLockedView();
+    this->AssertSameGrid( A );
+    if( this->Viewing() )
+        this->AssertSameSize( A );
+#endif
+    const elem::Grid& g = this->Grid();
+    // The new alignment is only applied by FinishRedistribute
+    const bool realign = 
+        !this->Viewing() && !this->ConstrainedRowAlignment();
+    if( realign || this->RowAlignment() == A.RowAlignment() )
+        this->pendingGather_.BeginRowGather( A, g.ColComm(), realign );
+    else
+        *this = A;
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
 //
 // Routines which explicitly work in the complex plane
 //
@@ -80,6 +80,17 @@ public:
     const DistMatrix<T,STAR,STAR,Int>& 
     operator=( const DistMatrix<T,STAR,STAR,Int>& A );
 
+    // Start an asynchronous redistribution, which must be completed with
+    // FinishRedistribute before this matrix is otherwise used
+    void BeginRedistribute( const DistMatrix<T,MC,STAR,Int>& A );
+    void BeginRedistribute( const DistMatrix<T,MR,STAR,Int>& A );
+    void BeginRedistribute( const DistMatrix<T,STAR,MC,Int>& A );
+    void BeginRedistribute( const DistMatrix<T,STAR,MR,Int>& A );
+    void BeginRedistribute( const DistMatrix<T,VC,STAR,Int>& A );
+    void BeginRedistribute( const DistMatrix<T,VR,STAR,Int>& A );
+    void BeginRedistribute( const DistMatrix<T,STAR,VC,Int>& A );
+    void BeginRedistribute( const DistMatrix<T,STAR,VR,Int>& A );
+
     //------------------------------------------------------------------------//
     // Fulfillments of abstract virtual func's from AbstractDistMatrix        //
     //------------------------------------------------------------------------//
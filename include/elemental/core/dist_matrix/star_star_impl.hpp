@@ -356,8 +356,7 @@ DistMatrix<T,STAR,STAR,Int>::operator=( const DistMatrix<T,MC,MR,Int>& A )
                 T* destCol = 
                     &thisLocalBuffer[colShift+(rowShift+jLocal*c)*thisLDim];
                 const T* sourceCol = &data[jLocal*localHeight];
-                for( Int iLocal=0; iLocal<localHeight; ++iLocal )
-                    destCol[iLocal*r] = sourceCol[iLocal];
+                StridedMemCopy( destCol, r, sourceCol, 1, localHeight );
             }
         }
     }
@@ -390,64 +389,7 @@ DistMatrix<T,STAR,STAR,Int>::operator=( const DistMatrix<T,MC,STAR,Int>& A )
         return *this;
     }
 
-    const Int r = g.Height();
-    const Int height = this->Height();
-    const Int width = this->Width();
-    const Int localHeightOfA = A.LocalHeight();
-    const Int maxLocalHeight = MaxLocalLength(height,r);
-
-    const Int portionSize = std::max(maxLocalHeight*width,mpi::MIN_COLL_MSG);
-
-    this->auxMemory_.Require( (r+1)*portionSize );
-
-    T* buffer = this->auxMemory_.Buffer();
-    T* originalData = &buffer[0];
-    T* gatheredData = &buffer[portionSize];
-
-    // Pack
-    const T* ALocalBuffer = A.LockedLocalBuffer();
-    const Int ALDim = A.LocalLDim();
-#ifdef HAVE_OPENMP
-    #pragma omp parallel for
-#endif
-    for( Int j=0; j<width; ++j )
-    {
-        const T* ACol = &ALocalBuffer[j*ALDim];
-        T* originalDataCol = &originalData[j*localHeightOfA];
-        MemCopy( originalDataCol, ACol, localHeightOfA );
-    }
-
-    // Communicate
-    mpi::AllGather
-    ( originalData, portionSize,
-      gatheredData, portionSize, g.ColComm() );
-
-    // Unpack
-    const Int colAlignmentOfA = A.ColAlignment();
-    T* thisLocalBuffer = this->LocalBuffer();
-    const Int thisLDim = this->LocalLDim();
-#if defined(HAVE_OPENMP) && !defined(PARALLELIZE_INNER_LOOPS)
-    #pragma omp parallel for
-#endif
-    for( Int k=0; k<r; ++k )
-    {
-        const T* data = &gatheredData[k*portionSize];
-
-        const Int colShift = RawShift( k, colAlignmentOfA, r );
-        const Int localHeight = RawLocalLength( height, colShift, r );
-
-#if defined(HAVE_OPENMP) && defined(PARALLELIZE_INNER_LOOPS)
-        #pragma omp parallel for
-#endif
-        for( Int j=0; j<width; ++j )
-        {
-            T* destCol = &thisLocalBuffer[colShift+j*thisLDim];
-            const T* sourceCol = &data[j*localHeight];
-            for( Int iLocal=0; iLocal<localHeight; ++iLocal )
-                destCol[iLocal*r] = sourceCol[iLocal];
-        }
-    }
-    this->auxMemory_.Release();
+    this->gatherPlan_.RowGather( A, *this, g.ColComm() );
 #ifndef RELEASE
     PopCallStack();
 #endif
@@ -476,63 +418,7 @@ DistMatrix<T,STAR,STAR,Int>::operator=( const DistMatrix<T,STAR,MR,Int>& A )
         return *this;
     }
 
-    const Int c = g.Width();
-    const Int height = this->Height();
-    const Int width = this->Width();
-    const Int localWidthOfA = A.LocalWidth();
-    const Int maxLocalWidth = MaxLocalLength(width,c);
-
-    const Int portionSize = std::max(height*maxLocalWidth,mpi::MIN_COLL_MSG);
-
-    this->auxMemory_.Require( (c+1)*portionSize );
-
-    T* buffer = this->auxMemory_.Buffer();
-    T* originalData = &buffer[0];
-    T* gatheredData = &buffer[portionSize];
-
-    // Pack
-    const T* ALocalBuffer = A.LockedLocalBuffer();
-    const Int ALDim = A.LocalLDim();
-#ifdef HAVE_OPENMP
-    #pragma omp parallel for
-#endif
-    for( Int jLocal=0; jLocal<localWidthOfA; ++jLocal )
-    {
-        const T* ACol = &ALocalBuffer[jLocal*ALDim];
-        T* originalDataCol = &originalData[jLocal*height];
-        MemCopy( originalDataCol, ACol, height );
-    }
-
-    // Communicate
-    mpi::AllGather
-    ( originalData, portionSize,
-      gatheredData, portionSize, g.RowComm() );
-
-    // Unpack
-    const Int rowAlignmentOfA = A.RowAlignment();
-    T* thisLocalBuffer = this->LocalBuffer();
-    const Int thisLDim = this->LocalLDim();
-#if defined(HAVE_OPENMP) && !defined(PARALLELIZE_INNER_LOOPS)
-    #pragma omp parallel for
-#endif
-    for( Int k=0; k<c; ++k )
-    {
-        const T* data = &gatheredData[k*portionSize];
-
-        const Int rowShift = RawShift( k, rowAlignmentOfA, c );
-        const Int localWidth = RawLocalLength( width, rowShift, c );
-
-#if defined(HAVE_OPENMP) && defined(PARALLELIZE_INNER_LOOPS)
-        #pragma omp parallel for
-#endif
-        for( Int jLocal=0; jLocal<localWidth; ++jLocal )
-        {
-            const T* dataCol = &data[jLocal*height];
-            T* thisCol = &thisLocalBuffer[(rowShift+jLocal*c)*thisLDim];
-            MemCopy( thisCol, dataCol, height );
-        }
-    }
-    this->auxMemory_.Release();
+    this->gatherPlan_.ColGather( A, *this, g.RowComm() );
 #ifndef RELEASE
     PopCallStack();
 #endif
@@ -626,8 +512,7 @@ DistMatrix<T,STAR,STAR,Int>::operator=( const DistMatrix<T,MD,STAR,Int>& A )
             {
                 T* destCol = &thisLocalBuffer[thisColShift+j*thisLDim];
                 const T* sourceCol = &data[j*thisLocalHeight];
-                for( Int iLocal=0; iLocal<thisLocalHeight; ++iLocal )
-                    destCol[iLocal*lcm] = sourceCol[iLocal];
+                StridedMemCopy( destCol, lcm, sourceCol, 1, thisLocalHeight );
             }
         }
     }
@@ -825,8 +710,7 @@ DistMatrix<T,STAR,STAR,Int>::operator=( const DistMatrix<T,MR,MC,Int>& A )
                 T* destCol = 
                     &thisLocalBuffer[colShift+(rowShift+jLocal*r)*thisLDim];
                 const T* sourceCol = &data[jLocal*localHeight];
-                for( Int iLocal=0; iLocal<localHeight; ++iLocal )
-                    destCol[iLocal*c] = sourceCol[iLocal];
+                StridedMemCopy( destCol, c, sourceCol, 1, localHeight );
             }
         }
     }
@@ -859,64 +743,7 @@ DistMatrix<T,STAR,STAR,Int>::operator=( const DistMatrix<T,MR,STAR,Int>& A )
         return *this;
     }
 
-    const Int c = g.Width();
-    const Int height = this->Height();
-    const Int width = this->Width();
-    const Int localHeightOfA = A.LocalHeight();
-    const Int maxLocalHeight = MaxLocalLength(height,c);
-
-    const Int portionSize = std::max(maxLocalHeight*width,mpi::MIN_COLL_MSG);
-
-    this->auxMemory_.Require( (c+1)*portionSize );
-
-    T* buffer = this->auxMemory_.Buffer();
-    T* originalData = &buffer[0];
-    T* gatheredData = &buffer[portionSize];
-
-    // Pack
-    const T* ALocalBuffer = A.LockedLocalBuffer();
-    const Int ALDim = A.LocalLDim();
-#ifdef HAVE_OPENMP
-    #pragma omp parallel for
-#endif
-    for( Int j=0; j<width; ++j )
-    {
-        const T* ACol = &ALocalBuffer[j*ALDim];
-        T* originalDataCol = &originalData[j*localHeightOfA];
-        MemCopy( originalDataCol, ACol, localHeightOfA );
-    }
-
-    // Communicate
-    mpi::AllGather
-    ( originalData, portionSize,
-      gatheredData, portionSize, g.RowComm() );
-
-    // Unpack
-    const Int colAlignmentOfA = A.ColAlignment();
-    T* thisLocalBuffer = this->LocalBuffer();
-    const Int thisLDim = this->LocalLDim();
-#if defined(HAVE_OPENMP) && !defined(PARALLELIZE_INNER_LOOPS)
-    #pragma omp parallel for
-#endif
-    for( Int k=0; k<c; ++k )
-    {
-        const T* data = &gatheredData[k*portionSize];
-
-        const Int colShift = RawShift( k, colAlignmentOfA, c );
-        const Int localHeight = RawLocalLength( height, colShift, c );
-
-#if defined(HAVE_OPENMP) && defined(PARALLELIZE_INNER_LOOPS)
-        #pragma omp parallel for
-#endif
-        for( Int j=0; j<width; ++j )
-        {
-            T* destCol = &thisLocalBuffer[colShift+j*thisLDim];
-            const T* sourceCol = &data[j*localHeight];
-            for( Int iLocal=0; iLocal<localHeight; ++iLocal )
-                destCol[iLocal*c] = sourceCol[iLocal];
-        }
-    }
-    this->auxMemory_.Release();
+    this->gatherPlan_.RowGather( A, *this, g.RowComm() );
 #ifndef RELEASE
     PopCallStack();
 #endif
@@ -945,63 +772,7 @@ DistMatrix<T,STAR,STAR,Int>::operator=( const DistMatrix<T,STAR,MC,Int>& A )
         return *this;
     }
 
-    const Int r = g.Height();
-    const Int height = this->Height();
-    const Int width = this->Width();
-    const Int localWidthOfA = A.LocalWidth();
-    const Int maxLocalWidth = MaxLocalLength(width,r);
-
-    const Int portionSize = std::max(height*maxLocalWidth,mpi::MIN_COLL_MSG);
-
-    this->auxMemory_.Require( (r+1)*portionSize );
-
-    T* buffer = this->auxMemory_.Buffer();
-    T* originalData = &buffer[0];
-    T* gatheredData = &buffer[portionSize];
-
-    // Pack
-    const T* ALocalBuffer = A.LockedLocalBuffer();
-    const Int ALDim = A.LocalLDim();
-#ifdef HAVE_OPENMP
-    #pragma omp parallel for
-#endif
-    for( Int jLocal=0; jLocal<localWidthOfA; ++jLocal )
-    {
-        const T* ACol = &ALocalBuffer[jLocal*ALDim];
-        T* originalDataCol = &originalData[jLocal*height];
-        MemCopy( originalDataCol, ACol, height );
-    }
-
-    // Communicate
-    mpi::AllGather
-    ( originalData, portionSize,
-      gatheredData, portionSize, g.ColComm() );
-
-    // Unpack
-    const Int rowAlignmentOfA = A.RowAlignment();
-    T* thisLocalBuffer = this->LocalBuffer();
-    const Int thisLDim = this->LocalLDim();
-#if defined(HAVE_OPENMP) && !defined(PARALLELIZE_INNER_LOOPS)
-    #pragma omp parallel for
-#endif
-    for( Int k=0; k<r; ++k )
-    {
-        const T* data = &gatheredData[k*portionSize];
-
-        const Int rowShift = RawShift( k, rowAlignmentOfA, r );
-        const Int localWidth = RawLocalLength( width, rowShift, r );
-
-#if defined(HAVE_OPENMP) && defined(PARALLELIZE_INNER_LOOPS)
-        #pragma omp parallel for
-#endif
-        for( Int jLocal=0; jLocal<localWidth; ++jLocal )
-        {
-            const T* dataCol = &data[jLocal*height];
-            T* thisCol = &thisLocalBuffer[(rowShift+jLocal*r)*thisLDim];
-            MemCopy( thisCol, dataCol, height );
-        }
-    }
-    this->auxMemory_.Release();
+    this->gatherPlan_.ColGather( A, *this, g.ColComm() );
 #ifndef RELEASE
     PopCallStack();
 #endif
@@ -1030,64 +801,7 @@ DistMatrix<T,STAR,STAR,Int>::operator=( const DistMatrix<T,VC,STAR,Int>& A )
         return *this;
     }
 
-    const Int p = g.Size();
-    const Int height = this->Height();
-    const Int width = this->Width();
-    const Int localHeightOfA = A.LocalHeight();
-    const Int maxLocalHeight = MaxLocalLength(height,p);
-
-    const Int portionSize = std::max(maxLocalHeight*width,mpi::MIN_COLL_MSG);
-
-    this->auxMemory_.Require( (p+1)*portionSize );
-
-    T* buffer = this->auxMemory_.Buffer();
-    T* originalData = &buffer[0];
-    T* gatheredData = &buffer[portionSize];
-
-    // Pack
-    const T* ALocalBuffer = A.LockedLocalBuffer();
-    const Int ALDim = A.LocalLDim();
-#ifdef HAVE_OPENMP
-    #pragma omp parallel for
-#endif
-    for( Int j=0; j<width; ++j )
-    {
-        const T* ACol = &ALocalBuffer[j*ALDim];
-        T* originalDataCol = &originalData[j*localHeightOfA];
-        MemCopy( originalDataCol, ACol, localHeightOfA );
-    }
-
-    // Communicate
-    mpi::AllGather
-    ( originalData, portionSize,
-      gatheredData, portionSize, g.VCComm() );
-
-    // Unpack
-    const Int colAlignmentOfA = A.ColAlignment();
-    T* thisLocalBuffer = this->LocalBuffer();
-    const Int thisLDim = this->LocalLDim();
-#if defined(HAVE_OPENMP) && !defined(PARALLELIZE_INNER_LOOPS)
-    #pragma omp parallel for
-#endif
-    for( Int k=0; k<p; ++k )
-    {
-        const T* data = &gatheredData[k*portionSize];
-
-        const Int colShift = RawShift( k, colAlignmentOfA, p );
-        const Int localHeight = RawLocalLength( height, colShift, p );
-
-#if defined(HAVE_OPENMP) && defined(PARALLELIZE_INNER_LOOPS)
-        #pragma omp parallel for 
-#endif
-        for( Int j=0; j<width; ++j )
-        {
-            T* destCol = &thisLocalBuffer[colShift+j*thisLDim];
-            const T* sourceCol = &data[j*localHeight];
-            for( Int iLocal=0; iLocal<localHeight; ++iLocal )
-                destCol[iLocal*p] = sourceCol[iLocal];
-        }
-    }
-    this->auxMemory_.Release();
+    this->gatherPlan_.RowGather( A, *this, g.VCComm() );
 #ifndef RELEASE
     PopCallStack();
 #endif
@@ -1116,63 +830,7 @@ DistMatrix<T,STAR,STAR,Int>::operator=( const DistMatrix<T,STAR,VC,Int>& A )
         return *this;
     }
 
-    const Int p = g.Size();
-    const Int height = this->Height();
-    const Int width = this->Width();
-    const Int localWidthOfA = A.LocalWidth();
-    const Int maxLocalWidth = MaxLocalLength(width,p);
-
-    const Int portionSize = std::max(height*maxLocalWidth,mpi::MIN_COLL_MSG);
-
-    this->auxMemory_.Require( (p+1)*portionSize );
-
-    T* buffer = this->auxMemory_.Buffer();
-    T* originalData = &buffer[0];
-    T* gatheredData = &buffer[portionSize];
-
-    // Pack
-    const T* ALocalBuffer = A.LockedLocalBuffer();
-    const Int ALDim = A.LocalLDim();
-#ifdef HAVE_OPENMP
-    #pragma omp parallel for
-#endif
-    for( Int jLocal=0; jLocal<localWidthOfA; ++jLocal )
-    {
-        const T* ACol = &ALocalBuffer[jLocal*ALDim];
-        T* originalDataCol = &originalData[jLocal*height];
-        MemCopy( originalDataCol, ACol, height );
-    }
-
-    // Communicate
-    mpi::AllGather
-    ( originalData, portionSize,
-      gatheredData, portionSize, g.VCComm() );
-
-    // Unpack
-    const Int rowAlignmentOfA = A.RowAlignment();
-    T* thisLocalBuffer = this->LocalBuffer();
-    const Int thisLDim = this->LocalLDim();
-#if defined(HAVE_OPENMP) && !defined(PARALLELIZE_INNER_LOOPS)
-    #pragma omp parallel for
-#endif
-    for( Int k=0; k<p; ++k )
-    {
-        const T* data = &gatheredData[k*portionSize];
-
-        const Int rowShift = RawShift( k, rowAlignmentOfA, p );
-        const Int localWidth = RawLocalLength( width, rowShift, p );
-
-#if defined(HAVE_OPENMP) && defined(PARALLELIZE_INNER_LOOPS)
-        #pragma omp parallel for
-#endif
-        for( Int jLocal=0; jLocal<localWidth; ++jLocal )
-        {
-            const T* dataCol = &data[jLocal*height];
-            T* thisCol = &thisLocalBuffer[(rowShift+jLocal*p)*thisLDim];
-            MemCopy( thisCol, dataCol, height );
-        }
-    }
-    this->auxMemory_.Release();
+    this->gatherPlan_.ColGather( A, *this, g.VCComm() );
 #ifndef RELEASE
     PopCallStack();
 #endif
@@ -1201,64 +859,7 @@ DistMatrix<T,STAR,STAR,Int>::operator=( const DistMatrix<T,VR,STAR,Int>& A )
         return *this;
     }
 
-    const Int p = g.Size();
-    const Int height = this->Height();
-    const Int width = this->Width();
-    const Int localHeightOfA = A.LocalHeight();
-    const Int maxLocalHeight = MaxLocalLength(height,p);
-
-    const Int portionSize = std::max(maxLocalHeight*width,mpi::MIN_COLL_MSG);
-
-    this->auxMemory_.Require( (p+1)*portionSize );
-
-    T* buffer = this->auxMemory_.Buffer();
-    T* originalData = &buffer[0];
-    T* gatheredData = &buffer[portionSize];
-
-    // Pack
-    const T* ALocalBuffer = A.LockedLocalBuffer();
-    const Int ALDim = A.LocalLDim();
-#ifdef HAVE_OPENMP
-    #pragma omp parallel for
-#endif
-    for( Int j=0; j<width; ++j )
-    {
-        const T* ACol = &ALocalBuffer[j*ALDim];
-        T* originalDataCol = &originalData[j*localHeightOfA];
-        MemCopy( originalDataCol, ACol, localHeightOfA );
-    }
-
-    // Communicate
-    mpi::AllGather
-    ( originalData, portionSize,
-      gatheredData, portionSize, g.VRComm() );
-
-    // Unpack
-    const Int colAlignmentOfA = A.ColAlignment();
-    T* thisLocalBuffer = this->LocalBuffer();
-    const Int thisLDim = this->LocalLDim();
-#if defined(HAVE_OPENMP) && !defined(PARALLELIZE_INNER_LOOPS)
-    #pragma omp parallel for
-#endif
-    for( Int k=0; k<p; ++k )
-    {
-        const T* data = &gatheredData[k*portionSize];
-
-        const Int colShift = RawShift( k, colAlignmentOfA, p );
-        const Int localHeight = RawLocalLength( height, colShift, p );
-
-#if defined(HAVE_OPENMP) && defined(PARALLELIZE_INNER_LOOPS)
-        #pragma omp parallel for 
-#endif
-        for( Int j=0; j<width; ++j )
-        {
-            T* destCol = &thisLocalBuffer[colShift+j*thisLDim];
-            const T* sourceCol = &data[j*localHeight];
-            for( Int iLocal=0; iLocal<localHeight; ++iLocal )
-                destCol[iLocal*p] = sourceCol[iLocal];
-        }
-    }
-    this->auxMemory_.Release();
+    this->gatherPlan_.RowGather( A, *this, g.VRComm() );
 #ifndef RELEASE
     PopCallStack();
 #endif
@@ -1287,63 +888,7 @@ DistMatrix<T,STAR,STAR,Int>::operator=( const DistMatrix<T,STAR,VR,Int>& A )
         return *this;
     }
 
-    const Int p = g.Size();
-    const Int height = this->Height();
-    const Int width = this->Width();
-    const Int localWidthOfA = A.LocalWidth();
-    const Int maxLocalWidth = MaxLocalLength(width,p);
-
-    const Int portionSize = std::max(height*maxLocalWidth,mpi::MIN_COLL_MSG);
-
-    this->auxMemory_.Require( (p+1)*portionSize );
-
-    T* buffer = this->auxMemory_.Buffer();
-    T* originalData = &buffer[0];
-    T* gatheredData = &buffer[portionSize];
-
-    // Pack
-    const T* ALocalBuffer = A.LockedLocalBuffer();
-    const Int ALDim = A.LocalLDim();
-#ifdef HAVE_OPENMP
-    #pragma omp parallel for
-#endif
-    for( Int jLocal=0; jLocal<localWidthOfA; ++jLocal )
-    {
-        const T* ACol = &ALocalBuffer[jLocal*ALDim];
-        T* originalDataCol = &originalData[jLocal*height];
-        MemCopy( originalDataCol, ACol, height );
-    }
-
-    // Communicate
-    mpi::AllGather
-    ( originalData, portionSize,
-      gatheredData, portionSize, g.VRComm() );
-
-    // Unpack
-    const Int rowAlignmentOfA = A.RowAlignment();
-    T* thisLocalBuffer = this->LocalBuffer();
-    const Int thisLDim = this->LocalLDim();
-#if defined(HAVE_OPENMP) && !defined(PARALLELIZE_INNER_LOOPS)
-    #pragma omp parallel for
-#endif
-    for( Int k=0; k<p; ++k )
-    {
-        const T* data = &gatheredData[k*portionSize];
-
-        const Int rowShift = RawShift( k, rowAlignmentOfA, p );
-        const Int localWidth = RawLocalLength( width, rowShift, p );
-
-#if defined(HAVE_OPENMP) && defined(PARALLELIZE_INNER_LOOPS)
-        #pragma omp parallel for
-#endif
-        for( Int jLocal=0; jLocal<localWidth; ++jLocal )
-        {
-            const T* dataCol = &data[jLocal*height];
-            T* thisCol = &thisLocalBuffer[(rowShift+jLocal*p)*thisLDim];
-            MemCopy( thisCol, dataCol, height );
-        }
-    }
-    this->auxMemory_.Release();
+    this->gatherPlan_.ColGather( A, *this, g.VRComm() );
 #ifndef RELEASE
     PopCallStack();
 #endif
@@ -1394,9 +939,10 @@ DistMatrix<T,STAR,STAR,Int>::operator=( const DistMatrix<T,STAR,STAR,Int>& A )
         mpi::Request sendRequest;
         if( A.Grid().VCRank() == 0 )
         {
-            for( Int j=0; j<A.Width(); ++j ) 
-                for( Int i=0; i<A.Height(); ++i )
-                    sendBuffer[i+j*A.Height()] = A.GetLocal(i,j);
+            InterleaveMatrix
+            ( A.Height(), A.Width(),
+              A.LockedLocalBuffer(), 1, A.LocalLDim(),
+              sendBuffer, 1, A.Height() );
             const Int recvViewingRank = this->Grid().VCToViewingMap(0);
             mpi::ISend
             ( sendBuffer, A.Height()*A.Width(), recvViewingRank, 0,
@@ -1418,9 +964,10 @@ DistMatrix<T,STAR,STAR,Int>::operator=( const DistMatrix<T,STAR,STAR,Int>& A )
             mpi::Broadcast
             ( bcastBuffer, A.Height()*A.Width(), 0, this->Grid().VCComm() );
 
-            for( Int j=0; j<A.Width(); ++j )
-                for( Int i=0; i<A.Height(); ++i )
-                    this->SetLocal(i,j,bcastBuffer[i+j*A.Height()]);
+            InterleaveMatrix
+            ( A.Height(), A.Width(),
+              bcastBuffer, 1, A.Height(),
+              this->LocalBuffer(), 1, this->LocalLDim() );
         }
 
         if( A.Grid().VCRank() == 0 )
@@ -1433,6 +980,158 @@ DistMatrix<T,STAR,STAR,Int>::operator=( const DistMatrix<T,STAR,STAR,Int>& A )
     return *this;
 }
 
+template<typename T,typename Int>
+inline void
+DistMatrix<T,STAR,STAR,Int>::BeginRedistribute
+( const DistMatrix<T,MC,STAR,Int>& A )
+{
+#ifndef RELEASE
+    PushCallStack("[* ,* ]::BeginRedistribute( [MC,* ] )");
+    this->AssertNotLockedView();
+    this->AssertSameGrid( A );
+    if( this->Viewing() )
+        this->AssertSameSize( A );
+#endif
+    const elem::Grid& g = this->Grid();
+    this->pendingGather_.BeginRowGather( A, g.ColComm() );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename T,typename Int>
+inline void
+DistMatrix<T,STAR,STAR,Int>::BeginRedistribute
+( const DistMatrix<T,MR,STAR,Int>& A )
+{
+#ifndef RELEASE
+    PushCallStack("[* ,* ]::BeginRedistribute( [MR,* ] )");
+    this->AssertNotLockedView();
+    this->AssertSameGrid( A );
+    if( this->Viewing() )
+        this->AssertSameSize( A );
+#endif
+    const elem::Grid& g = this->Grid();
+    this->pendingGather_.BeginRowGather( A, g.RowComm() );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename T,typename Int>
+inline void
+DistMatrix<T,STAR,STAR,Int>::BeginRedistribute
+( const DistMatrix<T,STAR,MC,Int>& A )
+{
+#ifndef RELEASE
+    PushCallStack("[* ,* ]::BeginRedistribute( [* ,MC] )");
+    this->AssertNotLockedView();
+    this->AssertSameGrid( A );
+    if( this->Viewing() )
+        this->AssertSameSize( A );
+#endif
+    const elem::Grid& g = this->Grid();
+    this->pendingGather_.BeginColGather( A, g.ColComm() );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename T,typename Int>
+inline void
+DistMatrix<T,STAR,STAR,Int>::BeginRedistribute
+( const DistMatrix<T,STAR,MR,Int>& A )
+{
+#ifndef RELEASE
+    PushCallStack("[* ,* ]::BeginRedistribute( [* ,MR] )");
+    this->AssertNotLockedView();
+    this->AssertSameGrid( A );
+    if( this->Viewing() )
+        this->AssertSameSize( A );
+#endif
+    const elem::Grid& g = this->Grid();
+    this->pendingGather_.BeginColGather( A, g.RowComm() );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename T,typename Int>
+inline void
+DistMatrix<T,STAR,STAR,Int>::BeginRedistribute
+( const DistMatrix<T,VC,STAR,Int>& A )
+{
+#ifndef RELEASE
+    PushCallStack("[* ,* ]::BeginRedistribute( [VC,* ] )");
+    this->AssertNotLockedView();
+    this->AssertSameGrid( A );
+    if( this->Viewing() )
+        this->AssertSameSize( A );
+#endif
+    const elem::Grid& g = this->Grid();
+    this->pendingGather_.BeginRowGather( A, g.VCComm() );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename T,typename Int>
+inline void
+DistMatrix<T,STAR,STAR,Int>::BeginRedistribute
+( const DistMatrix<T,VR,STAR,Int>& A )
+{
+#ifndef RELEASE
+    PushCallStack("[* ,* ]::BeginRedistribute( [VR,* ] )");
+    this->AssertNotLockedView();
+    this->AssertSameGrid( A );
+    if( this->Viewing() )
+        this->AssertSameSize( A );
+#endif
+    const elem::Grid& g = this->Grid();
+    this->pendingGather_.BeginRowGather( A, g.VRComm() );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename T,typename Int>
+inline void
+DistMatrix<T,STAR,STAR,Int>::BeginRedistribute
+( const DistMatrix<T,STAR,VC,Int>& A )
+{
+#ifndef RELEASE
+    PushCallStack("[* ,* ]::BeginRedistribute( [* ,VC] )");
+    this->AssertNotLockedView();
+    this->AssertSameGrid( A );
+    if( this->Viewing() )
+        this->AssertSameSize( A );
+#endif
+    const elem::Grid& g = this->Grid();
+    this->pendingGather_.BeginColGather( A, g.VCComm() );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename T,typename Int>
+inline void
+DistMatrix<T,STAR,STAR,Int>::BeginRedistribute
+( const DistMatrix<T,STAR,VR,Int>& A )
+{
+#ifndef RELEASE
+    PushCallStack("[* ,* ]::BeginRedistribute( [* ,VR] )");
+    this->AssertNotLockedView();
+    this->AssertSameGrid( A );
+    if( this->Viewing() )
+        this->AssertSameSize( A );
+#endif
+    const elem::Grid& g = this->Grid();
+    this->pendingGather_.BeginColGather( A, g.VRComm() );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
 template<typename T,typename Int>
 inline void
 DistMatrix<T,STAR,STAR,Int>::SumOverCol()
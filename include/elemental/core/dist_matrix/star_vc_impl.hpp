@@ -913,8 +913,7 @@ DistMatrix<T,STAR,VC,Int>::operator=( const DistMatrix<T,MR,MC,Int>& A )
             {
                 T* destCol = &thisLocalBuffer[thisColShift+jLocal*thisLDim];
                 const T* sourceCol = &data[jLocal*thisLocalHeight];
-                for( Int iLocal=0; iLocal<thisLocalHeight; ++iLocal )
-                    destCol[iLocal*c] = sourceCol[iLocal];
+                StridedMemCopy( destCol, c, sourceCol, 1, thisLocalHeight );
             }
         }
         this->auxMemory_.Release();
@@ -1008,8 +1007,7 @@ DistMatrix<T,STAR,VC,Int>::operator=( const DistMatrix<T,MR,MC,Int>& A )
             {
                 T* destCol = &thisLocalBuffer[thisColShift+jLocal*thisLDim];
                 const T* sourceCol = &data[jLocal*thisLocalHeight];
-                for( Int iLocal=0; iLocal<thisLocalHeight; ++iLocal )
-                    destCol[iLocal*c] = sourceCol[iLocal];
+                StridedMemCopy( destCol, c, sourceCol, 1, thisLocalHeight );
             }
         }
         this->auxMemory_.Release();
@@ -628,31 +628,15 @@ DistMatrix<T,STAR,VR,Int>::TransposeFrom
         const T* ALocalBuffer = A.LockedLocalBuffer();
         const Int ALDim = A.LocalLDim();
         if( conjugate )
-        {
-#ifdef HAVE_OPENMP
-            #pragma omp parallel for
-#endif
-            for( Int jLocal=0; jLocal<localWidth; ++jLocal )
-            {
-                T* destCol = &thisLocalBuffer[jLocal*thisLDim];
-                const T* sourceCol = &ALocalBuffer[rowOffset+jLocal*r];
-                for( Int i=0; i<height; ++i )
-                    destCol[i] = Conj( sourceCol[i*ALDim] );
-            }
-        }
+            ConjInterleaveMatrix
+            ( height, localWidth,
+              &ALocalBuffer[rowOffset], ALDim, r,
+              thisLocalBuffer, 1, thisLDim );
         else
-        {
-#ifdef HAVE_OPENMP
-            #pragma omp parallel for
-#endif
-            for( Int jLocal=0; jLocal<localWidth; ++jLocal )
-            {
-                T* destCol = &thisLocalBuffer[jLocal*thisLDim];
-                const T* sourceCol = &ALocalBuffer[rowOffset+jLocal*r];
-                for( Int i=0; i<height; ++i )
-                    destCol[i] = sourceCol[i*ALDim];
-            }
-        }
+            InterleaveMatrix
+            ( height, localWidth,
+              &ALocalBuffer[rowOffset], ALDim, r,
+              thisLocalBuffer, 1, thisLDim );
     }
     else
     {
@@ -695,31 +679,15 @@ DistMatrix<T,STAR,VR,Int>::TransposeFrom
         const T* ALocalBuffer = A.LockedLocalBuffer();
         const Int ALDim = A.LocalLDim();
         if( conjugate )
-        {
-#ifdef HAVE_OPENMP
-            #pragma omp parallel for
-#endif
-            for( Int jLocal=0; jLocal<localWidthOfSend; ++jLocal )
-            {
-                T* destCol = &sendBuffer[jLocal*height];
-                const T* sourceCol = &ALocalBuffer[sendRowOffset+jLocal*r];
-                for( Int i=0; i<height; ++i )
-                    destCol[i] = Conj( sourceCol[i*ALDim] );
-            }
-        }
+            ConjInterleaveMatrix
+            ( height, localWidthOfSend,
+              &ALocalBuffer[sendRowOffset], ALDim, r,
+              sendBuffer, 1, height );
         else
-        {
-#ifdef HAVE_OPENMP
-            #pragma omp parallel for
-#endif
-            for( Int jLocal=0; jLocal<localWidthOfSend; ++jLocal )
-            {
-                T* destCol = &sendBuffer[jLocal*height];
-                const T* sourceCol = &ALocalBuffer[sendRowOffset+jLocal*r];
-                for( Int i=0; i<height; ++i )
-                    destCol[i] = sourceCol[i*ALDim];
-            }
-        }
+            InterleaveMatrix
+            ( height, localWidthOfSend,
+              &ALocalBuffer[sendRowOffset], ALDim, r,
+              sendBuffer, 1, height );
 
         // Communicate
         mpi::SendRecv
@@ -852,8 +820,7 @@ DistMatrix<T,STAR,VR,Int>::operator=( const DistMatrix<T,MC,MR,Int>& A )
             {
                 T* destCol = &thisLocalBuffer[thisColShift+jLocal*thisLDim];
                 const T* sourceCol = &data[jLocal*thisLocalHeight];
-                for( Int iLocal=0; iLocal<thisLocalHeight; ++iLocal )
-                    destCol[iLocal*r] = sourceCol[iLocal];
+                StridedMemCopy( destCol, r, sourceCol, 1, thisLocalHeight );
             }
         }
         this->auxMemory_.Release();
@@ -947,8 +914,7 @@ DistMatrix<T,STAR,VR,Int>::operator=( const DistMatrix<T,MC,MR,Int>& A )
             {
                 T* destCol = &thisLocalBuffer[thisColShift+jLocal*thisLDim];
                 const T* sourceCol = &data[jLocal*thisLocalHeight];
-                for( Int iLocal=0; iLocal<thisLocalHeight; ++iLocal )
-                    destCol[iLocal*r] = sourceCol[iLocal];
+                StridedMemCopy( destCol, r, sourceCol, 1, thisLocalHeight );
             }
         }
         this->auxMemory_.Release();
@@ -473,8 +473,7 @@ DistMatrix<T,VC,STAR,Int>::PrintBase
     {
         T* destCol = &sendBuf[colShift+j*height];
         const T* sourceCol = &thisLocalBuffer[j*thisLDim];
-        for( Int iLocal=0; iLocal<localHeight; ++iLocal )
-            destCol[iLocal*p] = sourceCol[iLocal];
+        StridedMemCopy( destCol, p, sourceCol, 1, localHeight );
     }
 
     // If we are the root, allocate a receive buffer
@@ -750,15 +749,11 @@ DistMatrix<T,VC,STAR,Int>::GetDiagonal
     T* dLocalBuffer = d.LocalBuffer();
     const T* thisLocalBuffer = this->LockedLocalBuffer();
     const Int thisLDim = this->LocalLDim();
-#ifdef HAVE_OPENMP
-    #pragma omp parallel for
-#endif
-    for( Int k=0; k<localDiagLength; ++k )
-    {
-        const Int iLocal = iLocalStart+k;
-        const Int jLocal = jStart+k*p;
-        dLocalBuffer[k] = thisLocalBuffer[iLocal+jLocal*thisLDim];
-    }
+    const Int diagStride = 1 + p*thisLDim;
+    StridedMemCopy
+    ( dLocalBuffer, 1,
+      &thisLocalBuffer[iLocalStart+jStart*thisLDim], diagStride,
+      localDiagLength );
 #ifndef RELEASE
     PopCallStack();
 #endif
@@ -827,15 +822,11 @@ DistMatrix<T,VC,STAR,Int>::GetDiagonal
     const Int dLDim = d.LocalLDim();
     const T* thisLocalBuffer = this->LockedLocalBuffer();
     const Int thisLDim = this->LocalLDim();
-#ifdef HAVE_OPENMP
-    #pragma omp parallel for
-#endif
-    for( Int k=0; k<localDiagLength; ++k )
-    {
-        const Int iLocal = iLocalStart+k;
-        const Int jLocal = jStart+k*p;
-        dLocalBuffer[k*dLDim] = thisLocalBuffer[iLocal+jLocal*thisLDim];
-    }
+    const Int diagStride = 1 + p*thisLDim;
+    StridedMemCopy
+    ( dLocalBuffer, dLDim,
+      &thisLocalBuffer[iLocalStart+jStart*thisLDim], diagStride,
+      localDiagLength );
 #ifndef RELEASE
     PopCallStack();
 #endif
@@ -894,15 +885,10 @@ DistMatrix<T,VC,STAR,Int>::SetDiagonal
     const T* dLocalBuffer = d.LockedLocalBuffer();
     T* thisLocalBuffer = this->LocalBuffer();
     const Int thisLDim = this->LocalLDim();
-#ifdef HAVE_OPENMP
-    #pragma omp parallel for
-#endif
-    for( Int k=0; k<localDiagLength; ++k )
-    {
-        const Int iLocal = iLocalStart+k;
-        const Int jLocal = jStart+k*p;
-        thisLocalBuffer[iLocal+jLocal*thisLDim] = dLocalBuffer[k];
-    }
+    const Int diagStride = 1 + p*thisLDim;
+    StridedMemCopy
+    ( &thisLocalBuffer[iLocalStart+jStart*thisLDim], diagStride,
+      dLocalBuffer, 1, localDiagLength );
 #ifndef RELEASE
     PopCallStack();
 #endif
@@ -962,15 +948,10 @@ DistMatrix<T,VC,STAR,Int>::SetDiagonal
     T* thisLocalBuffer = this->LocalBuffer();
     const Int dLDim = d.LocalLDim();
     const Int thisLDim = this->LocalLDim();
-#ifdef HAVE_OPENMP
-    #pragma omp parallel for
-#endif
-    for( Int k=0; k<localDiagLength; ++k )
-    {
-        const Int iLocal = iLocalStart+k;
-        const Int jLocal = jStart+k*p;
-        thisLocalBuffer[iLocal+jLocal*thisLDim] = dLocalBuffer[k*dLDim];
-    }
+    const Int diagStride = 1 + p*thisLDim;
+    StridedMemCopy
+    ( &thisLocalBuffer[iLocalStart+jStart*thisLDim], diagStride,
+      dLocalBuffer, dLDim, localDiagLength );
 #ifndef RELEASE
     PopCallStack();
 #endif
@@ -1058,8 +1039,7 @@ DistMatrix<T,VC,STAR,Int>::operator=( const DistMatrix<T,MC,MR,Int>& A )
             {
                 T* destCol = &data[jLocal*thisLocalHeight];
                 const T* sourceCol = &ALocalBuffer[thisColOffset+jLocal*ALDim];
-                for( Int iLocal=0; iLocal<thisLocalHeight; ++iLocal )
-                    destCol[iLocal] = sourceCol[iLocal*c];
+                StridedMemCopy( destCol, 1, sourceCol, c, thisLocalHeight );
             }
         }
 
@@ -1148,8 +1128,7 @@ DistMatrix<T,VC,STAR,Int>::operator=( const DistMatrix<T,MC,MR,Int>& A )
             {
                 T* destCol = &data[jLocal*thisLocalHeight];
                 const T* sourceCol = &ALocalBuffer[thisColOffset+jLocal*ALDim];
-                for( Int iLocal=0; iLocal<thisLocalHeight; ++iLocal )
-                    destCol[iLocal] = sourceCol[iLocal*c];
+                StridedMemCopy( destCol, 1, sourceCol, c, thisLocalHeight );
             }
         }
 
@@ -1247,8 +1226,7 @@ DistMatrix<T,VC,STAR,Int>::operator=( const DistMatrix<T,MC,STAR,Int>& A )
         {
             T* destCol = &thisLocalBuffer[j*thisLDim];
             const T* sourceCol = &ALocalBuffer[colOffset+j*ALDim];
-            for( Int iLocal=0; iLocal<localHeight; ++iLocal )
-                destCol[iLocal] = sourceCol[iLocal*c];
+            StridedMemCopy( destCol, 1, sourceCol, c, localHeight );
         }
     }
     else
@@ -1298,8 +1276,7 @@ DistMatrix<T,VC,STAR,Int>::operator=( const DistMatrix<T,MC,STAR,Int>& A )
         {
             T* destCol = &sendBuffer[j*localHeightOfSend];
             const T* sourceCol = &ALocalBuffer[sendColOffset+j*ALDim];
-            for( Int iLocal=0; iLocal<localHeightOfSend; ++iLocal )
-                destCol[iLocal] = sourceCol[iLocal*c];
+            StridedMemCopy( destCol, 1, sourceCol, c, localHeightOfSend );
         }
 
         // Communicate
@@ -1739,8 +1716,7 @@ DistMatrix<T,VC,STAR,Int>::operator=( const DistMatrix<T,STAR,STAR,Int>& A )
     {
         T* destCol = &thisLocalBuffer[j*thisLDim];
         const T* sourceCol = &ALocalBuffer[colShift+j*ALDim];
-        for( Int iLocal=0; iLocal<localHeight; ++iLocal )
-            destCol[iLocal] = sourceCol[iLocal*p];
+        StridedMemCopy( destCol, 1, sourceCol, p, localHeight );
     }
 #ifndef RELEASE
     PopCallStack();
@@ -1832,8 +1808,7 @@ DistMatrix<T,VC,STAR,Int>::SumScatterFrom
             {
                 T* destCol = &data[j*thisLocalHeight];
                 const T* sourceCol = &ALocalBuffer[thisColOffset+j*ALDim];
-                for( Int iLocal=0; iLocal<thisLocalHeight; ++iLocal )
-                    destCol[iLocal] = sourceCol[iLocal*c];
+                StridedMemCopy( destCol, 1, sourceCol, c, thisLocalHeight );
             }
         }
 
@@ -1921,8 +1896,7 @@ DistMatrix<T,VC,STAR,Int>::SumScatterFrom
         {
             T* destCol = &data[j*thisLocalHeight];
             const T* sourceCol = &ALocalBuffer[thisColShift+j*ALDim];
-            for( Int iLocal=0; iLocal<thisLocalHeight; ++iLocal )
-                destCol[iLocal] = sourceCol[iLocal*p];
+            StridedMemCopy( destCol, 1, sourceCol, p, thisLocalHeight );
         }
     }
 
@@ -2019,8 +1993,7 @@ DistMatrix<T,VC,STAR,Int>::SumScatterUpdate
             {
                 T* destCol = &data[j*thisLocalHeight];
                 const T* sourceCol = &ALocalBuffer[thisColOffset+j*ALDim];
-                for( Int iLocal=0; iLocal<thisLocalHeight; ++iLocal )
-                    destCol[iLocal] = sourceCol[iLocal*c];
+                StridedMemCopy( destCol, 1, sourceCol, c, thisLocalHeight );
             }
         }
 
@@ -2106,8 +2079,7 @@ DistMatrix<T,VC,STAR,Int>::SumScatterUpdate
         {
             T* destCol = &data[j*thisLocalHeight];
             const T* sourceCol = &ALocalBuffer[thisColShift+j*ALDim];
-            for( Int iLocal=0; iLocal<thisLocalHeight; ++iLocal )
-                destCol[iLocal] = sourceCol[iLocal*p];
+            StridedMemCopy( destCol, 1, sourceCol, p, thisLocalHeight );
         }
     }
 
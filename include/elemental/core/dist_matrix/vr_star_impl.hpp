@@ -342,8 +342,7 @@ DistMatrix<T,VR,STAR,Int>::PrintBase
     {
         T* destCol = &sendBuf[colShift+j*height];
         const T* sourceCol = &thisLocalBuffer[j*thisLDim];
-        for( Int iLocal=0; iLocal<localHeight; ++iLocal )
-            destCol[iLocal*p] = sourceCol[iLocal];
+        StridedMemCopy( destCol, p, sourceCol, 1, localHeight );
     }
 
     // If we are the root, allocate a receive buffer
@@ -754,8 +753,7 @@ DistMatrix<T,VR,STAR,Int>::operator=( const DistMatrix<T,MR,MC,Int>& A )
             {
                 T* destCol = &data[jLocal*thisLocalHeight];
                 const T* sourceCol = &ALocalBuffer[thisColOffset+jLocal*ALDim];
-                for( Int iLocal=0; iLocal<thisLocalHeight; ++iLocal )
-                    destCol[iLocal] = sourceCol[iLocal*r];
+                StridedMemCopy( destCol, 1, sourceCol, r, thisLocalHeight );
             }
         }
 
@@ -844,8 +842,7 @@ DistMatrix<T,VR,STAR,Int>::operator=( const DistMatrix<T,MR,MC,Int>& A )
             {
                 T* destCol = &data[jLocal*thisLocalHeight];
                 const T* sourceCol = &ALocalBuffer[thisColOffset+jLocal*ALDim];
-                for( Int iLocal=0; iLocal<thisLocalHeight; ++iLocal )
-                    destCol[iLocal] = sourceCol[iLocal*r];
+                StridedMemCopy( destCol, 1, sourceCol, r, thisLocalHeight );
             }
         }
 
@@ -943,8 +940,7 @@ DistMatrix<T,VR,STAR,Int>::operator=( const DistMatrix<T,MR,STAR,Int>& A )
         {
             T* destCol = &thisLocalBuffer[j*thisLDim];
             const T* sourceCol = &ALocalBuffer[colOffset+j*ALDim];
-            for( Int iLocal=0; iLocal<localHeight; ++iLocal )
-                destCol[iLocal] = sourceCol[iLocal*r];
+            StridedMemCopy( destCol, 1, sourceCol, r, localHeight );
         }
     }
     else
@@ -994,8 +990,7 @@ DistMatrix<T,VR,STAR,Int>::operator=( const DistMatrix<T,MR,STAR,Int>& A )
         {
             T* destCol = &sendBuffer[j*localHeightOfSend];
             const T* sourceCol = &ALocalBuffer[sendColOffset+j*ALDim];
-            for( Int iLocal=0; iLocal<localHeightOfSend; ++iLocal )
-                destCol[iLocal] = sourceCol[iLocal*r];
+            StridedMemCopy( destCol, 1, sourceCol, r, localHeightOfSend );
         }
 
         // Communicate
@@ -1323,8 +1318,7 @@ DistMatrix<T,VR,STAR,Int>::operator=( const DistMatrix<T,STAR,STAR,Int>& A )
     {
         T* destCol = &thisLocalBuffer[j*thisLDim];
         const T* sourceCol = &ALocalBuffer[colShift+j*ALDim];
-        for( Int iLocal=0; iLocal<localHeight; ++iLocal )
-            destCol[iLocal] = sourceCol[iLocal*p];
+        StridedMemCopy( destCol, 1, sourceCol, p, localHeight );
     }
 #ifndef RELEASE
     PopCallStack();
@@ -1416,8 +1410,7 @@ DistMatrix<T,VR,STAR,Int>::SumScatterFrom
             {
                 T* destCol = &data[j*thisLocalHeight];
                 const T* sourceCol = &ALocalBuffer[thisColOffset+j*ALDim];
-                for( Int iLocal=0; iLocal<thisLocalHeight; ++iLocal )
-                    destCol[iLocal] = sourceCol[iLocal*r];
+                StridedMemCopy( destCol, 1, sourceCol, r, thisLocalHeight );
             }
         }
 
@@ -1505,8 +1498,7 @@ DistMatrix<T,VR,STAR,Int>::SumScatterFrom
         {
             T* destCol = &data[j*thisLocalHeight];
             const T* sourceCol = &ALocalBuffer[thisColShift+j*ALDim];
-            for( Int iLocal=0; iLocal<thisLocalHeight; ++iLocal )
-                destCol[iLocal] = sourceCol[iLocal*p];
+            StridedMemCopy( destCol, 1, sourceCol, p, thisLocalHeight );
         }
     }
 
@@ -1603,8 +1595,7 @@ DistMatrix<T,VR,STAR,Int>::SumScatterUpdate
             {
                 T* destCol = &data[j*thisLocalHeight];
                 const T* sourceCol = &ALocalBuffer[thisColOffset+j*ALDim];
-                for( Int iLocal=0; iLocal<thisLocalHeight; ++iLocal )
-                    destCol[iLocal] = sourceCol[iLocal*r];
+                StridedMemCopy( destCol, 1, sourceCol, r, thisLocalHeight );
             }
         }
 
@@ -1690,8 +1681,7 @@ DistMatrix<T,VR,STAR,Int>::SumScatterUpdate
         {
             T* destCol = &data[j*thisLocalHeight];
             const T* sourceCol = &ALocalBuffer[thisColShift+j*ALDim];
-            for( Int iLocal=0; iLocal<thisLocalHeight; ++iLocal )
-                destCol[iLocal] = sourceCol[iLocal*p];
+            StridedMemCopy( destCol, 1, sourceCol, p, thisLocalHeight );
         }
     }
 
@@ -7,6 +7,8 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 
+#include "elemental/core/dist_matrix/gather_plan_impl.hpp"
+#include "elemental/core/dist_matrix/pending_gather_impl.hpp"
 #include "elemental/core/dist_matrix/abstract_impl.hpp"
 #include "elemental/core/dist_matrix/mc_mr_impl.hpp"
 #include "elemental/core/dist_matrix/mc_star_impl.hpp"
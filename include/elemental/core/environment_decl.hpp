@@ -34,17 +34,45 @@ void SetBlocksize( int blocksize );
 void PushBlocksizeStack( int blocksize );
 void PopBlocksizeStack();
 
+// A registry of the blocksizes tuned for particular routines, datatypes, and
+// process grid shapes. The distributed Gemm, Cholesky, LU, QR,
+// HermitianTridiag, and Bidiag routines push their registered blocksize for
+// their entire duration (including any routines which they call), and
+// otherwise use Blocksize(). If the environment variable ELEM_BLOCKSIZE_FILE
+// names a file, then Initialize loads the registry from it.
+template<typename T>
+int Blocksize( std::string routine, const Grid& g );
+template<typename T>
+void SetBlocksize( std::string routine, const Grid& g, int blocksize );
+template<typename T>
+void PushBlocksizeStack( std::string routine, const Grid& g );
+void PopBlocksizeStack( std::string routine );
+void ClearBlocksizeRegistry();
+// All processes in mpi::COMM_WORLD must call the loading routine, and the
+// registry is saved by the root process
+void LoadBlocksizeRegistry( std::string filename );
+void SaveBlocksizeRegistry( std::string filename );
+
+// For the registry to identify the datatype of a routine
+template<typename T>
+char DataTypeChar();
+
+// The depths of the call stack, the profile regions, and the blocksize 
+// stacks. A routine which recovers from an exception thrown within a routine
+// that it called can restore the depths it recorded beforehand in order to 
+// discard the entries which the unwound routines could not pop.
+struct StackDepths
+{
+    int callStack, profileRegions, blocksizeStack, tunedRoutines;
+};
+StackDepths GetStackDepths();
+void RestoreStackDepths( const StackDepths& depths );
+
 // Replacement for std::memcpy, which is known to often be suboptimal.
 // Notice the sizeof(T) is no longer required.
 template<typename T>
 void MemCopy( T* dest, const T* source, std::size_t numEntries );
 
-// Generalization of std::memcpy so that unit strides are not required
-template<typename T>
-void StridedMemCopy
-(       T* dest,   std::size_t destStride,
-  const T* source, std::size_t sourceStride, std::size_t numEntries );
-
 // Replacement for std::memset, which is likely suboptimal and hard to extend
 // to non-POD datatypes. Notice that sizeof(T) is no longer required.
 template<typename T>
@@ -234,6 +262,29 @@ void PopCallStack();
 void DumpCallStack();
 #endif // ifndef RELEASE
 
+// Hierarchical profiling, which is available in all builds. Each region is 
+// keyed on its call-stack path and records its number of calls, its inclusive
+// and exclusive wall time, and the bytes communicated within it (including 
+// within its subregions). In non-RELEASE builds, each PushCallStack/PopCallStack 
+// pair is a region, whereas RELEASE builds only profile the major routines.
+void EnableProfiling( bool traceTimeline=false );
+void DisableProfiling();
+bool Profiling();
+void ResetProfile();
+void PushProfileRegion( std::string name );
+void PopProfileRegion();
+// The number of currently open profile regions
+int ProfileRegionDepth();
+void ProfileCommunication( std::size_t numBytes );
+
+// Collective over comm: the root prints the minimum, average, and maximum 
+// over the processes of each statistic of each region
+void PrintProfile
+( mpi::Comm comm=mpi::COMM_WORLD, std::ostream& os=std::cout );
+// Each process writes its timeline to "<basename>-<rank>.json" in the Chrome 
+// trace event format (viewable with chrome://tracing)
+void WriteProfileTrace( std::string basename );
+
 // We define an output stream that does nothing. This is done so that the 
 // root process can be used to print data to a file's ostream while all other 
 // processes use a null ostream. This is used within the DistMatrix class's
@@ -35,16 +35,6 @@ MemCopy( T* dest, const T* source, std::size_t numEntries )
     std::memcpy( dest, source, numEntries*sizeof(T) );
 }
 
-template<typename T>
-inline void
-StridedMemCopy
-(       T* dest,   std::size_t destStride, 
-  const T* source, std::size_t sourceStride, std::size_t numEntries )
-{
-    // For now, use the BLAS wrappers/generalization
-    blas::Copy( numEntries, source, sourceStride, dest, destStride );
-}
-
 template<typename T>
 inline void 
 MemZero( T* buffer, std::size_t numEntries )
@@ -156,6 +156,13 @@ Grid::SetUpGrid()
         mpi::AllGather
         ( &myDiagPathAndRank[0], 2, &diagPathsAndRanks_[0], 2, vectorColComm_ );
 
+        // Name the communicators for the communication accounting
+        mpi::SetCommName( cartComm_, "Grid" );
+        mpi::SetCommName( matrixColComm_, "MC" );
+        mpi::SetCommName( matrixRowComm_, "MR" );
+        mpi::SetCommName( vectorColComm_, "VC" );
+        mpi::SetCommName( vectorRowComm_, "VR" );
+
 #ifndef RELEASE
         mpi::ErrorHandlerSet
         ( matrixColComm_, mpi::ERRORS_RETURN );
@@ -175,7 +182,6 @@ Grid::SetUpGrid()
         vectorColRank_ = mpi::UNDEFINED;
         vectorRowRank_ = mpi::UNDEFINED;
     }
-    mpi::Broadcast( &diagPathsAndRanks_[0], 2*size_, 0, viewingComm_ );
 
     // Set up the map from the VC group to the viewingGroup_ ranks.
     // Since the VC communicator preserves the ordering of the owningGroup_
@@ -187,6 +193,12 @@ Grid::SetUpGrid()
     mpi::GroupTranslateRanks
     ( owningGroup_, size_, &ranks[0], viewingGroup_, 
       &vectorColToViewingMap_[0] );
+
+    // The diagonal path information must come from a member of the grid, 
+    // which need not include the root of the viewing communicator
+    mpi::Broadcast
+    ( &diagPathsAndRanks_[0], 2*size_, vectorColToViewingMap_[0], 
+      viewingComm_ );
 #ifndef RELEASE
     PopCallStack();
 #endif
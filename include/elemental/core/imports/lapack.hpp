@@ -158,5 +158,58 @@ void HessenbergEig( int n, double* H, int ldh, dcomplex* w );
 void HessenbergEig( int n, scomplex* H, int ldh, scomplex* w );
 void HessenbergEig( int n, dcomplex* H, int ldh, dcomplex* w );
 
+//
+// Compute the eigenvalues (in ascending order) and eigenvectors of a 
+// symmetric tridiagonal matrix using the implicit QL/QR algorithm
+//
+
+void SymmetricTridiagEig( int n, float* d, float* e, float* Z, int ldz );
+void SymmetricTridiagEig( int n, double* d, double* e, double* Z, int ldz );
+
+//
+// Compute the Cholesky factorization of an HPD matrix, overwriting the 
+// 'uplo' triangle of A with its Cholesky factor
+//
+
+void Cholesky( char uplo, int n, float* A, int lda );
+void Cholesky( char uplo, int n, double* A, int lda );
+void Cholesky( char uplo, int n, scomplex* A, int lda );
+void Cholesky( char uplo, int n, dcomplex* A, int lda );
+
+//
+// Compute the LU factorization of a general matrix with partial pivoting, 
+// where row i was interchanged with row p[i]-1 (the pivots are one-based)
+//
+
+void LU( int m, int n, float* A, int lda, int* p );
+void LU( int m, int n, double* A, int lda, int* p );
+void LU( int m, int n, scomplex* A, int lda, int* p );
+void LU( int m, int n, dcomplex* A, int lda, int* p );
+
+//
+// Compute the packed Householder QR factorization of a general matrix, where
+// the min(m,n) Householder scalars are returned in t
+//
+
+void QR( int m, int n, float* A, int lda, float* t );
+void QR( int m, int n, double* A, int lda, double* t );
+void QR( int m, int n, scomplex* A, int lda, scomplex* t );
+void QR( int m, int n, dcomplex* A, int lda, dcomplex* t );
+
+//
+// Compute the eigenvalues (in ascending order) and, optionally, the 
+// eigenvectors of a Hermitian matrix using a divide and conquer algorithm.
+// If the eigenvectors are requested, they overwrite A.
+//
+
+void HermitianEig
+( char uplo, int n, float* A, int lda, float* w, bool computeVectors );
+void HermitianEig
+( char uplo, int n, double* A, int lda, double* w, bool computeVectors );
+void HermitianEig
+( char uplo, int n, scomplex* A, int lda, float* w, bool computeVectors );
+void HermitianEig
+( char uplo, int n, dcomplex* A, int lda, double* w, bool computeVectors );
+
 } // namespace lapack
 } // namespace elem
@@ -12,9 +12,7 @@ namespace mpi {
 
 #if defined(HAVE_MPI3_NONBLOCKING_COLLECTIVES) || \
     defined(HAVE_MPIX_NONBLOCKING_COLLECTIVES)
-#define HAVE_NONBLOCKING 1
-#else
-#define HAVE_NONBLOCKING 0
+#define HAVE_NONBLOCKING_COLLECTIVES
 #endif
 
 #ifdef HAVE_NONBLOCKING_COLLECTIVES
@@ -26,10 +24,13 @@ namespace mpi {
 #endif
 
 // Datatype definitions
+typedef MPI_Aint Aint;
 typedef MPI_Comm Comm;
 typedef MPI_Datatype Datatype;
 typedef MPI_Errhandler ErrorHandler;
+typedef MPI_File File;
 typedef MPI_Group Group;
+typedef MPI_Offset Offset;
 typedef MPI_Op Op;
 typedef MPI_Request Request;
 typedef MPI_Status Status;
@@ -45,6 +46,11 @@ const int THREAD_MULTIPLE = MPI_THREAD_MULTIPLE;
 const int UNDEFINED = MPI_UNDEFINED;
 const Comm COMM_SELF = MPI_COMM_SELF;
 const Comm COMM_WORLD = MPI_COMM_WORLD;
+const Datatype BYTE = MPI_BYTE;
+const int MODE_CREATE = MPI_MODE_CREATE;
+const int MODE_RDONLY = MPI_MODE_RDONLY;
+const int MODE_WRONLY = MPI_MODE_WRONLY;
+const int MODE_RDWR = MPI_MODE_RDWR;
 const ErrorHandler ERRORS_RETURN = MPI_ERRORS_RETURN;
 const ErrorHandler ERRORS_ARE_FATAL = MPI_ERRORS_ARE_FATAL;
 const Group GROUP_EMPTY = MPI_GROUP_EMPTY;
@@ -87,6 +93,8 @@ void CommSplit( Comm comm, int color, int key, Comm& newComm );
 void CommFree( Comm& comm );
 bool CongruentComms( Comm comm1, Comm comm2 );
 void ErrorHandlerSet( Comm comm, ErrorHandler errorHandler );
+void SetCommName( Comm comm, std::string name );
+std::string CommName( Comm comm );
 
 // Cartesian communicator routines
 void CartCreate
@@ -106,10 +114,22 @@ void GroupTranslateRanks
 ( Group origGroup, int size, const int* origRanks, 
   Group newGroup,                  int* newRanks );
 
+// Derived datatypes
+void TypeContiguous( int count, Datatype oldType, Datatype& newType );
+void TypeVector
+( int count, int blockLength, int stride, Datatype oldType, 
+  Datatype& newType );
+void TypeCreateHVector
+( int count, int blockLength, Aint stride, Datatype oldType, 
+  Datatype& newType );
+void TypeCommit( Datatype& type );
+void TypeFree( Datatype& type );
+
 // Utilities
 void Barrier( Comm comm );
 void Wait( Request& request );
 void Wait( Request& request, Status& status );
+void WaitAll( int numRequests, Request* requests );
 void WaitAll( int numRequests, Request* requests, Status* statuses );
 bool Test( Request& request );
 bool IProbe( int source, int tag, Comm comm, Status& status );
@@ -201,6 +221,11 @@ void SendRecv
         dcomplex* rbuf, int rc, int from, int rtag, Comm comm );
 
 // Collective communication
+//
+// The nonblocking IBroadcast, IAllGather, IAllToAll, IAllReduce, and 
+// IReduceScatter routines are always available: if the MPI implementation 
+// does not support nonblocking collectives, they perform the blocking 
+// collective and return REQUEST_NULL, so that a subsequent Wait is a no-op.
 
 void Broadcast( byte* buf, int count, int root, Comm comm );
 void Broadcast( int* buf, int count, int root, Comm comm );
@@ -209,7 +234,6 @@ void Broadcast( double* buf, int count, int root, Comm comm );
 void Broadcast( scomplex* buf, int count, int root, Comm comm );
 void Broadcast( dcomplex* buf, int count, int root, Comm comm );
 
-#ifdef HAVE_NONBLOCKING_COLLECTIVES
 void IBroadcast
 ( byte* buf, int count, int root, Comm comm, Request& request );
 void IBroadcast
@@ -222,7 +246,6 @@ void IBroadcast
 ( scomplex* buf, int count, int root, Comm comm, Request& request );
 void IBroadcast
 ( dcomplex* buf, int count, int root, Comm comm, Request& request );
-#endif
 
 void Gather
 ( const byte* sbuf, int sc,
@@ -348,7 +371,6 @@ void AllGather
 ( const dcomplex* sbuf, int sc,
         dcomplex* rbuf, const int* rcs, const int* rds, Comm comm );
 
-#ifdef HAVE_NONBLOCKING_COLLECTIVES
 void IAllGather
 ( const byte* sbuf, int sc,
         byte* rbuf, int rc, Comm comm, Request& request );
@@ -367,7 +389,6 @@ void IAllGather
 void IAllGather
 ( const dcomplex* sbuf, int sc,
         dcomplex* rbuf, int rc, Comm comm, Request& request );
-#endif
 
 void Scatter
 ( const byte* sbuf, int sc,
@@ -440,7 +461,6 @@ void AllToAll
 ( const dcomplex* sbuf, int sc,
         dcomplex* rbuf, int rc, Comm comm );
 
-#ifdef HAVE_NONBLOCKING_COLLECTIVES
 void IAllToAll
 ( const byte* sbuf, int sc,
         byte* rbuf, int rc, Comm comm, Request& request );
@@ -459,7 +479,6 @@ void IAllToAll
 void IAllToAll
 ( const dcomplex* sbuf, int sc,
         dcomplex* rbuf, int rc, Comm comm, Request& request );
-#endif
 
 void AllToAll
 ( const byte* sbuf, const int* scs, const int* sds,
@@ -566,7 +585,6 @@ void AllReduce
 void AllReduce
 ( const dcomplex* sbuf, dcomplex* rbuf, int count, Op op, Comm comm );
 
-#ifdef HAVE_NONBLOCKING_COLLECTIVES
 void IAllReduce
 ( const byte* sbuf, byte* rbuf, int count, 
   Op op, Comm comm, Request& request );
@@ -585,7 +603,6 @@ void IAllReduce
 void IAllReduce
 ( const dcomplex* sbuf, dcomplex* rbuf, int count, 
   Op op, Comm comm, Request& request );
-#endif
 
 // In-place option
 void AllReduce( byte* buf, int count, Op op, Comm comm );
@@ -606,7 +623,6 @@ void ReduceScatter( double* sbuf, double* rbuf, int rc, Op op, Comm comm );
 void ReduceScatter( scomplex* sbuf, scomplex* rbuf, int rc, Op op, Comm comm );
 void ReduceScatter( dcomplex* sbuf, dcomplex* rbuf, int rc, Op op, Comm comm );
 
-#ifdef HAVE_NONBLOCKING_COLLECTIVES
 void IReduceScatter
 ( byte* sbuf, byte* rbuf, int rc, Op op, Comm comm, Request& request );
 void IReduceScatter
@@ -619,7 +635,6 @@ void IReduceScatter
 ( scomplex* sbuf, scomplex* rbuf, int rc, Op op, Comm comm, Request& request );
 void IReduceScatter
 ( dcomplex* sbuf, dcomplex* rbuf, int rc, Op op, Comm comm, Request& request );
-#endif
 
 // In-place option
 void ReduceScatter( byte* buf, int rc, Op op, Comm comm );
@@ -667,5 +682,51 @@ void IReduceScatter
   Op op, Comm comm, Request& request );
 #endif
 
+// Parallel file I/O
+//
+// Unlike the communication routines, I/O failures (e.g., a missing file or a 
+// full disk) are always reported, via std::runtime_error, since they are not 
+// programming errors. The counts of FileReadAll and FileWriteAll are in units 
+// of the given datatype, and FileReadAll throws if the file ends early. The
+// mode of FileOpen is a combination of the MODE_* constants.
+void FileOpen( Comm comm, std::string filename, int mode, File& file );
+void FileClose( File& file );
+void FileSetSize( File file, Offset size );
+void FileSync( File file );
+void FileSetView
+( File file, Offset displacement, Datatype entryType, Datatype fileType );
+void FileReadAtAll( File file, Offset offset, byte* buf, int count );
+void FileWriteAt( File file, Offset offset, const byte* buf, int count );
+void FileReadAll( File file, byte* buf, int count, Datatype type );
+void FileWriteAll( File file, const byte* buf, int count, Datatype type );
+// Independent, nonblocking access to raw bytes, completed by Wait or WaitAll
+void FileIReadAt
+( File file, Offset offset, byte* buf, int count, Request& request );
+void FileIWriteAt
+( File file, Offset offset, const byte* buf, int count, Request& request );
+
+// Communication accounting
+//
+// When enabled, every send, receive, and collective wrapper records its 
+// number of calls, the bytes in its send and receive buffers, and the time 
+// spent within it (for nonblocking routines, the time to start them), keyed 
+// on the routine (e.g., "AllGather" or "IAllGather") and the communicator.
+// The communicators of each Grid are named "MC", "MR", "VC", "VR", and 
+// "Grid", so that the statistics may be reported by distribution.
+struct CommStats
+{
+    unsigned long long numCalls, numBytes;
+    double time;
+};
+
+void EnableCommAccounting();
+void DisableCommAccounting();
+bool CommAccounting();
+void ResetCommAccounting();
+// If routine is empty, the statistics are summed over all routines
+CommStats GetCommStats( Comm comm, std::string routine="" );
+// Prints the statistics of this process, grouped by communicator name
+void PrintCommStats( std::ostream& os=std::cout );
+
 } // mpi
 } // elem
@@ -53,6 +53,9 @@ public:
 
     void Print( const std::string msg="" ) const;
     void Print( std::ostream& os, const std::string msg="" ) const;
+    // Binary checkpoints; see binary_io_decl.hpp for the file format
+    void WriteBinary( const std::string filename ) const;
+    void ReadBinary( const std::string filename );
 
     //
     // Entry manipulation
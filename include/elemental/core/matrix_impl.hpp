@@ -266,6 +266,62 @@ inline void
 Matrix<T,Int>::Print( const std::string msg ) const
 { Print( std::cout, msg ); }
 
+template<typename T,typename Int>
+inline void
+Matrix<T,Int>::WriteBinary( const std::string filename ) const
+{
+#ifndef RELEASE
+    PushCallStack("Matrix::WriteBinary");
+#endif
+    std::ofstream file
+    ( filename.c_str(), std::ios::binary | std::ios::trunc );
+    if( !file.is_open() )
+        throw std::runtime_error("Could not open "+filename);
+
+    const Int height = Height();
+    const Int width = Width();
+    byte header[BINARY_HEADER_SIZE];
+    FormBinaryHeader<T>( height, width, header );
+    file.write( (const char*)header, BINARY_HEADER_SIZE );
+    const T* buffer = LockedBuffer();
+    const Int ldim = LDim();
+    for( Int j=0; j<width; ++j )
+        file.write( (const char*)&buffer[j*ldim], height*sizeof(T) );
+    file.close();
+    if( !file )
+        throw std::runtime_error("Could not write "+filename);
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename T,typename Int>
+inline void
+Matrix<T,Int>::ReadBinary( const std::string filename )
+{
+#ifndef RELEASE
+    PushCallStack("Matrix::ReadBinary");
+#endif
+    std::ifstream file( filename.c_str(), std::ios::binary );
+    if( !file.is_open() )
+        throw std::runtime_error("Could not open "+filename);
+
+    byte header[BINARY_HEADER_SIZE];
+    if( !file.read( (char*)header, BINARY_HEADER_SIZE ) )
+        throw std::runtime_error(filename+" is not a binary matrix file");
+    Int height, width;
+    ParseBinaryHeader<T>( header, height, width, filename );
+    ResizeTo( height, width );
+    T* buffer = Buffer();
+    const Int ldim = LDim();
+    for( Int j=0; j<width; ++j )
+        if( !file.read( (char*)&buffer[j*ldim], height*sizeof(T) ) )
+            throw std::runtime_error(filename+": unexpected end of file");
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
 //
 // Entry manipulation
 //
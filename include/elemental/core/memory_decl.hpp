@@ -9,6 +9,49 @@
 
 namespace elem {
 
+// Memory<G> draws its buffers from a process-wide pool of size classes, 
+// spaced four per power of two, so that the repeated Require/Release cycles 
+// within blocked algorithms reuse existing buffers rather than returning to 
+// the system allocator. Each thread keeps a small cache of free blocks and 
+// the remaining free blocks are shared. Buffers are aligned to the 
+// MemoryAlignment, and the free blocks held by the pool are capped at the 
+// MemoryPoolCap bytes, beyond which they are returned to the system.
+//
+// Since buffers are not constructed, G must be a plain datatype, e.g., an
+// integer, real, or Complex<R>.
+
+struct MemoryPoolStats
+{
+    // The number of buffers requested and how many of them were served from 
+    // the pool rather than the system allocator
+    unsigned long long numRequests, numPoolHits;
+    // The number of bytes currently handed out, the maximum number of 
+    // bytes which were ever simultaneously handed out since the last reset, 
+    // and the number of bytes held in the free lists of the pool
+    unsigned long long bytesInUse, peakBytesInUse, bytesCached;
+};
+
+void SetMemoryPooling( bool pooling );
+bool MemoryPooling();
+// Must be a power of two which is at least the cache line size (64 bytes)
+void SetMemoryAlignment( std::size_t alignment );
+std::size_t MemoryAlignment();
+void SetMemoryPoolCap( std::size_t capBytes );
+std::size_t MemoryPoolCap();
+
+// Return all of the free blocks to the system. This should not be called 
+// from within a parallel region.
+void ReleaseMemoryPool();
+
+MemoryPoolStats GetMemoryPoolStats();
+void ResetMemoryPoolStats();
+void PrintMemoryPoolStats( const std::string msg="" );
+void PrintMemoryPoolStats( std::ostream& os, const std::string msg="" );
+
+// The raw interface to the pool which is used by Memory<G>
+void* PoolAllocate( std::size_t numBytes );
+void PoolFree( void* buffer );
+
 template<typename G>
 class Memory
 {
@@ -18,13 +18,13 @@ Memory<G>::Memory()
 template<typename G>
 inline 
 Memory<G>::Memory( std::size_t size )
-: size_(size), buffer_(new G[size])
-{ }
+: size_(0), buffer_(NULL)
+{ Require( size ); }
 
 template<typename G>
 inline 
 Memory<G>::~Memory()
-{ delete[] buffer_; }
+{ PoolFree( buffer_ ); }
 
 template<typename G>
 inline G* 
@@ -42,11 +42,13 @@ Memory<G>::Require( std::size_t size )
 {
     if( size > size_ )
     {
-        delete[] buffer_;
+        PoolFree( buffer_ );
+        buffer_ = NULL;
+        size_ = 0;
 #ifndef RELEASE
         try {
 #endif
-        buffer_ = new G[size];
+        buffer_ = static_cast<G*>(PoolAllocate( size*sizeof(G) ));
 #ifndef RELEASE
         } 
         catch( std::bad_alloc& exception )
@@ -60,20 +62,18 @@ Memory<G>::Require( std::size_t size )
     }
 }
 
+// The buffer is returned to the pool, so a subsequent Require of a similar
+// size is typically served without calling the system allocator
 template<typename G>
 inline void 
 Memory<G>::Release()
-{
-#ifndef POOL_MEMORY
-    this->Empty();
-#endif
-}
+{ this->Empty(); }
 
 template<typename G>
 inline void 
 Memory<G>::Empty()
 {
-    delete[] buffer_;
+    PoolFree( buffer_ );
     size_ = 0;
     buffer_ = 0;
 }
@@ -0,0 +1,51 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace elem {
+
+//
+// Kernels for packing the local data of distributed matrices into contiguous
+// communication buffers and for unpacking them again. The unit-stride cases
+// are written so that they may be vectorized, the strided cases avoid index
+// arithmetic within their inner loops, and the conjugating versions treat
+// complex data as interleaved real and imaginary parts.
+//
+
+// Generalization of std::memcpy so that unit strides are not required:
+//     dest[i*destStride] := source[i*sourceStride],  0 <= i < numEntries
+template<typename T>
+void StridedMemCopy
+(       T* dest,   std::size_t destStride,
+  const T* source, std::size_t sourceStride, std::size_t numEntries );
+
+// The same as StridedMemCopy, but the entries are conjugated
+template<typename T>
+void ConjStridedMemCopy
+(       T* dest,   std::size_t destStride,
+  const T* source, std::size_t sourceStride, std::size_t numEntries );
+
+// Copies a height x width matrix between two arbitrary strided layouts:
+//     B[i*colStrideB+j*rowStrideB] := A[i*colStrideA+j*rowStrideA]
+// e.g., a column-major matrix with leading dimension ldim has a column stride
+// of one and a row stride of ldim. Transpositions, where the unit stride of A
+// is along the rows of B, are performed in cache-sized blocks.
+template<typename T>
+void InterleaveMatrix
+( std::size_t height, std::size_t width,
+  const T* A, std::size_t colStrideA, std::size_t rowStrideA,
+        T* B, std::size_t colStrideB, std::size_t rowStrideB );
+
+// The same as InterleaveMatrix, but the entries are conjugated
+template<typename T>
+void ConjInterleaveMatrix
+( std::size_t height, std::size_t width,
+  const T* A, std::size_t colStrideA, std::size_t rowStrideA,
+        T* B, std::size_t colStrideB, std::size_t rowStrideB );
+
+} // namespace elem
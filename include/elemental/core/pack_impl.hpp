@@ -0,0 +1,222 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace elem {
+namespace pack {
+
+// The number of rows and columns in each block of a transposition
+const std::size_t TRANSPOSE_BLOCKSIZE = 64;
+
+struct Identity
+{
+    template<typename T>
+    static T Apply( const T& alpha ) { return alpha; }
+
+    template<typename T>
+    static void Contiguous( T* dest, const T* source, std::size_t numEntries )
+    { MemCopy( dest, source, numEntries ); }
+};
+
+struct Conjugate
+{
+    template<typename T>
+    static T Apply( const T& alpha ) { return Conj(alpha); }
+
+    // Conjugation is the identity for real datatypes
+    template<typename T>
+    static void Contiguous( T* dest, const T* source, std::size_t numEntries )
+    { MemCopy( dest, source, numEntries ); }
+
+    // Negate every other entry of the interleaved real and imaginary parts
+    template<typename R>
+    static void Contiguous
+    ( Complex<R>* dest, const Complex<R>* source, std::size_t numEntries )
+    {
+        R* destReal = reinterpret_cast<R*>(dest);
+        const R* sourceReal = reinterpret_cast<const R*>(source);
+        for( std::size_t i=0; i<numEntries; ++i )
+        {
+            destReal[2*i] = sourceReal[2*i];
+            destReal[2*i+1] = -sourceReal[2*i+1];
+        }
+    }
+};
+
+// Gather from a strided source into a contiguous destination
+template<class Op,typename T>
+inline void
+Gather
+( T* dest, const T* source, std::size_t sourceStride, std::size_t numEntries )
+{
+    const std::size_t s = sourceStride;
+    std::size_t i=0;
+    for( ; i+4<=numEntries; i+=4, source+=4*s )
+    {
+        dest[i  ] = Op::Apply(source[0  ]);
+        dest[i+1] = Op::Apply(source[s  ]);
+        dest[i+2] = Op::Apply(source[2*s]);
+        dest[i+3] = Op::Apply(source[3*s]);
+    }
+    for( ; i<numEntries; ++i, source+=s )
+        dest[i] = Op::Apply(*source);
+}
+
+// Scatter from a contiguous source into a strided destination
+template<class Op,typename T>
+inline void
+Scatter
+( T* dest, std::size_t destStride, const T* source, std::size_t numEntries )
+{
+    const std::size_t s = destStride;
+    std::size_t i=0;
+    for( ; i+4<=numEntries; i+=4, dest+=4*s )
+    {
+        dest[0  ] = Op::Apply(source[i  ]);
+        dest[s  ] = Op::Apply(source[i+1]);
+        dest[2*s] = Op::Apply(source[i+2]);
+        dest[3*s] = Op::Apply(source[i+3]);
+    }
+    for( ; i<numEntries; ++i, dest+=s )
+        *dest = Op::Apply(source[i]);
+}
+
+template<class Op,typename T>
+inline void
+StridedCopy
+(       T* dest,   std::size_t destStride,
+  const T* source, std::size_t sourceStride, std::size_t numEntries )
+{
+    if( destStride == 1 && sourceStride == 1 )
+        Op::Contiguous( dest, source, numEntries );
+    else if( destStride == 1 )
+        Gather<Op>( dest, source, sourceStride, numEntries );
+    else if( sourceStride == 1 )
+        Scatter<Op>( dest, destStride, source, numEntries );
+    else
+    {
+        for( std::size_t i=0; i<numEntries; ++i )
+        {
+            *dest = Op::Apply(*source);
+            dest += destStride;
+            source += sourceStride;
+        }
+    }
+}
+
+template<class Op,typename T>
+inline void
+Interleave
+( std::size_t height, std::size_t width,
+  const T* A, std::size_t colStrideA, std::size_t rowStrideA,
+        T* B, std::size_t colStrideB, std::size_t rowStrideB )
+{
+    if( height == 0 || width == 0 )
+        return;
+    if( colStrideA != 1 && colStrideB != 1 &&
+        (rowStrideA == 1 || rowStrideB == 1) )
+    {
+        // Traverse the matrix by rows instead
+        Interleave<Op>
+        ( width, height, A, rowStrideA, colStrideA, B, rowStrideB, colStrideB );
+    }
+    else if( colStrideA == 1 && colStrideB == 1 )
+    {
+        if( rowStrideA == height && rowStrideB == height )
+            Op::Contiguous( B, A, height*width );
+        else
+        {
+#ifdef HAVE_OPENMP
+            #pragma omp parallel for
+#endif
+            for( std::size_t j=0; j<width; ++j )
+                Op::Contiguous( &B[j*rowStrideB], &A[j*rowStrideA], height );
+        }
+    }
+    else if( (colStrideA == 1 && rowStrideB == 1) ||
+             (rowStrideA == 1 && colStrideB == 1) )
+    {
+        // A transposition: copy blocks which fit in cache so that the lines
+        // of both A and B are reused
+        const std::size_t bsize = TRANSPOSE_BLOCKSIZE;
+        const std::size_t numColBlocks = (width+bsize-1)/bsize;
+#ifdef HAVE_OPENMP
+        #pragma omp parallel for
+#endif
+        for( std::size_t jBlock=0; jBlock<numColBlocks; ++jBlock )
+        {
+            const std::size_t jStart = jBlock*bsize;
+            const std::size_t jEnd = std::min(jStart+bsize,width);
+            for( std::size_t iStart=0; iStart<height; iStart+=bsize )
+            {
+                const std::size_t blockHeight = std::min(bsize,height-iStart);
+                for( std::size_t j=jStart; j<jEnd; ++j )
+                    StridedCopy<Op>
+                    ( &B[iStart*colStrideB+j*rowStrideB], colStrideB,
+                      &A[iStart*colStrideA+j*rowStrideA], colStrideA,
+                      blockHeight );
+            }
+        }
+    }
+    else
+    {
+#ifdef HAVE_OPENMP
+        #pragma omp parallel for
+#endif
+        for( std::size_t j=0; j<width; ++j )
+            StridedCopy<Op>
+            ( &B[j*rowStrideB], colStrideB, &A[j*rowStrideA], colStrideA,
+              height );
+    }
+}
+
+} // namespace pack
+
+template<typename T>
+inline void
+StridedMemCopy
+(       T* dest,   std::size_t destStride,
+  const T* source, std::size_t sourceStride, std::size_t numEntries )
+{
+    pack::StridedCopy<pack::Identity>
+    ( dest, destStride, source, sourceStride, numEntries );
+}
+
+template<typename T>
+inline void
+ConjStridedMemCopy
+(       T* dest,   std::size_t destStride,
+  const T* source, std::size_t sourceStride, std::size_t numEntries )
+{
+    pack::StridedCopy<pack::Conjugate>
+    ( dest, destStride, source, sourceStride, numEntries );
+}
+
+template<typename T>
+inline void
+InterleaveMatrix
+( std::size_t height, std::size_t width,
+  const T* A, std::size_t colStrideA, std::size_t rowStrideA,
+        T* B, std::size_t colStrideB, std::size_t rowStrideB )
+{
+    pack::Interleave<pack::Identity>
+    ( height, width, A, colStrideA, rowStrideA, B, colStrideB, rowStrideB );
+}
+
+template<typename T>
+inline void
+ConjInterleaveMatrix
+( std::size_t height, std::size_t width,
+  const T* A, std::size_t colStrideA, std::size_t rowStrideA,
+        T* B, std::size_t colStrideB, std::size_t rowStrideB )
+{
+    pack::Interleave<pack::Conjugate>
+    ( height, width, A, colStrideA, rowStrideA, B, colStrideB, rowStrideB );
+}
+
+} // namespace elem
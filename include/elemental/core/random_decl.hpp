@@ -15,4 +15,8 @@ const double Pi = 3.141592653589793;
 // origin of the ring implied by the type T using the most natural metric.
 template<typename T> T SampleUnitBall();
 
+// Generate a sample from a normal PDF with zero mean and unit variance. For 
+// complex types, the real and imaginary parts each have variance 1/2.
+template<typename T> T SampleNormal();
+
 } // namespace elem
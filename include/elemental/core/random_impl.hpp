@@ -55,4 +55,42 @@ SampleUnitBall<Complex<double> >()
     return Complex<double>(r*cos(angle),r*sin(angle));
 }
 
+template<>
+inline float
+SampleNormal<float>()
+{
+    float X;
+    plcg::ParallelGaussianRandomVariable( X );
+    return X;
+}
+
+template<>
+inline double
+SampleNormal<double>()
+{
+    double X;
+    plcg::ParallelGaussianRandomVariable( X );
+    return X;
+}
+
+template<>
+inline Complex<float>
+SampleNormal<Complex<float> >()
+{
+    float X, Y;
+    plcg::ParallelBoxMuller( X, Y );
+    const float scale = 1/Sqrt(2.f);
+    return Complex<float>(scale*X,scale*Y);
+}
+
+template<>
+inline Complex<double>
+SampleNormal<Complex<double> >()
+{
+    double X, Y;
+    plcg::ParallelBoxMuller( X, Y );
+    const double scale = 1/Sqrt(2.);
+    return Complex<double>(scale*X,scale*Y);
+}
+
 } // namespace elem
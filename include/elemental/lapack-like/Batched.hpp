@@ -0,0 +1,936 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace elem {
+namespace batched {
+
+// The maximum number of entries exchanged by each round of AllGatherBatch.
+// Keeping each round small ensures that the int counts and displacements 
+// passed to MPI cannot overflow, no matter how large the entire batch is, and
+// bounds the size of the staging buffers.
+const int MAX_GATHER_ENTRIES = 1<<22;
+
+// Returns the index, within the entire batch, of the first member held by
+// this process, where each process holds a contiguous portion of the batch
+// and the portions are ordered by rank
+inline int
+BatchOffset( int localBatchSize, mpi::Comm comm )
+{
+    const int commRank = mpi::CommRank( comm );
+    const int commSize = mpi::CommSize( comm );
+    std::vector<int> localBatchSizes( commSize );
+    mpi::AllGather( &localBatchSize, 1, &localBatchSizes[0], 1, comm );
+    int offset = 0;
+    for( int q=0; q<commRank; ++q )
+        offset += localBatchSizes[q];
+    return offset;
+}
+
+// Keeps track of the first member of the batch which failed, as exceptions
+// cannot be allowed to escape from an OpenMP parallel region
+class Failure
+{
+public:
+    Failure() : index_(-1) { }
+
+    void Record( int k, const char* what )
+    {
+#ifdef HAVE_OPENMP
+        #pragma omp critical(ElemBatchedFailure)
+#endif
+        {
+            if( index_ < 0 || k < index_ )
+            {
+                index_ = k;
+                what_ = what;
+            }
+        }
+    }
+
+    // Agree upon the first failure over the entire communicator, where the
+    // members held by this process begin at index 'offset' of the batch
+    void AllReduce( int offset, mpi::Comm comm )
+    {
+        const int maxInt = std::numeric_limits<int>::max();
+        const int localIndex = ( index_ < 0 ? maxInt : offset+index_ );
+        int index;
+        mpi::AllReduce( &localIndex, &index, 1, mpi::MIN, comm );
+        if( index == maxInt )
+            index_ = -1;
+        else
+        {
+            if( index != localIndex )
+                what_ = "(on another process)";
+            index_ = index;
+        }
+    }
+
+    void Throw() const
+    {
+        if( index_ >= 0 )
+        {
+            std::ostringstream msg;
+            msg << "Member " << index_ << " of the batch failed: " << what_;
+            throw std::runtime_error( msg.str().c_str() );
+        }
+    }
+
+private:
+    int index_;
+    std::string what_;
+};
+
+// Runs kernel(k) for each k in [0,batchSize), spread over the OpenMP threads.
+// Dynamic scheduling balances batches whose members vary in size.
+//
+// A failing member unwinds out of routines which could not pop their 
+// call-stack, profile, and blocksize entries. Since these stacks are shared 
+// by the threads, they are restored once every member has finished, rather
+// than after each failure.
+template<class Kernel>
+inline void
+Apply( const Kernel& kernel, int batchSize, Failure& failure )
+{
+    const StackDepths depths = GetStackDepths();
+#ifdef HAVE_OPENMP
+    #pragma omp parallel for schedule(dynamic)
+#endif
+    for( int k=0; k<batchSize; ++k )
+    {
+        try { kernel( k ); }
+        catch( std::exception& e ) { failure.Record( k, e.what() ); }
+    }
+    RestoreStackDepths( depths );
+}
+
+// If a communicator is given, each process holds (and processes) only its 
+// own portion of the batch, and the only communication is the agreement upon
+// the first failure
+template<class Kernel>
+inline void
+Apply( const Kernel& kernel, int batchSize, Failure& failure, mpi::Comm comm )
+{
+    Apply( kernel, batchSize, failure );
+    failure.AllReduce( BatchOffset( batchSize, comm ), comm );
+}
+
+// Copies the entries [beg,end) of the concatenation of the (column-major)
+// members of the batch into 'buffer', where offsets[k] is the position of 
+// the first entry of A[k] within the concatenation
+template<typename T>
+inline void
+PackBatch
+( const std::vector<Matrix<T> >& A, const std::vector<std::size_t>& offsets,
+  std::size_t beg, std::size_t end, T* buffer )
+{
+    int k = std::upper_bound( offsets.begin(), offsets.end(), beg ) -
+            offsets.begin() - 1;
+    while( beg < end )
+    {
+        while( offsets[k+1] <= beg )
+            ++k;
+        const int height = A[k].Height();
+        const std::size_t entry = beg - offsets[k];
+        const int i = entry % height;
+        const int j = entry / height;
+        const std::size_t numEntries = 
+            std::min( std::size_t(height-i), end-beg );
+        MemCopy( buffer, A[k].LockedBuffer(i,j), numEntries );
+        buffer += numEntries;
+        beg += numEntries;
+    }
+}
+
+template<typename T>
+inline void
+UnpackBatch
+( const T* buffer, const std::vector<std::size_t>& offsets,
+  std::size_t beg, std::size_t end, std::vector<Matrix<T> >& A )
+{
+    int k = std::upper_bound( offsets.begin(), offsets.end(), beg ) -
+            offsets.begin() - 1;
+    while( beg < end )
+    {
+        while( offsets[k+1] <= beg )
+            ++k;
+        const int height = A[k].Height();
+        const std::size_t entry = beg - offsets[k];
+        const int i = entry % height;
+        const int j = entry / height;
+        const std::size_t numEntries = 
+            std::min( std::size_t(height-i), end-beg );
+        MemCopy( A[k].Buffer(i,j), buffer, numEntries );
+        buffer += numEntries;
+        beg += numEntries;
+    }
+}
+
+// Follows the convention of the sequential routines of only resizing outputs
+// which are not views, so that the outputs may also be stored contiguously
+template<typename T>
+inline void
+ResizeMember( Matrix<T>& A, int height, int width )
+{
+    if( A.Viewing() )
+    {
+        if( A.Height() != height || A.Width() != width )
+            throw std::logic_error("Viewed member of batch is the wrong size");
+    }
+    else
+        A.ResizeTo( height, width );
+}
+
+template<typename T>
+inline void
+ResizeBatch( std::vector<Matrix<T> >& A, int batchSize )
+{
+    if( (int)A.size() != batchSize )
+        A.resize( batchSize );
+}
+
+template<typename F>
+struct CholeskyKernel
+{
+    const char uplo;
+    std::vector<Matrix<F> >& A;
+
+    CholeskyKernel( UpperOrLower uploFact, std::vector<Matrix<F> >& AFact )
+    : uplo(UpperOrLowerToChar(uploFact)), A(AFact)
+    { }
+
+    void operator()( int k ) const
+    {
+        Matrix<F>& B = A[k];
+        lapack::Cholesky( uplo, B.Height(), B.Buffer(), B.LDim() );
+    }
+};
+
+template<typename F>
+struct LUKernel
+{
+    std::vector<Matrix<F> >& A;
+    std::vector<Matrix<int> >& p;
+
+    LUKernel
+    ( std::vector<Matrix<F> >& AFact, std::vector<Matrix<int> >& pFact )
+    : A(AFact), p(pFact)
+    { }
+
+    void operator()( int k ) const
+    {
+        Matrix<F>& B = A[k];
+        Matrix<int>& q = p[k];
+        // LAPACK completes the factorization even if it encounters a zero
+        // pivot, so the pivots are still converted to be zero-based
+        const int m = B.Height();
+        const int n = B.Width();
+        bool singular = false;
+        try { lapack::LU( m, n, B.Buffer(), B.LDim(), q.Buffer() ); }
+        catch( SingularMatrixException& e ) { singular = true; }
+        const int numPivots = q.Height();
+        int* pivots = q.Buffer();
+        for( int i=0; i<numPivots; ++i )
+            --pivots[i];
+        if( singular )
+            throw SingularMatrixException();
+    }
+};
+
+template<typename F>
+struct QRKernel
+{
+    std::vector<Matrix<F> >& A;
+    std::vector<Matrix<F> >& t;
+
+    QRKernel( std::vector<Matrix<F> >& AFact, std::vector<Matrix<F> >& tFact )
+    : A(AFact), t(tFact)
+    { }
+
+    void operator()( int k ) const
+    {
+        Matrix<F>& B = A[k];
+        lapack::QR
+        ( B.Height(), B.Width(), B.Buffer(), B.LDim(), t[k].Buffer() );
+    }
+};
+
+template<typename F>
+struct HermitianEigKernel
+{
+    typedef typename Base<F>::type R;
+
+    const char uplo;
+    std::vector<Matrix<F> >& A;
+    std::vector<Matrix<R> >& w;
+
+    HermitianEigKernel
+    ( UpperOrLower uploEig, 
+      std::vector<Matrix<F> >& AEig, std::vector<Matrix<R> >& wEig )
+    : uplo(UpperOrLowerToChar(uploEig)), A(AEig), w(wEig)
+    { }
+
+    void operator()( int k ) const
+    {
+        Matrix<F>& B = A[k];
+        lapack::HermitianEig
+        ( uplo, B.Height(), B.Buffer(), B.LDim(), w[k].Buffer(), false );
+    }
+};
+
+// The eigenvectors are computed within a copy of each member of the batch
+template<typename F>
+struct HermitianEigVectorsKernel
+{
+    typedef typename Base<F>::type R;
+
+    const char uplo;
+    const std::vector<Matrix<F> >& A;
+    std::vector<Matrix<R> >& w;
+    std::vector<Matrix<F> >& Z;
+
+    HermitianEigVectorsKernel
+    ( UpperOrLower uploEig, const std::vector<Matrix<F> >& AEig,
+      std::vector<Matrix<R> >& wEig, std::vector<Matrix<F> >& ZEig )
+    : uplo(UpperOrLowerToChar(uploEig)), A(AEig), w(wEig), Z(ZEig)
+    { }
+
+    void operator()( int k ) const
+    {
+        const Matrix<F>& B = A[k];
+        Matrix<F>& Y = Z[k];
+        const int n = B.Height();
+        for( int j=0; j<n; ++j )
+            MemCopy( Y.Buffer(0,j), B.LockedBuffer(0,j), n );
+        lapack::HermitianEig
+        ( uplo, n, Y.Buffer(), Y.LDim(), w[k].Buffer(), true );
+    }
+};
+
+template<typename T>
+struct GemmKernel
+{
+    const char transA, transB;
+    const T alpha, beta;
+    const std::vector<Matrix<T> >& A;
+    const std::vector<Matrix<T> >& B;
+    std::vector<Matrix<T> >& C;
+
+    GemmKernel
+    ( Orientation orientationOfA, Orientation orientationOfB,
+      T alphaGemm, const std::vector<Matrix<T> >& AGemm,
+                   const std::vector<Matrix<T> >& BGemm,
+      T betaGemm,        std::vector<Matrix<T> >& CGemm )
+    : transA(OrientationToChar(orientationOfA)),
+      transB(OrientationToChar(orientationOfB)),
+      alpha(alphaGemm), beta(betaGemm), A(AGemm), B(BGemm), C(CGemm)
+    { }
+
+    void operator()( int k ) const
+    {
+        const int m = C[k].Height();
+        const int n = C[k].Width();
+        const int kDim = ( transA == 'N' ? A[k].Width() : A[k].Height() );
+        blas::Gemm
+        ( transA, transB, m, n, kDim,
+          alpha, A[k].LockedBuffer(), A[k].LDim(),
+                 B[k].LockedBuffer(), B[k].LDim(),
+          beta,  C[k].Buffer(),       C[k].LDim() );
+    }
+};
+
+template<typename F>
+struct TrsmKernel
+{
+    const char side, uplo, trans, diag;
+    const F alpha;
+    const std::vector<Matrix<F> >& A;
+    std::vector<Matrix<F> >& B;
+
+    TrsmKernel
+    ( LeftOrRight sideTrsm, UpperOrLower uploTrsm,
+      Orientation orientation, UnitOrNonUnit diagTrsm,
+      F alphaTrsm, const std::vector<Matrix<F> >& ATrsm,
+                         std::vector<Matrix<F> >& BTrsm )
+    : side(LeftOrRightToChar(sideTrsm)), 
+      uplo(UpperOrLowerToChar(uploTrsm)),
+      trans(OrientationToChar(orientation)), 
+      diag(UnitOrNonUnitToChar(diagTrsm)),
+      alpha(alphaTrsm), A(ATrsm), B(BTrsm)
+    { }
+
+    void operator()( int k ) const
+    {
+        blas::Trsm
+        ( side, uplo, trans, diag, B[k].Height(), B[k].Width(),
+          alpha, A[k].LockedBuffer(), A[k].LDim(),
+                 B[k].Buffer(),       B[k].LDim() );
+    }
+};
+
+//
+// Argument checking and output resizing, which must be performed before
+// entering the parallel region
+//
+
+template<typename F>
+inline void
+CheckSquare( const std::vector<Matrix<F> >& A )
+{
+    const int batchSize = A.size();
+    for( int k=0; k<batchSize; ++k )
+        if( A[k].Height() != A[k].Width() )
+            throw std::logic_error("Each member of the batch must be square");
+}
+
+template<typename F>
+inline void
+PrepareLU( std::vector<Matrix<F> >& A, std::vector<Matrix<int> >& p )
+{
+    const int batchSize = A.size();
+    ResizeBatch( p, batchSize );
+    for( int k=0; k<batchSize; ++k )
+        ResizeMember( p[k], std::min(A[k].Height(),A[k].Width()), 1 );
+}
+
+template<typename F>
+inline void
+PrepareQR( std::vector<Matrix<F> >& A, std::vector<Matrix<F> >& t )
+{
+    const int batchSize = A.size();
+    ResizeBatch( t, batchSize );
+    for( int k=0; k<batchSize; ++k )
+        ResizeMember( t[k], std::min(A[k].Height(),A[k].Width()), 1 );
+}
+
+template<typename F>
+inline void
+PrepareHermitianEig
+( const std::vector<Matrix<F> >& A,
+  std::vector<Matrix<typename Base<F>::type> >& w )
+{
+    CheckSquare( A );
+    const int batchSize = A.size();
+    ResizeBatch( w, batchSize );
+    for( int k=0; k<batchSize; ++k )
+        ResizeMember( w[k], A[k].Height(), 1 );
+}
+
+template<typename F>
+inline void
+PrepareHermitianEig
+( const std::vector<Matrix<F> >& A,
+  std::vector<Matrix<typename Base<F>::type> >& w,
+  std::vector<Matrix<F> >& Z )
+{
+    PrepareHermitianEig( A, w );
+    const int batchSize = A.size();
+    ResizeBatch( Z, batchSize );
+    for( int k=0; k<batchSize; ++k )
+        ResizeMember( Z[k], A[k].Height(), A[k].Height() );
+}
+
+template<typename T>
+inline void
+CheckGemm
+( Orientation orientationOfA, Orientation orientationOfB,
+  const std::vector<Matrix<T> >& A, const std::vector<Matrix<T> >& B,
+  const std::vector<Matrix<T> >& C )
+{
+    const int batchSize = C.size();
+    if( (int)A.size() != batchSize || (int)B.size() != batchSize )
+        throw std::logic_error("Batches must be the same size");
+    for( int k=0; k<batchSize; ++k )
+    {
+        const int m =
+            ( orientationOfA == NORMAL ? A[k].Height() : A[k].Width() );
+        const int kA =
+            ( orientationOfA == NORMAL ? A[k].Width() : A[k].Height() );
+        const int kB =
+            ( orientationOfB == NORMAL ? B[k].Height() : B[k].Width() );
+        const int n =
+            ( orientationOfB == NORMAL ? B[k].Width() : B[k].Height() );
+        if( m != C[k].Height() || n != C[k].Width() || kA != kB )
+        {
+            std::ostringstream msg;
+            msg << "Nonconformal Gemm for member " << k << " of the batch";
+            throw std::logic_error( msg.str().c_str() );
+        }
+    }
+}
+
+template<typename F>
+inline void
+CheckTrsm
+( LeftOrRight side,
+  const std::vector<Matrix<F> >& A, const std::vector<Matrix<F> >& B )
+{
+    const int batchSize = B.size();
+    if( (int)A.size() != batchSize )
+        throw std::logic_error("Batches must be the same size");
+    CheckSquare( A );
+    for( int k=0; k<batchSize; ++k )
+    {
+        const int n = ( side == LEFT ? B[k].Height() : B[k].Width() );
+        if( A[k].Height() != n )
+        {
+            std::ostringstream msg;
+            msg << "Nonconformal Trsm for member " << k << " of the batch";
+            throw std::logic_error( msg.str().c_str() );
+        }
+    }
+}
+
+} // namespace batched
+
+template<typename T>
+inline void
+AttachBatch
+( int batchSize, int height, int width,
+  Matrix<T>& storage, std::vector<Matrix<T> >& batch )
+{
+#ifndef RELEASE
+    PushCallStack("AttachBatch");
+    if( batchSize < 0 || height < 0 || width < 0 )
+        throw std::logic_error("Batch dimensions must be non-negative");
+#endif
+    storage.ResizeTo( height, batchSize*width );
+    batch.resize( batchSize );
+    for( int k=0; k<batchSize; ++k )
+        View( batch[k], storage, 0, k*width, height, width );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename T>
+inline void
+AllGatherBatch
+( const std::vector<Matrix<T> >& ALocal, std::vector<Matrix<T> >& A,
+  mpi::Comm comm )
+{
+#ifndef RELEASE
+    PushCallStack("AllGatherBatch");
+#else
+    PushProfileRegion("AllGatherBatch");
+#endif
+    const int commRank = mpi::CommRank( comm );
+    const int commSize = mpi::CommSize( comm );
+    const int localBatchSize = ALocal.size();
+
+    // Determine the portion of the batch held by each process
+    std::vector<int> localBatchSizes( commSize ), batchOffsets( commSize+1 );
+    mpi::AllGather( &localBatchSize, 1, &localBatchSizes[0], 1, comm );
+    batchOffsets[0] = 0;
+    for( int q=0; q<commSize; ++q )
+        batchOffsets[q+1] = batchOffsets[q] + localBatchSizes[q];
+    const int batchSize = batchOffsets[commSize];
+
+    // Gather the dimensions of every member of the batch
+    std::vector<int> localDims( std::max(2*localBatchSize,1) ),
+                     dims( std::max(2*batchSize,1) ),
+                     dimCounts( commSize ), dimDispls( commSize );
+    for( int k=0; k<localBatchSize; ++k )
+    {
+        localDims[2*k] = ALocal[k].Height();
+        localDims[2*k+1] = ALocal[k].Width();
+    }
+    for( int q=0; q<commSize; ++q )
+    {
+        dimCounts[q] = 2*localBatchSizes[q];
+        dimDispls[q] = 2*batchOffsets[q];
+    }
+    mpi::AllGather
+    ( &localDims[0], 2*localBatchSize,
+      &dims[0], &dimCounts[0], &dimDispls[0], comm );
+    batched::ResizeBatch( A, batchSize );
+    for( int k=0; k<batchSize; ++k )
+        batched::ResizeMember( A[k], dims[2*k], dims[2*k+1] );
+
+    // The position of each member within the concatenation of the batch can
+    // easily exceed the range of an int
+    std::vector<std::size_t> offsets( batchSize+1 ), 
+                             localOffsets( localBatchSize+1 );
+    offsets[0] = 0;
+    for( int k=0; k<batchSize; ++k )
+        offsets[k+1] = offsets[k] + std::size_t(dims[2*k])*dims[2*k+1];
+    for( int k=0; k<=localBatchSize; ++k )
+        localOffsets[k] = offsets[batchOffsets[commRank]+k] - 
+                          offsets[batchOffsets[commRank]];
+
+    // Exchange the entries in rounds of at most 'chunk' entries per process
+    const std::size_t chunk = 
+        std::max( batched::MAX_GATHER_ENTRIES/commSize, 1 );
+    std::size_t maxLocalEntries = 0;
+    for( int q=0; q<commSize; ++q )
+        maxLocalEntries = std::max
+        ( maxLocalEntries, offsets[batchOffsets[q+1]]-offsets[batchOffsets[q]] );
+    const std::size_t numRounds = (maxLocalEntries+chunk-1) / chunk;
+    std::vector<T> sendBuf( chunk ), recvBuf( commSize*chunk );
+    std::vector<int> recvCounts( commSize ), recvDispls( commSize );
+    for( std::size_t round=0; round<numRounds; ++round )
+    {
+        const std::size_t roundBeg = round*chunk;
+        int recvSize = 0;
+        for( int q=0; q<commSize; ++q )
+        {
+            const std::size_t numLocalEntries = 
+                offsets[batchOffsets[q+1]] - offsets[batchOffsets[q]];
+            recvCounts[q] = ( numLocalEntries > roundBeg ? 
+                              std::min(chunk,numLocalEntries-roundBeg) : 0 );
+            recvDispls[q] = recvSize;
+            recvSize += recvCounts[q];
+        }
+        const int sendCount = recvCounts[commRank];
+        batched::PackBatch
+        ( ALocal, localOffsets, roundBeg, roundBeg+sendCount, &sendBuf[0] );
+        mpi::AllGather
+        ( &sendBuf[0], sendCount,
+          &recvBuf[0], &recvCounts[0], &recvDispls[0], comm );
+        for( int q=0; q<commSize; ++q )
+        {
+            const std::size_t beg = offsets[batchOffsets[q]] + roundBeg;
+            batched::UnpackBatch
+            ( &recvBuf[recvDispls[q]], offsets, beg, beg+recvCounts[q], A );
+        }
+    }
+#ifndef RELEASE
+    PopCallStack();
+#else
+    PopProfileRegion();
+#endif
+}
+
+template<typename F>
+inline void
+BatchedCholesky( UpperOrLower uplo, std::vector<Matrix<F> >& A )
+{
+#ifndef RELEASE
+    PushCallStack("BatchedCholesky");
+    batched::CheckSquare( A );
+#else
+    PushProfileRegion("BatchedCholesky");
+#endif
+    batched::Failure failure;
+    batched::Apply
+    ( batched::CholeskyKernel<F>( uplo, A ), A.size(), failure );
+    failure.Throw();
+#ifndef RELEASE
+    PopCallStack();
+#else
+    PopProfileRegion();
+#endif
+}
+
+template<typename F>
+inline void
+BatchedCholesky
+( UpperOrLower uplo, std::vector<Matrix<F> >& A, mpi::Comm comm )
+{
+#ifndef RELEASE
+    PushCallStack("BatchedCholesky");
+    batched::CheckSquare( A );
+#else
+    PushProfileRegion("BatchedCholesky");
+#endif
+    batched::Failure failure;
+    batched::Apply
+    ( batched::CholeskyKernel<F>( uplo, A ), A.size(), failure, comm );
+    failure.Throw();
+#ifndef RELEASE
+    PopCallStack();
+#else
+    PopProfileRegion();
+#endif
+}
+
+template<typename F>
+inline void
+BatchedLU( std::vector<Matrix<F> >& A, std::vector<Matrix<int> >& p )
+{
+#ifndef RELEASE
+    PushCallStack("BatchedLU");
+#else
+    PushProfileRegion("BatchedLU");
+#endif
+    batched::PrepareLU( A, p );
+    batched::Failure failure;
+    batched::Apply( batched::LUKernel<F>( A, p ), A.size(), failure );
+    failure.Throw();
+#ifndef RELEASE
+    PopCallStack();
+#else
+    PopProfileRegion();
+#endif
+}
+
+template<typename F>
+inline void
+BatchedLU
+( std::vector<Matrix<F> >& A, std::vector<Matrix<int> >& p, mpi::Comm comm )
+{
+#ifndef RELEASE
+    PushCallStack("BatchedLU");
+#else
+    PushProfileRegion("BatchedLU");
+#endif
+    batched::PrepareLU( A, p );
+    batched::Failure failure;
+    batched::Apply( batched::LUKernel<F>( A, p ), A.size(), failure, comm );
+    failure.Throw();
+#ifndef RELEASE
+    PopCallStack();
+#else
+    PopProfileRegion();
+#endif
+}
+
+template<typename F>
+inline void
+BatchedQR( std::vector<Matrix<F> >& A, std::vector<Matrix<F> >& t )
+{
+#ifndef RELEASE
+    PushCallStack("BatchedQR");
+#else
+    PushProfileRegion("BatchedQR");
+#endif
+    batched::PrepareQR( A, t );
+    batched::Failure failure;
+    batched::Apply( batched::QRKernel<F>( A, t ), A.size(), failure );
+    failure.Throw();
+#ifndef RELEASE
+    PopCallStack();
+#else
+    PopProfileRegion();
+#endif
+}
+
+template<typename F>
+inline void
+BatchedQR
+( std::vector<Matrix<F> >& A, std::vector<Matrix<F> >& t, mpi::Comm comm )
+{
+#ifndef RELEASE
+    PushCallStack("BatchedQR");
+#else
+    PushProfileRegion("BatchedQR");
+#endif
+    batched::PrepareQR( A, t );
+    batched::Failure failure;
+    batched::Apply( batched::QRKernel<F>( A, t ), A.size(), failure, comm );
+    failure.Throw();
+#ifndef RELEASE
+    PopCallStack();
+#else
+    PopProfileRegion();
+#endif
+}
+
+template<typename F>
+inline void
+BatchedHermitianEig
+( UpperOrLower uplo, std::vector<Matrix<F> >& A,
+  std::vector<Matrix<typename Base<F>::type> >& w )
+{
+#ifndef RELEASE
+    PushCallStack("BatchedHermitianEig");
+#else
+    PushProfileRegion("BatchedHermitianEig");
+#endif
+    batched::PrepareHermitianEig( A, w );
+    batched::Failure failure;
+    batched::Apply
+    ( batched::HermitianEigKernel<F>( uplo, A, w ), A.size(), failure );
+    failure.Throw();
+#ifndef RELEASE
+    PopCallStack();
+#else
+    PopProfileRegion();
+#endif
+}
+
+template<typename F>
+inline void
+BatchedHermitianEig
+( UpperOrLower uplo, std::vector<Matrix<F> >& A,
+  std::vector<Matrix<typename Base<F>::type> >& w, mpi::Comm comm )
+{
+#ifndef RELEASE
+    PushCallStack("BatchedHermitianEig");
+#else
+    PushProfileRegion("BatchedHermitianEig");
+#endif
+    batched::PrepareHermitianEig( A, w );
+    batched::Failure failure;
+    batched::Apply
+    ( batched::HermitianEigKernel<F>( uplo, A, w ), A.size(), failure,
+      comm );
+    failure.Throw();
+#ifndef RELEASE
+    PopCallStack();
+#else
+    PopProfileRegion();
+#endif
+}
+
+template<typename F>
+inline void
+BatchedHermitianEig
+( UpperOrLower uplo, const std::vector<Matrix<F> >& A,
+  std::vector<Matrix<typename Base<F>::type> >& w,
+  std::vector<Matrix<F> >& Z )
+{
+#ifndef RELEASE
+    PushCallStack("BatchedHermitianEig");
+#else
+    PushProfileRegion("BatchedHermitianEig");
+#endif
+    batched::PrepareHermitianEig( A, w, Z );
+    batched::Failure failure;
+    batched::Apply
+    ( batched::HermitianEigVectorsKernel<F>( uplo, A, w, Z ), A.size(),
+      failure );
+    failure.Throw();
+#ifndef RELEASE
+    PopCallStack();
+#else
+    PopProfileRegion();
+#endif
+}
+
+template<typename F>
+inline void
+BatchedHermitianEig
+( UpperOrLower uplo, const std::vector<Matrix<F> >& A,
+  std::vector<Matrix<typename Base<F>::type> >& w,
+  std::vector<Matrix<F> >& Z, mpi::Comm comm )
+{
+#ifndef RELEASE
+    PushCallStack("BatchedHermitianEig");
+#else
+    PushProfileRegion("BatchedHermitianEig");
+#endif
+    batched::PrepareHermitianEig( A, w, Z );
+    batched::Failure failure;
+    batched::Apply
+    ( batched::HermitianEigVectorsKernel<F>( uplo, A, w, Z ), A.size(),
+      failure, comm );
+    failure.Throw();
+#ifndef RELEASE
+    PopCallStack();
+#else
+    PopProfileRegion();
+#endif
+}
+
+template<typename T>
+inline void
+BatchedGemm
+( Orientation orientationOfA, Orientation orientationOfB,
+  T alpha, const std::vector<Matrix<T> >& A,
+           const std::vector<Matrix<T> >& B,
+  T beta,        std::vector<Matrix<T> >& C )
+{
+#ifndef RELEASE
+    PushCallStack("BatchedGemm");
+    batched::CheckGemm( orientationOfA, orientationOfB, A, B, C );
+#else
+    PushProfileRegion("BatchedGemm");
+#endif
+    batched::Failure failure;
+    batched::Apply
+    ( batched::GemmKernel<T>
+      ( orientationOfA, orientationOfB, alpha, A, B, beta, C ),
+      C.size(), failure );
+    failure.Throw();
+#ifndef RELEASE
+    PopCallStack();
+#else
+    PopProfileRegion();
+#endif
+}
+
+template<typename T>
+inline void
+BatchedGemm
+( Orientation orientationOfA, Orientation orientationOfB,
+  T alpha, const std::vector<Matrix<T> >& A,
+           const std::vector<Matrix<T> >& B,
+  T beta,        std::vector<Matrix<T> >& C, mpi::Comm comm )
+{
+#ifndef RELEASE
+    PushCallStack("BatchedGemm");
+    batched::CheckGemm( orientationOfA, orientationOfB, A, B, C );
+#else
+    PushProfileRegion("BatchedGemm");
+#endif
+    batched::Failure failure;
+    batched::Apply
+    ( batched::GemmKernel<T>
+      ( orientationOfA, orientationOfB, alpha, A, B, beta, C ),
+      C.size(), failure, comm );
+    failure.Throw();
+#ifndef RELEASE
+    PopCallStack();
+#else
+    PopProfileRegion();
+#endif
+}
+
+template<typename F>
+inline void
+BatchedTrsm
+( LeftOrRight side, UpperOrLower uplo,
+  Orientation orientation, UnitOrNonUnit diag,
+  F alpha, const std::vector<Matrix<F> >& A, std::vector<Matrix<F> >& B )
+{
+#ifndef RELEASE
+    PushCallStack("BatchedTrsm");
+    batched::CheckTrsm( side, A, B );
+#else
+    PushProfileRegion("BatchedTrsm");
+#endif
+    batched::Failure failure;
+    batched::Apply
+    ( batched::TrsmKernel<F>( side, uplo, orientation, diag, alpha, A, B ),
+      B.size(), failure );
+    failure.Throw();
+#ifndef RELEASE
+    PopCallStack();
+#else
+    PopProfileRegion();
+#endif
+}
+
+template<typename F>
+inline void
+BatchedTrsm
+( LeftOrRight side, UpperOrLower uplo,
+  Orientation orientation, UnitOrNonUnit diag,
+  F alpha, const std::vector<Matrix<F> >& A, std::vector<Matrix<F> >& B,
+  mpi::Comm comm )
+{
+#ifndef RELEASE
+    PushCallStack("BatchedTrsm");
+    batched::CheckTrsm( side, A, B );
+#else
+    PushProfileRegion("BatchedTrsm");
+#endif
+    batched::Failure failure;
+    batched::Apply
+    ( batched::TrsmKernel<F>( side, uplo, orientation, diag, alpha, A, B ),
+      B.size(), failure, comm );
+    failure.Throw();
+#ifndef RELEASE
+    PopCallStack();
+#else
+    PopProfileRegion();
+#endif
+}
+
+} // namespace elem
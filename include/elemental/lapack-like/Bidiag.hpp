@@ -14,6 +14,7 @@
 #include "./Bidiag/UnblockedU.hpp"
 #include "./Bidiag/L.hpp"
 #include "./Bidiag/U.hpp"
+#include "./Bidiag/TwoStage.hpp"
 
 namespace elem {
 
@@ -22,15 +23,23 @@ inline void Bidiag( DistMatrix<R>& A )
 {
 #ifndef RELEASE
     PushCallStack("Bidiag");
+#else
+    PushProfileRegion("Bidiag");
 #endif
     if( IsComplex<R>::val )
         throw std::logic_error("Called real routine with complex datatype");
+    PushBlocksizeStack<R>( "Bidiag", A.Grid() );
+    // The second-stage transforms of BIDIAG_TWO_STAGE cannot be returned, so
+    // the normal approach is always used here
     if( A.Height() >= A.Width() )
         internal::BidiagU( A );
     else
         internal::BidiagL( A );
+    PopBlocksizeStack( "Bidiag" );
 #ifndef RELEASE
     PopCallStack();
+#else
+    PopProfileRegion();
 #endif
 }
 
@@ -42,13 +51,21 @@ inline void Bidiag
 {
 #ifndef RELEASE
     PushCallStack("Bidiag");
+#else
+    PushProfileRegion("Bidiag");
 #endif
+    PushBlocksizeStack<Complex<R> >( "Bidiag", A.Grid() );
+    // The second-stage transforms of BIDIAG_TWO_STAGE cannot be returned, so
+    // the normal approach is always used here
     if( A.Height() >= A.Width() )
         internal::BidiagU( A, tP, tQ );
     else
         internal::BidiagL( A, tP, tQ );
+    PopBlocksizeStack( "Bidiag" );
 #ifndef RELEASE
     PopCallStack();
+#else
+    PopProfileRegion();
 #endif
 }
 
@@ -462,6 +462,8 @@ Bidiag( Matrix<R>& A )
 {
 #ifndef RELEASE
     PushCallStack("Bidiag");
+#else
+    PushProfileRegion("Bidiag");
 #endif
     if( IsComplex<R>::val )
         throw std::logic_error("Called real routine with complex datatype");
@@ -471,6 +473,8 @@ Bidiag( Matrix<R>& A )
         bidiag::BidiagL( A );
 #ifndef RELEASE
     PopCallStack();
+#else
+    PopProfileRegion();
 #endif
 }
 
@@ -482,6 +486,8 @@ inline void Bidiag
 {
 #ifndef RELEASE
     PushCallStack("Bidiag");
+#else
+    PushProfileRegion("Bidiag");
 #endif
     if( A.Height() >= A.Width() )
         bidiag::BidiagU( A, tP, tQ );
@@ -489,6 +495,8 @@ inline void Bidiag
         bidiag::BidiagL( A, tP, tQ );
 #ifndef RELEASE
     PopCallStack();
+#else
+    PopProfileRegion();
 #endif
 }
 
@@ -0,0 +1,382 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace elem {
+namespace internal {
+
+// The two-stage bidiagonalization first reduces A (which must be at least as
+// tall as it is wide) to upper-banded form with bandwidth b by alternating
+// blocked QR factorizations of its column panels and LQ factorizations of its
+// row panels, and then chases the bulges out of a replicated copy of the band
+// one pair of reflectors (each of length at most b) at a time. The first-stage
+// Householder vectors are stored below the diagonal and above the b'th
+// superdiagonal, while the left and right second-stage reflectors are stored
+// in VLeft and VRight in the same format as the second-stage reflectors of
+// HermitianTridiagTwoStage, so that both can be applied with
+// ApplyBandToTridiagReflectors.
+
+template<typename R>
+inline void
+BidiagTwoStagePanelQR
+( DistMatrix<R>& P, DistMatrix<R>& ARight, DistMatrix<R,STAR,STAR>& tP )
+{
+    QR( P );
+    if( ARight.Width() > 0 )
+        ApplyPackedReflectors
+        ( LEFT, LOWER, VERTICAL, FORWARD, 0, P, ARight );
+}
+
+template<typename R>
+inline void
+BidiagTwoStagePanelQR
+( DistMatrix<Complex<R> >& P, DistMatrix<Complex<R> >& ARight,
+  DistMatrix<Complex<R>,STAR,STAR>& tP )
+{
+    DistMatrix<Complex<R>,MD,STAR> t( P.Grid() );
+    QR( P, t );
+    if( ARight.Width() > 0 )
+        ApplyPackedReflectors
+        ( LEFT, LOWER, VERTICAL, FORWARD, CONJUGATED, 0, P, t, ARight );
+    tP = t;
+}
+
+template<typename R>
+inline void
+BidiagTwoStagePanelLQ
+( DistMatrix<R>& P, DistMatrix<R>& ABottom, DistMatrix<R,STAR,STAR>& tP )
+{
+    LQ( P );
+    if( ABottom.Height() > 0 )
+        ApplyPackedReflectors
+        ( RIGHT, UPPER, HORIZONTAL, FORWARD, 0, P, ABottom );
+}
+
+template<typename R>
+inline void
+BidiagTwoStagePanelLQ
+( DistMatrix<Complex<R> >& P, DistMatrix<Complex<R> >& ABottom,
+  DistMatrix<Complex<R>,STAR,STAR>& tP )
+{
+    DistMatrix<Complex<R>,MD,STAR> t( P.Grid() );
+    LQ( P, t );
+    if( ABottom.Height() > 0 )
+        ApplyPackedReflectors
+        ( RIGHT, UPPER, HORIZONTAL, FORWARD, CONJUGATED, 0, P, t, ABottom );
+    tP = t;
+}
+
+// Reduces A to upper-banded form with bandwidth b, storing the Householder
+// scalars of the complex case in tP and tQ
+template<typename F>
+inline void
+BidiagBandReduction
+( DistMatrix<F>& A,
+  DistMatrix<F,STAR,STAR>& tP, DistMatrix<F,STAR,STAR>& tQ, int b )
+{
+#ifndef RELEASE
+    PushCallStack("internal::BidiagBandReduction");
+#endif
+    const Grid& g = A.Grid();
+    const int m = A.Height();
+    const int n = A.Width();
+    tQ.ResizeTo( n, 1 );
+    tP.ResizeTo( std::max(n-b,0), 1 );
+
+    DistMatrix<F> P(g), ARight(g), ABottom(g);
+    DistMatrix<F,STAR,STAR> t(g);
+    for( int k=0; k<n; k+=b )
+    {
+        const int w = std::min(b,n-k);
+
+        // Annihilate below the diagonal of the column panel
+        View( P, A, k, k, m-k, w );
+        View( ARight, A, k, k+w, m-k, n-(k+w) );
+        BidiagTwoStagePanelQR( P, ARight, t );
+        for( int j=0; j<t.Height(); ++j )
+            tQ.SetLocal( k+j, 0, t.GetLocal(j,0) );
+
+        // Annihilate to the right of the b'th superdiagonal of the row panel
+        if( k+w < n )
+        {
+            View( P, A, k, k+w, w, n-(k+w) );
+            View( ABottom, A, k+w, k+w, m-(k+w), n-(k+w) );
+            BidiagTwoStagePanelLQ( P, ABottom, t );
+            for( int j=0; j<t.Height(); ++j )
+                tP.SetLocal( k+j, 0, t.GetLocal(j,0) );
+        }
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+// Returns the address of entry (i,j) of the band, which is stored with
+// leading dimension 3b+1 so that it has room for the bulges, or zero if the
+// entry lies outside of the storage (and is therefore known to be zero)
+template<typename F>
+inline F*
+BidiagBandEntry( std::vector<F>& band, int b, int i, int j )
+{
+    const int offset = i-j+2*b;
+    if( offset < 0 || offset > 3*b )
+        return 0;
+    return &band[offset+j*(3*b+1)];
+}
+
+// Reduces the n x n upper-banded matrix with bandwidth b to real upper
+// bidiagonal form, storing the left and right reflectors in VLeft and VRight
+template<typename F>
+inline void
+BidiagBandToBidiag
+( int n, int b, std::vector<F>& band,
+  DistMatrix<F,STAR,VR>& VLeft, DistMatrix<F,STAR,VR>& VRight )
+{
+#ifndef RELEASE
+    PushCallStack("internal::BidiagBandToBidiag");
+#endif
+    const int numReflectors = TwoStageNumReflectors( n, b );
+    VLeft.ResizeTo( b, numReflectors );
+    VRight.ResizeTo( b, numReflectors );
+    const int VLShift = VLeft.RowShift();
+    const int VRShift = VRight.RowShift();
+    const int stride = VLeft.RowStride();
+
+    Matrix<F> chi, x;
+    std::vector<F> v(b);
+    int reflector = 0;
+    for( int j=0; j<n-1; ++j )
+    {
+        // Annihilate to the right of the superdiagonal of row j and then
+        // chase the resulting bulge down the band
+        int row = j;
+        for( int c=j+1; c<n; c+=b )
+        {
+            const int length = std::min(b,n-c);
+            const bool ownVL = ( (reflector+stride-VLShift) % stride == 0 );
+            const bool ownVR = ( (reflector+stride-VRShift) % stride == 0 );
+            const int reflectorLocalVL = (reflector-VLShift)/stride;
+            const int reflectorLocalVR = (reflector-VRShift)/stride;
+
+            // Form the reflector which annihilates A(row,c+1:c+length-1) when
+            // applied from the right, which requires the conjugated row
+            chi.ResizeTo( 1, 1 );
+            x.ResizeTo( length-1, 1 );
+            chi.Set( 0, 0, Conj(*BidiagBandEntry(band,b,row,c)) );
+            for( int k=1; k<length; ++k )
+                x.Set( k-1, 0, Conj(*BidiagBandEntry(band,b,row,c+k)) );
+            F tau = Reflector( chi, x );
+            *BidiagBandEntry(band,b,row,c) = chi.Get(0,0);
+            v[0] = 1;
+            for( int k=1; k<length; ++k )
+            {
+                *BidiagBandEntry(band,b,row,c+k) = 0;
+                v[k] = x.Get(k-1,0);
+            }
+            if( ownVR )
+            {
+                VRight.SetLocal( 0, reflectorLocalVR, tau );
+                for( int k=1; k<length; ++k )
+                    VRight.SetLocal( k, reflectorLocalVR, v[k] );
+            }
+
+            // Apply the reflector from the right to the other rows which
+            // intersect columns c:c+length-1, which creates a bulge below the
+            // diagonal
+            const int rowBeg = std::max(0,c-2*b);
+            const int rowEnd = std::min(n,c+length+b);
+            for( int i=rowBeg; i<rowEnd; ++i )
+            {
+                if( i == row )
+                    continue;
+                F delta = 0;
+                for( int k=0; k<length; ++k )
+                {
+                    const F* alpha = BidiagBandEntry(band,b,i,c+k);
+                    if( alpha != 0 )
+                        delta += (*alpha)*v[k];
+                }
+                delta *= tau;
+                for( int k=0; k<length; ++k )
+                {
+                    F* alpha = BidiagBandEntry(band,b,i,c+k);
+                    if( alpha != 0 )
+                        *alpha -= delta*Conj(v[k]);
+                }
+            }
+
+            // Form the reflector which annihilates A(c+1:c+length-1,c)
+            chi.Set( 0, 0, *BidiagBandEntry(band,b,c,c) );
+            for( int k=1; k<length; ++k )
+                x.Set( k-1, 0, *BidiagBandEntry(band,b,c+k,c) );
+            tau = Reflector( chi, x );
+            *BidiagBandEntry(band,b,c,c) = chi.Get(0,0);
+            v[0] = 1;
+            for( int k=1; k<length; ++k )
+            {
+                *BidiagBandEntry(band,b,c+k,c) = 0;
+                v[k] = x.Get(k-1,0);
+            }
+            if( ownVL )
+            {
+                VLeft.SetLocal( 0, reflectorLocalVL, tau );
+                for( int k=1; k<length; ++k )
+                    VLeft.SetLocal( k, reflectorLocalVL, v[k] );
+            }
+
+            // Apply the adjoint of the reflector from the left to the other
+            // columns which intersect rows c:c+length-1, which creates the
+            // next bulge to the right of the band
+            const int colBeg = std::max(0,c-b);
+            const int colEnd = std::min(n,c+length+2*b);
+            for( int s=colBeg; s<colEnd; ++s )
+            {
+                if( s == c )
+                    continue;
+                F delta = 0;
+                for( int k=0; k<length; ++k )
+                {
+                    const F* alpha = BidiagBandEntry(band,b,c+k,s);
+                    if( alpha != 0 )
+                        delta += Conj(v[k])*(*alpha);
+                }
+                delta *= Conj(tau);
+                for( int k=0; k<length; ++k )
+                {
+                    F* alpha = BidiagBandEntry(band,b,c+k,s);
+                    if( alpha != 0 )
+                        *alpha -= v[k]*delta;
+                }
+            }
+
+            row = c;
+            ++reflector;
+        }
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename F>
+inline void
+BidiagTwoStageHelper
+( DistMatrix<F>& A, DistMatrix<F,STAR,STAR>& tP, DistMatrix<F,STAR,STAR>& tQ,
+  DistMatrix<F,STAR,VR>& VLeft, DistMatrix<F,STAR,VR>& VRight )
+{
+#ifndef RELEASE
+    PushCallStack("internal::BidiagTwoStageHelper");
+#endif
+    const Grid& g = A.Grid();
+    const int n = A.Width();
+    const int b = std::max( std::min(Blocksize(),n-1), 1 );
+    BidiagBandReduction( A, tP, tQ, b );
+
+    // Replicate the band on every process by summing the locally owned
+    // entries over the grid
+    const int colShift = A.ColShift();
+    const int rowShift = A.RowShift();
+    const int colStride = A.ColStride();
+    const int rowStride = A.RowStride();
+    const int localWidth = A.LocalWidth();
+    std::vector<F> sendBuffer( (b+1)*n, F(0) ), recvBuffer( (b+1)*n );
+    for( int jLocal=0; jLocal<localWidth; ++jLocal )
+    {
+        const int j = rowShift + jLocal*rowStride;
+        const int iLocalBeg =
+            LocalLength( std::max(0,j-b), colShift, colStride );
+        const int iLocalEnd = LocalLength( j+1, colShift, colStride );
+        for( int iLocal=iLocalBeg; iLocal<iLocalEnd; ++iLocal )
+        {
+            const int i = colShift + iLocal*colStride;
+            sendBuffer[(i-j+b)+j*(b+1)] = A.GetLocal(iLocal,jLocal);
+        }
+    }
+    mpi::AllReduce
+    ( &sendBuffer[0], &recvBuffer[0], (b+1)*n, mpi::SUM, g.Comm() );
+    const int ldim = 3*b+1;
+    std::vector<F> band( ldim*n, F(0) );
+    for( int j=0; j<n; ++j )
+        for( int i=0; i<=b; ++i )
+            band[(i+b)+j*ldim] = recvBuffer[i+j*(b+1)];
+
+    // Every process redundantly chases the bulges and keeps its columns of
+    // the second-stage reflectors for the back-transformations
+    BidiagBandToBidiag( n, b, band, VLeft, VRight );
+
+    // Store the bidiagonal matrix and clear the rest of the band below the
+    // first-stage reflectors
+    for( int jLocal=0; jLocal<localWidth; ++jLocal )
+    {
+        const int j = rowShift + jLocal*rowStride;
+        const int iLocalBeg =
+            LocalLength( std::max(0,j-b), colShift, colStride );
+        const int iLocalEnd = LocalLength( j+1, colShift, colStride );
+        for( int iLocal=iLocalBeg; iLocal<iLocalEnd; ++iLocal )
+        {
+            const int i = colShift + iLocal*colStride;
+            A.SetLocal
+            ( iLocal, jLocal, ( j-i <= 1 ? band[(i-j+2*b)+j*ldim] : F(0) ) );
+        }
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+// Reduces A to real upper bidiagonal form using the two-stage approach. A is
+// overwritten with the bidiagonal matrix, the Householder vectors of the
+// column panels (below the diagonal), and those of the row panels (above the
+// b'th superdiagonal, where they are implicitly one, and b=VLeft.Height()).
+template<typename R>
+inline void
+BidiagTwoStage
+( DistMatrix<R>& A, 
+  DistMatrix<R,STAR,VR>& VLeft, DistMatrix<R,STAR,VR>& VRight )
+{
+#ifndef RELEASE
+    PushCallStack("internal::BidiagTwoStage");
+    if( A.Height() < A.Width() )
+        throw std::logic_error("A must be at least as tall as it is wide");
+    if( A.Grid() != VLeft.Grid() || VLeft.Grid() != VRight.Grid() )
+        throw std::logic_error
+        ("{A,VLeft,VRight} must be distributed over the same grid");
+#endif
+    DistMatrix<R,STAR,STAR> tP( A.Grid() ), tQ( A.Grid() );
+    BidiagTwoStageHelper( A, tP, tQ, VLeft, VRight );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename R>
+inline void
+BidiagTwoStage
+( DistMatrix<Complex<R> >& A,
+  DistMatrix<Complex<R>,STAR,STAR>& tP,
+  DistMatrix<Complex<R>,STAR,STAR>& tQ,
+  DistMatrix<Complex<R>,STAR,VR>& VLeft,
+  DistMatrix<Complex<R>,STAR,VR>& VRight )
+{
+#ifndef RELEASE
+    PushCallStack("internal::BidiagTwoStage");
+    if( A.Height() < A.Width() )
+        throw std::logic_error("A must be at least as tall as it is wide");
+    if( A.Grid() != tP.Grid() || tP.Grid() != tQ.Grid() ||
+        tQ.Grid() != VLeft.Grid() || VLeft.Grid() != VRight.Grid() )
+        throw std::logic_error
+        ("{A,tP,tQ,VLeft,VRight} must be distributed over the same grid");
+#endif
+    BidiagTwoStageHelper( A, tP, tQ, VLeft, VRight );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+} // namespace internal
+} // namespace elem
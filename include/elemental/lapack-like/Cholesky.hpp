@@ -10,6 +10,7 @@
 #include "./Cholesky/LVar2.hpp"
 #include "./Cholesky/LVar3.hpp"
 #include "./Cholesky/LVar3Square.hpp"
+#include "./Cholesky/Tiled.hpp"
 #include "./Cholesky/UVar2.hpp"
 #include "./Cholesky/UVar3.hpp"
 #include "./Cholesky/UVar3Square.hpp"
@@ -42,13 +43,24 @@ Cholesky( UpperOrLower uplo, Matrix<F>& A )
     PushCallStack("Cholesky");
     if( A.Height() != A.Width() )
         throw std::logic_error("A must be square");
+#else
+    PushProfileRegion("Cholesky");
 #endif
-    if( uplo == LOWER )
+    if( internal::UseLocalTiles( A.Height(), A.Width() ) )
+    {
+        if( uplo == LOWER )
+            internal::CholeskyLTiled( A );
+        else
+            internal::CholeskyUTiled( A );
+    }
+    else if( uplo == LOWER )
         internal::CholeskyLVar3( A );
     else
         internal::CholeskyUVar3( A );
 #ifndef RELEASE
     PopCallStack();
+#else
+    PopProfileRegion();
 #endif
 }
 
@@ -58,7 +70,10 @@ Cholesky( UpperOrLower uplo, DistMatrix<F>& A )
 {
 #ifndef RELEASE
     PushCallStack("Cholesky");
+#else
+    PushProfileRegion("Cholesky");
 #endif
+    PushBlocksizeStack<F>( "Cholesky", A.Grid() );
     const Grid& g = A.Grid();
 
     if( g.Height() == g.Width() )
@@ -75,8 +90,11 @@ Cholesky( UpperOrLower uplo, DistMatrix<F>& A )
         else
             internal::CholeskyUVar3( A );
     }
+    PopBlocksizeStack( "Cholesky" );
 #ifndef RELEASE
     PopCallStack();
+#else
+    PopProfileRegion();
 #endif
 }
 
@@ -0,0 +1,239 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace elem {
+namespace internal {
+
+//
+// Rather than applying each step of the right-looking algorithm to the entire
+// trailing matrix, the matrix is split into nb x nb tiles and every update of
+// a single tile is an OpenMP task, with the dependencies tracked through the
+// top-left entry of each tile. Updates from different steps may therefore
+// overlap, e.g., the factorization of the next diagonal tile may begin as soon
+// as its own updates are complete.
+//
+
+template<typename F>
+inline void
+CholeskyLTiled( Matrix<F>& A )
+{
+#ifndef RELEASE
+    PushCallStack("internal::CholeskyLTiled");
+    if( A.Height() != A.Width() )
+        throw std::logic_error
+        ("Can only compute Cholesky factor of square matrices");
+#endif
+    const int n = A.Height();
+    const int nb = GetLocalTileSize();
+    const int numTiles = (n+nb-1)/nb;
+    bool failed = false;
+
+#ifdef HAVE_OMP_TASK_DEPEND
+    #pragma omp parallel
+    #pragma omp single
+#endif
+    for( int k=0; k<numTiles; ++k )
+    {
+        const int kSize = std::min(nb,n-k*nb);
+#ifdef HAVE_OMP_TASK_DEPEND
+        F* Akk = A.Buffer(k*nb,k*nb);
+        #pragma omp task depend(inout:Akk[0])
+#endif
+        if( !TileFailed( failed ) )
+        {
+            try
+            {
+                Matrix<F> A11;
+                View( A11, A, k*nb, k*nb, kSize, kSize );
+                CholeskyLVar3( A11 );
+            }
+            catch( std::exception& e ) { RecordTileFailure( failed ); }
+        }
+
+        for( int i=k+1; i<numTiles; ++i )
+        {
+            const int iSize = std::min(nb,n-i*nb);
+#ifdef HAVE_OMP_TASK_DEPEND
+            F* Aik = A.Buffer(i*nb,k*nb);
+            #pragma omp task depend(in:Akk[0]) depend(inout:Aik[0])
+#endif
+            if( !TileFailed( failed ) )
+            {
+                try
+                {
+                    Matrix<F> A11, A21;
+                    LockedView( A11, A, k*nb, k*nb, kSize, kSize );
+                    View( A21, A, i*nb, k*nb, iSize, kSize );
+                    Trsm( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), A11, A21 );
+                }
+                catch( std::exception& e ) { RecordTileFailure( failed ); }
+            }
+        }
+
+        for( int j=k+1; j<numTiles; ++j )
+        {
+            const int jSize = std::min(nb,n-j*nb);
+#ifdef HAVE_OMP_TASK_DEPEND
+            F* Ajk = A.Buffer(j*nb,k*nb);
+            F* Ajj = A.Buffer(j*nb,j*nb);
+            #pragma omp task depend(in:Ajk[0]) depend(inout:Ajj[0])
+#endif
+            if( !TileFailed( failed ) )
+            {
+                try
+                {
+                    Matrix<F> A21, A22;
+                    LockedView( A21, A, j*nb, k*nb, jSize, kSize );
+                    View( A22, A, j*nb, j*nb, jSize, jSize );
+                    Herk( LOWER, NORMAL, F(-1), A21, F(1), A22 );
+                }
+                catch( std::exception& e ) { RecordTileFailure( failed ); }
+            }
+
+            for( int i=j+1; i<numTiles; ++i )
+            {
+                const int iSize = std::min(nb,n-i*nb);
+#ifdef HAVE_OMP_TASK_DEPEND
+                F* Aik = A.Buffer(i*nb,k*nb);
+                F* Aij = A.Buffer(i*nb,j*nb);
+                #pragma omp task \
+                 depend(in:Aik[0],Ajk[0]) depend(inout:Aij[0])
+#endif
+                if( !TileFailed( failed ) )
+                {
+                    try
+                    {
+                        Matrix<F> A21, A31, A32;
+                        LockedView( A21, A, j*nb, k*nb, jSize, kSize );
+                        LockedView( A31, A, i*nb, k*nb, iSize, kSize );
+                        View( A32, A, i*nb, j*nb, iSize, jSize );
+                        Gemm( NORMAL, ADJOINT, F(-1), A31, A21, F(1), A32 );
+                    }
+                    catch( std::exception& e ) { RecordTileFailure( failed ); }
+                }
+            }
+        }
+    }
+    if( failed )
+        throw std::logic_error("A was not numerically HPD");
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename F>
+inline void
+CholeskyUTiled( Matrix<F>& A )
+{
+#ifndef RELEASE
+    PushCallStack("internal::CholeskyUTiled");
+    if( A.Height() != A.Width() )
+        throw std::logic_error
+        ("Can only compute Cholesky factor of square matrices");
+#endif
+    const int n = A.Height();
+    const int nb = GetLocalTileSize();
+    const int numTiles = (n+nb-1)/nb;
+    bool failed = false;
+
+#ifdef HAVE_OMP_TASK_DEPEND
+    #pragma omp parallel
+    #pragma omp single
+#endif
+    for( int k=0; k<numTiles; ++k )
+    {
+        const int kSize = std::min(nb,n-k*nb);
+#ifdef HAVE_OMP_TASK_DEPEND
+        F* Akk = A.Buffer(k*nb,k*nb);
+        #pragma omp task depend(inout:Akk[0])
+#endif
+        if( !TileFailed( failed ) )
+        {
+            try
+            {
+                Matrix<F> A11;
+                View( A11, A, k*nb, k*nb, kSize, kSize );
+                CholeskyUVar3( A11 );
+            }
+            catch( std::exception& e ) { RecordTileFailure( failed ); }
+        }
+
+        for( int j=k+1; j<numTiles; ++j )
+        {
+            const int jSize = std::min(nb,n-j*nb);
+#ifdef HAVE_OMP_TASK_DEPEND
+            F* Akj = A.Buffer(k*nb,j*nb);
+            #pragma omp task depend(in:Akk[0]) depend(inout:Akj[0])
+#endif
+            if( !TileFailed( failed ) )
+            {
+                try
+                {
+                    Matrix<F> A11, A12;
+                    LockedView( A11, A, k*nb, k*nb, kSize, kSize );
+                    View( A12, A, k*nb, j*nb, kSize, jSize );
+                    Trsm( LEFT, UPPER, ADJOINT, NON_UNIT, F(1), A11, A12 );
+                }
+                catch( std::exception& e ) { RecordTileFailure( failed ); }
+            }
+        }
+
+        for( int i=k+1; i<numTiles; ++i )
+        {
+            const int iSize = std::min(nb,n-i*nb);
+#ifdef HAVE_OMP_TASK_DEPEND
+            F* Aki = A.Buffer(k*nb,i*nb);
+            F* Aii = A.Buffer(i*nb,i*nb);
+            #pragma omp task depend(in:Aki[0]) depend(inout:Aii[0])
+#endif
+            if( !TileFailed( failed ) )
+            {
+                try
+                {
+                    Matrix<F> A12, A22;
+                    LockedView( A12, A, k*nb, i*nb, kSize, iSize );
+                    View( A22, A, i*nb, i*nb, iSize, iSize );
+                    Herk( UPPER, ADJOINT, F(-1), A12, F(1), A22 );
+                }
+                catch( std::exception& e ) { RecordTileFailure( failed ); }
+            }
+
+            for( int j=i+1; j<numTiles; ++j )
+            {
+                const int jSize = std::min(nb,n-j*nb);
+#ifdef HAVE_OMP_TASK_DEPEND
+                F* Akj = A.Buffer(k*nb,j*nb);
+                F* Aij = A.Buffer(i*nb,j*nb);
+                #pragma omp task \
+                 depend(in:Aki[0],Akj[0]) depend(inout:Aij[0])
+#endif
+                if( !TileFailed( failed ) )
+                {
+                    try
+                    {
+                        Matrix<F> A12, A13, A23;
+                        LockedView( A12, A, k*nb, i*nb, kSize, iSize );
+                        LockedView( A13, A, k*nb, j*nb, kSize, jSize );
+                        View( A23, A, i*nb, j*nb, iSize, jSize );
+                        Gemm( ADJOINT, NORMAL, F(-1), A12, A13, F(1), A23 );
+                    }
+                    catch( std::exception& e ) { RecordTileFailure( failed ); }
+                }
+            }
+        }
+    }
+    if( failed )
+        throw std::logic_error("A was not numerically HPD");
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+} // namespace internal
+} // namespace elem
@@ -31,27 +31,23 @@ HPSDSquareRoot( UpperOrLower uplo, DistMatrix<F>& A )
     DistMatrix<F> Z(g);
     HermitianEig( uplo, A, w, Z );
 
-    // Compute the two-norm of A as the maximum absolute value 
-    // of its eigenvalues
-    R maxLocalAbsEig = 0;
+    // Compute the two-norm of A as the maximum absolute value of its
+    // eigenvalues, as well as the smallest eigenvalue of A. Both are found
+    // with a single reduction by maximizing the negated smallest eigenvalue.
+    // The latter starts from the most negative value, rather than zero, so
+    // that minEig is the smallest eigenvalue even when A is positive-definite.
+    R localMaxs[2] = { 0, -std::numeric_limits<R>::max() };
     const int numLocalEigs = w.LocalHeight();
     for( int iLocal=0; iLocal<numLocalEigs; ++iLocal )
     {
         const R omega = w.GetLocal(iLocal,0);
-        maxLocalAbsEig = std::max(maxLocalAbsEig,Abs(omega));
+        localMaxs[0] = std::max(localMaxs[0],Abs(omega));
+        localMaxs[1] = std::max(localMaxs[1],-omega);
     }
-    R twoNorm;
-    mpi::AllReduce( &maxLocalAbsEig, &twoNorm, 1, mpi::MAX, g.VCComm() );
-
-    // Compute the smallest eigenvalue of A
-    R minLocalEig = twoNorm;
-    for( int iLocal=0; iLocal<numLocalEigs; ++iLocal )
-    {
-        const R omega = w.GetLocal(iLocal,0);
-        minLocalEig = std::min(minLocalEig,omega);
-    }
-    R minEig;
-    mpi::AllReduce( &minLocalEig, &minEig, 1, mpi::MIN, g.VCComm() );
+    R maxs[2];
+    mpi::AllReduce( localMaxs, maxs, 2, mpi::MAX, g.VCComm() );
+    const R twoNorm = maxs[0];
+    const R minEig = -maxs[1];
 
     // Set the tolerance equal to n ||A||_2 eps
     const int n = A.Height();
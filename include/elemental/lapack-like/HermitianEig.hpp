@@ -7,7 +7,10 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 
+#include "./HermitianEig/Util.hpp"
 #ifndef WITHOUT_PMRRR
+#include "./HermitianEig/Slice.hpp"
+#endif // WITHOUT_PMRRR
 
 namespace elem {
 
@@ -16,207 +19,7 @@ namespace elem {
 // distribution needed for backtransformation.
 #define TARGET_CHUNKS 20
 
-namespace hermitian_eig {
-
-// We create specialized redistribution routines for redistributing the 
-// real eigenvectors of the symmetric tridiagonal matrix at the core of our 
-// eigensolver in order to minimize the temporary memory usage.
-template<typename R>
-inline void
-InPlaceRedist
-( DistMatrix<R>& paddedZ,
-  int height,
-  int width,
-  int rowAlignmentOfInput,
-  const R* readBuffer )
-{
-    const Grid& g = paddedZ.Grid();
-
-    const int r = g.Height();
-    const int c = g.Width();
-    const int p = r * c;
-    const int row = g.Row();
-    const int col = g.Col();
-    const int rowShift = paddedZ.RowShift();
-    const int colAlignment = paddedZ.ColAlignment();
-
-    const int localWidthOfInput = 
-        LocalLength(width,g.VRRank(),rowAlignmentOfInput,p);
-
-    const int maxHeight = MaxLocalLength(height,r);
-    const int maxWidth = MaxLocalLength(width,p);
-    const int portionSize = 
-        std::max(maxHeight*maxWidth,mpi::MIN_COLL_MSG);
-    
-    // Allocate our send/recv buffers
-    std::vector<R> buffer(2*r*portionSize);
-    R* sendBuffer = &buffer[0];
-    R* recvBuffer = &buffer[r*portionSize];
-
-    // Pack
-#if defined(HAVE_OPENMP) && !defined(PARALLELIZE_INNER_LOOPS)
-    #pragma omp parallel for
-#endif
-    for( int k=0; k<r; ++k )
-    {
-        R* data = &sendBuffer[k*portionSize];
-
-        const int thisColShift = Shift(k,colAlignment,r);
-        const int thisLocalHeight = LocalLength(height,thisColShift,r);
-
-#if defined(HAVE_OPENMP) && defined(PARALLELIZE_INNER_LOOPS)
-        #pragma omp parallel for COLLAPSE(2)
-#endif
-        for( int j=0; j<localWidthOfInput; ++j )
-            for( int i=0; i<thisLocalHeight; ++i )
-                data[i+j*thisLocalHeight] = 
-                    readBuffer[thisColShift+i*r+j*height];
-    }
-
-    // Communicate
-    mpi::AllToAll
-    ( sendBuffer, portionSize,
-      recvBuffer, portionSize, g.ColComm() );
-
-    // Unpack
-    const int localHeight = LocalLength(height,row,colAlignment,r);
-#if defined(HAVE_OPENMP) && !defined(PARALLELIZE_INNER_LOOPS)
-    #pragma omp parallel for
-#endif
-    for( int k=0; k<r; ++k )
-    {
-        const R* data = &recvBuffer[k*portionSize];
-
-        const int thisRank = col+k*c;
-        const int thisRowShift = Shift(thisRank,rowAlignmentOfInput,p);
-        const int thisRowOffset = (thisRowShift-rowShift) / c;
-        const int thisLocalWidth = LocalLength(width,thisRowShift,p);
-
-#if defined(HAVE_OPENMP) && defined(PARALLELIZE_INNER_LOOPS)
-        #pragma omp parallel for
-#endif
-        for( int j=0; j<thisLocalWidth; ++j )
-        {
-            const R* dataCol = &(data[j*localHeight]);
-            R* thisCol = paddedZ.LocalBuffer(0,thisRowOffset+j*r);
-            MemCopy( thisCol, dataCol, localHeight );
-        }
-    }
-}
-
-template<typename R>
-inline void
-InPlaceRedist
-( DistMatrix<Complex<R> >& paddedZ,
-  int height,
-  int width,
-  int rowAlignmentOfInput,
-  const R* readBuffer )
-{
-    const Grid& g = paddedZ.Grid();
-
-    const int r = g.Height();
-    const int c = g.Width();
-    const int p = r * c;
-    const int row = g.Row();
-    const int col = g.Col();
-    const int rowShift = paddedZ.RowShift();
-    const int colAlignment = paddedZ.ColAlignment();
-
-    const int localWidthOfInput = 
-        LocalLength(width,g.VRRank(),rowAlignmentOfInput,p);
-
-    const int maxHeight = MaxLocalLength(height,r);
-    const int maxWidth = MaxLocalLength(width,p);
-    const int portionSize = 
-        std::max(maxHeight*maxWidth,mpi::MIN_COLL_MSG);
-    
-    // Allocate our send/recv buffers
-    std::vector<R> buffer(2*r*portionSize);
-    R* sendBuffer = &buffer[0];
-    R* recvBuffer = &buffer[r*portionSize];
-
-    // Pack
-#if defined(HAVE_OPENMP) && !defined(PARALLELIZE_INNER_LOOPS)
-    #pragma omp parallel for
-#endif
-    for( int k=0; k<r; ++k )
-    {
-        R* data = &sendBuffer[k*portionSize];
-
-        const int thisColShift = Shift(k,colAlignment,r);
-        const int thisLocalHeight = LocalLength(height,thisColShift,r);
-
-#if defined(HAVE_OPENMP) && defined(PARALLELIZE_INNER_LOOPS)
-        #pragma omp parallel for COLLAPSE(2)
-#endif
-        for( int j=0; j<localWidthOfInput; ++j )
-            for( int i=0; i<thisLocalHeight; ++i )
-                data[i+j*thisLocalHeight] = 
-                    readBuffer[thisColShift+i*r+j*height];
-    }
-
-    // Communicate
-    mpi::AllToAll
-    ( sendBuffer, portionSize,
-      recvBuffer, portionSize, g.ColComm() );
-
-    // Unpack
-    const int localHeight = LocalLength(height,row,colAlignment,r);
-#if defined(HAVE_OPENMP) && !defined(PARALLELIZE_INNER_LOOPS)
-    #pragma omp parallel for
-#endif
-    for( int k=0; k<r; ++k )
-    {
-        const R* data = &recvBuffer[k*portionSize];
-
-        const int thisRank = col+k*c;
-        const int thisRowShift = Shift(thisRank,rowAlignmentOfInput,p);
-        const int thisRowOffset = (thisRowShift-rowShift) / c;
-        const int thisLocalWidth = LocalLength(width,thisRowShift,p);
-
-#if defined(HAVE_OPENMP) && defined(PARALLELIZE_INNER_LOOPS)
-        #pragma omp parallel for
-#endif
-        for( int j=0; j<thisLocalWidth; ++j )
-        {
-            const R* dataCol = &(data[j*localHeight]);
-            R* thisCol = (R*)paddedZ.LocalBuffer(0,thisRowOffset+j*r);
-            for( int i=0; i<localHeight; ++i )
-            {
-                thisCol[2*i] = dataCol[i];
-                thisCol[2*i+1] = 0;
-            }
-        }
-    }
-}
-
-template<typename F>
-inline void
-CheckScale
-( UpperOrLower uplo, DistMatrix<F>& A, 
-  bool& needRescaling, typename Base<F>::type& scale )
-{
-    typedef typename Base<F>::type R;
-
-    scale = 1;
-    needRescaling = false;
-    const R maxNormOfA = HermitianNorm( uplo, A, MAX_NORM );
-    const R underflowThreshold = lapack::MachineUnderflowThreshold<R>();
-    const R overflowThreshold = lapack::MachineOverflowThreshold<R>();
-    if( maxNormOfA > 0 && maxNormOfA < underflowThreshold )
-    {
-        needRescaling = true;
-        scale = underflowThreshold / maxNormOfA;
-    }
-    else if( maxNormOfA > overflowThreshold )
-    {
-        needRescaling = true;
-        scale = overflowThreshold / maxNormOfA;
-    }
-}
-
-} // namespace hermitian_eig
+#ifndef WITHOUT_PMRRR
 
 //----------------------------------------------------------------------------//
 // Grab the full set of eigenpairs of the real, symmetric matrix A            //
@@ -226,11 +29,25 @@ HermitianEig
 ( UpperOrLower uplo, 
   DistMatrix<double>& A,
   DistMatrix<double,VR,STAR>& w,
-  DistMatrix<double>& paddedZ )
+  DistMatrix<double>& paddedZ,
+  TridiagEigAlg alg )
 {
 #ifndef RELEASE
     PushCallStack("HermitianEig");
+#else
+    PushProfileRegion("HermitianEig");
 #endif
+    if( alg == TRIDIAG_EIG_DIVIDE_AND_CONQUER )
+    {
+        hermitian_eig::DivideAndConquer
+        ( uplo, A, w, paddedZ, 0, A.Height()-1 );
+#ifndef RELEASE
+        PopCallStack();
+#else
+        PopProfileRegion();
+#endif
+        return;
+    }
     typedef double R;
 
     if( A.Height() != A.Width() )
@@ -283,7 +100,8 @@ HermitianEig
         ScaleTrapezoid( scale, LEFT, uplo, 0, A );
 
     // Tridiagonalize A
-    HermitianTridiag( uplo, A );
+    DistMatrix<R,STAR,VR> V(g);
+    hermitian_eig::Tridiagonalize( uplo, A, V );
 
     // Grab copies of the diagonal and subdiagonal of A
     DistMatrix<R,MD,STAR> d_MD_STAR( n,   1, g ),
@@ -366,18 +184,15 @@ HermitianEig
 
     // Backtransform the tridiagonal eigenvectors, Z
     paddedZ.ResizeTo( A.Height(), w.Height() ); // We can simply shrink matrices
-    if( uplo == LOWER )
-        ApplyPackedReflectors
-        ( LEFT, LOWER, VERTICAL, BACKWARD, subdiagonal, A, paddedZ );
-    else
-        ApplyPackedReflectors
-        ( LEFT, UPPER, VERTICAL, FORWARD,  subdiagonal, A, paddedZ );
+    hermitian_eig::BackTransform( uplo, A, V, paddedZ );
 
     // Rescale the eigenvalues if necessary
     if( needRescaling )
         Scale( 1/scale, w );
 #ifndef RELEASE
     PopCallStack();
+#else
+    PopProfileRegion();
 #endif
 }
 
@@ -394,11 +209,35 @@ HermitianEig
   DistMatrix<double>& A,
   DistMatrix<double,VR,STAR>& w,
   DistMatrix<double>& paddedZ,
-  int lowerBound, int upperBound )
+  int lowerBound, int upperBound, TridiagEigAlg alg )
 {
 #ifndef RELEASE
     PushCallStack("HermitianEig");
+#else
+    PushProfileRegion("HermitianEig");
+#endif
+    if( alg == TRIDIAG_EIG_DIVIDE_AND_CONQUER )
+    {
+        hermitian_eig::DivideAndConquer
+        ( uplo, A, w, paddedZ, lowerBound, upperBound );
+#ifndef RELEASE
+        PopCallStack();
+#else
+        PopProfileRegion();
 #endif
+        return;
+    }
+    if( GetHermitianEigNumSlices() > 1 )
+    {
+        hermitian_eig::SpectrumSlicing
+        ( uplo, A, w, paddedZ, lowerBound, upperBound );
+#ifndef RELEASE
+        PopCallStack();
+#else
+        PopProfileRegion();
+#endif
+        return;
+    }
     typedef double R;
     if( A.Height() != A.Width() )
         throw std::logic_error("Hermitian matrices must be square");
@@ -450,7 +289,8 @@ HermitianEig
         ScaleTrapezoid( scale, LEFT, uplo, 0, A );
 
     // Tridiagonalize A
-    HermitianTridiag( uplo, A );
+    DistMatrix<R,STAR,VR> V(g);
+    hermitian_eig::Tridiagonalize( uplo, A, V );
 
     // Grab copies of the diagonal and subdiagonal of A
     DistMatrix<R,MD,STAR> d_MD_STAR( n,   1, g ),
@@ -534,18 +374,15 @@ HermitianEig
 
     // Backtransform the tridiagonal eigenvectors, Z
     paddedZ.ResizeTo( A.Height(), w.Height() );
-    if( uplo == LOWER )
-        ApplyPackedReflectors
-        ( LEFT, LOWER, VERTICAL, BACKWARD, subdiagonal, A, paddedZ );
-    else
-        ApplyPackedReflectors
-        ( LEFT, UPPER, VERTICAL, FORWARD,  subdiagonal, A, paddedZ );
+    hermitian_eig::BackTransform( uplo, A, V, paddedZ );
 
     // Rescale the eigenvalues if necessary
     if( needRescaling )
         Scale( 1/scale, w );
 #ifndef RELEASE
     PopCallStack();
+#else
+    PopProfileRegion();
 #endif
 }
 
@@ -560,11 +397,35 @@ HermitianEig
   DistMatrix<double>& A,
   DistMatrix<double,VR,STAR>& w,
   DistMatrix<double>& paddedZ,
-  double lowerBound, double upperBound )
+  double lowerBound, double upperBound, TridiagEigAlg alg )
 {
 #ifndef RELEASE
     PushCallStack("HermitianEig");
+#else
+    PushProfileRegion("HermitianEig");
+#endif
+    if( alg == TRIDIAG_EIG_DIVIDE_AND_CONQUER )
+    {
+        hermitian_eig::DivideAndConquer
+        ( uplo, A, w, paddedZ, lowerBound, upperBound );
+#ifndef RELEASE
+        PopCallStack();
+#else
+        PopProfileRegion();
+#endif
+        return;
+    }
+    if( GetHermitianEigNumSlices() > 1 )
+    {
+        hermitian_eig::SpectrumSlicing
+        ( uplo, A, w, paddedZ, lowerBound, upperBound );
+#ifndef RELEASE
+        PopCallStack();
+#else
+        PopProfileRegion();
 #endif
+        return;
+    }
     typedef double R;
     if( A.Height() != A.Width() )
         throw std::logic_error("Hermitian matrices must be square");
@@ -611,7 +472,8 @@ HermitianEig
         ScaleTrapezoid( scale, LEFT, uplo, 0, A );
 
     // Tridiagonalize A
-    HermitianTridiag( uplo, A );
+    DistMatrix<R,STAR,VR> V(g);
+    hermitian_eig::Tridiagonalize( uplo, A, V );
 
     // Grab copies of the diagonal and subdiagonal of A
     DistMatrix<R,MD,STAR> d_MD_STAR( n,   1, g ),
@@ -716,18 +578,15 @@ HermitianEig
 
     // Backtransform the tridiagonal eigenvectors, Z
     paddedZ.ResizeTo( A.Height(), w.Height() );
-    if( uplo == LOWER )
-        ApplyPackedReflectors
-        ( LEFT, LOWER, VERTICAL, BACKWARD, subdiagonal, A, paddedZ );
-    else
-        ApplyPackedReflectors
-        ( LEFT, UPPER, VERTICAL, FORWARD,  subdiagonal, A, paddedZ );
+    hermitian_eig::BackTransform( uplo, A, V, paddedZ );
 
     // Rescale the eigenvalues if necessary
     if( needRescaling )
         Scale( 1/scale, w );
 #ifndef RELEASE
     PopCallStack();
+#else
+    PopProfileRegion();
 #endif
 }
 
@@ -742,6 +601,8 @@ HermitianEig
 {
 #ifndef RELEASE
     PushCallStack("HermitianEig");
+#else
+    PushProfileRegion("HermitianEig");
 #endif
     typedef double R;
     if( A.Height() != A.Width() )
@@ -807,6 +668,8 @@ HermitianEig
         Scale( 1/scale, w );
 #ifndef RELEASE
     PopCallStack();
+#else
+    PopProfileRegion();
 #endif
 }
 
@@ -826,6 +689,8 @@ HermitianEig
 {
 #ifndef RELEASE
     PushCallStack("HermitianEig");
+#else
+    PushProfileRegion("HermitianEig");
 #endif
     typedef double R;
     if( A.Height() != A.Width() )
@@ -891,6 +756,8 @@ HermitianEig
         Scale( 1/scale, w );
 #ifndef RELEASE
     PopCallStack();
+#else
+    PopProfileRegion();
 #endif
 }
 
@@ -908,6 +775,8 @@ HermitianEig
 {
 #ifndef RELEASE
     PushCallStack("HermitianEig");
+#else
+    PushProfileRegion("HermitianEig");
 #endif
     typedef double R;
     if( A.Height() != A.Width() )
@@ -973,6 +842,8 @@ HermitianEig
         Scale( 1/scale, w );
 #ifndef RELEASE
     PopCallStack();
+#else
+    PopProfileRegion();
 #endif
 }
 
@@ -984,11 +855,25 @@ HermitianEig
 ( UpperOrLower uplo, 
   DistMatrix<Complex<double> >& A,
   DistMatrix<double,VR,STAR>& w,
-  DistMatrix<Complex<double> >& paddedZ )
+  DistMatrix<Complex<double> >& paddedZ,
+  TridiagEigAlg alg )
 {
 #ifndef RELEASE
     PushCallStack("HermitianEig");
+#else
+    PushProfileRegion("HermitianEig");
 #endif
+    if( alg == TRIDIAG_EIG_DIVIDE_AND_CONQUER )
+    {
+        hermitian_eig::DivideAndConquer
+        ( uplo, A, w, paddedZ, 0, A.Height()-1 );
+#ifndef RELEASE
+        PopCallStack();
+#else
+        PopProfileRegion();
+#endif
+        return;
+    }
     typedef double R;
     typedef Complex<double> C;
     if( A.Height() != A.Width() )
@@ -1042,7 +927,8 @@ HermitianEig
 
     // Tridiagonalize A
     DistMatrix<C,STAR,STAR> t(g);
-    HermitianTridiag( uplo, A, t );
+    DistMatrix<C,STAR,VR> V(g);
+    hermitian_eig::Tridiagonalize( uplo, A, t, V );
 
     // Grab copies of the diagonal and subdiagonal of A
     DistMatrix<R,MD,STAR> d_MD_STAR( n,   1, g ),
@@ -1125,20 +1011,15 @@ HermitianEig
 
     // Backtransform the tridiagonal eigenvectors, Z
     paddedZ.ResizeTo( A.Height(), w.Height() ); 
-    if( uplo == LOWER )
-        ApplyPackedReflectors
-        ( LEFT, LOWER, VERTICAL, BACKWARD, UNCONJUGATED, 
-          subdiagonal, A, t, paddedZ );
-    else
-        ApplyPackedReflectors
-        ( LEFT, UPPER, VERTICAL, FORWARD, UNCONJUGATED, 
-          subdiagonal, A, t, paddedZ );
+    hermitian_eig::BackTransform( uplo, A, t, V, paddedZ );
 
     // Rescale the eigenvalues if necessary
     if( needRescaling )
         Scale( 1/scale, w );
 #ifndef RELEASE
     PopCallStack();
+#else
+    PopProfileRegion();
 #endif
 }
 
@@ -1154,11 +1035,35 @@ HermitianEig
   DistMatrix<Complex<double> >& A,
   DistMatrix<double,VR,STAR>& w,
   DistMatrix<Complex<double> >& paddedZ,
-  int lowerBound, int upperBound )
+  int lowerBound, int upperBound, TridiagEigAlg alg )
 {
 #ifndef RELEASE
     PushCallStack("HermitianEig");
+#else
+    PushProfileRegion("HermitianEig");
 #endif
+    if( alg == TRIDIAG_EIG_DIVIDE_AND_CONQUER )
+    {
+        hermitian_eig::DivideAndConquer
+        ( uplo, A, w, paddedZ, lowerBound, upperBound );
+#ifndef RELEASE
+        PopCallStack();
+#else
+        PopProfileRegion();
+#endif
+        return;
+    }
+    if( GetHermitianEigNumSlices() > 1 )
+    {
+        hermitian_eig::SpectrumSlicing
+        ( uplo, A, w, paddedZ, lowerBound, upperBound );
+#ifndef RELEASE
+        PopCallStack();
+#else
+        PopProfileRegion();
+#endif
+        return;
+    }
     typedef double R;
     typedef Complex<double> C;
     if( A.Height() != A.Width() )
@@ -1212,7 +1117,8 @@ HermitianEig
 
     // Tridiagonalize A
     DistMatrix<C,STAR,STAR> t(g);
-    HermitianTridiag( uplo, A, t );
+    DistMatrix<C,STAR,VR> V(g);
+    hermitian_eig::Tridiagonalize( uplo, A, t, V );
 
     // Grab copies of the diagonal and subdiagonal of A
     DistMatrix<R,MD,STAR> d_MD_STAR( n,   1, g ),
@@ -1296,20 +1202,15 @@ HermitianEig
 
     // Backtransform the tridiagonal eigenvectors, Z
     paddedZ.ResizeTo( A.Height(), w.Height() );
-    if( uplo == LOWER )
-        ApplyPackedReflectors
-        ( LEFT, LOWER, VERTICAL, BACKWARD, UNCONJUGATED, 
-          subdiagonal, A, t, paddedZ );
-    else
-        ApplyPackedReflectors
-        ( LEFT, UPPER, VERTICAL, FORWARD, UNCONJUGATED, 
-          subdiagonal, A, t, paddedZ );
+    hermitian_eig::BackTransform( uplo, A, t, V, paddedZ );
 
     // Rescale the eigenvalues if necessary
     if( needRescaling )
         Scale( 1/scale, w );
 #ifndef RELEASE
     PopCallStack();
+#else
+    PopProfileRegion();
 #endif
 }
 
@@ -1323,11 +1224,35 @@ HermitianEig
   DistMatrix<Complex<double> >& A,
   DistMatrix<double,VR,STAR>& w,
   DistMatrix<Complex<double> >& paddedZ,
-  double lowerBound, double upperBound )
+  double lowerBound, double upperBound, TridiagEigAlg alg )
 {
 #ifndef RELEASE
     PushCallStack("HermitianEig");
+#else
+    PushProfileRegion("HermitianEig");
 #endif
+    if( alg == TRIDIAG_EIG_DIVIDE_AND_CONQUER )
+    {
+        hermitian_eig::DivideAndConquer
+        ( uplo, A, w, paddedZ, lowerBound, upperBound );
+#ifndef RELEASE
+        PopCallStack();
+#else
+        PopProfileRegion();
+#endif
+        return;
+    }
+    if( GetHermitianEigNumSlices() > 1 )
+    {
+        hermitian_eig::SpectrumSlicing
+        ( uplo, A, w, paddedZ, lowerBound, upperBound );
+#ifndef RELEASE
+        PopCallStack();
+#else
+        PopProfileRegion();
+#endif
+        return;
+    }
     typedef double R;
     typedef Complex<double> C;
     if( A.Height() != A.Width() )
@@ -1376,7 +1301,8 @@ HermitianEig
 
     // Tridiagonalize A
     DistMatrix<C,STAR,STAR> t(g);
-    HermitianTridiag( uplo, A, t );
+    DistMatrix<C,STAR,VR> V(g);
+    hermitian_eig::Tridiagonalize( uplo, A, t, V );
 
     // Grab copies of the diagonal and subdiagonal of A
     DistMatrix<R,MD,STAR> d_MD_STAR( n,   1, g ),
@@ -1481,20 +1407,15 @@ HermitianEig
 
     // Backtransform the tridiagonal eigenvectors, Z
     paddedZ.ResizeTo( A.Height(), w.Height() );
-    if( uplo == LOWER )
-        ApplyPackedReflectors
-        ( LEFT, LOWER, VERTICAL, BACKWARD, UNCONJUGATED, 
-          subdiagonal, A, t, paddedZ );
-    else
-        ApplyPackedReflectors
-        ( LEFT, UPPER, VERTICAL, FORWARD, UNCONJUGATED, 
-          subdiagonal, A, t, paddedZ );
+    hermitian_eig::BackTransform( uplo, A, t, V, paddedZ );
 
     // Rescale the eigenvalues if necessary
     if( needRescaling )
         Scale( 1/scale, w );
 #ifndef RELEASE
     PopCallStack();
+#else
+    PopProfileRegion();
 #endif
 }
 
@@ -1509,6 +1430,8 @@ HermitianEig
 {
 #ifndef RELEASE
     PushCallStack("HermitianEig");
+#else
+    PushProfileRegion("HermitianEig");
 #endif
     typedef double R;
     typedef Complex<double> C;
@@ -1576,6 +1499,8 @@ HermitianEig
         Scale( 1/scale, w );
 #ifndef RELEASE
     PopCallStack();
+#else
+    PopProfileRegion();
 #endif
 }
 
@@ -1594,6 +1519,8 @@ HermitianEig
 {
 #ifndef RELEASE
     PushCallStack("HermitianEig");
+#else
+    PushProfileRegion("HermitianEig");
 #endif
     typedef double R;
     typedef Complex<double> C;
@@ -1661,6 +1588,8 @@ HermitianEig
         Scale( 1/scale, w ); 
 #ifndef RELEASE
     PopCallStack();
+#else
+    PopProfileRegion();
 #endif
 }
 
@@ -1677,6 +1606,8 @@ HermitianEig
 {
 #ifndef RELEASE
     PushCallStack("HermitianEig");
+#else
+    PushProfileRegion("HermitianEig");
 #endif
     typedef double R;
     typedef Complex<double> C;
@@ -1744,11 +1675,155 @@ HermitianEig
         Scale( 1/scale, w ); 
 #ifndef RELEASE
     PopCallStack();
+#else
+    PopProfileRegion();
 #endif
 }
 
-#undef TARGET_CHUNKS
+#else
 
-} // namespace elem
+// Without PMRRR, the eigenpairs are computed with divide and conquer
+
+inline void
+HermitianEig
+( UpperOrLower uplo, 
+  DistMatrix<double>& A,
+  DistMatrix<double,VR,STAR>& w,
+  DistMatrix<double>& Z,
+  TridiagEigAlg alg )
+{
+#ifndef RELEASE
+    PushCallStack("HermitianEig");
+#else
+    PushProfileRegion("HermitianEig");
+#endif
+    if( alg == TRIDIAG_EIG_MRRR )
+        throw std::logic_error("MRRR requires PMRRR");
+    hermitian_eig::DivideAndConquer( uplo, A, w, Z, 0, A.Height()-1 );
+#ifndef RELEASE
+    PopCallStack();
+#else
+    PopProfileRegion();
+#endif
+}
+
+inline void
+HermitianEig
+( UpperOrLower uplo, 
+  DistMatrix<double>& A,
+  DistMatrix<double,VR,STAR>& w,
+  DistMatrix<double>& Z,
+  int lowerBound, int upperBound, TridiagEigAlg alg )
+{
+#ifndef RELEASE
+    PushCallStack("HermitianEig");
+#else
+    PushProfileRegion("HermitianEig");
+#endif
+    if( alg == TRIDIAG_EIG_MRRR )
+        throw std::logic_error("MRRR requires PMRRR");
+    hermitian_eig::DivideAndConquer( uplo, A, w, Z, lowerBound, upperBound );
+#ifndef RELEASE
+    PopCallStack();
+#else
+    PopProfileRegion();
+#endif
+}
+
+inline void
+HermitianEig
+( UpperOrLower uplo, 
+  DistMatrix<double>& A,
+  DistMatrix<double,VR,STAR>& w,
+  DistMatrix<double>& Z,
+  double lowerBound, double upperBound, TridiagEigAlg alg )
+{
+#ifndef RELEASE
+    PushCallStack("HermitianEig");
+#else
+    PushProfileRegion("HermitianEig");
+#endif
+    if( alg == TRIDIAG_EIG_MRRR )
+        throw std::logic_error("MRRR requires PMRRR");
+    hermitian_eig::DivideAndConquer( uplo, A, w, Z, lowerBound, upperBound );
+#ifndef RELEASE
+    PopCallStack();
+#else
+    PopProfileRegion();
+#endif
+}
+
+inline void
+HermitianEig
+( UpperOrLower uplo, 
+  DistMatrix<Complex<double> >& A,
+  DistMatrix<double,VR,STAR>& w,
+  DistMatrix<Complex<double> >& Z,
+  TridiagEigAlg alg )
+{
+#ifndef RELEASE
+    PushCallStack("HermitianEig");
+#else
+    PushProfileRegion("HermitianEig");
+#endif
+    if( alg == TRIDIAG_EIG_MRRR )
+        throw std::logic_error("MRRR requires PMRRR");
+    hermitian_eig::DivideAndConquer( uplo, A, w, Z, 0, A.Height()-1 );
+#ifndef RELEASE
+    PopCallStack();
+#else
+    PopProfileRegion();
+#endif
+}
+
+inline void
+HermitianEig
+( UpperOrLower uplo, 
+  DistMatrix<Complex<double> >& A,
+  DistMatrix<double,VR,STAR>& w,
+  DistMatrix<Complex<double> >& Z,
+  int lowerBound, int upperBound, TridiagEigAlg alg )
+{
+#ifndef RELEASE
+    PushCallStack("HermitianEig");
+#else
+    PushProfileRegion("HermitianEig");
+#endif
+    if( alg == TRIDIAG_EIG_MRRR )
+        throw std::logic_error("MRRR requires PMRRR");
+    hermitian_eig::DivideAndConquer( uplo, A, w, Z, lowerBound, upperBound );
+#ifndef RELEASE
+    PopCallStack();
+#else
+    PopProfileRegion();
+#endif
+}
+
+inline void
+HermitianEig
+( UpperOrLower uplo, 
+  DistMatrix<Complex<double> >& A,
+  DistMatrix<double,VR,STAR>& w,
+  DistMatrix<Complex<double> >& Z,
+  double lowerBound, double upperBound, TridiagEigAlg alg )
+{
+#ifndef RELEASE
+    PushCallStack("HermitianEig");
+#else
+    PushProfileRegion("HermitianEig");
+#endif
+    if( alg == TRIDIAG_EIG_MRRR )
+        throw std::logic_error("MRRR requires PMRRR");
+    hermitian_eig::DivideAndConquer( uplo, A, w, Z, lowerBound, upperBound );
+#ifndef RELEASE
+    PopCallStack();
+#else
+    PopProfileRegion();
+#endif
+}
 
 #endif // WITHOUT_PMRRR
+
+#undef TARGET_CHUNKS
+
+} // namespace elem
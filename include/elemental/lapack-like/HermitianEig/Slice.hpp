@@ -0,0 +1,329 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace elem {
+namespace hermitian_eig {
+
+// Returns the number of eigenvalues of the symmetric tridiagonal matrix with
+// diagonal d and subdiagonal e which are less than or equal to sigma, which is
+// the number of nonpositive pivots in the LDL^T factorization of T - sigma I
+template<typename R>
+inline int
+SturmCount( const std::vector<R>& d, const std::vector<R>& e, R sigma )
+{
+    const int n = d.size();
+    const R safeMin = lapack::MachineSafeMin<R>();
+    int count = 0;
+    R delta = 1;
+    for( int i=0; i<n; ++i )
+    {
+        delta = (d[i]-sigma) - ( i==0 ? R(0) : e[i-1]*e[i-1]/delta );
+        if( delta <= 0 )
+        {
+            ++count;
+            if( delta > -safeMin )
+                delta = -safeMin;
+        }
+    }
+    return count;
+}
+
+// Converts the requested eigenpairs into the inclusive index range [a,b]
+template<typename R>
+inline void
+SliceRange
+( const std::vector<R>& d, const std::vector<R>& e, R scale,
+  int lowerBound, int upperBound, int& a, int& b )
+{
+    const int n = d.size();
+    if( lowerBound < 0 || upperBound >= n || lowerBound > upperBound )
+        throw std::logic_error("Invalid eigenpair index range");
+    a = lowerBound;
+    b = upperBound;
+}
+
+template<typename R>
+inline void
+SliceRange
+( const std::vector<R>& d, const std::vector<R>& e, R scale,
+  R lowerBound, R upperBound, int& a, int& b )
+{
+    a = SturmCount( d, e, scale*lowerBound );
+    b = std::max( SturmCount( d, e, scale*upperBound ), a ) - 1;
+}
+
+template<typename R>
+inline void
+BackTransformSlice
+( UpperOrLower uplo, const DistMatrix<R>& A,
+  const DistMatrix<R,STAR,STAR>& t, const DistMatrix<R,STAR,VR>& V,
+  DistMatrix<R>& Z )
+{ BackTransform( uplo, A, V, Z ); }
+
+template<typename R>
+inline void
+BackTransformSlice
+( UpperOrLower uplo, const DistMatrix<Complex<R> >& A,
+  const DistMatrix<Complex<R>,STAR,STAR>& t,
+  const DistMatrix<Complex<R>,STAR,VR>& V,
+  DistMatrix<Complex<R> >& Z )
+{ BackTransform( uplo, A, t, V, Z ); }
+
+// Computes the eigenpairs with indices a,a+1,...,b of the tridiagonalized
+// matrix A by splitting them into contiguous slices, one per subgrid of
+// consecutive processes, with the number of eigenpairs in each slice
+// proportional to the size of its subgrid. The slices are only balanced by
+// their numbers of eigenpairs, not by the cost of PMRRR, which grows with
+// the clustering of the eigenvalues. Each subgrid receives its own copy of 
+// the Householder transforms, runs PMRRR over its own communicator, and
+// backtransforms its eigenvectors before they are assembled into Z.
+template<typename F>
+inline void
+SliceEigenpairs
+( UpperOrLower uplo, const DistMatrix<F>& A,
+  const DistMatrix<F,STAR,STAR>& t, const DistMatrix<F,STAR,VR>& V,
+  const std::vector<typename Base<F>::type>& d,
+  const std::vector<typename Base<F>::type>& e,
+  int a, int b,
+  DistMatrix<typename Base<F>::type,VR,STAR>& w, DistMatrix<F>& Z )
+{
+#ifndef RELEASE
+    PushCallStack("hermitian_eig::SliceEigenpairs");
+#endif
+    typedef typename Base<F>::type R;
+    const Grid& g = A.Grid();
+    const int n = A.Height();
+    const int k = b-a+1;
+    const int p = g.Size();
+    const int numSlices =
+        std::max( std::min( GetHermitianEigNumSlices(), std::min(p,k) ), 1 );
+
+    // Balance the eigenpairs over the slices
+    std::vector<int> firstRanks(numSlices+1), firstEigs(numSlices+1);
+    int mySlice = 0;
+    for( int s=0; s<=numSlices; ++s )
+    {
+        firstRanks[s] = (s*p)/numSlices;
+        firstEigs[s] = a + int((double(k)*firstRanks[s])/p);
+        if( s < numSlices && g.VCRank() >= firstRanks[s] )
+            mySlice = s;
+    }
+    const int myBegin = firstEigs[mySlice];
+    const int myWidth = firstEigs[mySlice+1] - myBegin;
+
+    // Form the subgrids (every process must take part in each construction)
+    mpi::Group owningGroup = g.OwningGroup();
+    std::vector<mpi::Group> sliceGroups( numSlices );
+    std::vector<Grid*> sliceGrids( numSlices );
+    for( int s=0; s<numSlices; ++s )
+    {
+        const int sliceSize = firstRanks[s+1] - firstRanks[s];
+        std::vector<int> sliceRanks( sliceSize );
+        for( int j=0; j<sliceSize; ++j )
+            sliceRanks[j] = firstRanks[s] + j;
+        mpi::GroupIncl
+        ( owningGroup, sliceSize, &sliceRanks[0], sliceGroups[s] );
+        sliceGrids[s] = new Grid( g.ViewingComm(), sliceGroups[s] );
+    }
+    const Grid& mySliceGrid = *sliceGrids[mySlice];
+
+    // Give each subgrid a copy of the Householder transforms. Every process
+    // takes part in each cross-grid copy, and a subgrid of p_s processes 
+    // stores about n^2/p_s entries of A per process.
+    DistMatrix<F> V_MC_MR( g );
+    V_MC_MR = V;
+    DistMatrix<F> AMine( mySliceGrid ), VMine_MC_MR( mySliceGrid );
+    for( int s=0; s<numSlices; ++s )
+    {
+        if( s == mySlice )
+        {
+            AMine = A;
+            VMine_MC_MR = V_MC_MR;
+        }
+        else
+        {
+            DistMatrix<F> AOther( *sliceGrids[s] ),
+                          VOther( *sliceGrids[s] );
+            AOther = A;
+            VOther = V_MC_MR;
+        }
+    }
+    V_MC_MR.Empty();
+    DistMatrix<F,STAR,STAR> tMine( mySliceGrid );
+    tMine.ResizeTo( t.Height(), t.Width() );
+    for( int j=0; j<t.Width(); ++j )
+        for( int i=0; i<t.Height(); ++i )
+            tMine.SetLocal( i, j, t.GetLocal(i,j) );
+    DistMatrix<F,STAR,VR> VMine( mySliceGrid );
+    VMine = VMine_MC_MR;
+    VMine_MC_MR.Empty();
+
+    // Solve for our slice of eigenpairs with PMRRR and backtransform them
+    std::vector<R> wSlice;
+    DistMatrix<F> ZMine( mySliceGrid );
+    ZMine.Align( 0, 0 );
+    {
+        DistMatrix<R,STAR,VR> ZReal_STAR_VR( mySliceGrid );
+        internal::TridiagEigPMRRR
+        ( d, e, myBegin, myBegin+myWidth-1, wSlice, ZReal_STAR_VR );
+        DistMatrix<F,STAR,VR> Z_STAR_VR( mySliceGrid );
+        Z_STAR_VR.Align( 0 );
+        Z_STAR_VR.ResizeTo( n, myWidth );
+        for( int jLocal=0; jLocal<Z_STAR_VR.LocalWidth(); ++jLocal )
+            for( int i=0; i<n; ++i )
+                Z_STAR_VR.SetLocal
+                ( i, jLocal, ZReal_STAR_VR.GetLocal(i,jLocal) );
+        ZMine = Z_STAR_VR;
+    }
+    wSlice.resize( std::max(myWidth,1) );
+    if( myWidth > 0 )
+        BackTransformSlice( uplo, AMine, tMine, VMine, ZMine );
+    AMine.Empty();
+
+    // Gather every eigenvalue from the root of each slice
+    const bool sliceRoot = ( mySliceGrid.VCRank() == 0 );
+    const int mySendCount = ( sliceRoot ? myWidth : 0 );
+    std::vector<int> wCounts( p ), wDispls( p );
+    mpi::AllGather( &mySendCount, 1, &wCounts[0], 1, g.VCComm() );
+    for( int proc=0, offset=0; proc<p; offset+=wCounts[proc], ++proc )
+        wDispls[proc] = offset;
+    std::vector<R> wAll( std::max(k,1) );
+    mpi::AllGather
+    ( &wSlice[0], mySendCount, &wAll[0], &wCounts[0], &wDispls[0],
+      g.VCComm() );
+    if( !w.Viewing() )
+    {
+        w.Empty();
+        w.Align( 0 );
+    }
+    w.ResizeTo( k, 1 );
+    const int colShift = w.ColShift();
+    const int colStride = w.ColStride();
+    for( int iLocal=0; iLocal<w.LocalHeight(); ++iLocal )
+        w.SetLocal( iLocal, 0, wAll[colShift+iLocal*colStride] );
+
+    // Assemble the eigenvectors from each subgrid into Z
+    ResizeEigenvectors( Z, n, k );
+    for( int s=0; s<numSlices; ++s )
+    {
+        const int sliceWidth = firstEigs[s+1] - firstEigs[s];
+        DistMatrix<F> ZSlice( g ), ZSliceDest( g );
+        if( s == mySlice )
+            ZSlice = ZMine;
+        else
+        {
+            DistMatrix<F> ZOther( *sliceGrids[s] );
+            ZOther.ResizeTo( n, sliceWidth );
+            ZSlice = ZOther;
+        }
+        View( ZSliceDest, Z, 0, firstEigs[s]-a, n, sliceWidth );
+        ZSliceDest = ZSlice;
+    }
+
+    for( int s=0; s<numSlices; ++s )
+    {
+        delete sliceGrids[s];
+        mpi::GroupFree( sliceGroups[s] );
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename R,typename Bound>
+inline void
+SpectrumSlicing
+( UpperOrLower uplo, DistMatrix<R>& A,
+  DistMatrix<R,VR,STAR>& w, DistMatrix<R>& Z,
+  Bound lowerBound, Bound upperBound )
+{
+    if( A.Height() != A.Width() )
+        throw std::logic_error("Hermitian matrices must be square");
+    const Grid& g = A.Grid();
+    const int n = A.Height();
+    const int subdiagonal = ( uplo==LOWER ? -1 : +1 );
+
+    bool needRescaling;
+    R scale;
+    CheckScale( uplo, A, needRescaling, scale );
+    if( needRescaling )
+        ScaleTrapezoid( scale, LEFT, uplo, 0, A );
+
+    DistMatrix<R,STAR,STAR> t(g);
+    DistMatrix<R,STAR,VR> V(g);
+    Tridiagonalize( uplo, A, V );
+
+    DistMatrix<R,MD,STAR> d_MD_STAR( n,   1, g ),
+                          e_MD_STAR( n-1, 1, g );
+    A.GetDiagonal( d_MD_STAR );
+    A.GetDiagonal( e_MD_STAR, subdiagonal );
+    DistMatrix<R,STAR,STAR> d_STAR_STAR( g ), e_STAR_STAR( g );
+    d_STAR_STAR = d_MD_STAR;
+    e_STAR_STAR = e_MD_STAR;
+    std::vector<R> d( n ), e( n-1 );
+    for( int j=0; j<n; ++j )
+        d[j] = d_STAR_STAR.GetLocal(j,0);
+    for( int j=0; j<n-1; ++j )
+        e[j] = e_STAR_STAR.GetLocal(j,0);
+
+    int a, b;
+    SliceRange( d, e, scale, lowerBound, upperBound, a, b );
+    SliceEigenpairs( uplo, A, t, V, d, e, a, b, w, Z );
+
+    if( needRescaling )
+        Scale( 1/scale, w );
+}
+
+template<typename R,typename Bound>
+inline void
+SpectrumSlicing
+( UpperOrLower uplo, DistMatrix<Complex<R> >& A,
+  DistMatrix<R,VR,STAR>& w, DistMatrix<Complex<R> >& Z,
+  Bound lowerBound, Bound upperBound )
+{
+    typedef Complex<R> C;
+    if( A.Height() != A.Width() )
+        throw std::logic_error("Hermitian matrices must be square");
+    const Grid& g = A.Grid();
+    const int n = A.Height();
+    const int subdiagonal = ( uplo==LOWER ? -1 : +1 );
+
+    bool needRescaling;
+    R scale;
+    CheckScale( uplo, A, needRescaling, scale );
+    if( needRescaling )
+        ScaleTrapezoid( C(scale), LEFT, uplo, 0, A );
+
+    DistMatrix<C,STAR,STAR> t(g);
+    DistMatrix<C,STAR,VR> V(g);
+    Tridiagonalize( uplo, A, t, V );
+
+    DistMatrix<R,MD,STAR> d_MD_STAR( n,   1, g ),
+                          e_MD_STAR( n-1, 1, g );
+    A.GetRealPartOfDiagonal( d_MD_STAR );
+    A.GetRealPartOfDiagonal( e_MD_STAR, subdiagonal );
+    DistMatrix<R,STAR,STAR> d_STAR_STAR( g ), e_STAR_STAR( g );
+    d_STAR_STAR = d_MD_STAR;
+    e_STAR_STAR = e_MD_STAR;
+    std::vector<R> d( n ), e( n-1 );
+    for( int j=0; j<n; ++j )
+        d[j] = d_STAR_STAR.GetLocal(j,0);
+    for( int j=0; j<n-1; ++j )
+        e[j] = e_STAR_STAR.GetLocal(j,0);
+
+    int a, b;
+    SliceRange( d, e, scale, lowerBound, upperBound, a, b );
+    SliceEigenpairs( uplo, A, t, V, d, e, a, b, w, Z );
+
+    if( needRescaling )
+        Scale( 1/scale, w );
+}
+
+} // namespace hermitian_eig
+} // namespace elem
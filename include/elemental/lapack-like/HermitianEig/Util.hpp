@@ -0,0 +1,437 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace elem {
+namespace hermitian_eig {
+
+// We create specialized redistribution routines for redistributing the 
+// real eigenvectors of the symmetric tridiagonal matrix at the core of our 
+// eigensolver in order to minimize the temporary memory usage.
+template<typename R>
+inline void
+InPlaceRedist
+( DistMatrix<R>& paddedZ,
+  int height,
+  int width,
+  int rowAlignmentOfInput,
+  const R* readBuffer )
+{
+    const Grid& g = paddedZ.Grid();
+
+    const int r = g.Height();
+    const int c = g.Width();
+    const int p = r * c;
+    const int row = g.Row();
+    const int col = g.Col();
+    const int rowShift = paddedZ.RowShift();
+    const int colAlignment = paddedZ.ColAlignment();
+
+    const int localWidthOfInput = 
+        LocalLength(width,g.VRRank(),rowAlignmentOfInput,p);
+
+    const int maxHeight = MaxLocalLength(height,r);
+    const int maxWidth = MaxLocalLength(width,p);
+    const int portionSize = 
+        std::max(maxHeight*maxWidth,mpi::MIN_COLL_MSG);
+    
+    // Allocate our send/recv buffers
+    std::vector<R> buffer(2*r*portionSize);
+    R* sendBuffer = &buffer[0];
+    R* recvBuffer = &buffer[r*portionSize];
+
+    // Pack
+#if defined(HAVE_OPENMP) && !defined(PARALLELIZE_INNER_LOOPS)
+    #pragma omp parallel for
+#endif
+    for( int k=0; k<r; ++k )
+    {
+        R* data = &sendBuffer[k*portionSize];
+
+        const int thisColShift = Shift(k,colAlignment,r);
+        const int thisLocalHeight = LocalLength(height,thisColShift,r);
+
+#if defined(HAVE_OPENMP) && defined(PARALLELIZE_INNER_LOOPS)
+        #pragma omp parallel for COLLAPSE(2)
+#endif
+        for( int j=0; j<localWidthOfInput; ++j )
+            for( int i=0; i<thisLocalHeight; ++i )
+                data[i+j*thisLocalHeight] = 
+                    readBuffer[thisColShift+i*r+j*height];
+    }
+
+    // Communicate
+    mpi::AllToAll
+    ( sendBuffer, portionSize,
+      recvBuffer, portionSize, g.ColComm() );
+
+    // Unpack
+    const int localHeight = LocalLength(height,row,colAlignment,r);
+#if defined(HAVE_OPENMP) && !defined(PARALLELIZE_INNER_LOOPS)
+    #pragma omp parallel for
+#endif
+    for( int k=0; k<r; ++k )
+    {
+        const R* data = &recvBuffer[k*portionSize];
+
+        const int thisRank = col+k*c;
+        const int thisRowShift = Shift(thisRank,rowAlignmentOfInput,p);
+        const int thisRowOffset = (thisRowShift-rowShift) / c;
+        const int thisLocalWidth = LocalLength(width,thisRowShift,p);
+
+#if defined(HAVE_OPENMP) && defined(PARALLELIZE_INNER_LOOPS)
+        #pragma omp parallel for
+#endif
+        for( int j=0; j<thisLocalWidth; ++j )
+        {
+            const R* dataCol = &(data[j*localHeight]);
+            R* thisCol = paddedZ.LocalBuffer(0,thisRowOffset+j*r);
+            MemCopy( thisCol, dataCol, localHeight );
+        }
+    }
+}
+
+template<typename R>
+inline void
+InPlaceRedist
+( DistMatrix<Complex<R> >& paddedZ,
+  int height,
+  int width,
+  int rowAlignmentOfInput,
+  const R* readBuffer )
+{
+    const Grid& g = paddedZ.Grid();
+
+    const int r = g.Height();
+    const int c = g.Width();
+    const int p = r * c;
+    const int row = g.Row();
+    const int col = g.Col();
+    const int rowShift = paddedZ.RowShift();
+    const int colAlignment = paddedZ.ColAlignment();
+
+    const int localWidthOfInput = 
+        LocalLength(width,g.VRRank(),rowAlignmentOfInput,p);
+
+    const int maxHeight = MaxLocalLength(height,r);
+    const int maxWidth = MaxLocalLength(width,p);
+    const int portionSize = 
+        std::max(maxHeight*maxWidth,mpi::MIN_COLL_MSG);
+    
+    // Allocate our send/recv buffers
+    std::vector<R> buffer(2*r*portionSize);
+    R* sendBuffer = &buffer[0];
+    R* recvBuffer = &buffer[r*portionSize];
+
+    // Pack
+#if defined(HAVE_OPENMP) && !defined(PARALLELIZE_INNER_LOOPS)
+    #pragma omp parallel for
+#endif
+    for( int k=0; k<r; ++k )
+    {
+        R* data = &sendBuffer[k*portionSize];
+
+        const int thisColShift = Shift(k,colAlignment,r);
+        const int thisLocalHeight = LocalLength(height,thisColShift,r);
+
+#if defined(HAVE_OPENMP) && defined(PARALLELIZE_INNER_LOOPS)
+        #pragma omp parallel for COLLAPSE(2)
+#endif
+        for( int j=0; j<localWidthOfInput; ++j )
+            for( int i=0; i<thisLocalHeight; ++i )
+                data[i+j*thisLocalHeight] = 
+                    readBuffer[thisColShift+i*r+j*height];
+    }
+
+    // Communicate
+    mpi::AllToAll
+    ( sendBuffer, portionSize,
+      recvBuffer, portionSize, g.ColComm() );
+
+    // Unpack
+    const int localHeight = LocalLength(height,row,colAlignment,r);
+#if defined(HAVE_OPENMP) && !defined(PARALLELIZE_INNER_LOOPS)
+    #pragma omp parallel for
+#endif
+    for( int k=0; k<r; ++k )
+    {
+        const R* data = &recvBuffer[k*portionSize];
+
+        const int thisRank = col+k*c;
+        const int thisRowShift = Shift(thisRank,rowAlignmentOfInput,p);
+        const int thisRowOffset = (thisRowShift-rowShift) / c;
+        const int thisLocalWidth = LocalLength(width,thisRowShift,p);
+
+#if defined(HAVE_OPENMP) && defined(PARALLELIZE_INNER_LOOPS)
+        #pragma omp parallel for
+#endif
+        for( int j=0; j<thisLocalWidth; ++j )
+        {
+            const R* dataCol = &(data[j*localHeight]);
+            R* thisCol = (R*)paddedZ.LocalBuffer(0,thisRowOffset+j*r);
+            for( int i=0; i<localHeight; ++i )
+            {
+                thisCol[2*i] = dataCol[i];
+                thisCol[2*i+1] = 0;
+            }
+        }
+    }
+}
+
+template<typename F>
+inline void
+CheckScale
+( UpperOrLower uplo, DistMatrix<F>& A, 
+  bool& needRescaling, typename Base<F>::type& scale )
+{
+    typedef typename Base<F>::type R;
+
+    scale = 1;
+    needRescaling = false;
+    const R maxNormOfA = HermitianNorm( uplo, A, MAX_NORM );
+    const R underflowThreshold = lapack::MachineUnderflowThreshold<R>();
+    const R overflowThreshold = lapack::MachineOverflowThreshold<R>();
+    if( maxNormOfA > 0 && maxNormOfA < underflowThreshold )
+    {
+        needRescaling = true;
+        scale = underflowThreshold / maxNormOfA;
+    }
+    else if( maxNormOfA > overflowThreshold )
+    {
+        needRescaling = true;
+        scale = overflowThreshold / maxNormOfA;
+    }
+}
+
+// The two-stage tridiagonalization keeps its second-stage transforms in V,
+// which must be passed along to the backtransformation
+template<typename R>
+inline void
+Tridiagonalize
+( UpperOrLower uplo, DistMatrix<R>& A, DistMatrix<R,STAR,VR>& V )
+{
+    if( GetHermitianTridiagApproach() == HERMITIAN_TRIDIAG_TWO_STAGE )
+    {
+        PushBlocksizeStack<R>( "HermitianTridiag", A.Grid() );
+        internal::HermitianTridiagTwoStage( uplo, A, V );
+        PopBlocksizeStack( "HermitianTridiag" );
+    }
+    else
+        HermitianTridiag( uplo, A );
+}
+
+template<typename R>
+inline void
+Tridiagonalize
+( UpperOrLower uplo,
+  DistMatrix<Complex<R> >& A,
+  DistMatrix<Complex<R>,STAR,STAR>& t,
+  DistMatrix<Complex<R>,STAR,VR>& V )
+{
+    if( GetHermitianTridiagApproach() == HERMITIAN_TRIDIAG_TWO_STAGE )
+    {
+        PushBlocksizeStack<Complex<R> >( "HermitianTridiag", A.Grid() );
+        internal::HermitianTridiagTwoStage( uplo, A, t, V );
+        PopBlocksizeStack( "HermitianTridiag" );
+    }
+    else
+        HermitianTridiag( uplo, A, t );
+}
+
+template<typename R>
+inline void
+BackTransform
+( UpperOrLower uplo, const DistMatrix<R>& A, 
+  const DistMatrix<R,STAR,VR>& V, DistMatrix<R>& Z )
+{
+    if( GetHermitianTridiagApproach() == HERMITIAN_TRIDIAG_TWO_STAGE )
+        internal::ApplyTwoStageReflectors( A, V, Z );
+    else if( uplo == LOWER )
+        ApplyPackedReflectors( LEFT, LOWER, VERTICAL, BACKWARD, -1, A, Z );
+    else
+        ApplyPackedReflectors( LEFT, UPPER, VERTICAL, FORWARD, 1, A, Z );
+}
+
+template<typename R>
+inline void
+BackTransform
+( UpperOrLower uplo, 
+  const DistMatrix<Complex<R> >& A,
+  const DistMatrix<Complex<R>,STAR,STAR>& t,
+  const DistMatrix<Complex<R>,STAR,VR>& V,
+        DistMatrix<Complex<R> >& Z )
+{
+    if( GetHermitianTridiagApproach() == HERMITIAN_TRIDIAG_TWO_STAGE )
+        internal::ApplyTwoStageReflectors( A, t, V, Z );
+    else if( uplo == LOWER )
+        ApplyPackedReflectors
+        ( LEFT, LOWER, VERTICAL, BACKWARD, UNCONJUGATED, -1, A, t, Z );
+    else
+        ApplyPackedReflectors
+        ( LEFT, UPPER, VERTICAL, FORWARD, UNCONJUGATED, 1, A, t, Z );
+}
+
+// Converts the requested index range or interval of eigenvalues of the 
+// original matrix into the half-open range [begin,end) of the (ascending)
+// eigenvalues of the scaled matrix
+template<typename R>
+inline void
+SelectionRange
+( const DistMatrix<R,VR,STAR>& w, R scale, int lowerBound, int upperBound,
+  int& begin, int& end )
+{
+    if( lowerBound < 0 || upperBound >= w.Height() || lowerBound > upperBound )
+        throw std::logic_error("Invalid eigenpair index range");
+    begin = lowerBound;
+    end = upperBound+1;
+}
+
+template<typename R>
+inline void
+SelectionRange
+( const DistMatrix<R,VR,STAR>& w, R scale, R lowerBound, R upperBound,
+  int& begin, int& end )
+{
+    DistMatrix<R,STAR,STAR> w_STAR_STAR( w.Grid() );
+    w_STAR_STAR = w;
+    begin = 0;
+    end = 0;
+    for( int j=0; j<w.Height(); ++j )
+    {
+        const R omega = w_STAR_STAR.GetLocal(j,0);
+        if( omega <= scale*lowerBound )
+            ++begin;
+        if( omega <= scale*upperBound )
+            ++end;
+    }
+    end = std::max( begin, end );
+}
+
+// Solves for the selected eigenpairs of the real symmetric tridiagonal matrix
+// stored on the main diagonal and sub/super-diagonal of A with the 
+// divide-and-conquer tridiagonal eigensolver
+template<typename F,typename Bound>
+inline void
+TridiagDivideAndConquer
+( UpperOrLower uplo, const DistMatrix<F>& A, typename Base<F>::type scale, 
+  Bound lowerBound, Bound upperBound,
+  DistMatrix<typename Base<F>::type,VR,STAR>& w, 
+  DistMatrix<typename Base<F>::type>& Z )
+{
+    typedef typename Base<F>::type R;
+    const Grid& g = A.Grid();
+    const int n = A.Height();
+    const int subdiagonal = ( uplo==LOWER ? -1 : +1 );
+
+    DistMatrix<R,MD,STAR> d_MD_STAR( n,   1, g ),
+                          e_MD_STAR( n-1, 1, g );
+    A.GetRealPartOfDiagonal( d_MD_STAR );
+    A.GetRealPartOfDiagonal( e_MD_STAR, subdiagonal );
+    DistMatrix<R,STAR,STAR> d_STAR_STAR( g ), e_STAR_STAR( g );
+    d_STAR_STAR = d_MD_STAR;
+    e_STAR_STAR = e_MD_STAR;
+
+    DistMatrix<R,VR,STAR> wFull( g ), wSelected( g );
+    DistMatrix<R> ZFull( g ), ZSelected( g );
+    HermitianTridiagEig( d_STAR_STAR, e_STAR_STAR, wFull, ZFull );
+
+    int begin, end;
+    SelectionRange( wFull, scale, lowerBound, upperBound, begin, end );
+    LockedView( wSelected, wFull, begin, 0, end-begin, 1 );
+    LockedView( ZSelected, ZFull, 0, begin, n, end-begin );
+    w = wSelected;
+    Z = ZSelected;
+}
+
+// Prepares the output eigenvectors, which may be a (padded) view, to hold
+// the n x k backtransformed eigenvectors
+template<typename F>
+inline void
+ResizeEigenvectors( DistMatrix<F>& Z, int n, int k )
+{
+    if( Z.Viewing() && (Z.Height() < n || Z.Width() < k) )
+        throw std::logic_error("Z was a view but was too small");
+    Z.ResizeTo( n, k );
+}
+
+template<typename R,typename Bound>
+inline void
+DivideAndConquer
+( UpperOrLower uplo, DistMatrix<R>& A,
+  DistMatrix<R,VR,STAR>& w, DistMatrix<R>& Z,
+  Bound lowerBound, Bound upperBound )
+{
+    if( A.Height() != A.Width() )
+        throw std::logic_error("Hermitian matrices must be square");
+    const Grid& g = A.Grid();
+
+    bool needRescaling;
+    R scale;
+    CheckScale( uplo, A, needRescaling, scale );
+    if( needRescaling )
+        ScaleTrapezoid( scale, LEFT, uplo, 0, A );
+
+    DistMatrix<R,STAR,VR> V(g);
+    Tridiagonalize( uplo, A, V );
+
+    DistMatrix<R> ZTri(g);
+    TridiagDivideAndConquer( uplo, A, scale, lowerBound, upperBound, w, ZTri );
+    ResizeEigenvectors( Z, ZTri.Height(), ZTri.Width() );
+    Z = ZTri;
+    BackTransform( uplo, A, V, Z );
+
+    if( needRescaling )
+        Scale( 1/scale, w );
+}
+
+template<typename R,typename Bound>
+inline void
+DivideAndConquer
+( UpperOrLower uplo, DistMatrix<Complex<R> >& A,
+  DistMatrix<R,VR,STAR>& w, DistMatrix<Complex<R> >& Z,
+  Bound lowerBound, Bound upperBound )
+{
+    typedef Complex<R> C;
+    if( A.Height() != A.Width() )
+        throw std::logic_error("Hermitian matrices must be square");
+    const Grid& g = A.Grid();
+
+    bool needRescaling;
+    R scale;
+    CheckScale( uplo, A, needRescaling, scale );
+    if( needRescaling )
+        ScaleTrapezoid( C(scale), LEFT, uplo, 0, A );
+
+    DistMatrix<C,STAR,STAR> t(g);
+    DistMatrix<C,STAR,VR> V(g);
+    Tridiagonalize( uplo, A, t, V );
+
+    // Copy the real tridiagonal eigenvectors into the complex Z 
+    DistMatrix<R> ZTri(g), ZTriAligned(g);
+    TridiagDivideAndConquer( uplo, A, scale, lowerBound, upperBound, w, ZTri );
+    if( !Z.Viewing() )
+    {
+        Z.Empty();
+        Z.AlignWith( ZTri );
+    }
+    ResizeEigenvectors( Z, ZTri.Height(), ZTri.Width() );
+    ZTriAligned.AlignWith( Z );
+    ZTriAligned = ZTri;
+    const int localHeight = Z.LocalHeight();
+    const int localWidth = Z.LocalWidth();
+    for( int jLocal=0; jLocal<localWidth; ++jLocal )
+        for( int iLocal=0; iLocal<localHeight; ++iLocal )
+            Z.SetLocal( iLocal, jLocal, ZTriAligned.GetLocal(iLocal,jLocal) );
+    BackTransform( uplo, A, t, V, Z );
+
+    if( needRescaling )
+        Scale( 1/scale, w );
+}
+
+} // namespace hermitian_eig
+} // namespace elem
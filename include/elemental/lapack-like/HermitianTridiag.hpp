@@ -16,6 +16,7 @@
 #include "./HermitianTridiag/U.hpp"
 #include "./HermitianTridiag/USquare.hpp"
 #include "./HermitianTridiag/Local.hpp"
+#include "./HermitianTridiag/TwoStage.hpp"
 
 namespace elem {
 
@@ -25,9 +26,12 @@ HermitianTridiag( UpperOrLower uplo, DistMatrix<R>& A )
 {
 #ifndef RELEASE
     PushCallStack("HermitianTridiag");
+#else
+    PushProfileRegion("HermitianTridiag");
 #endif
     if( IsComplex<R>::val )
         throw std::logic_error("Called real routine with complex datatype");
+    PushBlocksizeStack<R>( "HermitianTridiag", A.Grid() );
     const Grid& g = A.Grid();
     const HermitianTridiagApproach approach = GetHermitianTridiagApproach();
     const GridOrder order = GetHermitianTridiagGridOrder();
@@ -81,7 +85,9 @@ HermitianTridiag( UpperOrLower uplo, DistMatrix<R>& A )
     else
     {
         // Use the normal approach unless we're already on a square 
-        // grid, in which case we use the fast square method.
+        // grid, in which case we use the fast square method. This includes
+        // HERMITIAN_TRIDIAG_TWO_STAGE, since its second-stage transforms 
+        // cannot be returned from here.
         if( g.Height() == g.Width() )
         {
             if( uplo == LOWER )
@@ -97,8 +103,11 @@ HermitianTridiag( UpperOrLower uplo, DistMatrix<R>& A )
                 internal::HermitianTridiagU( A );
         }
     }
+    PopBlocksizeStack( "HermitianTridiag" );
 #ifndef RELEASE
     PopCallStack();
+#else
+    PopProfileRegion();
 #endif
 }
 
@@ -111,7 +120,10 @@ HermitianTridiag
 {
 #ifndef RELEASE
     PushCallStack("HermitianTridiag");
+#else
+    PushProfileRegion("HermitianTridiag");
 #endif
+    PushBlocksizeStack<Complex<R> >( "HermitianTridiag", A.Grid() );
     typedef Complex<R> C;
 
     const Grid& g = A.Grid();
@@ -169,7 +181,9 @@ HermitianTridiag
     else
     {
         // Use the normal approach unless we're already on a square 
-        // grid, in which case we use the fast square method.
+        // grid, in which case we use the fast square method. This includes
+        // HERMITIAN_TRIDIAG_TWO_STAGE, since its second-stage transforms 
+        // cannot be returned from here.
         if( g.Height() == g.Width() )
         {
             if( uplo == LOWER )
@@ -185,8 +199,11 @@ HermitianTridiag
                 internal::HermitianTridiagU( A, t );
         }
     }
+    PopBlocksizeStack( "HermitianTridiag" );
 #ifndef RELEASE
     PopCallStack();
+#else
+    PopProfileRegion();
 #endif
 }
 
@@ -274,6 +274,8 @@ inline void HermitianTridiag( UpperOrLower uplo, Matrix<R>& A )
 {
 #ifndef RELEASE
     PushCallStack("HermitianTridiag");
+#else
+    PushProfileRegion("HermitianTridiag");
 #endif
     if( IsComplex<R>::val )
         throw std::logic_error("Called real routine with complex datatype");
@@ -283,6 +285,8 @@ inline void HermitianTridiag( UpperOrLower uplo, Matrix<R>& A )
         hermitian_tridiag::HermitianTridiagU( A );
 #ifndef RELEASE
     PopCallStack();
+#else
+    PopProfileRegion();
 #endif
 }
 
@@ -292,6 +296,8 @@ inline void HermitianTridiag
 {
 #ifndef RELEASE
     PushCallStack("HermitianTridiag");
+#else
+    PushProfileRegion("HermitianTridiag");
 #endif
     if( uplo == LOWER )
         hermitian_tridiag::HermitianTridiagL( A, t );
@@ -299,6 +305,8 @@ inline void HermitianTridiag
         hermitian_tridiag::HermitianTridiagU( A, t );
 #ifndef RELEASE
     PopCallStack();
+#else
+    PopProfileRegion();
 #endif
 }
 
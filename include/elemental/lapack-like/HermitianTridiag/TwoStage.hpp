@@ -0,0 +1,828 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace elem {
+namespace internal {
+
+// The two-stage reduction first reduces the lower triangle of A to a band of
+// width b using blocked (BLAS-3) two-sided updates, with the Householder
+// vectors of each panel stored below the b'th subdiagonal, and then chases
+// the bulges out of the band. Step m of sweep j applies the reflector which
+// starts at row r=j+1+m b, has length min(b,n-r), and annihilates either
+// below the subdiagonal of column j (m=0) or the bulge in column r-b (m>0).
+//
+// The columns of the band are split into contiguous blocks of width at least
+// 2b, one per process of the VR communicator, and each step is applied by the
+// process which owns the last column of its diagonal block. A step can also 
+// touch up to 2b of the preceding columns, which the previous process lends 
+// for the duration of the sweep, so that neighboring processes work on 
+// consecutive sweeps at the same time.
+//
+// The second-stage reflectors are stored, ordered by sweep and then by step,
+// as the columns of a b x K matrix V[* ,VR], with each Householder scalar 
+// stored in the first row, followed by the remaining entries of its 
+// (unit-leading) Householder vector.
+
+inline int
+TwoStageNumSteps( int n, int b, int j )
+{ return (n-1-j+b-1)/b; }
+
+inline int
+TwoStageNumReflectors( int n, int b )
+{
+    std::size_t numReflectors = 0;
+    for( int j=0; j<n-1; ++j )
+        numReflectors += TwoStageNumSteps( n, b, j );
+    if( numReflectors > std::size_t(std::numeric_limits<int>::max()) )
+        throw std::logic_error("Too many second-stage reflectors to index");
+    return numReflectors;
+}
+
+// The first step of sweep j whose diagonal block ends at or after column 
+// 'col', or the number of steps if there is no such step
+inline int
+TwoStageFirstStep( int n, int b, int j, int col )
+{
+    const int numSteps = TwoStageNumSteps( n, b, j );
+    if( col >= n )
+        return numSteps;
+    if( col <= j+b )
+        return 0;
+    return std::min( (col-j+b-1)/b-1, numSteps );
+}
+
+// The first column touched by the steps of sweep j which belong to the 
+// process owning columns [beginCol,endCol) if it precedes beginCol, and 
+// otherwise beginCol
+inline int
+TwoStageBorrowBegin( int n, int b, int j, int beginCol, int endCol )
+{
+    const int mBeg = TwoStageFirstStep( n, b, j, beginCol );
+    const int mEnd = TwoStageFirstStep( n, b, j, endCol );
+    if( mBeg == mEnd )
+        return beginCol;
+    const int c = ( mBeg == 0 ? j : j+1+(mBeg-1)*b );
+    return std::min( c, beginCol );
+}
+
+template<typename R>
+inline void
+TwoStagePanelQR( DistMatrix<R>& P, DistMatrix<R,STAR,STAR>& tP )
+{ QR( P ); }
+
+template<typename R>
+inline void
+TwoStagePanelQR
+( DistMatrix<Complex<R> >& P, DistMatrix<Complex<R>,STAR,STAR>& tP )
+{
+    DistMatrix<Complex<R>,MD,STAR> t( P.Grid() );
+    QR( P, t );
+    tP = t;
+}
+
+template<typename R>
+inline void
+TwoStageFixDiagonal
+( const DistMatrix<R,STAR,STAR>& tP, DistMatrix<R,STAR,STAR>& SInv )
+{ HalveMainDiagonal( SInv ); }
+
+template<typename R>
+inline void
+TwoStageFixDiagonal
+( const DistMatrix<Complex<R>,STAR,STAR>& tP,
+        DistMatrix<Complex<R>,STAR,STAR>& SInv )
+{ FixDiagonal( UNCONJUGATED, tP, SInv ); }
+
+// Reduces the lower triangle of A to a band of width b, storing the
+// Householder scalars of the complex case in t
+template<typename F>
+inline void
+HermitianBandReduction
+( DistMatrix<F>& A, DistMatrix<F,STAR,STAR>& t, int b )
+{
+#ifndef RELEASE
+    PushCallStack("internal::HermitianBandReduction");
+#endif
+    const Grid& g = A.Grid();
+    const int n = A.Height();
+    t.ResizeTo( std::max(n-b,0), 1 );
+
+    DistMatrix<F> P(g), PL(g), A22(g), V(g), X(g), W(g);
+    DistMatrix<F,VC,STAR> V_VC_STAR(g), X_VC_STAR(g);
+    DistMatrix<F,STAR,STAR> tP(g), SInv(g), Y(g);
+    for( int k=0; k+b<n; k+=b )
+    {
+        const int m = n-(k+b);
+        const int w = std::min(m,b);
+        View( P, A, k+b, k, m, b );
+        View( A22, A, k+b, k+b, m, m );
+        //--------------------------------------------------------------------//
+        TwoStagePanelQR( P, tP );
+        for( int j=0; j<tP.Height(); ++j )
+            t.SetLocal( k+j, 0, tP.GetLocal(j,0) );
+
+        // Form the compact WY representation, I - V inv(SInv) V^H, of the
+        // product of the panel's reflectors
+        LockedView( PL, P, 0, 0, m, w );
+        V.AlignWith( A22 );
+        V = PL;
+        MakeTrapezoidal( LEFT, LOWER, 0, V );
+        SetDiagonalToOne( LEFT, 0, V );
+        V_VC_STAR = V;
+        Zeros( w, w, SInv );
+        Herk
+        ( UPPER, ADJOINT,
+          F(1), V_VC_STAR.LockedLocalMatrix(),
+          F(0), SInv.LocalMatrix() );
+        SInv.SumOverGrid();
+        TwoStageFixDiagonal( tP, SInv );
+
+        // A22 := A22 - V W^H - W V^H, where X = A22 V inv(SInv) and
+        // W = X - 1/2 V inv(SInv)^H V^H X
+        X.AlignWith( A22 );
+        Zeros( m, w, X );
+        Hemm( LEFT, LOWER, F(1), A22, V, F(0), X );
+        X_VC_STAR.AlignWith( V_VC_STAR );
+        X_VC_STAR = X;
+        Trsm
+        ( RIGHT, UPPER, NORMAL, NON_UNIT,
+          F(1), SInv.LockedLocalMatrix(), X_VC_STAR.LocalMatrix() );
+        Zeros( w, w, Y );
+        Gemm
+        ( ADJOINT, NORMAL,
+          F(1), V_VC_STAR.LockedLocalMatrix(), X_VC_STAR.LockedLocalMatrix(),
+          F(0), Y.LocalMatrix() );
+        Y.SumOverGrid();
+        Trsm
+        ( LEFT, UPPER, ADJOINT, NON_UNIT,
+          F(1), SInv.LockedLocalMatrix(), Y.LocalMatrix() );
+        Gemm
+        ( NORMAL, NORMAL,
+          F(-1)/F(2), V_VC_STAR.LockedLocalMatrix(), Y.LockedLocalMatrix(),
+          F(1), X_VC_STAR.LocalMatrix() );
+        W.AlignWith( A22 );
+        W = X_VC_STAR;
+        Her2k( LOWER, NORMAL, F(-1), V, W, F(1), A22 );
+        //--------------------------------------------------------------------//
+        V.FreeAlignments();
+        X.FreeAlignments();
+        W.FreeAlignments();
+        X_VC_STAR.FreeAlignments();
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+// Applies step m of sweep j to the band, where column s of the band starts at
+// band[(s-firstCol)(2b+1)] and holds the entries in rows s through s+2b (which
+// leaves room for the bulges), and stores the reflector in the format of V
+template<typename F>
+inline void
+HermitianBandChaseStep
+( int n, int b, int j, int m, F* band, int firstCol, F* reflector,
+  Matrix<F>& chi, Matrix<F>& x, std::vector<F>& work )
+{
+    typedef typename Base<F>::type R;
+    const std::size_t ldim = 2*b+1;
+    const int r = j+1+m*b;
+    const int c = ( m == 0 ? j : r-b );
+    const int length = std::min(b,n-r);
+    F* v = &work[0];
+    F* y = &work[b];
+    F* w = &work[2*b];
+    F* block = &work[3*b];
+
+    // Form the reflector which annihilates A(r+1:r+length-1,c)
+    F* colC = &band[(c-firstCol)*ldim];
+    chi.ResizeTo( 1, 1 );
+    x.ResizeTo( length-1, 1 );
+    chi.Set( 0, 0, colC[r-c] );
+    for( int k=1; k<length; ++k )
+        x.Set( k-1, 0, colC[r+k-c] );
+    const F tau = Reflector( chi, x );
+    colC[r-c] = chi.Get(0,0);
+    v[0] = 1;
+    reflector[0] = tau;
+    for( int k=1; k<length; ++k )
+    {
+        colC[r+k-c] = 0;
+        v[k] = x.Get(k-1,0);
+        reflector[k] = v[k];
+    }
+    for( int k=length; k<b; ++k )
+        reflector[k] = 0;
+
+    // Apply the adjoint of the reflector from the left to the remainder of
+    // the bulge, A(r:r+length-1,c+1:r-1)
+    for( int s=c+1; s<r; ++s )
+    {
+        F* col = &band[(s-firstCol)*ldim];
+        F delta = 0;
+        for( int k=0; k<length; ++k )
+            delta += Conj(v[k])*col[r+k-s];
+        for( int k=0; k<length; ++k )
+            col[r+k-s] -= Conj(tau)*v[k]*delta;
+    }
+
+    // Apply the reflector from both sides of the diagonal block,
+    // A(r:r+length-1,r:r+length-1) -= v w^H + w v^H, where
+    // w = tau y - 1/2 |tau|^2 (v^H y) v and y = A v
+    for( int jj=0; jj<length; ++jj )
+    {
+        const F* col = &band[(r+jj-firstCol)*ldim];
+        for( int ii=jj; ii<length; ++ii )
+        {
+            const F alpha = col[ii-jj];
+            block[ii+jj*b] = alpha;
+            block[jj+ii*b] = Conj(alpha);
+        }
+    }
+    F vHy = 0;
+    for( int ii=0; ii<length; ++ii )
+    {
+        y[ii] = 0;
+        for( int jj=0; jj<length; ++jj )
+            y[ii] += block[ii+jj*b]*v[jj];
+        vHy += Conj(v[ii])*y[ii];
+    }
+    const R tauAbs = Abs(tau);
+    for( int ii=0; ii<length; ++ii )
+        w[ii] = tau*y[ii] - (tauAbs*tauAbs/R(2))*vHy*v[ii];
+    for( int jj=0; jj<length; ++jj )
+    {
+        F* col = &band[(r+jj-firstCol)*ldim];
+        for( int ii=jj; ii<length; ++ii )
+            col[ii-jj] -= v[ii]*Conj(w[jj]) + w[ii]*Conj(v[jj]);
+    }
+
+    // Apply the reflector from the right to the rows below the diagonal 
+    // block, which creates the next bulge
+    const int rowEnd = std::min(n,r+length+b);
+    for( int i=r+length; i<rowEnd; ++i )
+    {
+        F delta = 0;
+        for( int k=0; k<length; ++k )
+            delta += band[(i-r-k)+(r+k-firstCol)*ldim]*v[k];
+        for( int k=0; k<length; ++k )
+            band[(i-r-k)+(r+k-firstCol)*ldim] -= tau*delta*Conj(v[k]);
+    }
+}
+
+// Chases the bulges through columns [beginCol,endCol) of the band, which are 
+// stored in 'band' after the (up to 2b) preceding columns starting at 
+// firstCol, which are borrowed from the previous process when needed. The 
+// reflectors of the steps owned by this process are stored, in order, in 
+// 'reflectors'. The next process owns columns [endCol,nextEndCol).
+template<typename F>
+inline void
+HermitianBandChase
+( int n, int b, int firstCol, int beginCol, int endCol, int nextEndCol,
+  std::vector<F>& band, std::vector<F>& reflectors, mpi::Comm comm )
+{
+#ifndef RELEASE
+    PushCallStack("internal::HermitianBandChase");
+#endif
+    const std::size_t ldim = 2*b+1;
+    const int commRank = mpi::CommRank( comm );
+
+    std::size_t numOwnedSteps = 0;
+    for( int j=0; j<n-1; ++j )
+        numOwnedSteps += TwoStageFirstStep( n, b, j, endCol ) - 
+                         TwoStageFirstStep( n, b, j, beginCol );
+    reflectors.resize( std::max(numOwnedSteps*b,std::size_t(1)) );
+
+    Matrix<F> chi, x;
+    std::vector<F> work( 3*b+b*b );
+    std::size_t offset = 0;
+    int lentBegin = endCol;
+    for( int j=0; j<n-1; ++j )
+    {
+        // Take back the columns which the next process borrowed for the
+        // previous sweep
+        if( lentBegin < endCol )
+        {
+            mpi::Recv
+            ( &band[(lentBegin-firstCol)*ldim], (endCol-lentBegin)*ldim, 
+              commRank+1, 0, comm );
+            lentBegin = endCol;
+        }
+
+        // Borrow the columns of the previous process which our steps touch
+        int borrowBegin = TwoStageBorrowBegin( n, b, j, beginCol, endCol );
+        if( borrowBegin < beginCol )
+            mpi::Recv
+            ( &band[(borrowBegin-firstCol)*ldim], (beginCol-borrowBegin)*ldim,
+              commRank-1, 0, comm );
+
+        const int mBeg = TwoStageFirstStep( n, b, j, beginCol );
+        const int mEnd = TwoStageFirstStep( n, b, j, endCol );
+        for( int m=mBeg; m<mEnd; ++m )
+        {
+            HermitianBandChaseStep
+            ( n, b, j, m, &band[0], firstCol, &reflectors[offset], 
+              chi, x, work );
+            offset += b;
+
+            // Return the borrowed columns as soon as the remaining steps no
+            // longer touch them, so that the previous process can continue
+            // with the next sweep
+            if( borrowBegin < beginCol && 
+                (m+1 == mEnd || j+1+m*b >= beginCol) )
+            {
+                mpi::Send
+                ( &band[(borrowBegin-firstCol)*ldim], 
+                  (beginCol-borrowBegin)*ldim, commRank-1, 0, comm );
+                borrowBegin = beginCol;
+            }
+        }
+
+        // Lend the columns which the steps of the next process will touch
+        if( endCol < n )
+        {
+            const int nextBorrowBegin = 
+                TwoStageBorrowBegin( n, b, j, endCol, nextEndCol );
+            if( nextBorrowBegin < endCol )
+            {
+                mpi::Send
+                ( &band[(nextBorrowBegin-firstCol)*ldim], 
+                  (endCol-nextBorrowBegin)*ldim, commRank+1, 0, comm );
+                lentBegin = nextBorrowBegin;
+            }
+        }
+    }
+    if( lentBegin < endCol )
+        mpi::Recv
+        ( &band[(lentBegin-firstCol)*ldim], (endCol-lentBegin)*ldim, 
+          commRank+1, 0, comm );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+// Moves the reflectors computed by HermitianBandChase (where the process with
+// the given rank in the VR communicator owned the band columns 
+// [rank blockWidth,(rank+1) blockWidth)) into V[* ,VR]
+template<typename F>
+inline void
+TwoStageDistributeReflectors
+( int n, int b, int blockWidth, const std::vector<F>& reflectors,
+  DistMatrix<F,STAR,VR>& V )
+{
+#ifndef RELEASE
+    PushCallStack("internal::TwoStageDistributeReflectors");
+#endif
+    mpi::Comm comm = V.Grid().VRComm();
+    const int p = mpi::CommSize( comm );
+    const int commRank = mpi::CommRank( comm );
+    const int beginCol = std::min( commRank*blockWidth, n );
+    const int endCol = std::min( beginCol+blockWidth, n );
+    V.ResizeTo( b, TwoStageNumReflectors(n,b) );
+    const int rowAlignment = V.RowAlignment();
+    const int rowShift = V.RowShift();
+    const std::size_t VLDim = V.LocalLDim();
+    F* VBuffer = V.LocalBuffer();
+
+    // Exchange the reflectors of a limited number of sweeps at a time so that
+    // the counts fit within an int
+    const int maxStepsPerSweep = blockWidth/b + 2;
+    const int sweepsPerExchange = 
+        std::max( 1, (1<<26)/(maxStepsPerSweep*b) );
+    std::vector<int> sendCounts(p), sendDispls(p), recvCounts(p), 
+                     recvDispls(p), offsets(p);
+    std::vector<F> sendBuffer, recvBuffer;
+    std::size_t ownedOffset = 0;
+    int firstReflector = 0;
+    for( int J=0; J<n-1; J+=sweepsPerExchange )
+    {
+        const int JEnd = std::min( J+sweepsPerExchange, n-1 );
+        std::fill( sendCounts.begin(), sendCounts.end(), 0 );
+        std::fill( recvCounts.begin(), recvCounts.end(), 0 );
+        for( int j=J, k0=firstReflector; j<JEnd; 
+             k0+=TwoStageNumSteps(n,b,j), ++j )
+        {
+            const int mBeg = TwoStageFirstStep( n, b, j, beginCol );
+            const int mEnd = TwoStageFirstStep( n, b, j, endCol );
+            for( int m=mBeg; m<mEnd; ++m )
+                sendCounts[((k0+m)%p+rowAlignment)%p] += b;
+            const int numSteps = TwoStageNumSteps( n, b, j );
+            for( int k=k0+(rowShift-k0%p+p)%p; k<k0+numSteps; k+=p )
+            {
+                const int m = k-k0;
+                const int lastCol = std::min( n-1, j+(m+1)*b );
+                recvCounts[lastCol/blockWidth] += b;
+            }
+        }
+        int sendSize=0, recvSize=0;
+        for( int q=0; q<p; ++q )
+        {
+            sendDispls[q] = sendSize;
+            recvDispls[q] = recvSize;
+            sendSize += sendCounts[q];
+            recvSize += recvCounts[q];
+        }
+        sendBuffer.resize( std::max(sendSize,1) );
+        recvBuffer.resize( std::max(recvSize,1) );
+
+        // Pack the reflectors of our steps, in order, for their owners
+        std::fill( offsets.begin(), offsets.end(), 0 );
+        for( int j=J, k0=firstReflector; j<JEnd; 
+             k0+=TwoStageNumSteps(n,b,j), ++j )
+        {
+            const int mBeg = TwoStageFirstStep( n, b, j, beginCol );
+            const int mEnd = TwoStageFirstStep( n, b, j, endCol );
+            for( int m=mBeg; m<mEnd; ++m )
+            {
+                const int q = ((k0+m)%p+rowAlignment)%p;
+                MemCopy
+                ( &sendBuffer[sendDispls[q]+offsets[q]], 
+                  &reflectors[ownedOffset], b );
+                offsets[q] += b;
+                ownedOffset += b;
+            }
+        }
+
+        mpi::AllToAll
+        ( &sendBuffer[0], &sendCounts[0], &sendDispls[0],
+          &recvBuffer[0], &recvCounts[0], &recvDispls[0], comm );
+
+        // Unpack our reflectors, which arrive in order from each process
+        std::fill( offsets.begin(), offsets.end(), 0 );
+        for( int j=J; j<JEnd; ++j )
+        {
+            const int numSteps = TwoStageNumSteps( n, b, j );
+            for( int k=firstReflector+(rowShift-firstReflector%p+p)%p; 
+                 k<firstReflector+numSteps; k+=p )
+            {
+                const int m = k-firstReflector;
+                const int q = std::min( n-1, j+(m+1)*b ) / blockWidth;
+                const std::size_t kLocal = (k-rowShift)/p;
+                MemCopy
+                ( &VBuffer[kLocal*VLDim], 
+                  &recvBuffer[recvDispls[q]+offsets[q]], b );
+                offsets[q] += b;
+            }
+            firstReflector += numSteps;
+        }
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename F>
+inline void
+HermitianTridiagTwoStageHelper
+( UpperOrLower uplo, DistMatrix<F>& A,
+  DistMatrix<F,STAR,STAR>& t, DistMatrix<F,STAR,VR>& V )
+{
+#ifndef RELEASE
+    PushCallStack("internal::HermitianTridiagTwoStageHelper");
+#endif
+    const Grid& g = A.Grid();
+    const int n = A.Height();
+    const int b = std::max( std::min(Blocksize(),n-1), 1 );
+
+    // The reduction is always performed within the lower triangle
+    if( uplo == UPPER )
+        MakeHermitian( UPPER, A );
+    HermitianBandReduction( A, t, b );
+
+    // Split the columns of the band into contiguous blocks, one per process
+    // of the VR communicator, each of which also leaves room for the 2b 
+    // preceding columns
+    mpi::Comm comm = g.VRComm();
+    const int p = g.Size();
+    const int commRank = g.VRRank();
+    const int blockWidth = std::max( 2*b, (n+p-1)/p );
+    const int beginCol = std::min( commRank*blockWidth, n );
+    const int endCol = std::min( beginCol+blockWidth, n );
+    const int nextEndCol = std::min( endCol+blockWidth, n );
+    const int firstCol = std::max( beginCol-2*b, 0 );
+    const std::size_t ldim = 2*b+1;
+    std::vector<F> band
+    ( std::max((endCol-firstCol)*ldim,std::size_t(1)), F(0) );
+
+    // Send each locally owned entry of the band to the owner of its column
+    const int colAlignment = A.ColAlignment();
+    const int rowAlignment = A.RowAlignment();
+    const int colShift = A.ColShift();
+    const int rowShift = A.RowShift();
+    const int colStride = A.ColStride();
+    const int rowStride = A.RowStride();
+    const int localWidth = A.LocalWidth();
+    std::vector<int> sendCounts(p,0), sendDispls(p), 
+                     recvCounts(p,0), recvDispls(p);
+    for( int jLocal=0; jLocal<localWidth; ++jLocal )
+    {
+        const int j = rowShift + jLocal*rowStride;
+        sendCounts[j/blockWidth] += 
+            LocalLength( std::min(n,j+b+1), colShift, colStride ) - 
+            LocalLength( j, colShift, colStride );
+    }
+    for( int q=0; q<p; ++q )
+    {
+        const int qColShift = Shift( q/rowStride, colAlignment, colStride );
+        const int qRowShift = Shift( q%rowStride, rowAlignment, rowStride );
+        const int jLocalBeg = LocalLength( beginCol, qRowShift, rowStride );
+        const int jLocalEnd = LocalLength( endCol, qRowShift, rowStride );
+        for( int jLocal=jLocalBeg; jLocal<jLocalEnd; ++jLocal )
+        {
+            const int j = qRowShift + jLocal*rowStride;
+            recvCounts[q] += 
+                LocalLength( std::min(n,j+b+1), qColShift, colStride ) - 
+                LocalLength( j, qColShift, colStride );
+        }
+    }
+    int sendSize=0, recvSize=0;
+    for( int q=0; q<p; ++q )
+    {
+        sendDispls[q] = sendSize;
+        recvDispls[q] = recvSize;
+        sendSize += sendCounts[q];
+        recvSize += recvCounts[q];
+    }
+    std::vector<F> sendBuffer( std::max(sendSize,1) ), 
+                   recvBuffer( std::max(recvSize,1) );
+    // The owners of the local columns are nondecreasing, so the entries are
+    // packed contiguously
+    for( int jLocal=0, offset=0; jLocal<localWidth; ++jLocal )
+    {
+        const int j = rowShift + jLocal*rowStride;
+        const int iLocalBeg = LocalLength( j, colShift, colStride );
+        const int iLocalEnd =
+            LocalLength( std::min(n,j+b+1), colShift, colStride );
+        for( int iLocal=iLocalBeg; iLocal<iLocalEnd; ++iLocal, ++offset )
+            sendBuffer[offset] = A.GetLocal(iLocal,jLocal);
+    }
+    mpi::AllToAll
+    ( &sendBuffer[0], &sendCounts[0], &sendDispls[0],
+      &recvBuffer[0], &recvCounts[0], &recvDispls[0], comm );
+    for( int q=0; q<p; ++q )
+    {
+        const int qColShift = Shift( q/rowStride, colAlignment, colStride );
+        const int qRowShift = Shift( q%rowStride, rowAlignment, rowStride );
+        const int jLocalBeg = LocalLength( beginCol, qRowShift, rowStride );
+        const int jLocalEnd = LocalLength( endCol, qRowShift, rowStride );
+        int offset = recvDispls[q];
+        for( int jLocal=jLocalBeg; jLocal<jLocalEnd; ++jLocal )
+        {
+            const int j = qRowShift + jLocal*rowStride;
+            const int iLocalBeg = LocalLength( j, qColShift, colStride );
+            const int iLocalEnd =
+                LocalLength( std::min(n,j+b+1), qColShift, colStride );
+            for( int iLocal=iLocalBeg; iLocal<iLocalEnd; ++iLocal, ++offset )
+            {
+                const int i = qColShift + iLocal*colStride;
+                band[(i-j)+(j-firstCol)*ldim] = recvBuffer[offset];
+            }
+        }
+    }
+    std::vector<F>().swap( sendBuffer );
+    std::vector<F>().swap( recvBuffer );
+
+    // Pipeline the bulge chasing over the processes and then distribute the
+    // second-stage reflectors for the back-transformation
+    std::vector<F> reflectors;
+    HermitianBandChase
+    ( n, b, firstCol, beginCol, endCol, nextEndCol, band, reflectors, comm );
+    TwoStageDistributeReflectors( n, b, blockWidth, reflectors, V );
+    std::vector<F>().swap( reflectors );
+
+    // Every process needs the diagonal and subdiagonal for its part of A
+    std::vector<F> tridiag( std::max(2*n,1), F(0) );
+    for( int j=beginCol; j<endCol; ++j )
+    {
+        tridiag[j] = band[(j-firstCol)*ldim];
+        if( j < n-1 )
+            tridiag[n+j] = band[1+(j-firstCol)*ldim];
+    }
+    mpi::AllReduce( &tridiag[0], 2*n, mpi::SUM, comm );
+
+    // Store the tridiagonal matrix and clear the rest of the band above the
+    // first-stage reflectors
+    for( int jLocal=0; jLocal<localWidth; ++jLocal )
+    {
+        const int j = rowShift + jLocal*rowStride;
+        const int iLocalBeg = LocalLength( j, colShift, colStride );
+        const int iLocalEnd =
+            LocalLength( std::min(n,j+b), colShift, colStride );
+        for( int iLocal=iLocalBeg; iLocal<iLocalEnd; ++iLocal )
+        {
+            const int i = colShift + iLocal*colStride;
+            F alpha = 0;
+            if( i == j )
+                alpha = tridiag[j];
+            else if( i == j+1 )
+                alpha = tridiag[n+j];
+            A.SetLocal( iLocal, jLocal, alpha );
+        }
+        if( uplo == UPPER && j > 0 )
+        {
+            const int i = j-1;
+            if( (i+colStride-colShift) % colStride == 0 )
+                A.SetLocal
+                ( (i-colShift)/colStride, jLocal, Conj(tridiag[n+i]) );
+        }
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+// Reduces A to real symmetric tridiagonal form using the two-stage approach.
+// Regardless of 'uplo', the reduction uses the lower triangle of A, which is
+// overwritten with the tridiagonal matrix and the first-stage Householder
+// vectors (implicitly one on the b'th subdiagonal, where b=V.Height()). When
+// uplo=UPPER, the superdiagonal is also overwritten.
+template<typename R>
+inline void
+HermitianTridiagTwoStage
+( UpperOrLower uplo, DistMatrix<R>& A, DistMatrix<R,STAR,VR>& V )
+{
+#ifndef RELEASE
+    PushCallStack("internal::HermitianTridiagTwoStage");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("A must be square");
+    if( A.Grid() != V.Grid() )
+        throw std::logic_error("{A,V} must be distributed over the same grid");
+#endif
+    DistMatrix<R,STAR,STAR> t( A.Grid() );
+    HermitianTridiagTwoStageHelper( uplo, A, t, V );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename R>
+inline void
+HermitianTridiagTwoStage
+( UpperOrLower uplo,
+  DistMatrix<Complex<R> >& A,
+  DistMatrix<Complex<R>,STAR,STAR>& t,
+  DistMatrix<Complex<R>,STAR,VR>& V )
+{
+#ifndef RELEASE
+    PushCallStack("internal::HermitianTridiagTwoStage");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("A must be square");
+    if( A.Grid() != t.Grid() || t.Grid() != V.Grid() )
+        throw std::logic_error("{A,t,V} must be distributed over the same grid");
+#endif
+    HermitianTridiagTwoStageHelper( uplo, A, t, V );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+// Z := Q2 Z, where Q2 is the product of the second-stage reflectors.
+//
+// Within a block of sweeps, a reflector commutes with the reflectors of 
+// later sweeps and higher steps, so the block is applied one step at a time,
+// with the staircase of reflectors of that step from each sweep of the block
+// applied at once as I - W T W^H (the compact-WY form).
+template<typename F>
+inline void
+ApplyBandToTridiagReflectors
+( const DistMatrix<F,STAR,VR>& V, DistMatrix<F>& Z )
+{
+#ifndef RELEASE
+    PushCallStack("internal::ApplyBandToTridiagReflectors");
+#endif
+    const Grid& g = Z.Grid();
+    const int n = Z.Height();
+    const int b = V.Height();
+
+    // The index of the first reflector of each sweep
+    std::vector<int> offsets( std::max(n,1), 0 );
+    for( int j=0; j<n-1; ++j )
+        offsets[j+1] = offsets[j] + TwoStageNumSteps( n, b, j );
+
+    // Each process owns entire columns of Z[* ,VR]
+    DistMatrix<F,STAR,VR> Z_STAR_VR( g );
+    Z_STAR_VR = Z;
+    Matrix<F>& ZLocal = Z_STAR_VR.LocalMatrix();
+    const int localWidth = Z_STAR_VR.LocalWidth();
+
+    DistMatrix<F,STAR,VR> VBlock_STAR_VR( g );
+    DistMatrix<F,STAR,STAR> VBlock_STAR_STAR( g );
+    Matrix<F> W, T, S, Y, ZGroup;
+    const int lastBlock = ( n > 1 ? ((n-2)/b)*b : 0 );
+    for( int J=lastBlock; J>=0 && n>1; J-=b )
+    {
+        const int JEnd = std::min( J+b, n-1 );
+        const int firstReflector = offsets[J];
+        LockedView
+        ( VBlock_STAR_VR, V, 0, firstReflector, 
+          b, offsets[JEnd]-firstReflector );
+        VBlock_STAR_STAR = VBlock_STAR_VR;
+        const Matrix<F>& VBlock = VBlock_STAR_STAR.LockedLocalMatrix();
+
+        const int numSteps = TwoStageNumSteps( n, b, J );
+        for( int m=0; m<numSteps; ++m )
+        {
+            // Gather the staircase of reflectors for step m of the sweeps
+            int groupSize = 0;
+            while( J+groupSize < JEnd && J+groupSize+1+m*b < n )
+                ++groupSize;
+            const int rowBeg = J+1+m*b;
+            const int rowEnd = std::min( n, J+groupSize+(m+1)*b );
+            const int height = rowEnd-rowBeg;
+            Zeros( height, groupSize, W );
+            T.ResizeTo( groupSize, groupSize );
+            for( int jj=0; jj<groupSize; ++jj )
+            {
+                const int j = J+jj;
+                const int length = std::min( b, n-(j+1+m*b) );
+                const int reflector = offsets[j]+m-firstReflector;
+                T.Set( jj, jj, VBlock.Get(0,reflector) );
+                W.Set( jj, jj, F(1) );
+                for( int k=1; k<length; ++k )
+                    W.Set( jj+k, jj, VBlock.Get(k,reflector) );
+            }
+
+            // Form the upper-triangular T such that the product of the
+            // reflectors, in order of sweep, is I - W T W^H
+            S.ResizeTo( groupSize, groupSize );
+            Gemm( ADJOINT, NORMAL, F(1), W, W, F(0), S );
+            for( int jj=1; jj<groupSize; ++jj )
+            {
+                const F tau = T.Get(jj,jj);
+                for( int i=0; i<jj; ++i )
+                {
+                    F alpha = 0;
+                    for( int l=i; l<jj; ++l )
+                        alpha += T.Get(i,l)*S.Get(l,jj);
+                    T.Set( i, jj, -tau*alpha );
+                }
+            }
+
+            // ZGroup := (I - W T W^H) ZGroup
+            View( ZGroup, ZLocal, rowBeg, 0, height, localWidth );
+            Y.ResizeTo( groupSize, localWidth );
+            Gemm( ADJOINT, NORMAL, F(1), W, ZGroup, F(0), Y );
+            Trmm( LEFT, UPPER, NORMAL, NON_UNIT, F(1), T, Y );
+            Gemm( NORMAL, NORMAL, F(-1), W, Y, F(1), ZGroup );
+        }
+    }
+    Z = Z_STAR_VR;
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+// Z := Q Z, where A = Q T Q^H was computed by HermitianTridiagTwoStage
+template<typename R>
+inline void
+ApplyTwoStageReflectors
+( const DistMatrix<R>& A, const DistMatrix<R,STAR,VR>& V,
+  DistMatrix<R>& Z )
+{
+#ifndef RELEASE
+    PushCallStack("internal::ApplyTwoStageReflectors");
+    if( A.Grid() != V.Grid() || V.Grid() != Z.Grid() )
+        throw std::logic_error("{A,V,Z} must be distributed over the same grid");
+    if( A.Height() != Z.Height() )
+        throw std::logic_error("A and Z must be the same height");
+#endif
+    ApplyBandToTridiagReflectors( V, Z );
+    ApplyPackedReflectors
+    ( LEFT, LOWER, VERTICAL, BACKWARD, -V.Height(), A, Z );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename R>
+inline void
+ApplyTwoStageReflectors
+( const DistMatrix<Complex<R> >& A,
+  const DistMatrix<Complex<R>,STAR,STAR>& t,
+  const DistMatrix<Complex<R>,STAR,VR>& V,
+        DistMatrix<Complex<R> >& Z )
+{
+#ifndef RELEASE
+    PushCallStack("internal::ApplyTwoStageReflectors");
+    if( A.Grid() != t.Grid() || t.Grid() != V.Grid() ||
+        V.Grid() != Z.Grid() )
+        throw std::logic_error
+        ("{A,t,V,Z} must be distributed over the same grid");
+    if( A.Height() != Z.Height() )
+        throw std::logic_error("A and Z must be the same height");
+#endif
+    ApplyBandToTridiagReflectors( V, Z );
+    ApplyPackedReflectors
+    ( LEFT, LOWER, VERTICAL, BACKWARD, UNCONJUGATED, -V.Height(), A, t, Z );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+} // namespace internal
+} // namespace elem
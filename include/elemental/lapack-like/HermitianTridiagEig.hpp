@@ -0,0 +1,561 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace elem {
+namespace internal {
+
+// Solves the secular equation
+//
+//   1 + rho sum_j z_j^2 / (d_j - lambda) = 0,
+//
+// for its roots with indices iBeg,...,iEnd-1 (out of k), where d is sorted in
+// ascending order, rho > 0, and no z_j is zero. In order to avoid 
+// cancellation, root i is stored as lambda_i = d_{origins[i-iBeg]} + 
+// taus[i-iBeg], where the origin is the closer of the two poles which bound
+// the root.
+template<typename R>
+inline void
+SecularRoots
+( const std::vector<R>& d, const std::vector<R>& z, R rho, int iBeg, int iEnd,
+  std::vector<int>& origins, std::vector<R>& taus )
+{
+    const int k = d.size();
+    const R eps = lapack::MachineEpsilon<R>();
+    origins.resize( iEnd-iBeg );
+    taus.resize( iEnd-iBeg );
+
+    R zNormSquared = 0;
+    for( int j=0; j<k; ++j )
+        zNormSquared += z[j]*z[j];
+
+    std::vector<R> shifts( k );
+    for( int i=iBeg; i<iEnd; ++i )
+    {
+        // Bracket the root relative to the nearer pole
+        int origin;
+        R lower, upper;
+        if( i < k-1 )
+        {
+            const R halfGap = (d[i+1]-d[i])/2;
+            R f = 1;
+            for( int j=0; j<k; ++j )
+                f += rho*z[j]*z[j]/((d[j]-d[i])-halfGap);
+            if( f >= 0 )
+            {
+                origin = i;
+                lower = 0;
+                upper = halfGap;
+            }
+            else
+            {
+                origin = i+1;
+                lower = -halfGap;
+                upper = 0;
+            }
+        }
+        else
+        {
+            origin = i;
+            lower = 0;
+            upper = rho*zNormSquared;
+        }
+        for( int j=0; j<k; ++j )
+            shifts[j] = d[j] - d[origin];
+
+        // Safeguarded Newton iteration, falling back to bisection whenever
+        // the Newton step leaves the bracket
+        R tau = (lower+upper)/2;
+        for( int iter=0; iter<100; ++iter )
+        {
+            R f = 1, fPrime = 0, fAbs = 1;
+            for( int j=0; j<k; ++j )
+            {
+                const R ratio = z[j]/(shifts[j]-tau);
+                f += rho*z[j]*ratio;
+                fPrime += rho*ratio*ratio;
+                fAbs += Abs(rho*z[j]*ratio);
+            }
+            if( Abs(f) <= 8*eps*k*fAbs )
+                break;
+            if( f > 0 )
+                upper = tau;
+            else
+                lower = tau;
+            if( upper-lower <= 2*eps*std::max(Abs(lower),Abs(upper)) )
+                break;
+            const R newtonTau = tau - f/fPrime;
+            if( newtonTau > lower && newtonTau < upper )
+                tau = newtonTau;
+            else
+                tau = (lower+upper)/2;
+        }
+        origins[i-iBeg] = origin;
+        taus[i-iBeg] = tau;
+    }
+}
+
+// Returns d_j - lambda_i, where lambda_i = d_{origins[i]} + taus[i]
+template<typename R>
+inline R
+SecularGap
+( const std::vector<R>& d, const std::vector<int>& origins,
+  const std::vector<R>& taus, int j, int i )
+{ return (d[j]-d[origins[i]]) - taus[i]; }
+
+// Merges the eigendecompositions of the two halves of a tridiagonal matrix,
+//
+//   T = diag(Q1,Q2) (diag(D1,D2) + rho z z^T) diag(Q1,Q2)^T,
+//
+// by deflating the small components of z and the nearly equal entries of D,
+// finding the remaining eigenpairs of the rank-one modification through the
+// secular equation (with the Gu-Eisenstat recomputation of z to guarantee
+// orthogonal eigenvectors), and then updating Q with two calls to Gemm.
+// On exit, 'd' holds the sorted eigenvalues of T.
+template<typename R>
+inline void
+MergeTridiagEig
+( std::vector<R>& d, std::vector<R>& z, R rho, int n1, DistMatrix<R>& Q )
+{
+#ifndef RELEASE
+    PushCallStack("internal::MergeTridiagEig");
+#endif
+    const Grid& g = Q.Grid();
+    const int n = d.size();
+    const R eps = lapack::MachineEpsilon<R>();
+
+    // Normalize z (its norm is ideally sqrt(2))
+    R zNorm = 0;
+    for( int j=0; j<n; ++j )
+        zNorm += z[j]*z[j];
+    zNorm = Sqrt(zNorm);
+    for( int j=0; j<n; ++j )
+        z[j] /= zNorm;
+    rho *= zNorm*zNorm;
+
+    std::vector<std::pair<R,int> > sorted( n );
+    R dMax = 0, zMax = 0;
+    for( int j=0; j<n; ++j )
+    {
+        sorted[j] = std::pair<R,int>( d[j], j );
+        dMax = std::max( dMax, Abs(d[j]) );
+        zMax = std::max( zMax, Abs(z[j]) );
+    }
+    std::sort( sorted.begin(), sorted.end() );
+    const R tol = 8*eps*std::max(dMax,zMax);
+
+    // Deflate, remembering the Givens rotations which combine nearly equal
+    // poles. Each rotation acts on the columns (pivot,index) of Q.
+    std::vector<int> deflated, kept;
+    std::vector<int> rotPivots, rotIndices;
+    std::vector<R> rotCosines, rotSines;
+    int prev = -1;
+    for( int jSorted=0; jSorted<n; ++jSorted )
+    {
+        const int j = sorted[jSorted].second;
+        if( rho*Abs(z[j]) <= tol )
+        {
+            deflated.push_back( j );
+            continue;
+        }
+        if( prev == -1 )
+        {
+            prev = j;
+            continue;
+        }
+        const R tau = lapack::SafeNorm( z[j], z[prev] );
+        const R c = z[j]/tau;
+        const R s = -z[prev]/tau;
+        if( Abs((d[j]-d[prev])*c*s) <= tol )
+        {
+            z[j] = tau;
+            z[prev] = 0;
+            rotPivots.push_back( prev );
+            rotIndices.push_back( j );
+            rotCosines.push_back( c );
+            rotSines.push_back( s );
+            const R alpha = d[prev]*c*c + d[j]*s*s;
+            d[j] = d[prev]*s*s + d[j]*c*c;
+            d[prev] = alpha;
+            deflated.push_back( prev );
+        }
+        else
+            kept.push_back( prev );
+        prev = j;
+    }
+    if( prev != -1 )
+        kept.push_back( prev );
+    for( int jKept=0; jKept<(int)kept.size(); ++jKept )
+        sorted[jKept] = std::pair<R,int>( d[kept[jKept]], kept[jKept] );
+    std::sort( sorted.begin(), sorted.begin()+kept.size() );
+    const int k = kept.size();
+    std::vector<R> dKept( k ), zKept( k );
+    for( int jKept=0; jKept<k; ++jKept )
+    {
+        kept[jKept] = sorted[jKept].second;
+        dKept[jKept] = d[kept[jKept]];
+        zKept[jKept] = z[kept[jKept]];
+    }
+
+    // Solve the secular equation and recompute z from the roots so that the
+    // eigenvectors, (zHat_j/(d_j-lambda_i))_j, are numerically orthogonal.
+    // Each process of the VR communicator handles a contiguous block of the
+    // roots and of the entries of zHat, which are then gathered, and the
+    // gaps d_j-lambda_i are recomputed as needed rather than stored.
+    mpi::Comm comm = g.VRComm();
+    const int p = g.Size();
+    const int commRank = g.VRRank();
+    std::vector<int> blockCounts( p ), blockDispls( p );
+    for( int q=0; q<p; ++q )
+        blockDispls[q] = int((double(k)*q)/p);
+    for( int q=0; q<p; ++q )
+        blockCounts[q] = ( q<p-1 ? blockDispls[q+1] : k ) - blockDispls[q];
+    const int iBeg = blockDispls[commRank];
+    const int iEnd = iBeg + blockCounts[commRank];
+    std::vector<int> myOrigins, origins( std::max(k,1) );
+    std::vector<R> myTaus, taus( std::max(k,1) );
+    SecularRoots( dKept, zKept, rho, iBeg, iEnd, myOrigins, myTaus );
+    myOrigins.resize( std::max(iEnd-iBeg,1) );
+    myTaus.resize( std::max(iEnd-iBeg,1) );
+    mpi::AllGather
+    ( &myOrigins[0], iEnd-iBeg, 
+      &origins[0], &blockCounts[0], &blockDispls[0], comm );
+    mpi::AllGather
+    ( &myTaus[0], iEnd-iBeg, &taus[0], &blockCounts[0], &blockDispls[0], comm );
+    std::vector<R> myZHat( std::max(iEnd-iBeg,1) ), zHat( std::max(k,1) );
+    for( int j=iBeg; j<iEnd; ++j )
+    {
+        R product = -SecularGap(dKept,origins,taus,j,k-1)/rho;
+        for( int i=0; i<j; ++i )
+            product *= 
+                -SecularGap(dKept,origins,taus,j,i)/(dKept[i]-dKept[j]);
+        for( int i=j; i<k-1; ++i )
+            product *= 
+                -SecularGap(dKept,origins,taus,j,i)/(dKept[i+1]-dKept[j]);
+        myZHat[j-iBeg] = 
+            ( zKept[j] >= 0 ? Sqrt(product) : -Sqrt(product) );
+    }
+    mpi::AllGather
+    ( &myZHat[0], iEnd-iBeg, &zHat[0], &blockCounts[0], &blockDispls[0], comm );
+
+    // Sort the deflated and secular eigenvalues together. Deflated entries
+    // are tagged by their index, and secular roots by -(i+1).
+    std::vector<std::pair<R,int> > eigs;
+    eigs.reserve( n );
+    for( int jDef=0; jDef<(int)deflated.size(); ++jDef )
+        eigs.push_back
+        ( std::pair<R,int>( d[deflated[jDef]], deflated[jDef] ) );
+    for( int i=0; i<k; ++i )
+        eigs.push_back
+        ( std::pair<R,int>( dKept[origins[i]]+taus[i], -(i+1) ) );
+    std::sort( eigs.begin(), eigs.end() );
+
+    // Form our columns of the eigenvectors of the rank-one modification
+    DistMatrix<R,STAR,VR> U_STAR_VR( g );
+    Zeros( n, n, U_STAR_VR );
+    const int rowShift = U_STAR_VR.RowShift();
+    const int rowStride = U_STAR_VR.RowStride();
+    const int localWidth = U_STAR_VR.LocalWidth();
+    for( int jLocal=0; jLocal<localWidth; ++jLocal )
+    {
+        const int j = rowShift + jLocal*rowStride;
+        const int tag = eigs[j].second;
+        if( tag >= 0 )
+            U_STAR_VR.SetLocal( tag, jLocal, 1 );
+        else
+        {
+            const int i = -(tag+1);
+            R norm = 0;
+            for( int jKept=0; jKept<k; ++jKept )
+            {
+                const R upsilon = 
+                    zHat[jKept]/SecularGap(dKept,origins,taus,jKept,i);
+                norm += upsilon*upsilon;
+            }
+            norm = Sqrt(norm);
+            for( int jKept=0; jKept<k; ++jKept )
+                U_STAR_VR.SetLocal
+                ( kept[jKept], jLocal, 
+                  zHat[jKept]/SecularGap(dKept,origins,taus,jKept,i)/norm );
+        }
+    }
+
+    // Undo the deflating rotations, U := G_0 G_1 ... U
+    for( int r=rotPivots.size()-1; r>=0; --r )
+    {
+        const int pivot = rotPivots[r];
+        const int j = rotIndices[r];
+        const R c = rotCosines[r];
+        const R s = rotSines[r];
+        for( int jLocal=0; jLocal<localWidth; ++jLocal )
+        {
+            const R upsilonP = U_STAR_VR.GetLocal(pivot,jLocal);
+            const R upsilonJ = U_STAR_VR.GetLocal(j,jLocal);
+            U_STAR_VR.SetLocal( pivot, jLocal, c*upsilonP - s*upsilonJ );
+            U_STAR_VR.SetLocal( j, jLocal, s*upsilonP + c*upsilonJ );
+        }
+    }
+    for( int j=0; j<n; ++j )
+        d[j] = eigs[j].first;
+
+    // Q := diag(Q1,Q2) U
+    DistMatrix<R> QT(g), QB(g), Q1(g), Q2(g), U(g), UT(g), UB(g);
+    DistMatrix<R> QNew(g);
+    U = U_STAR_VR;
+    LockedView( UT, U, 0,  0, n1,   n );
+    LockedView( UB, U, n1, 0, n-n1, n );
+    LockedView( Q1, Q, 0,  0,  n1,   n1   );
+    LockedView( Q2, Q, n1, n1, n-n1, n-n1 );
+    View( QT, Q, 0,  0, n1,   n );
+    View( QB, Q, n1, 0, n-n1, n );
+    QNew.AlignWith( QT );
+    Zeros( n1, n, QNew );
+    Gemm( NORMAL, NORMAL, R(1), Q1, UT, R(0), QNew );
+    QT = QNew;
+    QNew.FreeAlignments();
+    QNew.AlignWith( QB );
+    Zeros( n-n1, n, QNew );
+    Gemm( NORMAL, NORMAL, R(1), Q2, UB, R(0), QNew );
+    QB = QNew;
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+// Recursively computes the eigendecomposition of the tridiagonal matrix with
+// diagonal d and subdiagonal e into the (initially zero) matrix Q, with
+// subproblems no larger than 'cutoff' solved redundantly by every process
+template<typename R>
+inline void
+DivideAndConquerTridiagEig
+( std::vector<R>& d, const std::vector<R>& e, DistMatrix<R>& Q, int cutoff )
+{
+#ifndef RELEASE
+    PushCallStack("internal::DivideAndConquerTridiagEig");
+#endif
+    const Grid& g = Q.Grid();
+    const int n = d.size();
+    if( n <= cutoff )
+    {
+        // LAPACK requires a nonempty (though unused) subdiagonal when n=1
+        std::vector<R> eCopy( e ), Z( n*n );
+        eCopy.push_back( 0 );
+        lapack::SymmetricTridiagEig( n, &d[0], &eCopy[0], &Z[0], n );
+        const int colShift = Q.ColShift();
+        const int rowShift = Q.RowShift();
+        const int colStride = Q.ColStride();
+        const int rowStride = Q.RowStride();
+        const int localHeight = Q.LocalHeight();
+        const int localWidth = Q.LocalWidth();
+        for( int jLocal=0; jLocal<localWidth; ++jLocal )
+        {
+            const int j = rowShift + jLocal*rowStride;
+            for( int iLocal=0; iLocal<localHeight; ++iLocal )
+            {
+                const int i = colShift + iLocal*colStride;
+                Q.SetLocal( iLocal, jLocal, Z[i+j*n] );
+            }
+        }
+#ifndef RELEASE
+        PopCallStack();
+#endif
+        return;
+    }
+
+    // Tear T into two tridiagonal matrices and a rank-one modification,
+    // T = diag(T1,T2) + |beta| v v^T, where v = [e_{n1-1}; sgn(beta) e_0]
+    const int n1 = n/2;
+    const R beta = e[n1-1];
+    const R rho = Abs(beta);
+    std::vector<R> d1( d.begin(), d.begin()+n1 ), 
+                   d2( d.begin()+n1, d.end() );
+    std::vector<R> e1( e.begin(), e.begin()+(n1-1) ), 
+                   e2( e.begin()+n1, e.end() );
+    d1[n1-1] -= rho;
+    d2[0] -= rho;
+
+    DistMatrix<R> Q1(g), Q2(g);
+    View( Q1, Q, 0,  0,  n1,   n1   );
+    View( Q2, Q, n1, n1, n-n1, n-n1 );
+    DivideAndConquerTridiagEig( d1, e1, Q1, cutoff );
+    DivideAndConquerTridiagEig( d2, e2, Q2, cutoff );
+
+    // z = diag(Q1,Q2)^T v is formed from the last row of Q1 and the first
+    // row of Q2
+    DistMatrix<R> QRows(g);
+    DistMatrix<R,STAR,STAR> QRows_STAR_STAR(g);
+    LockedView( QRows, Q, n1-1, 0, 2, n );
+    QRows_STAR_STAR = QRows;
+    std::vector<R> z( n );
+    for( int j=0; j<n1; ++j )
+        z[j] = QRows_STAR_STAR.GetLocal(0,j);
+    for( int j=n1; j<n; ++j )
+        z[j] = ( beta >= 0 ? 1 : -1 )*QRows_STAR_STAR.GetLocal(1,j);
+
+    for( int j=0; j<n1; ++j )
+        d[j] = d1[j];
+    for( int j=n1; j<n; ++j )
+        d[j] = d2[j-n1];
+    MergeTridiagEig( d, z, rho, n1, Q );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+#ifndef WITHOUT_PMRRR
+// Computes the eigenpairs with indices a,a+1,...,b of the symmetric 
+// tridiagonal matrix with diagonal d and subdiagonal e using PMRRR over the 
+// VR communicator of Z's grid. PMRRR leaves each process with a contiguous 
+// block of the eigenpairs, which is redistributed into the [* ,VR] layout, 
+// and every process receives all of the eigenvalues.
+template<typename R>
+inline void
+TridiagEigPMRRR
+( const std::vector<R>& d, const std::vector<R>& e, int a, int b,
+  std::vector<R>& w, DistMatrix<R,STAR,VR>& Z )
+{
+#ifndef RELEASE
+    PushCallStack("internal::TridiagEigPMRRR");
+#endif
+    const Grid& g = Z.Grid();
+    const int n = d.size();
+    const int k = b-a+1;
+    const int q = g.Size();
+    const int rank = g.VRRank();
+    const mpi::Comm comm = g.VRComm();
+    if( !Z.Viewing() )
+    {
+        Z.Empty();
+        Z.Align( 0 );
+    }
+    Zeros( n, k, Z );
+    w.resize( k );
+    if( k <= 0 )
+    {
+#ifndef RELEASE
+        PopCallStack();
+#endif
+        return;
+    }
+
+    std::vector<R> dCopy( d ), eCopy( e ), wBlock( n );
+    eCopy.resize( n );
+    std::vector<R> ZBlock( n*std::max((k+q-1)/q,1) );
+    pmrrr::Info info = pmrrr::Eig
+    ( n, &dCopy[0], &eCopy[0], &wBlock[0], &ZBlock[0], n, comm, a, b );
+    int blockInfo[2] = { info.firstLocalEigenvalue, info.numLocalEigenvalues };
+    std::vector<int> blockInfos( 2*q );
+    mpi::AllGather( blockInfo, 2, &blockInfos[0], 2, comm );
+
+    // Send each eigenvector to the owner of its column in Z[* ,VR]
+    std::vector<int> sendCounts(q,0), sendDispls(q),
+                     recvCounts(q,0), recvDispls(q);
+    for( int jBlock=0; jBlock<blockInfo[1]; ++jBlock )
+        sendCounts[(blockInfo[0]+jBlock) % q] += n;
+    for( int source=0; source<q; ++source )
+        for( int jBlock=0; jBlock<blockInfos[2*source+1]; ++jBlock )
+            if( (blockInfos[2*source]+jBlock) % q == rank )
+                recvCounts[source] += n;
+    int sendSize=0, recvSize=0;
+    for( int proc=0; proc<q; ++proc )
+    {
+        sendDispls[proc] = sendSize;
+        recvDispls[proc] = recvSize;
+        sendSize += sendCounts[proc];
+        recvSize += recvCounts[proc];
+    }
+    std::vector<R> sendBuffer( std::max(sendSize,1) ),
+                   recvBuffer( std::max(recvSize,1) );
+    std::vector<int> offsets( sendDispls );
+    for( int jBlock=0; jBlock<blockInfo[1]; ++jBlock )
+    {
+        const int dest = (blockInfo[0]+jBlock) % q;
+        MemCopy( &sendBuffer[offsets[dest]], &ZBlock[jBlock*n], n );
+        offsets[dest] += n;
+    }
+    mpi::AllToAll
+    ( &sendBuffer[0], &sendCounts[0], &sendDispls[0],
+      &recvBuffer[0], &recvCounts[0], &recvDispls[0], comm );
+    for( int source=0; source<q; ++source )
+    {
+        int offset = recvDispls[source];
+        for( int jBlock=0; jBlock<blockInfos[2*source+1]; ++jBlock )
+        {
+            const int j = blockInfos[2*source] + jBlock;
+            if( j % q != rank )
+                continue;
+            const int jLocal = (j-rank) / q;
+            MemCopy( Z.LocalBuffer(0,jLocal), &recvBuffer[offset], n );
+            offset += n;
+        }
+    }
+
+    // Gather the eigenvalues
+    std::vector<int> wCounts( q ), wDispls( q );
+    for( int proc=0; proc<q; ++proc )
+    {
+        wCounts[proc] = blockInfos[2*proc+1];
+        wDispls[proc] = blockInfos[2*proc];
+    }
+    mpi::AllGather
+    ( &wBlock[0], blockInfo[1], &w[0], &wCounts[0], &wDispls[0], comm );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+#endif // WITHOUT_PMRRR
+
+} // namespace internal
+
+template<typename R>
+inline void
+HermitianTridiagEig
+( const DistMatrix<R,STAR,STAR>& d,
+  const DistMatrix<R,STAR,STAR>& e,
+  DistMatrix<R,VR,STAR>& w,
+  DistMatrix<R>& Z )
+{
+#ifndef RELEASE
+    PushCallStack("HermitianTridiagEig");
+    if( d.Grid() != e.Grid() || e.Grid() != w.Grid() || w.Grid() != Z.Grid() )
+        throw std::logic_error
+        ("{d,e,w,Z} must be distributed over the same grid");
+    if( d.Width() != 1 || e.Width() != 1 )
+        throw std::logic_error("d and e must be column vectors");
+    if( d.Height() != 0 && e.Height() != d.Height()-1 )
+        throw std::logic_error("e must be one entry shorter than d");
+#else
+    PushProfileRegion("HermitianTridiagEig");
+#endif
+    const int n = d.Height();
+    std::vector<R> dVector( n ), eVector( std::max(n-1,0) );
+    for( int j=0; j<n; ++j )
+        dVector[j] = d.GetLocal(j,0);
+    for( int j=0; j<n-1; ++j )
+        eVector[j] = e.GetLocal(j,0);
+
+    Zeros( n, n, Z );
+    if( n > 0 )
+    {
+        const int cutoff = std::max( Blocksize(), 2 );
+        internal::DivideAndConquerTridiagEig( dVector, eVector, Z, cutoff );
+    }
+
+    w.ResizeTo( n, 1 );
+    const int colShift = w.ColShift();
+    const int colStride = w.ColStride();
+    for( int iLocal=0; iLocal<w.LocalHeight(); ++iLocal )
+        w.SetLocal( iLocal, 0, dVector[colShift+iLocal*colStride] );
+#ifndef RELEASE
+    PopCallStack();
+#else
+    PopProfileRegion();
+#endif
+}
+
+} // namespace elem
@@ -8,6 +8,7 @@
 */
 
 #include "./LDL/Var3.hpp"
+#include "./LDL/Pivoted.hpp"
 
 namespace elem {
 
@@ -89,6 +90,35 @@ LDLH( DistMatrix<F>& A, DistMatrix<F,MC,STAR>& d )
 #endif
 }
 
+template<typename F>
+inline void
+LDLH
+( Matrix<F>& A, Matrix<F>& dSub, Matrix<int>& p )
+{
+#ifndef RELEASE
+    PushCallStack("LDLH");
+#endif
+    internal::LDLPivotedUnb( ADJOINT, A, dSub, p );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename F>
+inline void
+LDLH
+( DistMatrix<F>& A,
+  DistMatrix<F,MC,STAR>& dSub, DistMatrix<int,VC,STAR>& p )
+{
+#ifndef RELEASE
+    PushCallStack("LDLH");
+#endif
+    internal::LDLPivoted( ADJOINT, A, dSub, p );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
 template<typename F>
 inline void
 LDLT( Matrix<F>& A )
@@ -143,4 +173,33 @@ LDLT( DistMatrix<F>& A, DistMatrix<F,MC,STAR>& d )
 #endif
 }
 
+template<typename F>
+inline void
+LDLT
+( Matrix<F>& A, Matrix<F>& dSub, Matrix<int>& p )
+{
+#ifndef RELEASE
+    PushCallStack("LDLT");
+#endif
+    internal::LDLPivotedUnb( TRANSPOSE, A, dSub, p );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename F>
+inline void
+LDLT
+( DistMatrix<F>& A,
+  DistMatrix<F,MC,STAR>& dSub, DistMatrix<int,VC,STAR>& p )
+{
+#ifndef RELEASE
+    PushCallStack("LDLT");
+#endif
+    internal::LDLPivoted( TRANSPOSE, A, dSub, p );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
 } // namespace elem
@@ -0,0 +1,693 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace elem {
+namespace internal {
+
+// The Bunch-Kaufman threshold, (1+sqrt(17))/8, which minimizes the bound on
+// the element growth of a 1x1 step followed by a 2x2 step
+template<typename F>
+inline typename Base<F>::type
+BunchKaufmanAlpha()
+{
+    typedef typename Base<F>::type R;
+    return (1+Sqrt(R(17)))/8;
+}
+
+// Symmetrically swap rows/columns i1 < i2 of the symmetric (or Hermitian)
+// matrix whose lower triangle is stored in A
+template<typename F>
+inline void
+SymmetricSwap( bool conjugate, Matrix<F>& A, int i1, int i2 )
+{
+    const int n = A.Height();
+    F* ABuffer = A.Buffer();
+    const int ldim = A.LDim();
+    for( int j=0; j<i1; ++j )
+        std::swap( ABuffer[i1+j*ldim], ABuffer[i2+j*ldim] );
+    for( int i=i2+1; i<n; ++i )
+        std::swap( ABuffer[i+i1*ldim], ABuffer[i+i2*ldim] );
+    for( int j=i1+1; j<i2; ++j )
+    {
+        const F temp = ABuffer[j+i1*ldim];
+        ABuffer[j+i1*ldim] = ( conjugate ? Conj(ABuffer[i2+j*ldim])
+                                         : ABuffer[i2+j*ldim] );
+        ABuffer[i2+j*ldim] = ( conjugate ? Conj(temp) : temp );
+    }
+    if( conjugate )
+        ABuffer[i2+i1*ldim] = Conj(ABuffer[i2+i1*ldim]);
+    std::swap( ABuffer[i1+i1*ldim], ABuffer[i2+i2*ldim] );
+}
+
+// Unblocked serial LDL with Bunch-Kaufman pivoting, as in LAPACK's
+// xSYTF2/xHETF2. The lower triangle of A is overwritten with the unit
+// lower-triangular L, except that its diagonal is overwritten with the
+// diagonal of the quasi-diagonal D; the subdiagonal of D, which is only
+// nonzero within its 2x2 blocks, is returned in dSub. Each entry p(k) of the
+// pivot vector is the row which was swapped with row k, so that
+// P A P^T = L D L^[T/H], where P applies the swaps in order.
+template<typename F>
+inline void
+LDLPivotedUnb
+( Orientation orientation, Matrix<F>& A, Matrix<F>& dSub, Matrix<int>& p )
+{
+#ifndef RELEASE
+    PushCallStack("internal::LDLPivotedUnb");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("A must be square");
+    if( orientation == NORMAL )
+        throw std::logic_error("Can only perform LDL^T or LDL^H");
+#endif
+    typedef typename Base<F>::type R;
+    const int n = A.Height();
+    const bool conjugate = ( orientation == ADJOINT );
+    const R alpha = BunchKaufmanAlpha<F>();
+    Zeros( std::max(n-1,0), 1, dSub );
+    p.ResizeTo( n, 1 );
+
+    F* ABuffer = A.Buffer();
+    const int ldim = A.LDim();
+    std::vector<F> l1, l2;
+    int k = 0;
+    while( k < n )
+    {
+        if( conjugate )
+            ABuffer[k+k*ldim] = RealPart(ABuffer[k+k*ldim]);
+
+        // Find the largest off-diagonal entry in column k
+        const R absakk = FastAbs(ABuffer[k+k*ldim]);
+        R colmax = 0;
+        int imax = k;
+        for( int i=k+1; i<n; ++i )
+        {
+            const R absaik = FastAbs(ABuffer[i+k*ldim]);
+            if( absaik > colmax )
+            {
+                colmax = absaik;
+                imax = i;
+            }
+        }
+
+        int kp = k, kstep = 1;
+        if( absakk < alpha*colmax )
+        {
+            // Find the largest off-diagonal entry in row/column imax, which
+            // is at least colmax
+            R rowmax = 0;
+            for( int j=k; j<imax; ++j )
+                rowmax = std::max( rowmax, FastAbs(ABuffer[imax+j*ldim]) );
+            for( int i=imax+1; i<n; ++i )
+                rowmax = std::max( rowmax, FastAbs(ABuffer[i+imax*ldim]) );
+
+            if( absakk >= alpha*colmax*(colmax/rowmax) )
+                kp = k;
+            else if( FastAbs(ABuffer[imax+imax*ldim]) >= alpha*rowmax )
+                kp = imax;
+            else
+            {
+                kp = imax;
+                kstep = 2;
+            }
+        }
+
+        const int kk = k + kstep - 1;
+        if( kp != kk )
+            SymmetricSwap( conjugate, A, kk, kp );
+
+        const int a21Height = n - (k+kstep);
+        if( kstep == 1 )
+        {
+            p.Set( k, 0, kp );
+            const F delta11 = ABuffer[k+k*ldim];
+            if( delta11 != F(0) )
+            {
+                // A22 := A22 - a21 inv(delta11) a21^[T/H]
+                F* RESTRICT a21 = &ABuffer[(k+1)+k*ldim];
+                for( int j=0; j<a21Height; ++j )
+                {
+                    const F beta =
+                        ( conjugate ? Conj(a21[j]) : a21[j] ) / delta11;
+                    F* RESTRICT A22Col = &ABuffer[(k+1)+(k+1+j)*ldim];
+                    for( int i=j; i<a21Height; ++i )
+                        A22Col[i] -= a21[i]*beta;
+                }
+                // a21 := a21 / delta11
+                for( int i=0; i<a21Height; ++i )
+                    a21[i] /= delta11;
+            }
+        }
+        else
+        {
+            p.Set( k, 0, k );
+            p.Set( k+1, 0, kp );
+            if( conjugate )
+                ABuffer[(k+1)+(k+1)*ldim] =
+                    RealPart(ABuffer[(k+1)+(k+1)*ldim]);
+
+            // Form L21 = W21 inv(D11), where W21 = A(k+2:n,k:k+1), using
+            // the scaling of xSYTF2/xHETF2 to avoid overflow
+            const F d11 = ABuffer[k+k*ldim];
+            const F d21 = ABuffer[(k+1)+k*ldim];
+            const F d22 = ABuffer[(k+1)+(k+1)*ldim];
+            const F d21Conj = ( conjugate ? Conj(d21) : d21 );
+            const F delta11 = d22 / d21;
+            const F delta22 = d11 / d21Conj;
+            const F prod = delta11*delta22;
+            const F t =
+                F(1) / ( (conjugate ? F(RealPart(prod)) : prod) - F(1) );
+            const F delta21 = t / d21;
+            const F delta21Conj = ( conjugate ? Conj(delta21) : delta21 );
+            F* RESTRICT w1 = &ABuffer[(k+2)+k*ldim];
+            F* RESTRICT w2 = &ABuffer[(k+2)+(k+1)*ldim];
+            l1.resize( a21Height );
+            l2.resize( a21Height );
+            for( int i=0; i<a21Height; ++i )
+            {
+                l1[i] = delta21Conj*(delta11*w1[i]-w2[i]);
+                l2[i] = delta21*(delta22*w2[i]-w1[i]);
+            }
+
+            // A22 := A22 - L21 W21^[T/H]
+            for( int j=0; j<a21Height; ++j )
+            {
+                const F beta1 = ( conjugate ? Conj(w1[j]) : w1[j] );
+                const F beta2 = ( conjugate ? Conj(w2[j]) : w2[j] );
+                F* RESTRICT A22Col = &ABuffer[(k+2)+(k+2+j)*ldim];
+                for( int i=j; i<a21Height; ++i )
+                    A22Col[i] -= l1[i]*beta1 + l2[i]*beta2;
+            }
+
+            for( int i=0; i<a21Height; ++i )
+            {
+                w1[i] = l1[i];
+                w2[i] = l2[i];
+            }
+            dSub.Set( k, 0, d21 );
+            ABuffer[(k+1)+k*ldim] = 0;
+        }
+        k += kstep;
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+// Overwrite W(k:m,c) with the corresponding portion of column r of the
+// symmetric (or Hermitian) matrix whose lower triangle is stored in A
+template<typename F>
+inline void
+PanelFetchColumn
+( bool conjugate, const DistMatrix<F>& A, int r, int k,
+  DistMatrix<F,MC,STAR>& W, int c )
+{
+    const Grid& g = A.Grid();
+    const int m = A.Height();
+    DistMatrix<F> aCol(g);
+    DistMatrix<F,MC,STAR> wCol(g);
+    LockedView( aCol, A, r, r, m-r, 1 );
+    View( wCol, W, r, c, m-r, 1 );
+    wCol = aCol;
+    if( r > k )
+    {
+        // The entries above row r come from row r of the lower triangle
+        DistMatrix<F> aRow(g);
+        DistMatrix<F,STAR,STAR> aRow_STAR_STAR(g);
+        LockedView( aRow, A, r, k, 1, r-k );
+        aRow_STAR_STAR = aRow;
+        const int colShift = W.ColShift();
+        const int colStride = W.ColStride();
+        const int localBeg = LocalLength( k, colShift, colStride );
+        const int localEnd = LocalLength( r, colShift, colStride );
+        for( int iLocal=localBeg; iLocal<localEnd; ++iLocal )
+        {
+            const int i = colShift + iLocal*colStride;
+            const F value = aRow_STAR_STAR.GetLocal(0,i-k);
+            W.SetLocal( iLocal, c, (conjugate ? Conj(value) : value) );
+        }
+    }
+}
+
+// W(k:m,c) := W(k:m,c) - L(k:m,0:k) op(W(r,0:k))^T, where op conjugates for
+// LDL^H, which applies the updates from the previous columns of the panel
+template<typename F>
+inline void
+PanelUpdateColumn
+( bool conjugate, const DistMatrix<F,MC,STAR>& L, int r, int k,
+  DistMatrix<F,MC,STAR>& W, int c )
+{
+    if( k == 0 )
+        return;
+    const Grid& g = W.Grid();
+    const int m = W.Height();
+    DistMatrix<F,MC,STAR> wRow(g), LBL(g), wB(g);
+    DistMatrix<F,STAR,STAR> wRow_STAR_STAR(g);
+    LockedView( wRow, W, r, 0, 1, k );
+    wRow_STAR_STAR = wRow;
+    Matrix<F> x( k, 1 );
+    for( int j=0; j<k; ++j )
+    {
+        const F value = wRow_STAR_STAR.GetLocal(0,j);
+        x.Set( j, 0, (conjugate ? Conj(value) : value) );
+    }
+    LockedView( LBL, L, k, 0, m-k, k );
+    View( wB, W, k, c, m-k, 1 );
+    if( wB.LocalHeight() > 0 )
+        Gemv
+        ( NORMAL, F(-1), LBL.LockedLocalMatrix(), x, F(1), wB.LocalMatrix() );
+}
+
+// Return the largest magnitude in W(iBeg:iEnd,c), skipping row 'exclude', and
+// set iMax to the first row where it occurs (or to iEnd if there are no
+// nonzeros)
+template<typename F>
+inline typename Base<F>::type
+PanelColumnMax
+( const DistMatrix<F,MC,STAR>& W, int c, int iBeg, int iEnd, int exclude,
+  int& iMax )
+{
+    typedef typename Base<F>::type R;
+    const Grid& g = W.Grid();
+    const int colShift = W.ColShift();
+    const int colStride = W.ColStride();
+    const int localBeg = LocalLength( iBeg, colShift, colStride );
+    const int localEnd = LocalLength( iEnd, colShift, colStride );
+
+    R localMax = 0;
+    int localRow = iEnd;
+    for( int iLocal=localBeg; iLocal<localEnd; ++iLocal )
+    {
+        const int i = colShift + iLocal*colStride;
+        if( i == exclude )
+            continue;
+        const R absValue = FastAbs(W.GetLocal(iLocal,c));
+        if( absValue > localMax )
+        {
+            localMax = absValue;
+            localRow = i;
+        }
+    }
+
+    // Only the magnitude and the row are needed, so two small reductions
+    // suffice: the maximum magnitude, then the first row which attains it
+    R globalMax;
+    mpi::AllReduce( &localMax, &globalMax, 1, mpi::MAX, g.ColComm() );
+    if( localMax != globalMax || globalMax == R(0) )
+        localRow = iEnd;
+    mpi::AllReduce( &localRow, &iMax, 1, mpi::MIN, g.ColComm() );
+    return globalMax;
+}
+
+// Swap rows i1 and i2 of the first 'width' columns of X
+template<typename F>
+inline void
+PanelSwapRows( DistMatrix<F,MC,STAR>& X, int i1, int i2, int width )
+{
+    if( width == 0 || i1 == i2 )
+        return;
+    const Grid& g = X.Grid();
+    const int r = g.Height();
+    const int colShift = X.ColShift();
+    const int owner1 = (i1+X.ColAlignment()) % r;
+    const int owner2 = (i2+X.ColAlignment()) % r;
+    const int ldim = X.LocalLDim();
+    if( owner1 == owner2 )
+    {
+        if( g.Row() == owner1 )
+        {
+            F* row1 = X.LocalBuffer( (i1-colShift)/r, 0 );
+            F* row2 = X.LocalBuffer( (i2-colShift)/r, 0 );
+            for( int j=0; j<width; ++j )
+                std::swap( row1[j*ldim], row2[j*ldim] );
+        }
+    }
+    else if( g.Row() == owner1 || g.Row() == owner2 )
+    {
+        const bool haveFirst = ( g.Row() == owner1 );
+        const int i = ( haveFirst ? i1 : i2 );
+        const int partner = ( haveFirst ? owner2 : owner1 );
+        F* row = X.LocalBuffer( (i-colShift)/r, 0 );
+        std::vector<F> sendBuf(width), recvBuf(width);
+        for( int j=0; j<width; ++j )
+            sendBuf[j] = row[j*ldim];
+        mpi::SendRecv
+        ( &sendBuf[0], width, partner, 0,
+          &recvBuf[0], width, partner, 0, g.ColComm() );
+        for( int j=0; j<width; ++j )
+            row[j*ldim] = recvBuf[j];
+    }
+}
+
+// Copy column kk of the symmetric (or Hermitian) matrix whose lower triangle
+// is stored in A into row/column kp > kk. Only the trailing portion of
+// column kk is read, and it is about to be overwritten by L.
+template<typename F>
+inline void
+PanelSymmetricCopy( bool conjugate, DistMatrix<F>& A, int kk, int kp )
+{
+    const Grid& g = A.Grid();
+    const int m = A.Height();
+    const int colShift = A.ColShift();
+    const int rowShift = A.RowShift();
+    const int r = g.Height();
+    const int c = g.Width();
+    DistMatrix<F> aCol(g);
+    DistMatrix<F,STAR,STAR> aCol_STAR_STAR(g);
+    LockedView( aCol, A, kk, kk, m-kk, 1 );
+    aCol_STAR_STAR = aCol;
+    const F* col = aCol_STAR_STAR.LockedLocalBuffer();
+
+    const F diag = col[0];
+    A.Set( kp, kp, (conjugate ? F(RealPart(diag)) : diag) );
+    if( g.Row() == (kp+A.ColAlignment()) % r )
+    {
+        // A(kp,kk+1:kp) := op(A(kk+1:kp,kk))^T
+        const int iLocal = (kp-colShift) / r;
+        const int localBeg = LocalLength( kk+1, rowShift, c );
+        const int localEnd = LocalLength( kp, rowShift, c );
+        for( int jLocal=localBeg; jLocal<localEnd; ++jLocal )
+        {
+            const int j = rowShift + jLocal*c;
+            const F value = col[j-kk];
+            A.SetLocal( iLocal, jLocal, (conjugate ? Conj(value) : value) );
+        }
+    }
+    if( g.Col() == (kp+A.RowAlignment()) % c )
+    {
+        // A(kp+1:m,kp) := A(kp+1:m,kk)
+        const int jLocal = (kp-rowShift) / c;
+        const int localHeight = A.LocalHeight();
+        for( int iLocal=LocalLength(kp+1,colShift,r);
+             iLocal<localHeight; ++iLocal )
+        {
+            const int i = colShift + iLocal*r;
+            A.SetLocal( iLocal, jLocal, col[i-kk] );
+        }
+    }
+}
+
+// Factor up to nb columns of A with Bunch-Kaufman pivoting, as in LAPACK's
+// xLASYF/xLAHEF, without updating the trailing matrix. The factored columns
+// of L, with D on their diagonal, are formed in L, and the corresponding
+// columns of W = L D, which are needed for the trailing update, in W. The
+// number of factored columns is returned; it is one less than nb when a 2x2
+// pivot would have straddled the end of the panel. L and W must be aligned
+// with A.
+template<typename F>
+inline int
+PanelLDLPivoted
+( Orientation orientation, DistMatrix<F>& A, int nb,
+  DistMatrix<F,MC,STAR>& L, DistMatrix<F,MC,STAR>& W,
+  DistMatrix<int,STAR,STAR>& p, Matrix<F>& dSub, int pivotOffset )
+{
+#ifndef RELEASE
+    PushCallStack("internal::PanelLDLPivoted");
+#endif
+    typedef typename Base<F>::type R;
+    const int m = A.Height();
+    const bool conjugate = ( orientation == ADJOINT );
+    const R alpha = BunchKaufmanAlpha<F>();
+    Zeros( m, nb, L );
+    Zeros( m, nb, W );
+    p.ResizeTo( nb, 1 );
+    Zeros( nb, 1, dSub );
+    const int colShift = W.ColShift();
+    const int colStride = W.ColStride();
+    const int localHeight = W.LocalHeight();
+
+    int k = 0;
+    while( k < m && (k < nb-1 || nb == m) )
+    {
+        PanelFetchColumn( conjugate, A, k, k, W, k );
+        PanelUpdateColumn( conjugate, L, k, k, W, k );
+        F wkk = W.Get( k, k );
+        if( conjugate )
+        {
+            wkk = RealPart(wkk);
+            W.Set( k, k, wkk );
+        }
+        const R absakk = FastAbs(wkk);
+        int imax = m;
+        R colmax = 0;
+        if( k+1 < m )
+            colmax = PanelColumnMax( W, k, k+1, m, -1, imax );
+
+        int kp = k, kstep = 1;
+        if( absakk < alpha*colmax )
+        {
+            // Form the updated column imax in W(:,k+1)
+            PanelFetchColumn( conjugate, A, imax, k, W, k+1 );
+            PanelUpdateColumn( conjugate, L, imax, k, W, k+1 );
+            F wii = W.Get( imax, k+1 );
+            if( conjugate )
+            {
+                wii = RealPart(wii);
+                W.Set( imax, k+1, wii );
+            }
+            int jmax;
+            const R rowmax = PanelColumnMax( W, k+1, k, m, imax, jmax );
+
+            if( absakk >= alpha*colmax*(colmax/rowmax) )
+                kp = k;
+            else if( FastAbs(wii) >= alpha*rowmax )
+            {
+                kp = imax;
+                const int localK = LocalLength( k, colShift, colStride );
+                for( int iLocal=localK; iLocal<localHeight; ++iLocal )
+                    W.SetLocal( iLocal, k, W.GetLocal(iLocal,k+1) );
+            }
+            else
+            {
+                kp = imax;
+                kstep = 2;
+            }
+        }
+
+        const int kk = k + kstep - 1;
+        if( kp != kk )
+        {
+            PanelSymmetricCopy( conjugate, A, kk, kp );
+            PanelSwapRows( L, kk, kp, kk );
+            PanelSwapRows( W, kk, kp, kk+1 );
+        }
+
+        const int localK = LocalLength( k, colShift, colStride );
+        if( kstep == 1 )
+        {
+            // L(k:m,k) := W(k:m,k), with the subdiagonal scaled by 1/d
+            p.SetLocal( k, 0, pivotOffset+kp );
+            const F delta11 = W.Get( k, k );
+            for( int iLocal=localK; iLocal<localHeight; ++iLocal )
+            {
+                const int i = colShift + iLocal*colStride;
+                F value = W.GetLocal(iLocal,k);
+                if( i > k && delta11 != F(0) )
+                    value /= delta11;
+                L.SetLocal( iLocal, k, value );
+            }
+        }
+        else
+        {
+            // L(k+2:m,k:k+1) := W(k+2:m,k:k+1) inv(D11), using the scaling
+            // of xLASYF/xLAHEF to avoid overflow
+            p.SetLocal( k, 0, pivotOffset+k );
+            p.SetLocal( k+1, 0, pivotOffset+kp );
+            const F d11 = W.Get( k, k );
+            const F d21 = W.Get( k+1, k );
+            const F d22 = W.Get( k+1, k+1 );
+            const F d21Conj = ( conjugate ? Conj(d21) : d21 );
+            const F delta11 = d22 / d21;
+            const F delta22 = d11 / d21Conj;
+            const F prod = delta11*delta22;
+            const F t =
+                F(1) / ( (conjugate ? F(RealPart(prod)) : prod) - F(1) );
+            const F delta21 = t / d21;
+            const F delta21Conj = ( conjugate ? Conj(delta21) : delta21 );
+            for( int iLocal=localK; iLocal<localHeight; ++iLocal )
+            {
+                const int i = colShift + iLocal*colStride;
+                if( i == k )
+                    L.SetLocal( iLocal, k, d11 );
+                else if( i == k+1 )
+                    L.SetLocal( iLocal, k+1, d22 );
+                else
+                {
+                    const F w1 = W.GetLocal(iLocal,k);
+                    const F w2 = W.GetLocal(iLocal,k+1);
+                    L.SetLocal( iLocal, k, delta21Conj*(delta11*w1-w2) );
+                    L.SetLocal( iLocal, k+1, delta21*(delta22*w2-w1) );
+                }
+            }
+            dSub.Set( k, 0, d21 );
+        }
+        k += kstep;
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+    return k;
+}
+
+// Blocked distributed LDL with Bunch-Kaufman pivoting, which is right-looking
+// across panels and left-looking within them, as in LAPACK's xSYTRF/xHETRF
+template<typename F>
+inline void
+LDLPivoted
+( Orientation orientation, DistMatrix<F>& A,
+  DistMatrix<F,MC,STAR>& dSub, DistMatrix<int,VC,STAR>& p )
+{
+#ifndef RELEASE
+    PushCallStack("internal::LDLPivoted");
+    if( A.Grid() != dSub.Grid() || A.Grid() != p.Grid() )
+        throw std::logic_error("{A,dSub,p} must be distributed over same grid");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("A must be square");
+    if( orientation == NORMAL )
+        throw std::logic_error("Can only perform LDL^T or LDL^H");
+    if( dSub.Viewing() &&
+        (dSub.Height() != std::max(A.Height()-1,0) || dSub.Width() != 1) )
+        throw std::logic_error("dSub must be one shorter than A");
+    if( dSub.Viewing() && dSub.ColAlignment() != A.ColAlignment() )
+        throw std::logic_error("dSub must be aligned with A");
+    if( p.Viewing() && (p.Height() != A.Height() || p.Width() != 1) )
+        throw std::logic_error
+        ("p must be a column vector of the same height as A");
+#endif
+    const Grid& g = A.Grid();
+    const int n = A.Height();
+    if( !dSub.Viewing() )
+    {
+        dSub.AlignWith( A );
+        dSub.ResizeTo( std::max(n-1,0), 1 );
+    }
+    MakeZeros( dSub );
+    if( !p.Viewing() )
+        p.ResizeTo( n, 1 );
+    // A panel must be able to hold a 2x2 pivot
+    const int bsize = std::max( Blocksize(), 2 );
+
+    DistMatrix<F> ABL(g), ABR(g), A22(g);
+    DistMatrix<F,MC,STAR> L(g), W(g), L21_MC_STAR(g), W21_MC_STAR(g);
+    DistMatrix<F,MR,STAR> W21_MR_STAR(g);
+    DistMatrix<int,STAR,STAR> pPan_STAR_STAR(g), p1_STAR_STAR(g);
+    DistMatrix<int,VC,STAR> p1(g);
+    Matrix<F> dSubPan;
+    std::vector<int> image, preimage;
+    int k = 0;
+    while( k < n )
+    {
+        View( ABR, A, k, k, n-k, n-k );
+        const int nb = ( n-k <= bsize ? n-k : bsize );
+        L.AlignWith( ABR );
+        W.AlignWith( ABR );
+        //--------------------------------------------------------------------//
+        const int kb = PanelLDLPivoted
+        ( orientation, ABR, nb, L, W, pPan_STAR_STAR, dSubPan, k );
+        LockedView( p1_STAR_STAR, pPan_STAR_STAR, 0, 0, kb, 1 );
+
+        // Apply the panel's interchanges to the previous columns of L
+        if( k > 0 )
+        {
+            View( ABL, A, k, 0, n-k, k );
+            ComposePanelPivots( p1_STAR_STAR, k, image, preimage );
+            ApplyRowPivots( ABL, image, preimage );
+        }
+
+        // Store the panel's columns of L, with D on their diagonal
+        const int colShift = ABR.ColShift();
+        const int rowShift = ABR.RowShift();
+        const int localHeight = ABR.LocalHeight();
+        const int localWidth = LocalLength( kb, rowShift, g.Width() );
+        for( int jLocal=0; jLocal<localWidth; ++jLocal )
+        {
+            const int j = rowShift + jLocal*g.Width();
+            const int localBeg = LocalLength( j, colShift, g.Height() );
+            for( int iLocal=localBeg; iLocal<localHeight; ++iLocal )
+                ABR.SetLocal( iLocal, jLocal, L.GetLocal(iLocal,j) );
+        }
+
+        // A22 := A22 - L21 W21^[T/H]
+        if( kb < n-k )
+        {
+            View( A22, ABR, kb, kb, n-k-kb, n-k-kb );
+            LockedView( L21_MC_STAR, L, kb, 0, n-k-kb, kb );
+            LockedView( W21_MC_STAR, W, kb, 0, n-k-kb, kb );
+            W21_MR_STAR.AlignWith( A22 );
+            W21_MR_STAR = W21_MC_STAR;
+            LocalTrrk
+            ( LOWER, orientation,
+              F(-1), L21_MC_STAR, W21_MR_STAR, F(1), A22 );
+        }
+
+        View( p1, p, k, 0, kb, 1 );
+        p1 = p1_STAR_STAR;
+        for( int j=0; j<std::min(kb,n-k-1); ++j )
+            dSub.Set( k+j, 0, dSubPan.Get(j,0) );
+        //--------------------------------------------------------------------//
+        L.FreeAlignments();
+        W.FreeAlignments();
+        W21_MR_STAR.FreeAlignments();
+        k += kb;
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+// Solve against the quasi-diagonal matrix D, with main diagonal d and
+// subdiagonal dSub, whose 2x2 blocks are marked by nonzero subdiagonal entries
+template<typename F>
+inline void
+QuasiDiagonalSolve
+( Orientation orientation,
+  const Matrix<F>& d, const Matrix<F>& dSub, Matrix<F>& B )
+{
+#ifndef RELEASE
+    PushCallStack("internal::QuasiDiagonalSolve");
+#endif
+    const bool conjugate = ( orientation == ADJOINT );
+    const int n = B.Height();
+    const int width = B.Width();
+    int k = 0;
+    while( k < n )
+    {
+        if( k+1 < n && dSub.Get(k,0) != F(0) )
+        {
+            // Solve against [d11, op(d21); d21, d22] using the scaling of
+            // xSYTRS/xHETRS
+            const F d21 = dSub.Get(k,0);
+            const F d21Conj = ( conjugate ? Conj(d21) : d21 );
+            const F delta11 = d.Get(k,0) / d21Conj;
+            const F delta22 = d.Get(k+1,0) / d21;
+            const F denom = delta11*delta22 - F(1);
+            for( int j=0; j<width; ++j )
+            {
+                const F beta1 = B.Get(k,j) / d21Conj;
+                const F beta2 = B.Get(k+1,j) / d21;
+                B.Set( k,   j, (delta22*beta1-beta2)/denom );
+                B.Set( k+1, j, (delta11*beta2-beta1)/denom );
+            }
+            k += 2;
+        }
+        else
+        {
+            const F delta = d.Get(k,0);
+            if( delta == F(0) )
+                throw SingularMatrixException();
+            for( int j=0; j<width; ++j )
+                B.Set( k, j, B.Get(k,j)/delta );
+            k += 1;
+        }
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+} // namespace internal
+} // namespace elem
@@ -28,6 +28,8 @@ LQ( Matrix<Real>& A )
 {
 #ifndef RELEASE
     PushCallStack("LQ");
+#else
+    PushProfileRegion("LQ");
 #endif
     if( IsComplex<Real>::val )
         throw std::logic_error("Called real routine with complex datatype");
@@ -66,6 +68,8 @@ LQ( Matrix<Real>& A )
     }
 #ifndef RELEASE
     PopCallStack();
+#else
+    PopProfileRegion();
 #endif
 }
 
@@ -75,6 +79,8 @@ LQ( DistMatrix<Real>& A )
 {
 #ifndef RELEASE
     PushCallStack("LQ");
+#else
+    PushProfileRegion("LQ");
 #endif
     if( IsComplex<Real>::val )
         throw std::logic_error("Called real routine with complex datatype");
@@ -114,6 +120,8 @@ LQ( DistMatrix<Real>& A )
     }
 #ifndef RELEASE
     PopCallStack();
+#else
+    PopProfileRegion();
 #endif
 }
 
@@ -124,6 +132,8 @@ LQ( Matrix<Complex<Real> >& A,
 {
 #ifndef RELEASE
     PushCallStack("LQ");
+#else
+    PushProfileRegion("LQ");
 #endif
     typedef Complex<Real> C;
     t.ResizeTo( std::min(A.Height(),A.Width()), 1 );
@@ -182,6 +192,8 @@ LQ( Matrix<Complex<Real> >& A,
     }
 #ifndef RELEASE
     PopCallStack();
+#else
+    PopProfileRegion();
 #endif
 }
 
@@ -194,6 +206,8 @@ LQ( DistMatrix<Complex<Real> >& A,
     PushCallStack("LQ");
     if( A.Grid() != t.Grid() )
         throw std::logic_error("{A,t} must be distributed over the same grid");
+#else
+    PushProfileRegion("LQ");
 #endif
     typedef Complex<Real> C;
     const Grid& g = A.Grid();
@@ -264,6 +278,8 @@ LQ( DistMatrix<Complex<Real> >& A,
     }
 #ifndef RELEASE
     PopCallStack();
+#else
+    PopProfileRegion();
 #endif
 }
 
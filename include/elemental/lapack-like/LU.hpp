@@ -9,6 +9,8 @@
 
 #include "./LU/Local.hpp"
 #include "./LU/Panel.hpp"
+#include "./LU/Tiled.hpp"
+#include "./LU/Tournament.hpp"
 
 namespace elem {
 
@@ -37,7 +39,20 @@ LU( Matrix<F>& A )
 {
 #ifndef RELEASE
     PushCallStack("LU");
+#else
+    PushProfileRegion("LU");
 #endif
+    if( internal::UseLocalTiles( A.Height(), A.Width() ) )
+    {
+        internal::LUTiled( A );
+#ifndef RELEASE
+        PopCallStack();
+#else
+        PopProfileRegion();
+#endif
+        return;
+    }
+
     // Matrix views
     Matrix<F>
         ATL, ATR,  A00, A01, A02, 
@@ -71,6 +86,8 @@ LU( Matrix<F>& A )
     }
 #ifndef RELEASE
     PopCallStack();
+#else
+    PopProfileRegion();
 #endif
 }
 
@@ -80,7 +97,10 @@ LU( DistMatrix<F>& A )
 {
 #ifndef RELEASE
     PushCallStack("LU");
+#else
+    PushProfileRegion("LU");
 #endif
+    PushBlocksizeStack<F>( "LU", A.Grid() );
     const Grid& g = A.Grid();
 
     // Matrix views
@@ -142,8 +162,11 @@ LU( DistMatrix<F>& A )
          /*************/ /******************/
           ABL, /**/ ABR,  A20, A21, /**/ A22 );
     }
+    PopBlocksizeStack( "LU" );
 #ifndef RELEASE
     PopCallStack();
+#else
+    PopProfileRegion();
 #endif
 }
 
@@ -159,6 +182,8 @@ LU( Matrix<F>& A, Matrix<int>& p )
         (std::min(A.Height(),A.Width()) != p.Height() || p.Width() != 1) ) 
         throw std::logic_error
         ("p must be a vector of the same height as the min dimension of A.");
+#else
+    PushProfileRegion("LU");
 #endif
     if( !p.Viewing() )
         p.ResizeTo( std::min(A.Height(),A.Width()), 1 );
@@ -225,6 +250,8 @@ LU( Matrix<F>& A, Matrix<int>& p )
     }
 #ifndef RELEASE
     PopCallStack();
+#else
+    PopProfileRegion();
 #endif
 }
 
@@ -240,7 +267,10 @@ LU( DistMatrix<F>& A, DistMatrix<int,VC,STAR>& p )
         (std::min(A.Height(),A.Width()) != p.Height() || p.Width() != 1) ) 
         throw std::logic_error
         ("p must be a vector of the same height as the min dimension of A.");
+#else
+    PushProfileRegion("LU");
 #endif
+    PushBlocksizeStack<F>( "LU", A.Grid() );
     const Grid& g = A.Grid();
     if( !p.Viewing() )
         p.ResizeTo( std::min(A.Height(),A.Width()), 1 );
@@ -248,7 +278,7 @@ LU( DistMatrix<F>& A, DistMatrix<int,VC,STAR>& p )
     // Matrix views
     DistMatrix<F>
         ATL(g), ATR(g),  A00(g), A01(g), A02(g),  AB(g),
-        ABL(g), ABR(g),  A10(g), A11(g), A12(g),  
+        ABL(g), ABR(g),  A10(g), A11(g), A12(g),  APan(g),
                          A20(g), A21(g), A22(g);
 
     DistMatrix<int,VC,STAR>
@@ -261,6 +291,7 @@ LU( DistMatrix<F>& A, DistMatrix<int,VC,STAR>& p )
     DistMatrix<F,  MC,  STAR> A21_MC_STAR(g);
     DistMatrix<F,  STAR,VR  > A12_STAR_VR(g);
     DistMatrix<F,  STAR,MR  > A12_STAR_MR(g);
+    DistMatrix<F,  VC,  STAR> APan_VC_STAR(g);
     DistMatrix<int,STAR,STAR> p1_STAR_STAR(g);
 
     // Pivot composition
@@ -288,6 +319,7 @@ LU( DistMatrix<F>& A, DistMatrix<int,VC,STAR>& p )
           pB,  p2 );
 
         View1x2( AB, ABL, ABR );
+        View2x1( APan, A11, A21 );
 
         const int pivotOffset = A01.Height();
         A12_STAR_VR.AlignWith( A22 );
@@ -296,13 +328,34 @@ LU( DistMatrix<F>& A, DistMatrix<int,VC,STAR>& p )
         A11_STAR_STAR.ResizeTo( A11.Height(), A11.Width() );
         p1_STAR_STAR.ResizeTo( p1.Height(), 1 );
         //--------------------------------------------------------------------//
-        A21_MC_STAR = A21;
-        A11_STAR_STAR = A11;
-        internal::PanelLU
-        ( A11_STAR_STAR, A21_MC_STAR, p1_STAR_STAR, pivotOffset );
-        internal::ComposePanelPivots
-        ( p1_STAR_STAR, pivotOffset, image, preimage );
-        ApplyRowPivots( AB, image, preimage );
+        if( GetLUPivoting() == LU_TOURNAMENT_PIVOTING )
+        {
+            // Choose all of the pivots of the panel up front so that the
+            // panel can be factored without further pivoting
+            APan_VC_STAR = APan;
+            internal::TournamentPivots
+            ( APan_VC_STAR, p1_STAR_STAR, pivotOffset );
+            internal::ComposePanelPivots
+            ( p1_STAR_STAR, pivotOffset, image, preimage );
+            ApplyRowPivots( AB, image, preimage );
+
+            A11_STAR_STAR = A11;
+            internal::LocalLU( A11_STAR_STAR );
+            A21_MC_STAR = A21;
+            internal::LocalTrsm
+            ( RIGHT, UPPER, NORMAL, NON_UNIT,
+              F(1), A11_STAR_STAR, A21_MC_STAR );
+        }
+        else
+        {
+            A21_MC_STAR = A21;
+            A11_STAR_STAR = A11;
+            internal::PanelLU
+            ( A11_STAR_STAR, A21_MC_STAR, p1_STAR_STAR, pivotOffset );
+            internal::ComposePanelPivots
+            ( p1_STAR_STAR, pivotOffset, image, preimage );
+            ApplyRowPivots( AB, image, preimage );
+        }
 
         // Perhaps we should give up perfectly distributing this operation since
         // it's total contribution is only O(n^2)
@@ -335,8 +388,11 @@ LU( DistMatrix<F>& A, DistMatrix<int,VC,STAR>& p )
          /**/ /**/
           pB,  p2 );
     }
+    PopBlocksizeStack( "LU" );
 #ifndef RELEASE
     PopCallStack();
+#else
+    PopProfileRegion();
 #endif
 }
 
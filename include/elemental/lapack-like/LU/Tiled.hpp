@@ -0,0 +1,128 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace elem {
+namespace internal {
+
+// LU factorization without pivoting as a graph of OpenMP tasks over nb x nb
+// tiles (see CholeskyLTiled). Only the last row or column of tiles may be
+// rectangular, in which case its diagonal tile is factored by LUUnb and has
+// no trailing tiles on the side of its longer dimension.
+
+template<typename F>
+inline void
+LUTiled( Matrix<F>& A )
+{
+#ifndef RELEASE
+    PushCallStack("internal::LUTiled");
+#endif
+    const int m = A.Height();
+    const int n = A.Width();
+    const int nb = GetLocalTileSize();
+    const int mTiles = (m+nb-1)/nb;
+    const int nTiles = (n+nb-1)/nb;
+    const int kTiles = std::min(mTiles,nTiles);
+    bool failed = false;
+
+#ifdef HAVE_OMP_TASK_DEPEND
+    #pragma omp parallel
+    #pragma omp single
+#endif
+    for( int k=0; k<kTiles; ++k )
+    {
+        const int kHeight = std::min(nb,m-k*nb);
+        const int kWidth = std::min(nb,n-k*nb);
+        const int kSize = std::min(kHeight,kWidth);
+#ifdef HAVE_OMP_TASK_DEPEND
+        F* Akk = A.Buffer(k*nb,k*nb);
+        #pragma omp task depend(inout:Akk[0])
+#endif
+        if( !TileFailed( failed ) )
+        {
+            try
+            {
+                Matrix<F> A11;
+                View( A11, A, k*nb, k*nb, kHeight, kWidth );
+                LUUnb( A11 );
+            }
+            catch( std::exception& e ) { RecordTileFailure( failed ); }
+        }
+
+        for( int i=k+1; i<mTiles; ++i )
+        {
+            const int iSize = std::min(nb,m-i*nb);
+#ifdef HAVE_OMP_TASK_DEPEND
+            F* Aik = A.Buffer(i*nb,k*nb);
+            #pragma omp task depend(in:Akk[0]) depend(inout:Aik[0])
+#endif
+            if( !TileFailed( failed ) )
+            {
+                try
+                {
+                    Matrix<F> A11, A21;
+                    LockedView( A11, A, k*nb, k*nb, kSize, kSize );
+                    View( A21, A, i*nb, k*nb, iSize, kSize );
+                    Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), A11, A21 );
+                }
+                catch( std::exception& e ) { RecordTileFailure( failed ); }
+            }
+        }
+
+        for( int j=k+1; j<nTiles; ++j )
+        {
+            const int jSize = std::min(nb,n-j*nb);
+#ifdef HAVE_OMP_TASK_DEPEND
+            F* Akj = A.Buffer(k*nb,j*nb);
+            #pragma omp task depend(in:Akk[0]) depend(inout:Akj[0])
+#endif
+            if( !TileFailed( failed ) )
+            {
+                try
+                {
+                    Matrix<F> A11, A12;
+                    LockedView( A11, A, k*nb, k*nb, kSize, kSize );
+                    View( A12, A, k*nb, j*nb, kSize, jSize );
+                    Trsm( LEFT, LOWER, NORMAL, UNIT, F(1), A11, A12 );
+                }
+                catch( std::exception& e ) { RecordTileFailure( failed ); }
+            }
+
+            for( int i=k+1; i<mTiles; ++i )
+            {
+                const int iSize = std::min(nb,m-i*nb);
+#ifdef HAVE_OMP_TASK_DEPEND
+                F* Aik = A.Buffer(i*nb,k*nb);
+                F* Aij = A.Buffer(i*nb,j*nb);
+                #pragma omp task \
+                 depend(in:Aik[0],Akj[0]) depend(inout:Aij[0])
+#endif
+                if( !TileFailed( failed ) )
+                {
+                    try
+                    {
+                        Matrix<F> A21, A12, A22;
+                        LockedView( A21, A, i*nb, k*nb, iSize, kSize );
+                        LockedView( A12, A, k*nb, j*nb, kSize, jSize );
+                        View( A22, A, i*nb, j*nb, iSize, jSize );
+                        Gemm( NORMAL, NORMAL, F(-1), A21, A12, F(1), A22 );
+                    }
+                    catch( std::exception& e ) { RecordTileFailure( failed ); }
+                }
+            }
+        }
+    }
+    if( failed )
+        throw SingularMatrixException();
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+} // namespace internal
+} // namespace elem
@@ -0,0 +1,163 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace elem {
+namespace internal {
+
+// Runs Gaussian elimination with partial pivoting on a copy of the first
+// 'height' rows of the height x width column-major buffer 'rows' and moves
+// the chosen pivot rows (with their original values), and their indices, to
+// the top in pivot order. Returns the number of chosen rows.
+template<typename F>
+inline int
+TournamentSelect( std::vector<F>& rows, std::vector<int>& indices, int height )
+{
+    const int width = rows.size() / indices.size();
+    const int ldim = indices.size();
+    std::vector<F> work( rows );
+    const int numPivots = std::min(height,width);
+    for( int k=0; k<numPivots; ++k )
+    {
+        int pivotRow = k;
+        for( int i=k+1; i<height; ++i )
+            if( FastAbs(work[i+k*ldim]) > FastAbs(work[pivotRow+k*ldim]) )
+                pivotRow = i;
+        if( pivotRow != k )
+        {
+            for( int j=0; j<width; ++j )
+            {
+                std::swap( work[k+j*ldim], work[pivotRow+j*ldim] );
+                std::swap( rows[k+j*ldim], rows[pivotRow+j*ldim] );
+            }
+            std::swap( indices[k], indices[pivotRow] );
+        }
+
+        // An exactly zero column leaves the choice of this pivot arbitrary
+        const F alpha = work[k+k*ldim];
+        if( alpha == F(0) )
+            continue;
+        const F alphaInv = F(1) / alpha;
+        for( int i=k+1; i<height; ++i )
+        {
+            const F gamma = work[i+k*ldim]*alphaInv;
+            for( int j=k+1; j<width; ++j )
+                work[i+j*ldim] -= gamma*work[k+j*ldim];
+        }
+    }
+    return numPivots;
+}
+
+// Chooses the pivots of the panel A with a binary reduction tree over the
+// processes of the VC communicator: each process selects up to A.Width()
+// candidate rows from its local rows with partial pivoting, and each parent
+// reselects from the union of its own candidates and those of its child.
+// The root's selection is then broadcast and converted into the sequence of
+// row swaps returned by PanelLU, so that only O(log p) messages are required
+// rather than the O(A.Width() log r) of the column-by-column approach.
+template<typename F>
+inline void
+TournamentPivots
+( const DistMatrix<F,VC,STAR>& A,
+  DistMatrix<int,STAR,STAR>& p,
+  int pivotOffset )
+{
+#ifndef RELEASE
+    PushCallStack("internal::TournamentPivots");
+    if( A.Grid() != p.Grid() )
+        throw std::logic_error
+        ("Matrices must be distributed over the same grid");
+    if( A.Width() != p.Height() || p.Width() != 1 )
+        throw std::logic_error("p must be a vector that conforms with A");
+    if( A.Height() < A.Width() )
+        throw std::logic_error("Panel must be at least as tall as it is wide");
+#endif
+    const Grid& g = A.Grid();
+    const int width = A.Width();
+    const int commSize = g.Size();
+    const int commRank = g.VCRank();
+    const int colShift = A.ColShift();
+    const int localHeight = A.LocalHeight();
+
+    // Store the indices and rows of our candidates with room for those of a
+    // child to be appended below them
+    const int maxHeight = std::max( 2*width, localHeight );
+    std::vector<int> indices( maxHeight );
+    std::vector<F> rows( maxHeight*width );
+    for( int iLocal=0; iLocal<localHeight; ++iLocal )
+    {
+        indices[iLocal] = colShift + iLocal*commSize;
+        for( int j=0; j<width; ++j )
+            rows[iLocal+j*maxHeight] = A.GetLocal(iLocal,j);
+    }
+    int count = TournamentSelect( rows, indices, localHeight );
+
+    // Candidates are communicated as [count | indices] and their packed rows
+    std::vector<int> intBuffer( width+1 );
+    std::vector<F> rowBuffer( width*width );
+
+    // Reduce the candidates to the root of the VC communicator
+    const mpi::Comm comm = g.VCComm();
+    for( int step=1; step<commSize; step*=2 )
+    {
+        if( commRank % (2*step) == step )
+        {
+            intBuffer[0] = count;
+            for( int i=0; i<count; ++i )
+                intBuffer[i+1] = indices[i];
+            for( int j=0; j<width; ++j )
+                for( int i=0; i<count; ++i )
+                    rowBuffer[i+j*width] = rows[i+j*maxHeight];
+            mpi::Send( &intBuffer[0], width+1, commRank-step, 0, comm );
+            mpi::Send( &rowBuffer[0], width*width, commRank-step, 0, comm );
+            break;
+        }
+        else if( commRank+step < commSize )
+        {
+            mpi::Recv( &intBuffer[0], width+1, commRank+step, 0, comm );
+            mpi::Recv( &rowBuffer[0], width*width, commRank+step, 0, comm );
+            const int childCount = intBuffer[0];
+            for( int i=0; i<childCount; ++i )
+                indices[count+i] = intBuffer[i+1];
+            for( int j=0; j<width; ++j )
+                for( int i=0; i<childCount; ++i )
+                    rows[count+i+j*maxHeight] = rowBuffer[i+j*width];
+            count = TournamentSelect( rows, indices, count+childCount );
+        }
+    }
+
+    // Broadcast the winners, in pivot order, from the root
+    if( commRank == 0 )
+        for( int i=0; i<width; ++i )
+            intBuffer[i] = indices[i];
+    mpi::Broadcast( &intBuffer[0], width, 0, comm );
+
+    // Convert the winners into a sequence of row swaps by tracking the
+    // (few) rows which have been moved from their original positions
+    std::map<int,int> positionOf, rowAt;
+    for( int k=0; k<width; ++k )
+    {
+        const int winner = intBuffer[k];
+        std::map<int,int>::const_iterator it = positionOf.find( winner );
+        const int position = ( it==positionOf.end() ? winner : it->second );
+        it = rowAt.find( k );
+        const int displaced = ( it==rowAt.end() ? k : it->second );
+        p.SetLocal( k, 0, position+pivotOffset );
+
+        rowAt[position] = displaced;
+        positionOf[displaced] = position;
+        rowAt[k] = winner;
+        positionOf[winner] = k;
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+} // namespace internal
+} // namespace elem
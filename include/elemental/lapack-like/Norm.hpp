@@ -17,6 +17,8 @@
 #include "./Norm/Frobenius.hpp"
 #include "./Norm/Two.hpp"
 
+#include "./Norm/Fused.hpp"
+
 namespace elem {
 
 template<typename F>
@@ -89,4 +91,37 @@ Norm( const DistMatrix<F,U,V>& A, NormType type )
     return norm;
 }
 
+template<typename F>
+inline void
+Norms
+( const Matrix<F>& A, const std::vector<NormType>& types,
+  std::vector<typename Base<F>::type>& norms )
+{
+#ifndef RELEASE
+    PushCallStack("Norms");
+#endif
+    const int numNorms = types.size();
+    norms.resize( numNorms );
+    for( int k=0; k<numNorms; ++k )
+        norms[k] = Norm( A, types[k] );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename F,Distribution U,Distribution V>
+inline void
+Norms
+( const DistMatrix<F,U,V>& A, const std::vector<NormType>& types,
+  std::vector<typename Base<F>::type>& norms )
+{
+#ifndef RELEASE
+    PushCallStack("Norms");
+#endif
+    internal::FusedNorms( A, types, norms );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
 } // namespace elem
@@ -0,0 +1,134 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace elem {
+namespace internal {
+
+// Compute any combination of the one, infinity, max, and Frobenius norms of A
+// using a single pass over the local data and a single AllReduce.
+//
+// Each reduced entry is a (scale,scaledSquare) pair, stored as a Complex<R>,
+// which is combined as in LAPACK's xLASSQ (see ScaledSquareOp). The Frobenius
+// norm contributes its own local pair, the maximum absolute value contributes
+// (maxAbs,0), and the partial column and row sums contribute (1,sum), since
+// pairs with unit scales are simply summed.
+template<typename F,Distribution U,Distribution V>
+inline void
+FusedNorms
+( const DistMatrix<F,U,V>& A, const std::vector<NormType>& types,
+  std::vector<typename Base<F>::type>& norms )
+{
+#ifndef RELEASE
+    PushCallStack("internal::FusedNorms");
+#endif
+    typedef typename Base<F>::type R;
+    const int numNorms = types.size();
+    bool needOne=false, needInf=false, needFrob=false;
+    for( int k=0; k<numNorms; ++k )
+    {
+        switch( types[k] )
+        {
+        case ONE_NORM:       needOne = true;  break;
+        case INFINITY_NORM:  needInf = true;  break;
+        case MAX_NORM:       break;
+        case FROBENIUS_NORM: needFrob = true; break;
+        default:
+            throw std::logic_error
+            ("Only the one, infinity, max, and Frobenius norms can be fused");
+        }
+    }
+
+    const int height = A.Height();
+    const int width = A.Width();
+    const int colShift = A.ColShift();
+    const int rowShift = A.RowShift();
+    const int colStride = A.ColStride();
+    const int rowStride = A.RowStride();
+    const int localHeight = A.LocalHeight();
+    const int localWidth = A.LocalWidth();
+
+    // Entry 0 holds the max norm, entry 1 the Frobenius norm, and they are
+    // followed by the column sums and then the row sums
+    const int colSumOffset = 2;
+    const int rowSumOffset = colSumOffset + ( needOne ? width : 0 );
+    const int bufferSize = rowSumOffset + ( needInf ? height : 0 );
+    std::vector<Complex<R> > sendBuf( bufferSize, Complex<R>(1,0) ),
+                             recvBuf( bufferSize );
+    R localMaxAbs = 0;
+    R localScale = 0;
+    R localScaledSquare = 0;
+    for( int jLocal=0; jLocal<localWidth; ++jLocal )
+    {
+        const int j = rowShift + jLocal*rowStride;
+        R colSum = 0;
+        for( int iLocal=0; iLocal<localHeight; ++iLocal )
+        {
+            const R alphaAbs = Abs(A.GetLocal(iLocal,jLocal));
+            colSum += alphaAbs;
+            localMaxAbs = std::max( localMaxAbs, alphaAbs );
+            if( needInf )
+            {
+                const int i = colShift + iLocal*colStride;
+                sendBuf[rowSumOffset+i].imag += alphaAbs;
+            }
+            if( needFrob && alphaAbs != 0 )
+            {
+                if( alphaAbs <= localScale )
+                {
+                    const R relScale = alphaAbs/localScale;
+                    localScaledSquare += relScale*relScale;
+                }
+                else
+                {
+                    const R relScale = localScale/alphaAbs;
+                    localScaledSquare = localScaledSquare*relScale*relScale + 1;
+                    localScale = alphaAbs;
+                }
+            }
+        }
+        if( needOne )
+            sendBuf[colSumOffset+j].imag = colSum;
+    }
+    sendBuf[0] = Complex<R>(localMaxAbs,0);
+    sendBuf[1] = Complex<R>(localScale,localScaledSquare);
+
+    mpi::AllReduce
+    ( &sendBuf[0], &recvBuf[0], bufferSize, ScaledSquareOp<R>(),
+      NormComm( A ) );
+
+    const R maxNorm = recvBuf[0].real;
+    const R frobNorm = recvBuf[1].real*Sqrt(recvBuf[1].imag);
+    R oneNorm = 0;
+    if( needOne )
+        for( int j=0; j<width; ++j )
+            oneNorm = std::max( oneNorm, recvBuf[colSumOffset+j].imag );
+    R infNorm = 0;
+    if( needInf )
+        for( int i=0; i<height; ++i )
+            infNorm = std::max( infNorm, recvBuf[rowSumOffset+i].imag );
+
+    norms.resize( numNorms );
+    for( int k=0; k<numNorms; ++k )
+    {
+        switch( types[k] )
+        {
+        case ONE_NORM:       norms[k] = oneNorm;  break;
+        case INFINITY_NORM:  norms[k] = infNorm;  break;
+        case MAX_NORM:       norms[k] = maxNorm;  break;
+        case FROBENIUS_NORM: norms[k] = frobNorm; break;
+        default: break;
+        }
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+} // namespace internal
+} // namespace elem
@@ -0,0 +1,300 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace elem {
+namespace ooc {
+
+// Start reading the block of op(A) with top-left entry (i,j)
+template<typename T>
+inline void
+BeginReadOp
+( const DiskMatrix<T>& A, Orientation orientation,
+  int i, int j, int height, int width, DiskRead<T>& read )
+{
+    if( orientation == NORMAL )
+        A.BeginRead( i, j, height, width, read );
+    else
+        A.BeginRead( j, i, width, height, read );
+}
+
+template<typename T>
+inline void
+AssertSameGrid( const DiskMatrix<T>& A, const DiskMatrix<T>& C )
+{
+    if( A.Grid() != C.Grid() )
+        throw std::logic_error("Matrices must be stored over the same grid");
+    if( &A == &C )
+        throw std::logic_error("Matrices must be stored separately");
+}
+
+} // namespace ooc
+
+template<typename T>
+inline void
+OutOfCoreGemm
+( Orientation orientationOfA, Orientation orientationOfB,
+  T alpha, const DiskMatrix<T>& A, const DiskMatrix<T>& B,
+  T beta,        DiskMatrix<T>& C )
+{
+#ifndef RELEASE
+    PushCallStack("OutOfCoreGemm");
+#endif
+    ooc::AssertSameGrid( A, C );
+    ooc::AssertSameGrid( B, C );
+    const int m = C.Height();
+    const int n = C.Width();
+    const int k = ( orientationOfA==NORMAL ? A.Width() : A.Height() );
+    const int mA = ( orientationOfA==NORMAL ? A.Height() : A.Width() );
+    const int kB = ( orientationOfB==NORMAL ? B.Height() : B.Width() );
+    const int nB = ( orientationOfB==NORMAL ? B.Width() : B.Height() );
+    if( mA != m || kB != k || nB != n )
+    {
+        std::ostringstream msg;
+        msg << "Nonconformal OutOfCoreGemm:\n"
+            << "  op(A) ~ " << mA << " x " << k << "\n"
+            << "  op(B) ~ " << kB << " x " << nB << "\n"
+            << "  C ~ " << m << " x " << n;
+        throw std::logic_error( msg.str().c_str() );
+    }
+    const Grid& g = C.Grid();
+    const int bsize = C.TileSize();
+    // C need not be read if it is to be overwritten
+    const bool readC = ( beta != T(0) );
+    // Synchronize any previous writes before reads are left pending
+    A.Flush();
+    B.Flush();
+    C.Flush();
+
+    DistMatrix<T> A1(g), B1(g), C11(g);
+    DiskRead<T> readA(g), readB(g), nextC(g);
+    if( readC && m > 0 && n > 0 )
+        C.BeginRead( 0, 0, std::min(bsize,m), std::min(bsize,n), nextC );
+    for( int j=0; j<n; j+=bsize )
+    {
+        const int nb = std::min(bsize,n-j);
+        for( int i=0; i<m; i+=bsize )
+        {
+            const int mb = std::min(bsize,m-i);
+            if( readC )
+            {
+                nextC.Finish( C11 );
+                // Prefetch the next block of C, in column-major order
+                int iNext = i+mb, jNext = j;
+                if( iNext == m )
+                {
+                    iNext = 0;
+                    jNext = j+nb;
+                }
+                if( jNext < n )
+                    C.BeginRead
+                    ( iNext, jNext, std::min(bsize,m-iNext),
+                      std::min(bsize,n-jNext), nextC );
+                Scale( beta, C11 );
+            }
+            else
+                Zeros( mb, nb, C11 );
+
+            if( k > 0 )
+            {
+                const int kb = std::min(bsize,k);
+                ooc::BeginReadOp( A, orientationOfA, i, 0, mb, kb, readA );
+                ooc::BeginReadOp( B, orientationOfB, 0, j, kb, nb, readB );
+            }
+            for( int p=0; p<k; p+=bsize )
+            {
+                const int kb = std::min(bsize,k-p);
+                readA.Finish( A1 );
+                readB.Finish( B1 );
+                if( p+kb < k )
+                {
+                    const int kbNext = std::min(bsize,k-p-kb);
+                    ooc::BeginReadOp
+                    ( A, orientationOfA, i, p+kb, mb, kbNext, readA );
+                    ooc::BeginReadOp
+                    ( B, orientationOfB, p+kb, j, kbNext, nb, readB );
+                }
+                Gemm
+                ( orientationOfA, orientationOfB, alpha, A1, B1, T(1), C11 );
+            }
+            C.Write( i, j, C11 );
+        }
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename T>
+inline void
+OutOfCoreHerk
+( UpperOrLower uplo, Orientation orientation,
+  T alpha, const DiskMatrix<T>& A, T beta, DiskMatrix<T>& C )
+{
+#ifndef RELEASE
+    PushCallStack("OutOfCoreHerk");
+#endif
+    if( orientation == TRANSPOSE )
+        throw std::logic_error("OutOfCoreHerk accepts NORMAL and ADJOINT");
+    ooc::AssertSameGrid( A, C );
+    const int n = C.Height();
+    const int k = ( orientation==NORMAL ? A.Width() : A.Height() );
+    const int nA = ( orientation==NORMAL ? A.Height() : A.Width() );
+    if( C.Width() != n || nA != n )
+        throw std::logic_error("Nonconformal OutOfCoreHerk");
+    const Grid& g = C.Grid();
+    const int bsize = C.TileSize();
+    // Block (i,j) of C is updated by block row i of op(A) times the adjoint
+    // of block row j of op(A)
+    const Orientation adjOrientation =
+        ( orientation==NORMAL ? ADJOINT : NORMAL );
+    A.Flush();
+    C.Flush();
+
+    DistMatrix<T> A1(g), A2(g), C11(g);
+    DiskRead<T> read1(g), read2(g);
+    for( int j=0; j<n; j+=bsize )
+    {
+        const int nb = std::min(bsize,n-j);
+        const int iBeg = ( uplo==LOWER ? j : 0 );
+        const int iEnd = ( uplo==LOWER ? n : j+nb );
+        for( int i=iBeg; i<iEnd; i+=bsize )
+        {
+            const int mb = std::min(bsize,n-i);
+            const bool diagonal = ( i == j );
+            C.Read( i, j, mb, nb, C11 );
+            if( diagonal )
+                ScaleTrapezoid( beta, LEFT, uplo, 0, C11 );
+            else
+                Scale( beta, C11 );
+
+            // Stream the block rows i and j of op(A) through memory
+            if( k > 0 )
+            {
+                const int kb = std::min(bsize,k);
+                ooc::BeginReadOp( A, orientation, i, 0, mb, kb, read1 );
+                if( !diagonal )
+                    ooc::BeginReadOp( A, orientation, j, 0, nb, kb, read2 );
+            }
+            for( int p=0; p<k; p+=bsize )
+            {
+                const int kb = std::min(bsize,k-p);
+                read1.Finish( A1 );
+                if( !diagonal )
+                    read2.Finish( A2 );
+                if( p+kb < k )
+                {
+                    const int kbNext = std::min(bsize,k-p-kb);
+                    ooc::BeginReadOp
+                    ( A, orientation, i, p+kb, mb, kbNext, read1 );
+                    if( !diagonal )
+                        ooc::BeginReadOp
+                        ( A, orientation, j, p+kb, nb, kbNext, read2 );
+                }
+                if( diagonal )
+                    Herk( uplo, orientation, alpha, A1, T(1), C11 );
+                else
+                    Gemm
+                    ( orientation, adjOrientation, alpha, A1, A2, T(1), C11 );
+            }
+            C.Write( i, j, C11 );
+        }
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+// A left-looking algorithm: each panel of block columns (rows) is read once,
+// updated by streaming all of the previously factored panels through memory,
+// factored, and written back
+template<typename F>
+inline void
+OutOfCoreCholesky( UpperOrLower uplo, DiskMatrix<F>& A )
+{
+#ifndef RELEASE
+    PushCallStack("OutOfCoreCholesky");
+#endif
+    const int n = A.Height();
+    if( A.Width() != n )
+        throw std::logic_error("Can only compute Cholesky factor of square");
+    const Grid& g = A.Grid();
+    const int bsize = A.TileSize();
+
+    DistMatrix<F> APan(g), A11(g), A2(g), L(g), L1(g), L2(g);
+    DiskRead<F> readPan(g), readL(g);
+    for( int j=0; j<n; j+=bsize )
+    {
+        const int nb = std::min(bsize,n-j);
+        // Begin streaming the factored panels first, since the first read
+        // of them must flush the previous panel's write
+        if( j > 0 )
+        {
+            const int kb = std::min(bsize,j);
+            if( uplo == LOWER )
+                A.BeginRead( j, 0, n-j, kb, readL );
+            else
+                A.BeginRead( 0, j, kb, n-j, readL );
+        }
+        if( uplo == LOWER )
+            A.BeginRead( j, j, n-j, nb, readPan );
+        else
+            A.BeginRead( j, j, nb, n-j, readPan );
+        readPan.Finish( APan );
+        if( uplo == LOWER )
+        {
+            View( A11, APan, 0, 0, nb, nb );
+            View( A2, APan, nb, 0, n-j-nb, nb );
+        }
+        else
+        {
+            View( A11, APan, 0, 0, nb, nb );
+            View( A2, APan, 0, nb, nb, n-j-nb );
+        }
+
+        for( int k=0; k<j; k+=bsize )
+        {
+            const int kb = std::min(bsize,j-k);
+            readL.Finish( L );
+            if( k+kb < j )
+            {
+                const int kbNext = std::min(bsize,j-k-kb);
+                if( uplo == LOWER )
+                    A.BeginRead( j, k+kb, n-j, kbNext, readL );
+                else
+                    A.BeginRead( k+kb, j, kbNext, n-j, readL );
+            }
+            if( uplo == LOWER )
+            {
+                LockedView( L1, L, 0, 0, nb, kb );
+                LockedView( L2, L, nb, 0, n-j-nb, kb );
+                Herk( LOWER, NORMAL, F(-1), L1, F(1), A11 );
+                Gemm( NORMAL, ADJOINT, F(-1), L2, L1, F(1), A2 );
+            }
+            else
+            {
+                LockedView( L1, L, 0, 0, kb, nb );
+                LockedView( L2, L, 0, nb, kb, n-j-nb );
+                Herk( UPPER, ADJOINT, F(-1), L1, F(1), A11 );
+                Gemm( ADJOINT, NORMAL, F(-1), L1, L2, F(1), A2 );
+            }
+        }
+
+        Cholesky( uplo, A11 );
+        if( uplo == LOWER )
+            Trsm( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), A11, A2 );
+        else
+            Trsm( LEFT, UPPER, ADJOINT, NON_UNIT, F(1), A11, A2 );
+        A.Write( j, j, APan );
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+} // namespace elem
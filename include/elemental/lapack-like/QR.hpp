@@ -8,6 +8,8 @@
 */
 
 #include "./QR/Panel.hpp"
+#include "./QR/Tiled.hpp"
+#include "./QR/TS.hpp"
 
 namespace elem {
 
@@ -28,9 +30,21 @@ QR( Matrix<Real>& A )
 {
 #ifndef RELEASE
     PushCallStack("QR");
+#else
+    PushProfileRegion("QR");
 #endif
     if( IsComplex<Real>::val )
         throw std::logic_error("Called real routine with complex datatype");
+    if( internal::UseLocalTiles( A.Height(), A.Width() ) )
+    {
+        internal::QRTiled( A );
+#ifndef RELEASE
+        PopCallStack();
+#else
+        PopProfileRegion();
+#endif
+        return;
+    }
 
     Matrix<Real>
         ATL, ATR,  A00, A01, A02,  ALeftPan, ARightPan,
@@ -70,6 +84,8 @@ QR( Matrix<Real>& A )
     }
 #ifndef RELEASE
     PopCallStack();
+#else
+    PopProfileRegion();
 #endif
 }
 
@@ -79,9 +95,12 @@ QR( DistMatrix<Real>& A )
 {
 #ifndef RELEASE
     PushCallStack("QR");
+#else
+    PushProfileRegion("QR");
 #endif
     if( IsComplex<Real>::val )
         throw std::logic_error("Called real routine with complex datatype");
+    PushBlocksizeStack<Real>( "QR", A.Grid() );
     const Grid& g = A.Grid();
 
     // Matrix views
@@ -110,7 +129,10 @@ QR( DistMatrix<Real>& A )
                      A22 );
 
         //--------------------------------------------------------------------//
-        internal::PanelQR( ALeftPan );
+        if( GetQRApproach() == QR_CAQR )
+            internal::PanelTSQR( ALeftPan );
+        else
+            internal::PanelQR( ALeftPan );
         ApplyPackedReflectors
         ( LEFT, LOWER, VERTICAL, FORWARD, 0, ALeftPan, ARightPan );
         //--------------------------------------------------------------------//
@@ -121,8 +143,11 @@ QR( DistMatrix<Real>& A )
          /*************/ /******************/
           ABL, /**/ ABR,  A20, A21, /**/ A22 );
     }
+    PopBlocksizeStack( "QR" );
 #ifndef RELEASE
     PopCallStack();
+#else
+    PopProfileRegion();
 #endif
 }
 
@@ -133,10 +158,22 @@ QR( Matrix<Complex<Real> >& A,
 {
 #ifndef RELEASE
     PushCallStack("QR");
+#else
+    PushProfileRegion("QR");
 #endif
     typedef Complex<Real> C;
 
     t.ResizeTo( std::min(A.Height(),A.Width()), 1 );
+    if( internal::UseLocalTiles( A.Height(), A.Width() ) )
+    {
+        internal::QRTiled( A, t );
+#ifndef RELEASE
+        PopCallStack();
+#else
+        PopProfileRegion();
+#endif
+        return;
+    }
 
     // Matrix views
     Matrix<C>
@@ -197,6 +234,8 @@ QR( Matrix<Complex<Real> >& A,
     }
 #ifndef RELEASE
     PopCallStack();
+#else
+    PopProfileRegion();
 #endif
 }
 
@@ -209,7 +248,10 @@ QR( DistMatrix<Complex<Real> >& A,
     PushCallStack("QR");
     if( A.Grid() != t.Grid() )
         throw std::logic_error("{A,s} must be distributed over the same grid");
+#else
+    PushProfileRegion("QR");
 #endif
+    PushBlocksizeStack<Complex<Real> >( "QR", A.Grid() );
     typedef Complex<Real> C;
     const Grid& g = A.Grid();
 
@@ -265,7 +307,10 @@ QR( DistMatrix<Complex<Real> >& A,
                      A22 );
 
         //--------------------------------------------------------------------//
-        internal::PanelQR( ALeftPan, t1 );
+        if( GetQRApproach() == QR_CAQR )
+            internal::PanelTSQR( ALeftPan, t1 );
+        else
+            internal::PanelQR( ALeftPan, t1 );
         ApplyPackedReflectors
         ( LEFT, LOWER, VERTICAL, FORWARD, CONJUGATED, 
           0, ALeftPan, t1, ARightPan );
@@ -283,8 +328,11 @@ QR( DistMatrix<Complex<Real> >& A,
          /*************/ /******************/
           ABL, /**/ ABR,  A20, A21, /**/ A22 );
     }
+    PopBlocksizeStack( "QR" );
 #ifndef RELEASE
     PopCallStack();
+#else
+    PopProfileRegion();
 #endif
 }
 
@@ -24,7 +24,9 @@ PanelQR( Matrix<Real>& A )
 
     Matrix<Real> z;
 
-    PushBlocksizeStack( 1 );
+    // The unit blocksize is passed explicitly, rather than pushed onto the 
+    // (shared) blocksize stack, so that QRTiled may factor several panels 
+    // within concurrent tasks
     PartitionDownLeftDiagonal
     ( A, ATL, ATR,
          ABL, ABR, 0 );
@@ -34,7 +36,7 @@ PanelQR( Matrix<Real>& A )
         ( ATL, /**/ ATR,  A00, /**/ a01,     A02,
          /*************/ /**********************/
                /**/       a10, /**/ alpha11, a12,
-          ABL, /**/ ABR,  A20, /**/ a21,     A22 );
+          ABL, /**/ ABR,  A20, /**/ a21,     A22, 1 );
 
         View2x1( aLeftCol, alpha11,
                            a21 );
@@ -60,7 +62,6 @@ PanelQR( Matrix<Real>& A )
          /*************/ /**********************/
           ABL, /**/ ABR,  A20, a21,     /**/ A22 );
     }
-    PopBlocksizeStack();
 #ifndef RELEASE
     PopCallStack();
 #endif
@@ -176,7 +177,6 @@ PanelQR
 
     Matrix<C> z;
 
-    PushBlocksizeStack( 1 );
     PartitionDownLeftDiagonal
     ( A, ATL, ATR,
          ABL, ABR, 0 );
@@ -189,13 +189,13 @@ PanelQR
         ( ATL, /**/ ATR,  A00, /**/ a01,     A02,
          /*************/ /**********************/
                /**/       a10, /**/ alpha11, a12,
-          ABL, /**/ ABR,  A20, /**/ a21,     A22 );
+          ABL, /**/ ABR,  A20, /**/ a21,     A22, 1 );
 
         RepartitionDown
         ( tT,  t0,
          /**/ /****/
                tau1, 
-          tB,  t2 );
+          tB,  t2, 1 );
 
         View2x1( aLeftCol, alpha11,
                            a21 );
@@ -228,7 +228,6 @@ PanelQR
          /*************/ /**********************/
           ABL, /**/ ABR,  A20, a21,     /**/ A22 );
     }
-    PopBlocksizeStack();
 #ifndef RELEASE
     PopCallStack();
 #endif
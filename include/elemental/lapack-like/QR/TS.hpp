@@ -0,0 +1,268 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace elem {
+
+// Tall-skinny QR: each process factors its local rows, and the resulting
+// triangular factors are combined pairwise with a binary tree over the VC
+// communicator, so that only O(log p) messages are required. The explicit Q
+// is then formed by traversing the tree in the opposite direction.
+template<typename F>
+inline void
+TSQR( DistMatrix<F,VC,STAR>& A, DistMatrix<F,STAR,STAR>& R )
+{
+#ifndef RELEASE
+    PushCallStack("TSQR");
+    if( A.Grid() != R.Grid() )
+        throw std::logic_error("{A,R} must be distributed over the same grid");
+    if( A.Height() < A.Width() )
+        throw std::logic_error("A must be at least as tall as it is wide");
+#else
+    PushProfileRegion("TSQR");
+#endif
+    const Grid& g = A.Grid();
+    const int n = A.Width();
+    const int localHeight = A.LocalHeight();
+    const int commSize = g.Size();
+    const int commRank = g.VCRank();
+    const mpi::Comm comm = g.VCComm();
+
+    // Factor the local rows. If there are fewer local rows than columns, then
+    // they are simply padded with zeros to form the triangular factor.
+    Matrix<F> QLeaf, RNode;
+    if( localHeight >= n )
+    {
+        QLeaf = A.LocalMatrix();
+        ExplicitQR( QLeaf, RNode );
+    }
+    else
+    {
+        Identity( localHeight, n, QLeaf );
+        Zeros( n, n, RNode );
+        for( int j=0; j<n; ++j )
+            for( int iLocal=0; iLocal<localHeight; ++iLocal )
+                RNode.Set( iLocal, j, A.GetLocal(iLocal,j) );
+    }
+
+    // Combine the triangular factors up the tree, remembering the
+    // orthogonal factor from each level for the second traversal
+    std::vector<F> buffer( n*n );
+    std::vector<Matrix<F> > QNodes;
+    int numLevels = 0;
+    int parentStep = 0;
+    for( int step=1; step<commSize; step*=2 )
+    {
+        if( commRank % (2*step) == step )
+        {
+            for( int j=0; j<n; ++j )
+                for( int i=0; i<n; ++i )
+                    buffer[i+j*n] = RNode.Get(i,j);
+            mpi::Send( &buffer[0], n*n, commRank-step, 0, comm );
+            parentStep = step;
+            break;
+        }
+        else if( commRank+step < commSize )
+        {
+            mpi::Recv( &buffer[0], n*n, commRank+step, 0, comm );
+            Matrix<F> QNode( 2*n, n );
+            for( int j=0; j<n; ++j )
+            {
+                for( int i=0; i<n; ++i )
+                {
+                    QNode.Set( i,   j, RNode.Get(i,j) );
+                    QNode.Set( i+n, j, buffer[i+j*n] );
+                }
+            }
+            ExplicitQR( QNode, RNode );
+            QNodes.push_back( QNode );
+        }
+        else
+            QNodes.push_back( Matrix<F>() );
+        ++numLevels;
+    }
+
+    // Broadcast the final triangular factor from the root
+    if( commRank == 0 )
+        for( int j=0; j<n; ++j )
+            for( int i=0; i<n; ++i )
+                buffer[i+j*n] = RNode.Get(i,j);
+    mpi::Broadcast( &buffer[0], n*n, 0, comm );
+    R.ResizeTo( n, n );
+    for( int j=0; j<n; ++j )
+        for( int i=0; i<n; ++i )
+            R.SetLocal( i, j, ( i<=j ? buffer[i+j*n] : F(0) ) );
+
+    // Push the identity back down the tree to form the explicit Q
+    Matrix<F> C, CTop, CBottom;
+    if( commRank == 0 )
+        Identity( n, n, C );
+    else
+    {
+        mpi::Recv( &buffer[0], n*n, commRank-parentStep, 0, comm );
+        C.ResizeTo( n, n );
+        for( int j=0; j<n; ++j )
+            for( int i=0; i<n; ++i )
+                C.Set( i, j, buffer[i+j*n] );
+    }
+    for( int level=numLevels-1; level>=0; --level )
+    {
+        const Matrix<F>& QNode = QNodes[level];
+        if( QNode.Height() == 0 )
+            continue;
+        Matrix<F> QNodeTop, QNodeBottom;
+        LockedView( QNodeTop, QNode, 0, 0, n, n );
+        LockedView( QNodeBottom, QNode, n, 0, n, n );
+        Zeros( n, n, CBottom );
+        Gemm( NORMAL, NORMAL, F(1), QNodeBottom, C, F(0), CBottom );
+        for( int j=0; j<n; ++j )
+            for( int i=0; i<n; ++i )
+                buffer[i+j*n] = CBottom.Get(i,j);
+        mpi::Send( &buffer[0], n*n, commRank+(1<<level), 0, comm );
+        Zeros( n, n, CTop );
+        Gemm( NORMAL, NORMAL, F(1), QNodeTop, C, F(0), CTop );
+        C = CTop;
+    }
+    if( localHeight > 0 )
+        Gemm( NORMAL, NORMAL, F(1), QLeaf, C, F(0), A.LocalMatrix() );
+#ifndef RELEASE
+    PopCallStack();
+#else
+    PopProfileRegion();
+#endif
+}
+
+namespace internal {
+
+// Reconstructs the Householder vectors which would produce the explicit Q,
+// up to the signs of its columns, by computing the LU factorization of
+// [I; 0] - Q S, where the diagonal unitary S is chosen so that every pivot,
+// 1 + |q_jj|, is at least one. The unit lower-trapezoidal factor then holds
+// the Householder vectors, the j'th pivot is the j'th Householder scalar,
+// and the triangular factor of A becomes S^H R.
+template<typename F>
+inline void
+PanelTSQRHelper( DistMatrix<F>& A, DistMatrix<F,STAR,STAR>& tau )
+{
+#ifndef RELEASE
+    PushCallStack("internal::PanelTSQRHelper");
+#endif
+    typedef typename Base<F>::type R;
+    const Grid& g = A.Grid();
+    const int n = A.Width();
+
+    DistMatrix<F,VC,STAR> Q_VC_STAR( g );
+    DistMatrix<F,STAR,STAR> R_STAR_STAR( g );
+    Q_VC_STAR = A;
+    TSQR( Q_VC_STAR, R_STAR_STAR );
+    const int localHeight = Q_VC_STAR.LocalHeight();
+
+    DistMatrix<F,VC,STAR> Q1_VC_STAR( g );
+    LockedView( Q1_VC_STAR, Q_VC_STAR, 0, 0, n, n );
+    DistMatrix<F,STAR,STAR> W( Q1_VC_STAR );
+
+    // Factor the top block of [I; 0] - Q S while choosing the signs in S.
+    // The elimination is applied to Q, and the contribution of S (and of
+    // the identity) is folded into each column as it is reached.
+    std::vector<F> s( n );
+    Matrix<F> U;
+    Zeros( n, n, U );
+    for( int j=0; j<n; ++j )
+    {
+        const F omega = W.GetLocal(j,j);
+        const R omegaAbs = Abs(omega);
+        s[j] = ( omegaAbs == R(0) ? F(-1) : -Conj(omega)/omegaAbs );
+        const F pivot = F(1) + omegaAbs;
+        for( int k=0; k<j; ++k )
+            U.Set( k, j, -s[j]*W.GetLocal(k,j) );
+        U.Set( j, j, pivot );
+        for( int i=j+1; i<n; ++i )
+            W.SetLocal( i, j, -s[j]*W.GetLocal(i,j)/pivot );
+        for( int k=j+1; k<n; ++k )
+        {
+            const F upsilon = W.GetLocal(j,k);
+            for( int i=j+1; i<n; ++i )
+                W.SetLocal( i, k, W.GetLocal(i,k)-W.GetLocal(i,j)*upsilon );
+        }
+    }
+
+    // The Householder vectors are ([I; 0] - Q S) inv(U)
+    const int colShift = Q_VC_STAR.ColShift();
+    const int colStride = Q_VC_STAR.ColStride();
+    for( int iLocal=0; iLocal<localHeight; ++iLocal )
+    {
+        const int i = colShift + iLocal*colStride;
+        for( int j=0; j<n; ++j )
+            Q_VC_STAR.SetLocal( iLocal, j, -Q_VC_STAR.GetLocal(iLocal,j)*s[j] );
+        if( i < n )
+            Q_VC_STAR.UpdateLocal( iLocal, i, F(1) );
+    }
+    Trsm
+    ( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), U, Q_VC_STAR.LocalMatrix() );
+
+    // Overwrite the upper triangle with S^H R
+    for( int iLocal=0; iLocal<localHeight; ++iLocal )
+    {
+        const int i = colShift + iLocal*colStride;
+        if( i >= n )
+            break;
+        for( int j=i; j<n; ++j )
+            Q_VC_STAR.SetLocal
+            ( iLocal, j, Conj(s[i])*R_STAR_STAR.GetLocal(i,j) );
+    }
+    A = Q_VC_STAR;
+
+    tau.ResizeTo( n, 1 );
+    for( int j=0; j<n; ++j )
+        tau.SetLocal( j, 0, U.Get(j,j) );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename Real>
+inline void
+PanelTSQR( DistMatrix<Real>& A )
+{
+#ifndef RELEASE
+    PushCallStack("internal::PanelTSQR");
+#endif
+    // The real Householder scalars are implied by the Householder vectors
+    DistMatrix<Real,STAR,STAR> tau( A.Grid() );
+    PanelTSQRHelper( A, tau );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename Real>
+inline void
+PanelTSQR
+( DistMatrix<Complex<Real> >& A,
+  DistMatrix<Complex<Real>,MD,STAR>& t )
+{
+#ifndef RELEASE
+    PushCallStack("internal::PanelTSQR");
+    if( A.Grid() != t.Grid() )
+        throw std::logic_error("{A,t} must be distributed over the same grid");
+    if( t.Height() != A.Width() || t.Width() != 1 )
+        throw std::logic_error
+        ("t must be a vector of height equal to the width of A");
+    if( !t.AlignedWithDiagonal( A, 0 ) )
+        throw std::logic_error("t must be aligned with A's main diagonal");
+#endif
+    DistMatrix<Complex<Real>,STAR,STAR> tau( A.Grid() );
+    PanelTSQRHelper( A, tau );
+    t = tau;
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+} // namespace internal
+} // namespace elem
@@ -0,0 +1,158 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace elem {
+namespace internal {
+
+// Householder QR as a graph of OpenMP tasks over the nb-wide column tiles of
+// A: the k'th task factors the k'th panel and then each of the following
+// column tiles is updated by a separate task, so that the factorization of the
+// next panel may overlap with the rest of the trailing update. This is only a
+// lookahead over column panels: each full-height panel is still factored by 
+// the unblocked PanelQR within a single task. The output is in the same 
+// format as QR.
+
+template<typename Real>
+inline void
+QRTiled( Matrix<Real>& A )
+{
+#ifndef RELEASE
+    PushCallStack("internal::QRTiled");
+#endif
+    const int m = A.Height();
+    const int n = A.Width();
+    const int nb = GetLocalTileSize();
+    const int nTiles = (n+nb-1)/nb;
+    const int kTiles = (std::min(m,n)+nb-1)/nb;
+    bool failed = false;
+
+#ifdef HAVE_OMP_TASK_DEPEND
+    #pragma omp parallel
+    #pragma omp single
+#endif
+    for( int k=0; k<kTiles; ++k )
+    {
+        const int kWidth = std::min(nb,n-k*nb);
+#ifdef HAVE_OMP_TASK_DEPEND
+        Real* Ak = A.Buffer(0,k*nb);
+        #pragma omp task depend(inout:Ak[0])
+#endif
+        if( !TileFailed( failed ) )
+        {
+            try
+            {
+                Matrix<Real> APan;
+                View( APan, A, k*nb, k*nb, m-k*nb, kWidth );
+                PanelQR( APan );
+            }
+            catch( std::exception& e ) { RecordTileFailure( failed ); }
+        }
+
+        for( int j=k+1; j<nTiles; ++j )
+        {
+            const int jWidth = std::min(nb,n-j*nb);
+#ifdef HAVE_OMP_TASK_DEPEND
+            Real* Aj = A.Buffer(0,j*nb);
+            #pragma omp task depend(in:Ak[0]) depend(inout:Aj[0])
+#endif
+            if( !TileFailed( failed ) )
+            {
+                try
+                {
+                    Matrix<Real> APan, ARight;
+                    LockedView( APan, A, k*nb, k*nb, m-k*nb, kWidth );
+                    View( ARight, A, k*nb, j*nb, m-k*nb, jWidth );
+                    ApplyPackedReflectors
+                    ( LEFT, LOWER, VERTICAL, FORWARD, 0, APan, ARight );
+                }
+                catch( std::exception& e ) { RecordTileFailure( failed ); }
+            }
+        }
+    }
+    if( failed )
+        throw std::runtime_error("A task of the tiled QR failed");
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename Real>
+inline void
+QRTiled( Matrix<Complex<Real> >& A, Matrix<Complex<Real> >& t )
+{
+#ifndef RELEASE
+    PushCallStack("internal::QRTiled");
+    if( t.Height() != std::min(A.Height(),A.Width()) || t.Width() != 1 )
+        throw std::logic_error
+        ("t must be a vector of height equal to the minimum dimension of A");
+#endif
+    typedef Complex<Real> C;
+    const int m = A.Height();
+    const int n = A.Width();
+    const int nb = GetLocalTileSize();
+    const int nTiles = (n+nb-1)/nb;
+    const int kTiles = (std::min(m,n)+nb-1)/nb;
+    bool failed = false;
+
+#ifdef HAVE_OMP_TASK_DEPEND
+    #pragma omp parallel
+    #pragma omp single
+#endif
+    for( int k=0; k<kTiles; ++k )
+    {
+        const int kWidth = std::min(nb,n-k*nb);
+        const int kSize = std::min(kWidth,m-k*nb);
+#ifdef HAVE_OMP_TASK_DEPEND
+        C* Ak = A.Buffer(0,k*nb);
+        #pragma omp task depend(inout:Ak[0])
+#endif
+        if( !TileFailed( failed ) )
+        {
+            try
+            {
+                Matrix<C> APan, tPan;
+                View( APan, A, k*nb, k*nb, m-k*nb, kWidth );
+                View( tPan, t, k*nb, 0, kSize, 1 );
+                PanelQR( APan, tPan );
+            }
+            catch( std::exception& e ) { RecordTileFailure( failed ); }
+        }
+
+        for( int j=k+1; j<nTiles; ++j )
+        {
+            const int jWidth = std::min(nb,n-j*nb);
+#ifdef HAVE_OMP_TASK_DEPEND
+            C* Aj = A.Buffer(0,j*nb);
+            #pragma omp task depend(in:Ak[0]) depend(inout:Aj[0])
+#endif
+            if( !TileFailed( failed ) )
+            {
+                try
+                {
+                    Matrix<C> APan, tPan, ARight;
+                    LockedView( APan, A, k*nb, k*nb, m-k*nb, kWidth );
+                    LockedView( tPan, t, k*nb, 0, kSize, 1 );
+                    View( ARight, A, k*nb, j*nb, m-k*nb, jWidth );
+                    ApplyPackedReflectors
+                    ( LEFT, LOWER, VERTICAL, FORWARD, CONJUGATED,
+                      0, APan, tPan, ARight );
+                }
+                catch( std::exception& e ) { RecordTileFailure( failed ); }
+            }
+        }
+    }
+    if( failed )
+        throw std::runtime_error("A task of the tiled QR failed");
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+} // namespace internal
+} // namespace elem
@@ -0,0 +1,332 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+// The randomized schemes follow Halko, Martinsson, and Tropp, "Finding
+// structure with randomness: Probabilistic algorithms for constructing
+// approximate matrix decompositions", SIAM Review, 53(2), 2011.
+
+namespace elem {
+namespace randomized_svd {
+
+// Overwrites Y with an orthonormal basis for the range of (A A^H)^q Y, where
+// each product is followed by a reorthonormalization in order to prevent the
+// leading singular vectors from swamping the rest of the basis
+template<typename F>
+inline void
+PowerIterations
+( const DistMatrix<F>& A, DistMatrix<F>& Y, int numPowerIts )
+{
+#ifndef RELEASE
+    PushCallStack("randomized_svd::PowerIterations");
+#endif
+    const Grid& g = A.Grid();
+    const int m = A.Height();
+    const int n = A.Width();
+    const int l = Y.Width();
+
+    ExplicitQR( Y );
+    DistMatrix<F> Z( g );
+    for( int it=0; it<numPowerIts; ++it )
+    {
+        Zeros( n, l, Z );
+        Gemm( ADJOINT, NORMAL, F(1), A, Y, F(0), Z );
+        ExplicitQR( Z );
+        Zeros( m, l, Y );
+        Gemm( NORMAL, NORMAL, F(1), A, Z, F(0), Y );
+        ExplicitQR( Y );
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+// Y := (I - Q Q^H) Y using two passes of classical Gram-Schmidt
+template<typename F>
+inline void
+ProjectOut( const DistMatrix<F>& Q, DistMatrix<F>& Y )
+{
+#ifndef RELEASE
+    PushCallStack("randomized_svd::ProjectOut");
+#endif
+    if( Q.Width() != 0 )
+    {
+        DistMatrix<F> Z( Q.Grid() );
+        for( int pass=0; pass<2; ++pass )
+        {
+            Zeros( Q.Width(), Y.Width(), Z );
+            Gemm( ADJOINT, NORMAL, F(1), Q, Y, F(0), Z );
+            Gemm( NORMAL, NORMAL, F(-1), Q, Z, F(1), Y );
+        }
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+// Returns the largest two-norm of the columns of Y
+template<typename F>
+inline typename Base<F>::type
+MaxColumnTwoNorm( const DistMatrix<F>& Y )
+{
+#ifndef RELEASE
+    PushCallStack("randomized_svd::MaxColumnTwoNorm");
+#endif
+    typedef typename Base<F>::type R;
+    const Grid& g = Y.Grid();
+    const int localHeight = Y.LocalHeight();
+    const int localWidth = Y.LocalWidth();
+
+    std::vector<R> localNormsSquared( localWidth, 0 ),
+                   normsSquared( localWidth );
+    for( int jLocal=0; jLocal<localWidth; ++jLocal )
+    {
+        const F* y = Y.LockedLocalBuffer(0,jLocal);
+        R normSquared = 0;
+        for( int iLocal=0; iLocal<localHeight; ++iLocal )
+        {
+            const R alpha = Abs(y[iLocal]);
+            normSquared += alpha*alpha;
+        }
+        localNormsSquared[jLocal] = normSquared;
+    }
+    if( localWidth != 0 )
+        mpi::AllReduce
+        ( &localNormsSquared[0], &normsSquared[0], localWidth,
+          mpi::SUM, g.ColComm() );
+
+    R localMaxNormSquared = 0;
+    for( int jLocal=0; jLocal<localWidth; ++jLocal )
+        localMaxNormSquared = 
+            std::max(localMaxNormSquared,normsSquared[jLocal]);
+    R maxNormSquared;
+    mpi::AllReduce
+    ( &localMaxNormSquared, &maxNormSquared, 1, mpi::MAX, g.RowComm() );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+    return Sqrt(maxNormSquared);
+}
+
+// Given an orthonormal basis Q for the approximate range of A, form the
+// small matrix B = Q^H A, compute its SVD, and return the leading rank
+// triplets of the approximation Q B = (Q U_B) S V_B^H
+template<typename F>
+inline void
+ProjectedSVD
+( const DistMatrix<F>& A, const DistMatrix<F>& Q,
+  DistMatrix<F>& U, DistMatrix<typename Base<F>::type,VR,STAR>& s,
+  DistMatrix<F>& V, int rank )
+{
+#ifndef RELEASE
+    PushCallStack("randomized_svd::ProjectedSVD");
+#endif
+    typedef typename Base<F>::type R;
+    const Grid& g = A.Grid();
+    const int m = A.Height();
+    const int n = A.Width();
+    const int l = Q.Width();
+
+    DistMatrix<F> B( g );
+    Zeros( l, n, B );
+    Gemm( ADJOINT, NORMAL, F(1), Q, A, F(0), B );
+
+    // B is overwritten with its l x l matrix of left singular vectors
+    DistMatrix<R,VR,STAR> sB( g );
+    DistMatrix<F> VB( g );
+    SVD( B, sB, VB );
+
+    DistMatrix<F> BL( g ), VBL( g );
+    DistMatrix<R,VR,STAR> sBT( g );
+    LockedView( BL, B, 0, 0, l, rank );
+    LockedView( VBL, VB, 0, 0, n, rank );
+    LockedView( sBT, sB, 0, 0, rank, 1 );
+    Zeros( m, rank, U );
+    Gemm( NORMAL, NORMAL, F(1), Q, BL, F(0), U );
+    V = VBL;
+    s = sBT;
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+} // namespace randomized_svd
+
+template<typename F>
+inline void
+RandomizedRangeFinder
+( const DistMatrix<F>& A, DistMatrix<F>& Q, int numColumns, int numPowerIts )
+{
+#ifndef RELEASE
+    PushCallStack("RandomizedRangeFinder");
+    if( numColumns < 0 || numColumns > std::min(A.Height(),A.Width()) )
+        throw std::logic_error
+        ("Number of columns must be in [0,min(m,n)]");
+    if( numPowerIts < 0 )
+        throw std::logic_error("Number of power iterations must be >= 0");
+#else
+    PushProfileRegion("RandomizedRangeFinder");
+#endif
+    const Grid& g = A.Grid();
+    const int m = A.Height();
+    const int n = A.Width();
+
+    DistMatrix<F> Omega( g );
+    Gaussian( n, numColumns, Omega );
+    Zeros( m, numColumns, Q );
+    Gemm( NORMAL, NORMAL, F(1), A, Omega, F(0), Q );
+    randomized_svd::PowerIterations( A, Q, numPowerIts );
+#ifndef RELEASE
+    PopCallStack();
+#else
+    PopProfileRegion();
+#endif
+}
+
+template<typename F>
+inline void
+AdaptiveRangeFinder
+( const DistMatrix<F>& A, DistMatrix<F>& Q,
+  typename Base<F>::type tol, int maxColumns, int blocksize, int numPowerIts )
+{
+#ifndef RELEASE
+    PushCallStack("AdaptiveRangeFinder");
+    if( tol < 0 )
+        throw std::logic_error("Tolerance must be non-negative");
+    if( blocksize <= 0 )
+        throw std::logic_error("Blocksize must be positive");
+    if( numPowerIts < 0 )
+        throw std::logic_error("Number of power iterations must be >= 0");
+#else
+    PushProfileRegion("AdaptiveRangeFinder");
+#endif
+    typedef typename Base<F>::type R;
+    const Grid& g = A.Grid();
+    const int m = A.Height();
+    const int n = A.Width();
+    const int minDim = std::min(m,n);
+    if( maxColumns <= 0 || maxColumns > minDim )
+        maxColumns = minDim;
+
+    // With probability at least 1 - 10^(-b), the spectral norm of the residual
+    // is at most this multiple of the largest residual of the b samples
+    const R errorFactor = 10*Sqrt(2/R(Pi));
+
+    Zeros( m, 0, Q );
+    DistMatrix<F> Omega( g ), Y( g ), QOld( g );
+    while( Q.Width() < maxColumns )
+    {
+        const int k = Q.Width();
+        const int b = std::min(blocksize,maxColumns-k);
+        Gaussian( n, b, Omega );
+        Zeros( m, b, Y );
+        Gemm( NORMAL, NORMAL, F(1), A, Omega, F(0), Y );
+        randomized_svd::ProjectOut( Q, Y );
+        const R errorEstimate = errorFactor*randomized_svd::MaxColumnTwoNorm(Y);
+        if( errorEstimate <= tol )
+            break;
+
+        if( numPowerIts > 0 )
+        {
+            randomized_svd::PowerIterations( A, Y, numPowerIts );
+            randomized_svd::ProjectOut( Q, Y );
+        }
+        ExplicitQR( Y );
+        // Orthonormalizing can expose the parts of the directions that were
+        // already captured by Q, so project them out once more
+        randomized_svd::ProjectOut( Q, Y );
+        ExplicitQR( Y );
+
+        QOld = Q;
+        Zeros( m, k+b, Q );
+        DistMatrix<F> QLeft( g ), QRight( g );
+        View( QLeft, Q, 0, 0, m, k );
+        View( QRight, Q, 0, k, m, b );
+        QLeft = QOld;
+        QRight = Y;
+    }
+#ifndef RELEASE
+    PopCallStack();
+#else
+    PopProfileRegion();
+#endif
+}
+
+template<typename F>
+inline void
+RandomizedSVD
+( const DistMatrix<F>& A,
+  DistMatrix<F>& U,
+  DistMatrix<typename Base<F>::type,VR,STAR>& s,
+  DistMatrix<F>& V,
+  int rank, int oversample, int numPowerIts )
+{
+#ifndef RELEASE
+    PushCallStack("RandomizedSVD");
+    if( rank < 0 || rank > std::min(A.Height(),A.Width()) )
+        throw std::logic_error("Rank must be in [0,min(m,n)]");
+    if( oversample < 0 )
+        throw std::logic_error("Oversampling must be non-negative");
+#else
+    PushProfileRegion("RandomizedSVD");
+#endif
+    const int l = std::min(rank+oversample,std::min(A.Height(),A.Width()));
+    DistMatrix<F> Q( A.Grid() );
+    RandomizedRangeFinder( A, Q, l, numPowerIts );
+    randomized_svd::ProjectedSVD( A, Q, U, s, V, rank );
+#ifndef RELEASE
+    PopCallStack();
+#else
+    PopProfileRegion();
+#endif
+}
+
+template<typename F>
+inline void
+AdaptiveRandomizedSVD
+( const DistMatrix<F>& A,
+  DistMatrix<F>& U,
+  DistMatrix<typename Base<F>::type,VR,STAR>& s,
+  DistMatrix<F>& V,
+  typename Base<F>::type tol, int maxRank, int blocksize, int numPowerIts )
+{
+#ifndef RELEASE
+    PushCallStack("AdaptiveRandomizedSVD");
+#else
+    PushProfileRegion("AdaptiveRandomizedSVD");
+#endif
+    typedef typename Base<F>::type R;
+    const Grid& g = A.Grid();
+    DistMatrix<F> Q( g );
+    AdaptiveRangeFinder( A, Q, tol, maxRank, blocksize, numPowerIts );
+    const int l = Q.Width();
+
+    // Drop the triplets whose singular values do not exceed the tolerance
+    DistMatrix<F> UFull( g ), VFull( g );
+    DistMatrix<R,VR,STAR> sFull( g );
+    randomized_svd::ProjectedSVD( A, Q, UFull, sFull, VFull, l );
+    DistMatrix<R,STAR,STAR> s_STAR_STAR( sFull );
+    int rank = 0;
+    while( rank < l && s_STAR_STAR.GetLocal(rank,0) > tol )
+        ++rank;
+    DistMatrix<F> UL( g ), VL( g );
+    DistMatrix<R,VR,STAR> sT( g );
+    LockedView( UL, UFull, 0, 0, UFull.Height(), rank );
+    LockedView( VL, VFull, 0, 0, VFull.Height(), rank );
+    LockedView( sT, sFull, 0, 0, rank, 1 );
+    U = UL;
+    V = VL;
+    s = sT;
+#ifndef RELEASE
+    PopCallStack();
+#else
+    PopProfileRegion();
+#endif
+}
+
+} // namespace elem
@@ -0,0 +1,291 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace elem {
+namespace refined_solve {
+
+// The datatype used for the factorization of a matrix of type F
+template<typename F>
+struct LowerPrecision { typedef F type; };
+template<>
+struct LowerPrecision<double> { typedef float type; };
+template<>
+struct LowerPrecision<Complex<double> > { typedef Complex<float> type; };
+
+template<typename S,typename T>
+inline void
+ConvertScalar( const T& alpha, S& beta )
+{ beta = S(alpha); }
+
+template<typename S,typename T>
+inline void
+ConvertScalar( const Complex<T>& alpha, Complex<S>& beta )
+{ beta = Complex<S>( S(alpha.real), S(alpha.imag) ); }
+
+// Overwrites B with a copy of A, aligned with A, in B's datatype
+template<typename T,typename S>
+inline void
+Convert( const DistMatrix<T>& A, DistMatrix<S>& B )
+{
+#ifndef RELEASE
+    PushCallStack("refined_solve::Convert");
+#endif
+    B.Empty();
+    B.AlignWith( A );
+    B.ResizeTo( A.Height(), A.Width() );
+    const int localHeight = A.LocalHeight();
+    const int localWidth = A.LocalWidth();
+    const T* ABuffer = A.LockedLocalBuffer();
+    S* BBuffer = B.LocalBuffer();
+    const int ALDim = A.LocalLDim();
+    const int BLDim = B.LocalLDim();
+#ifdef HAVE_OPENMP
+    #pragma omp parallel for
+#endif
+    for( int jLocal=0; jLocal<localWidth; ++jLocal )
+        for( int iLocal=0; iLocal<localHeight; ++iLocal )
+            ConvertScalar
+            ( ABuffer[iLocal+jLocal*ALDim], BBuffer[iLocal+jLocal*BLDim] );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+// Applies A and the inverse of its LU factorization in lower precision
+template<typename F,typename FLow>
+struct LUSolver
+{
+    const DistMatrix<F>& A;
+    const DistMatrix<FLow>& ALU;
+    const DistMatrix<int,VC,STAR>& p;
+
+    LUSolver
+    ( const DistMatrix<F>& AOrig, 
+      const DistMatrix<FLow>& AFact, const DistMatrix<int,VC,STAR>& pFact )
+    : A(AOrig), ALU(AFact), p(pFact)
+    { }
+
+    // R := R - A X
+    void UpdateResidual( const DistMatrix<F>& X, DistMatrix<F>& R ) const
+    {
+        if( X.Width() == 1 )
+            Gemv( NORMAL, F(-1), A, X, F(1), R );
+        else
+            Gemm( NORMAL, NORMAL, F(-1), A, X, F(1), R );
+    }
+
+    void Solve( DistMatrix<FLow>& B ) const
+    { SolveAfterLU( NORMAL, ALU, p, B ); }
+
+    typename Base<F>::type InfinityNorm() const
+    { return Norm( A, INFINITY_NORM ); }
+};
+
+// Applies the Hermitian matrix A, which is only referenced in the 'uplo'
+// triangle, and the inverse of its Cholesky factorization in lower precision
+template<typename F,typename FLow>
+struct CholeskySolver
+{
+    const UpperOrLower uplo;
+    const DistMatrix<F>& A;
+    const DistMatrix<FLow>& AChol;
+
+    CholeskySolver
+    ( UpperOrLower uploFact, 
+      const DistMatrix<F>& AOrig, const DistMatrix<FLow>& AFact )
+    : uplo(uploFact), A(AOrig), AChol(AFact)
+    { }
+
+    // R := R - A X
+    void UpdateResidual( const DistMatrix<F>& X, DistMatrix<F>& R ) const
+    {
+        if( X.Width() == 1 )
+            Hemv( uplo, F(-1), A, X, F(1), R );
+        else
+            Hemm( LEFT, uplo, F(-1), A, X, F(1), R );
+    }
+
+    void Solve( DistMatrix<FLow>& B ) const
+    { SolveAfterCholesky( uplo, NORMAL, AChol, B ); }
+
+    typename Base<F>::type InfinityNorm() const
+    { return HermitianNorm( uplo, A, INFINITY_NORM ); }
+};
+
+// Overwrites B with the solution of A X = B using a factorization of A in
+// lower precision, which is applied by 'solver', followed by iterative
+// refinement with residuals in the working precision. Each step is
+// considered converged once
+//
+//     || B - A X ||_max <= sqrt(n) eps || A ||_oo || X ||_max,
+//
+// which mirrors the criterion of LAPACK's [d,z]sgesv. The number of
+// refinement steps is returned, unless the residual failed to at least halve
+// within a step, or maxRefineIts steps were taken, in which case B is left
+// unchanged and -1 is returned.
+template<typename F,class Solver>
+inline int
+Refine
+( const DistMatrix<F>& A, DistMatrix<F>& B, const Solver& solver,
+  int maxRefineIts )
+{
+#ifndef RELEASE
+    PushCallStack("refined_solve::Refine");
+#endif
+    typedef typename Base<F>::type R;
+    typedef typename LowerPrecision<F>::type FLow;
+    const Grid& g = A.Grid();
+    const int n = A.Height();
+    const R eps = lapack::MachineEpsilon<R>();
+    const R tol = Sqrt(R(n))*eps*solver.InfinityNorm();
+
+    DistMatrix<FLow> DLow( g );
+    DistMatrix<F> X( g ), D( g ), Res( g );
+    Convert( B, DLow );
+    solver.Solve( DLow );
+    Convert( DLow, X );
+
+    int numIts = -1;
+    R lastResNorm = lapack::MachineOverflowThreshold<R>();
+    for( int it=0; it<=maxRefineIts; ++it )
+    {
+        Res = B;
+        solver.UpdateResidual( X, Res );
+        const R resNorm = Norm( Res, MAX_NORM );
+        if( resNorm <= tol*Norm( X, MAX_NORM ) )
+        {
+            numIts = it;
+            break;
+        }
+        // This also catches infinities and NaNs from over/underflow
+        if( !(resNorm <= lastResNorm/2) || it == maxRefineIts )
+            break;
+        lastResNorm = resNorm;
+
+        Convert( Res, DLow );
+        solver.Solve( DLow );
+        Convert( DLow, D );
+        Axpy( F(1), D, X );
+    }
+    if( numIts >= 0 )
+        B = X;
+#ifndef RELEASE
+    PopCallStack();
+#endif
+    return numIts;
+}
+
+} // namespace refined_solve
+
+template<typename F>
+inline int
+RefinedGaussianElimination
+( const DistMatrix<F>& A, DistMatrix<F>& B, int maxRefineIts )
+{
+#ifndef RELEASE
+    PushCallStack("RefinedGaussianElimination");
+    if( A.Grid() != B.Grid() )
+        throw std::logic_error("{A,B} must be distributed over the same grid");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("A must be square");
+    if( A.Height() != B.Height() )
+        throw std::logic_error("A and B must be the same height");
+#else
+    PushProfileRegion("RefinedGaussianElimination");
+#endif
+    typedef typename refined_solve::LowerPrecision<F>::type FLow;
+    const Grid& g = A.Grid();
+
+    // The rounded matrix may be exactly singular (e.g., if the conversion 
+    // flushed a column to zero), in which case the LU factorization throws a
+    // SingularMatrixException from within routines which could not pop their
+    // call-stack, profile, and blocksize entries
+    DistMatrix<FLow> ALow( g );
+    DistMatrix<int,VC,STAR> p( g );
+    refined_solve::Convert( A, ALow );
+    int numIts = -1;
+    bool factored = true;
+    const StackDepths depths = GetStackDepths();
+    try { LU( ALow, p ); }
+    catch( SingularMatrixException& e ) { factored = false; }
+    if( !factored )
+        RestoreStackDepths( depths );
+    if( factored )
+        numIts = refined_solve::Refine
+        ( A, B, refined_solve::LUSolver<F,FLow>( A, ALow, p ), maxRefineIts );
+    if( numIts < 0 )
+    {
+        // Fall back to a factorization in the working precision
+        ALow.Empty();
+        DistMatrix<F> ACopy( A );
+        GaussianElimination( ACopy, B );
+    }
+#ifndef RELEASE
+    PopCallStack();
+#else
+    PopProfileRegion();
+#endif
+    return numIts;
+}
+
+template<typename F>
+inline int
+RefinedCholeskySolve
+( UpperOrLower uplo, const DistMatrix<F>& A, DistMatrix<F>& B,
+  int maxRefineIts )
+{
+#ifndef RELEASE
+    PushCallStack("RefinedCholeskySolve");
+    if( A.Grid() != B.Grid() )
+        throw std::logic_error("{A,B} must be distributed over the same grid");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("A must be square");
+    if( A.Height() != B.Height() )
+        throw std::logic_error("A and B must be the same height");
+#else
+    PushProfileRegion("RefinedCholeskySolve");
+#endif
+    typedef typename refined_solve::LowerPrecision<F>::type FLow;
+    const Grid& g = A.Grid();
+
+    // A matrix which is HPD in the working precision need not be numerically
+    // HPD after rounding, in which case the Cholesky factorization throws 
+    // (a NonHPDMatrixException from LAPACK, or a std::logic_error from the
+    // unblocked kernels) from within routines which could not pop their 
+    // call-stack, profile, and blocksize entries
+    DistMatrix<FLow> ALow( g );
+    refined_solve::Convert( A, ALow );
+    int numIts = -1;
+    bool factored = true;
+    const StackDepths depths = GetStackDepths();
+    try { Cholesky( uplo, ALow ); }
+    catch( NonHPDMatrixException& e ) { factored = false; }
+    catch( std::logic_error& e ) { factored = false; }
+    if( !factored )
+        RestoreStackDepths( depths );
+    if( factored )
+        numIts = refined_solve::Refine
+        ( A, B, refined_solve::CholeskySolver<F,FLow>( uplo, A, ALow ),
+          maxRefineIts );
+    if( numIts < 0 )
+    {
+        // Fall back to a factorization in the working precision
+        ALow.Empty();
+        DistMatrix<F> ACopy( A );
+        CholeskySolve( uplo, ACopy, B );
+    }
+#ifndef RELEASE
+    PopCallStack();
+#else
+    PopProfileRegion();
+#endif
+    return numIts;
+}
+
+} // namespace elem
@@ -7,10 +7,108 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 
+#include "./SVD/BidiagSVD.hpp"
+
 namespace elem {
 
 namespace svd {
 
+// The two-stage bidiagonalization keeps its second-stage transforms in VLeft 
+// and VRight, which must be passed along to the backtransformations
+template<typename Real>
+inline void
+Bidiagonalize
+( DistMatrix<Real>& A, 
+  DistMatrix<Real,STAR,VR>& VLeft, DistMatrix<Real,STAR,VR>& VRight )
+{
+    if( GetBidiagApproach() == BIDIAG_TWO_STAGE && A.Height() >= A.Width() )
+    {
+        PushBlocksizeStack<Real>( "Bidiag", A.Grid() );
+        internal::BidiagTwoStage( A, VLeft, VRight );
+        PopBlocksizeStack( "Bidiag" );
+    }
+    else
+        Bidiag( A );
+}
+
+template<typename Real>
+inline void
+Bidiagonalize
+( DistMatrix<Complex<Real> >& A, 
+  DistMatrix<Complex<Real>,STAR,STAR>& tP,
+  DistMatrix<Complex<Real>,STAR,STAR>& tQ,
+  DistMatrix<Complex<Real>,STAR,VR>& VLeft,
+  DistMatrix<Complex<Real>,STAR,VR>& VRight )
+{
+    if( GetBidiagApproach() == BIDIAG_TWO_STAGE && A.Height() >= A.Width() )
+    {
+        PushBlocksizeStack<Complex<Real> >( "Bidiag", A.Grid() );
+        internal::BidiagTwoStage( A, tP, tQ, VLeft, VRight );
+        PopBlocksizeStack( "Bidiag" );
+    }
+    else
+        Bidiag( A, tP, tQ );
+}
+
+// Pulls the (real) bidiagonal matrix out of the diagonal and 
+// sub/super-diagonal of A
+template<typename F>
+inline void
+GetBidiagonal
+( const DistMatrix<F>& A, 
+  std::vector<typename Base<F>::type>& d, 
+  std::vector<typename Base<F>::type>& e )
+{
+    typedef typename Base<F>::type Real;
+    const int m = A.Height();
+    const int n = A.Width();
+    const int k = std::min( m, n );
+    const int offdiagonal = ( m>=n ? 1 : -1 );
+    const Grid& g = A.Grid();
+
+    DistMatrix<Real,MD,STAR> d_MD_STAR( g ),
+                             e_MD_STAR( g );
+    A.GetRealPartOfDiagonal( d_MD_STAR );
+    A.GetRealPartOfDiagonal( e_MD_STAR, offdiagonal );
+    DistMatrix<Real,STAR,STAR> d_STAR_STAR( d_MD_STAR ),
+                               e_STAR_STAR( e_MD_STAR );
+    d.resize( k );
+    e.resize( std::max(k-1,0) );
+    for( int j=0; j<k; ++j )
+        d[j] = d_STAR_STAR.GetLocal(j,0);
+    for( int j=0; j<k-1; ++j )
+        e[j] = e_STAR_STAR.GetLocal(j,0);
+}
+
+template<typename Real>
+inline void
+SetSingularValues
+( const std::vector<Real>& sVector, DistMatrix<Real,VR,STAR>& s )
+{
+    const int k = sVector.size();
+    s.ResizeTo( k, 1 );
+    const int colShift = s.ColShift();
+    const int colStride = s.ColStride();
+    const int localHeight = s.LocalHeight();
+    for( int iLocal=0; iLocal<localHeight; ++iLocal )
+        s.SetLocal( iLocal, 0, sVector[colShift+iLocal*colStride] );
+}
+
+// Copies the real matrix A into the complex matrix B, which is aligned with A
+template<typename Real>
+inline void
+MakeComplex( const DistMatrix<Real>& A, DistMatrix<Complex<Real> >& B )
+{
+    B.Empty();
+    B.AlignWith( A );
+    B.ResizeTo( A.Height(), A.Width() );
+    const int localHeight = A.LocalHeight();
+    const int localWidth = A.LocalWidth();
+    for( int jLocal=0; jLocal<localWidth; ++jLocal )
+        for( int iLocal=0; iLocal<localHeight; ++iLocal )
+            B.SetLocal( iLocal, jLocal, A.GetLocal(iLocal,jLocal) );
+}
+
 template<typename Real>
 inline void
 SimpleSVDUpper
@@ -23,79 +121,65 @@ SimpleSVDUpper
 #endif
     const int m = A.Height();
     const int n = A.Width();
-    const int k = std::min( m, n );
-    const int offdiagonal = ( m>=n ? 1 : -1 );
-    const char uplo = ( m>=n ? 'U' : 'L' );
+    const bool twoStage = 
+        ( GetBidiagApproach() == BIDIAG_TWO_STAGE && m >= n );
     const Grid& g = A.Grid();
 
     // Bidiagonalize A
-    Bidiag( A );
-
-    // Grab copies of the diagonal and sub/super-diagonal of A
-    DistMatrix<Real,MD,STAR> d_MD_STAR( g ), 
-                             e_MD_STAR( g );
-    A.GetDiagonal( d_MD_STAR );
-    A.GetDiagonal( e_MD_STAR, offdiagonal );
-
-    // In order to use serial QR kernels, we need the full bidiagonal matrix
-    // on each process.
-    //
-    // NOTE: lapack::BidiagQRAlg expects e to be of length k
-    DistMatrix<Real,STAR,STAR> d_STAR_STAR( d_MD_STAR );
-    DistMatrix<Real,STAR,STAR> eHat_STAR_STAR( k, 1, g );
-    DistMatrix<Real,STAR,STAR> e_STAR_STAR( g );
-    View( e_STAR_STAR, eHat_STAR_STAR, 0, 0, k-1, 1 );
-    e_STAR_STAR = e_MD_STAR;
-
-    // Initialize U and VTrans to the appropriate identity matrices.
-    DistMatrix<Real,VC,STAR> U_VC_STAR( g );
-    DistMatrix<Real,STAR,VC> VTrans_STAR_VC( g );
-    U_VC_STAR.AlignWith( A );
-    VTrans_STAR_VC.AlignWith( V );
-    Identity( m, k, U_VC_STAR );
-    Identity( k, n, VTrans_STAR_VC );
-
-    // Compute the SVD of the bidiagonal matrix and accumulate the Givens
-    // rotations into our local portion of U and VTrans
-    Matrix<Real>& ULocal = U_VC_STAR.LocalMatrix();
-    Matrix<Real>& VTransLocal = VTrans_STAR_VC.LocalMatrix();
-    lapack::BidiagQRAlg
-    ( uplo, k, VTransLocal.Width(), ULocal.Height(),
-      d_STAR_STAR.LocalBuffer(), e_STAR_STAR.LocalBuffer(), 
-      VTransLocal.Buffer(), VTransLocal.LDim(), 
-      ULocal.Buffer(), ULocal.LDim() );
+    DistMatrix<Real,STAR,VR> VLeft( g ), VRight( g );
+    Bidiagonalize( A, VLeft, VRight );
+
+    // Compute the SVD of the bidiagonal matrix, where the lower bidiagonal 
+    // matrix of the m < n case is handled through its (upper) transpose
+    std::vector<Real> d, e, sVector;
+    GetBidiagonal( A, d, e );
+    DistMatrix<Real> UHat( g ), VHat( g );
+    if( m >= n )
+        BidiagSVD( d, e, sVector, UHat, VHat );
+    else
+        BidiagSVD( d, e, sVector, VHat, UHat );
 
-    // Make a copy of A (for the Householder vectors) and pull the necessary 
-    // portions of U and VTrans into a standard matrix dist.
+    // Make a copy of A (for the Householder vectors) and pull the singular
+    // vectors of the bidiagonal matrix into a standard matrix dist.
     DistMatrix<Real> B( A );
     if( m >= n )
     {
         DistMatrix<Real> AT( g ),
                          AB( g );
-        DistMatrix<Real,VC,STAR> UT_VC_STAR( g ), 
-                                 UB_VC_STAR( g );
         PartitionDown( A, AT,
                           AB, n );
-        PartitionDown( U_VC_STAR, UT_VC_STAR,
-                                  UB_VC_STAR, n );
-        AT = UT_VC_STAR;
+        AT = UHat;
         MakeZeros( AB );
-        Transpose( VTrans_STAR_VC, V );
+        V = VHat;
     }
     else
     {
-        DistMatrix<Real> VT( g ), 
+        DistMatrix<Real> AL( g ), AR( g ),
+                         VT( g ), 
                          VB( g );
-        DistMatrix<Real,STAR,VC> VTransL_STAR_VC( g ), VTransR_STAR_VC( g );
+        PartitionRight( A, AL, AR, m );
         PartitionDown( V, VT, 
                           VB, m );
-        PartitionRight( VTrans_STAR_VC, VTransL_STAR_VC, VTransR_STAR_VC, m );
-        Transpose( VTransL_STAR_VC, VT );
+        AL = UHat;
+        MakeZeros( AR );
+        VT = VHat;
         MakeZeros( VB );
     }
 
     // Backtransform U and V
-    if( m >= n )
+    if( twoStage )
+    {
+        DistMatrix<Real> AT( g ),
+                         AB( g );
+        PartitionDown( A, AT,
+                          AB, n );
+        internal::ApplyBandToTridiagReflectors( VLeft, AT );
+        internal::ApplyBandToTridiagReflectors( VRight, V );
+        ApplyPackedReflectors( LEFT, LOWER, VERTICAL, BACKWARD, 0, B, A );
+        ApplyPackedReflectors
+        ( LEFT, UPPER, HORIZONTAL, BACKWARD, VLeft.Height(), B, V );
+    }
+    else if( m >= n )
     {
         ApplyPackedReflectors( LEFT, LOWER, VERTICAL, BACKWARD, 0, B, A );
         ApplyPackedReflectors( LEFT, UPPER, HORIZONTAL, BACKWARD, 1, B, V );
@@ -106,8 +190,7 @@ SimpleSVDUpper
         ApplyPackedReflectors( LEFT, UPPER, HORIZONTAL, BACKWARD, 0, B, V );
     }
 
-    // Copy out the appropriate subset of the singular values
-    s = d_STAR_STAR;
+    SetSingularValues( sVector, s );
 #ifndef RELEASE
     PopCallStack();
 #endif
@@ -126,77 +209,71 @@ SimpleSVDUpper
     typedef Complex<Real> C;
     const int m = A.Height();
     const int n = A.Width();
-    const int k = std::min( m, n );
-    const int offdiagonal = ( m>=n ? 1 : -1 );
-    const char uplo = ( m>=n ? 'U' : 'L' );
+    const bool twoStage = 
+        ( GetBidiagApproach() == BIDIAG_TWO_STAGE && m >= n );
     const Grid& g = A.Grid();
 
     // Bidiagonalize A
     DistMatrix<C,STAR,STAR> tP( g ), tQ( g );
-    Bidiag( A, tP, tQ );
-
-    // Grab copies of the diagonal and sub/super-diagonal of A
-    DistMatrix<Real,MD,STAR> d_MD_STAR( g ),
-                             e_MD_STAR( g );
-    A.GetRealPartOfDiagonal( d_MD_STAR );
-    A.GetRealPartOfDiagonal( e_MD_STAR, offdiagonal );
-
-    // NOTE: lapack::BidiagQRAlg expects e to be of length k
-    DistMatrix<Real,STAR,STAR> d_STAR_STAR( d_MD_STAR );
-    DistMatrix<Real,STAR,STAR> eHat_STAR_STAR( k, 1, g );
-    DistMatrix<Real,STAR,STAR> e_STAR_STAR( g );
-    View( e_STAR_STAR, eHat_STAR_STAR, 0, 0, k-1, 1 );
-    e_STAR_STAR = e_MD_STAR;
-
-    // Initialize U and VAdj to the appropriate identity matrices
-    DistMatrix<C,VC,STAR> U_VC_STAR( g );
-    DistMatrix<C,STAR,VC> VAdj_STAR_VC( g );
-    U_VC_STAR.AlignWith( A );
-    VAdj_STAR_VC.AlignWith( V );
-    Identity( m, k, U_VC_STAR );
-    Identity( k, n, VAdj_STAR_VC );
-
-    // Compute the SVD of the bidiagonal matrix and accumulate the Givens
-    // rotations into our local portion of U and VAdj
-    Matrix<C>& ULocal = U_VC_STAR.LocalMatrix();
-    Matrix<C>& VAdjLocal = VAdj_STAR_VC.LocalMatrix();
-    lapack::BidiagQRAlg
-    ( uplo, k, VAdjLocal.Width(), ULocal.Height(),
-      d_STAR_STAR.LocalBuffer(), e_STAR_STAR.LocalBuffer(), 
-      VAdjLocal.Buffer(), VAdjLocal.LDim(), 
-      ULocal.Buffer(), ULocal.LDim() );
+    DistMatrix<C,STAR,VR> VLeft( g ), VRight( g );
+    Bidiagonalize( A, tP, tQ, VLeft, VRight );
+
+    // Compute the SVD of the (real) bidiagonal matrix, where the lower 
+    // bidiagonal matrix of the m < n case is handled through its transpose
+    std::vector<Real> d, e, sVector;
+    GetBidiagonal( A, d, e );
+    DistMatrix<Real> UHat( g ), VHat( g );
+    if( m >= n )
+        BidiagSVD( d, e, sVector, UHat, VHat );
+    else
+        BidiagSVD( d, e, sVector, VHat, UHat );
+    DistMatrix<C> UHatComplex( g ), VHatComplex( g );
+    MakeComplex( UHat, UHatComplex );
+    MakeComplex( VHat, VHatComplex );
 
-    // Make a copy of A (for the Householder vectors) and pull the necessary 
-    // portions of U and VAdj into a standard matrix dist.
+    // Make a copy of A (for the Householder vectors) and pull the singular
+    // vectors of the bidiagonal matrix into a standard matrix dist.
     DistMatrix<C> B( A );
     if( m >= n )
     {
         DistMatrix<C> AT( g ),
                       AB( g );
-        DistMatrix<C,VC,STAR> UT_VC_STAR( g ),
-                              UB_VC_STAR( g );
         PartitionDown( A, AT,
                           AB, n );
-        PartitionDown( U_VC_STAR, UT_VC_STAR,
-                                  UB_VC_STAR, n );
-        AT = UT_VC_STAR;
+        AT = UHatComplex;
         MakeZeros( AB );
-        Adjoint( VAdj_STAR_VC, V );
+        V = VHatComplex;
     }
     else
     {
-        DistMatrix<C> VT( g ), 
+        DistMatrix<C> AL( g ), AR( g ),
+                      VT( g ), 
                       VB( g );
-        DistMatrix<C,STAR,VC> VAdjL_STAR_VC( g ), VAdjR_STAR_VC( g );
+        PartitionRight( A, AL, AR, m );
         PartitionDown( V, VT, 
                           VB, m );
-        PartitionRight( VAdj_STAR_VC, VAdjL_STAR_VC, VAdjR_STAR_VC, m );
-        Adjoint( VAdjL_STAR_VC, VT );
+        AL = UHatComplex;
+        MakeZeros( AR );
+        VT = VHatComplex;
         MakeZeros( VB );
     }
 
     // Backtransform U and V
-    if( m >= n )
+    if( twoStage )
+    {
+        DistMatrix<C> AT( g ),
+                      AB( g );
+        PartitionDown( A, AT,
+                          AB, n );
+        internal::ApplyBandToTridiagReflectors( VLeft, AT );
+        internal::ApplyBandToTridiagReflectors( VRight, V );
+        ApplyPackedReflectors
+        ( LEFT, LOWER, VERTICAL, BACKWARD, UNCONJUGATED, 0, B, tQ, A );
+        ApplyPackedReflectors
+        ( LEFT, UPPER, HORIZONTAL, BACKWARD, CONJUGATED, 
+          VLeft.Height(), B, tP, V );
+    }
+    else if( m >= n )
     {
         ApplyPackedReflectors
         ( LEFT, LOWER, VERTICAL, BACKWARD, UNCONJUGATED, 0, B, tQ, A );
@@ -211,8 +288,7 @@ SimpleSVDUpper
         ( LEFT, UPPER, HORIZONTAL, BACKWARD, UNCONJUGATED, 0, B, tP, V );
     }
 
-    // Copy out the appropriate subset of the singular values
-    s = d_STAR_STAR;
+    SetSingularValues( sVector, s );
 #ifndef RELEASE
     PopCallStack();
 #endif
@@ -502,38 +578,28 @@ SimpleSingularValuesUpper
     const int m = A.Height();
     const int n = A.Width();
     const int k = std::min( m, n );
-    const int offdiagonal = ( m>=n ? 1 : -1 );
     const char uplo = ( m>=n ? 'U' : 'L' );
     const Grid& g = A.Grid();
 
-    // Bidiagonalize A
-    Bidiag( A );
-
-    // Grab copies of the diagonal and sub/super-diagonal of A
-    DistMatrix<Real,MD,STAR> d_MD_STAR( g ), 
-                             e_MD_STAR( g );
-    A.GetDiagonal( d_MD_STAR );
-    A.GetDiagonal( e_MD_STAR, offdiagonal );
-
+    // Bidiagonalize A (the second-stage transforms are not needed)
+    DistMatrix<Real,STAR,VR> VLeft( g ), VRight( g );
+    Bidiagonalize( A, VLeft, VRight );
 
     // In order to use serial QR kernels, we need the full bidiagonal matrix
     // on each process
     //
     // NOTE: lapack::BidiagQRAlg expects e to be of length k
-    DistMatrix<Real,STAR,STAR> d_STAR_STAR( d_MD_STAR );
-    DistMatrix<Real,STAR,STAR> eHat_STAR_STAR( k, 1, g );
-    DistMatrix<Real,STAR,STAR> e_STAR_STAR( g );
-    View( e_STAR_STAR, eHat_STAR_STAR, 0, 0, k-1, 1 );
-    e_STAR_STAR = e_MD_STAR;
+    std::vector<Real> d, e;
+    GetBidiagonal( A, d, e );
+    e.resize( k );
 
     // Compute the singular values of the bidiagonal matrix
-    lapack::BidiagQRAlg
-    ( uplo, k, 0, 0,
-      d_STAR_STAR.LocalBuffer(), e_STAR_STAR.LocalBuffer(), 
-      (Real*)0, 1, (Real*)0, 1 );
+    if( k > 0 )
+        lapack::BidiagQRAlg
+        ( uplo, k, 0, 0, &d[0], &e[0], (Real*)0, 1, (Real*)0, 1 );
 
     // Copy out the appropriate subset of the singular values
-    s = d_STAR_STAR;
+    SetSingularValues( d, s );
 #ifndef RELEASE
     PopCallStack();
 #endif
@@ -552,38 +618,29 @@ SimpleSingularValuesUpper
     const int m = A.Height();
     const int n = A.Width();
     const int k = std::min( m, n );
-    const int offdiagonal = ( m>=n ? 1 : -1 );
     const char uplo = ( m>=n ? 'U' : 'L' );
     const Grid& g = A.Grid();
 
-    // Bidiagonalize A
-    DistMatrix<C,STAR,STAR> tP(g), tQ(g);
-    Bidiag( A, tP, tQ );
-
-    // Grab copies of the diagonal and sub/super-diagonal of A
-    DistMatrix<Real,MD,STAR> d_MD_STAR( g ), 
-                             e_MD_STAR( g );
-    A.GetRealPartOfDiagonal( d_MD_STAR );
-    A.GetRealPartOfDiagonal( e_MD_STAR, offdiagonal );
+    // Bidiagonalize A (the second-stage transforms are not needed)
+    DistMatrix<C,STAR,STAR> tP( g ), tQ( g );
+    DistMatrix<C,STAR,VR> VLeft( g ), VRight( g );
+    Bidiagonalize( A, tP, tQ, VLeft, VRight );
 
     // In order to use serial QR kernels, we need the full bidiagonal matrix
     // on each process
     //
     // NOTE: lapack::BidiagQRAlg expects e to be of length k
-    DistMatrix<Real,STAR,STAR> d_STAR_STAR( d_MD_STAR );
-    DistMatrix<Real,STAR,STAR> eHat_STAR_STAR( k, 1, g );
-    DistMatrix<Real,STAR,STAR> e_STAR_STAR( g );
-    View( e_STAR_STAR, eHat_STAR_STAR, 0, 0, k-1, 1 );
-    e_STAR_STAR = e_MD_STAR;
+    std::vector<Real> d, e;
+    GetBidiagonal( A, d, e );
+    e.resize( k );
 
     // Compute the singular values of the bidiagonal matrix
-    lapack::BidiagQRAlg
-    ( uplo, k, 0, 0,
-      d_STAR_STAR.LocalBuffer(), e_STAR_STAR.LocalBuffer(), 
-      (C*)0, 1, (C*)0, 1 );
+    if( k > 0 )
+        lapack::BidiagQRAlg
+        ( uplo, k, 0, 0, &d[0], &e[0], (C*)0, 1, (C*)0, 1 );
 
     // Copy out the appropriate subset of the singular values
-    s = d_STAR_STAR;
+    SetSingularValues( d, s );
 #ifndef RELEASE
     PopCallStack();
 #endif
@@ -756,6 +813,8 @@ SVD( Matrix<F>& A, Matrix<typename Base<F>::type>& s, Matrix<F>& V, bool useQR )
 {
 #ifndef RELEASE
     PushCallStack("SVD");
+#else
+    PushProfileRegion("SVD");
 #endif
     if( useQR )
         svd::QRSVD( A, s, V );
@@ -763,6 +822,8 @@ SVD( Matrix<F>& A, Matrix<typename Base<F>::type>& s, Matrix<F>& V, bool useQR )
         svd::DivideAndConquerSVD( A, s, V );
 #ifndef RELEASE
     PopCallStack();
+#else
+    PopProfileRegion();
 #endif
 }
 
@@ -778,6 +839,8 @@ SVD
     PushCallStack("SVD");
     if( heightRatio <= 1.0 )
         throw std::logic_error("Nonsensical switchpoint for SVD");
+#else
+    PushProfileRegion("SVD");
 #endif
     typedef typename Base<F>::type Real;
 
@@ -807,6 +870,8 @@ SVD
         Scal( 1/scale, s );
 #ifndef RELEASE
     PopCallStack();
+#else
+    PopProfileRegion();
 #endif
 }
 
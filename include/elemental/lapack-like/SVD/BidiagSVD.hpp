@@ -0,0 +1,219 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace elem {
+namespace svd {
+
+// Computes the SVD, B = U diag(s) V^T, of the k x k upper bidiagonal matrix
+// with diagonal d and superdiagonal e by having every process run the QR
+// algorithm on the entire problem while accumulating the rotations into its
+// local rows of U and local columns of V^T
+template<typename R>
+inline void
+BidiagQRSVD
+( const std::vector<R>& d, const std::vector<R>& e,
+  std::vector<R>& s, DistMatrix<R>& U, DistMatrix<R>& V )
+{
+#ifndef RELEASE
+    PushCallStack("svd::BidiagQRSVD");
+#endif
+    const Grid& g = U.Grid();
+    const int k = d.size();
+
+    // NOTE: lapack::BidiagQRAlg expects e to be of length k
+    std::vector<R> eHat( e );
+    eHat.resize( k );
+    s = d;
+
+    DistMatrix<R,VC,STAR> U_VC_STAR( g );
+    DistMatrix<R,STAR,VC> VTrans_STAR_VC( g );
+    U_VC_STAR.AlignWith( U );
+    VTrans_STAR_VC.AlignWith( V );
+    Identity( k, k, U_VC_STAR );
+    Identity( k, k, VTrans_STAR_VC );
+    Matrix<R>& ULocal = U_VC_STAR.LocalMatrix();
+    Matrix<R>& VTransLocal = VTrans_STAR_VC.LocalMatrix();
+    lapack::BidiagQRAlg
+    ( 'U', k, VTransLocal.Width(), ULocal.Height(),
+      &s[0], &eHat[0],
+      VTransLocal.Buffer(), VTransLocal.LDim(),
+      ULocal.Buffer(), ULocal.LDim() );
+    U = U_VC_STAR;
+    Transpose( VTrans_STAR_VC, V );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+// The Golub-Kahan tridiagonal matrix of B has a zero diagonal and the
+// off-diagonal (d_0,e_0,d_1,e_1,...,d_{k-1}), and its eigenpairs are
+// (-s_j,[v_0;-u_0;v_1;-u_1;...]/sqrt(2)) and
+// ( s_j,[v_0; u_0;v_1; u_1;...]/sqrt(2))
+template<typename R>
+inline void
+GolubKahanTridiag
+( const std::vector<R>& d, const std::vector<R>& e,
+  std::vector<R>& dTGK, std::vector<R>& eTGK )
+{
+    const int k = d.size();
+    dTGK.resize( 2*k );
+    eTGK.resize( 2*k-1 );
+    for( int j=0; j<2*k; ++j )
+        dTGK[j] = 0;
+    for( int j=0; j<k; ++j )
+    {
+        eTGK[2*j] = d[j];
+        if( j < k-1 )
+            eTGK[2*j+1] = e[j];
+    }
+}
+
+// Splits the eigenvectors of the k most negative eigenvalues, -s, of the
+// Golub-Kahan tridiagonal matrix into the left and right singular vectors.
+// Each half is normalized separately, and false is returned if the halves
+// of any eigenvector do not have (nearly) equal norms, which happens when
+// the eigenvectors of zero (or tightly clustered) singular values mix.
+template<typename R>
+inline bool
+GolubKahanVectors
+( const std::vector<R>& w, const DistMatrix<R,STAR,VR>& Z,
+  std::vector<R>& s, DistMatrix<R>& U, DistMatrix<R>& V )
+{
+#ifndef RELEASE
+    PushCallStack("svd::GolubKahanVectors");
+#endif
+    const Grid& g = Z.Grid();
+    const int k = w.size();
+    const R tol = Sqrt(lapack::MachineEpsilon<R>());
+
+    DistMatrix<R,STAR,VR> U_STAR_VR( g ), V_STAR_VR( g );
+    U_STAR_VR.AlignWith( Z );
+    V_STAR_VR.AlignWith( Z );
+    Zeros( k, k, U_STAR_VR );
+    Zeros( k, k, V_STAR_VR );
+    const int rowShift = Z.RowShift();
+    const int rowStride = Z.RowStride();
+    const int localWidth = Z.LocalWidth();
+    int separated = 1;
+    for( int jLocal=0; jLocal<localWidth; ++jLocal )
+    {
+        const int j = rowShift + jLocal*rowStride;
+        const R* z = Z.LockedLocalBuffer(0,jLocal);
+        R uNormSquared=0, vNormSquared=0;
+        for( int i=0; i<k; ++i )
+        {
+            vNormSquared += z[2*i]*z[2*i];
+            uNormSquared += z[2*i+1]*z[2*i+1];
+        }
+        if( Abs(uNormSquared-vNormSquared) > tol )
+            separated = 0;
+
+        // Tiny singular values may be computed with the wrong sign
+        const R uScale = ( -w[j] >= 0 ? -1 : 1 ) / Sqrt(uNormSquared);
+        const R vScale = R(1) / Sqrt(vNormSquared);
+        R* u = U_STAR_VR.LocalBuffer(0,jLocal);
+        R* v = V_STAR_VR.LocalBuffer(0,jLocal);
+        for( int i=0; i<k; ++i )
+        {
+            u[i] = uScale*z[2*i+1];
+            v[i] = vScale*z[2*i];
+        }
+    }
+    int allSeparated;
+    mpi::AllReduce( &separated, &allSeparated, 1, mpi::MIN, g.VRComm() );
+    if( allSeparated )
+    {
+        s.resize( k );
+        for( int j=0; j<k; ++j )
+            s[j] = Abs(w[j]);
+        U = U_STAR_VR;
+        V = V_STAR_VR;
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+    return allSeparated;
+}
+
+// Computes the SVD, B = U diag(s) V^T, of the k x k upper bidiagonal matrix
+// with diagonal d and superdiagonal e, where the singular values are in
+// non-increasing order
+template<typename R>
+inline void
+BidiagSVD
+( const std::vector<R>& d, const std::vector<R>& e,
+  std::vector<R>& s, DistMatrix<R>& U, DistMatrix<R>& V )
+{
+#ifndef RELEASE
+    PushCallStack("svd::BidiagSVD");
+#endif
+    const Grid& g = U.Grid();
+    const int k = d.size();
+    BidiagSVDApproach approach = GetBidiagSVDApproach();
+    if( approach == BIDIAG_SVD_DEFAULT )
+    {
+#ifndef WITHOUT_PMRRR
+        approach = BIDIAG_SVD_MRRR;
+#else
+        approach = BIDIAG_SVD_DIVIDE_AND_CONQUER;
+#endif
+    }
+    if( k == 0 )
+    {
+        s.resize( 0 );
+        Zeros( 0, 0, U );
+        Zeros( 0, 0, V );
+    }
+    else if( approach == BIDIAG_SVD_QR )
+        BidiagQRSVD( d, e, s, U, V );
+    else
+    {
+        std::vector<R> dTGK, eTGK, w;
+        GolubKahanTridiag( d, e, dTGK, eTGK );
+        DistMatrix<R,STAR,VR> Z_STAR_VR( g );
+#ifndef WITHOUT_PMRRR
+        if( approach == BIDIAG_SVD_MRRR )
+        {
+            // PMRRR can write outside of its output when a cluster straddles
+            // the end of a requested index range, and the pairs (-s_j,s_j) of
+            // tiny singular values form exactly such a cluster, so the full
+            // spectrum is computed and the first half is kept
+            DistMatrix<R,STAR,VR> ZTGK( g ), ZTGKLeft( g );
+            internal::TridiagEigPMRRR( dTGK, eTGK, 0, 2*k-1, w, ZTGK );
+            w.resize( k );
+            LockedView( ZTGKLeft, ZTGK, 0, 0, 2*k, k );
+            Z_STAR_VR = ZTGKLeft;
+        }
+        else
+#endif
+        {
+            DistMatrix<R,STAR,STAR> dTGK_STAR_STAR( 2*k, 1, g ),
+                                    eTGK_STAR_STAR( 2*k-1, 1, g );
+            MemCopy( dTGK_STAR_STAR.LocalBuffer(), &dTGK[0], 2*k );
+            MemCopy( eTGK_STAR_STAR.LocalBuffer(), &eTGK[0], 2*k-1 );
+            DistMatrix<R,VR,STAR> wTGK( g );
+            DistMatrix<R> ZTGK( g ), ZTGKLeft( g );
+            HermitianTridiagEig( dTGK_STAR_STAR, eTGK_STAR_STAR, wTGK, ZTGK );
+            LockedView( ZTGKLeft, ZTGK, 0, 0, 2*k, k );
+            Z_STAR_VR = ZTGKLeft;
+            DistMatrix<R,STAR,STAR> wTGK_STAR_STAR( wTGK );
+            w.resize( k );
+            for( int j=0; j<k; ++j )
+                w[j] = wTGK_STAR_STAR.GetLocal(j,0);
+        }
+        if( !GolubKahanVectors( w, Z_STAR_VR, s, U, V ) )
+            BidiagQRSVD( d, e, s, U, V );
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+} // namespace svd
+} // namespace elem
@@ -0,0 +1,106 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace elem {
+
+template<typename F>
+inline void
+SolveAfterLDL
+( Orientation orientation,
+  const Matrix<F>& A, const Matrix<F>& dSub, const Matrix<int>& p,
+  Matrix<F>& B )
+{
+#ifndef RELEASE
+    PushCallStack("SolveAfterLDL");
+    if( orientation == NORMAL )
+        throw std::logic_error("Can only solve after LDL^T or LDL^H");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("A must be square");
+    if( A.Height() != B.Height() )
+        throw std::logic_error("A and B must be the same height");
+    if( p.Height() != A.Height() )
+        throw std::logic_error("A and p must be the same height");
+#endif
+    Matrix<F> d;
+    A.GetDiagonal( d );
+    ApplyRowPivots( B, p );
+    if( B.Width() == 1 )
+    {
+        Trsv( LOWER, NORMAL, UNIT, A, B );
+        internal::QuasiDiagonalSolve( orientation, d, dSub, B );
+        Trsv( LOWER, orientation, UNIT, A, B );
+    }
+    else
+    {
+        Trsm( LEFT, LOWER, NORMAL, UNIT, F(1), A, B );
+        internal::QuasiDiagonalSolve( orientation, d, dSub, B );
+        Trsm( LEFT, LOWER, orientation, UNIT, F(1), A, B );
+    }
+    ApplyInverseRowPivots( B, p );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename F>
+inline void
+SolveAfterLDL
+( Orientation orientation,
+  const DistMatrix<F>& A, const DistMatrix<F,MC,STAR>& dSub,
+  const DistMatrix<int,VC,STAR>& p, DistMatrix<F>& B )
+{
+#ifndef RELEASE
+    PushCallStack("SolveAfterLDL");
+    if( A.Grid() != B.Grid() || A.Grid() != dSub.Grid() ||
+        A.Grid() != p.Grid() )
+        throw std::logic_error
+        ("{A,dSub,p,B} must be distributed over the same grid");
+    if( orientation == NORMAL )
+        throw std::logic_error("Can only solve after LDL^T or LDL^H");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("A must be square");
+    if( A.Height() != B.Height() )
+        throw std::logic_error("A and B must be the same height");
+    if( p.Height() != A.Height() )
+        throw std::logic_error("A and p must be the same height");
+#endif
+    const Grid& g = A.Grid();
+    ApplyRowPivots( B, p );
+    if( B.Width() == 1 )
+        Trsv( LOWER, NORMAL, UNIT, A, B );
+    else
+        Trsm( LEFT, LOWER, NORMAL, UNIT, F(1), A, B );
+
+    // The 2x2 blocks of D couple pairs of rows, so solve against D with each
+    // process owning entire columns of B
+    {
+        DistMatrix<F,MD,STAR> d(g);
+        A.GetDiagonal( d );
+        DistMatrix<F,STAR,STAR> d_STAR_STAR(g), dSub_STAR_STAR(g);
+        d_STAR_STAR = d;
+        dSub_STAR_STAR = dSub;
+        DistMatrix<F,STAR,VR> B_STAR_VR(g);
+        B_STAR_VR = B;
+        internal::QuasiDiagonalSolve
+        ( orientation, d_STAR_STAR.LockedLocalMatrix(),
+          dSub_STAR_STAR.LockedLocalMatrix(), B_STAR_VR.LocalMatrix() );
+        B = B_STAR_VR;
+    }
+
+    if( B.Width() == 1 )
+        Trsv( LOWER, orientation, UNIT, A, B );
+    else
+        Trsm( LEFT, LOWER, orientation, UNIT, F(1), A, B );
+    ApplyInverseRowPivots( B, p );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+} // namespace elem
@@ -44,10 +44,18 @@ TwoNormLowerBound( const DistMatrix<F>& A )
     const R m = A.Height();
     const R n = A.Width();
 
-    const R maxNorm = Norm( A, MAX_NORM );
-    const R oneNorm = Norm( A, ONE_NORM );
-    const R infNorm = Norm( A, INFINITY_NORM );
-    const R frobNorm = Norm( A, FROBENIUS_NORM );
+    // Compute all of the norms with a single reduction
+    std::vector<NormType> types(4);
+    types[0] = MAX_NORM;
+    types[1] = ONE_NORM;
+    types[2] = INFINITY_NORM;
+    types[3] = FROBENIUS_NORM;
+    std::vector<R> norms;
+    Norms( A, types, norms );
+    const R maxNorm = norms[0];
+    const R oneNorm = norms[1];
+    const R infNorm = norms[2];
+    const R frobNorm = norms[3];
     R lowerBound = std::max( maxNorm, infNorm/Sqrt(n) );
     lowerBound = std::max( lowerBound, oneNorm/Sqrt(m) );
     lowerBound = std::max( lowerBound, frobNorm/Sqrt(std::min(m,n)) );
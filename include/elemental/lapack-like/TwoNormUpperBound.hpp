@@ -44,9 +44,16 @@ TwoNormUpperBound( const DistMatrix<F>& A )
     const R m = A.Height();
     const R n = A.Width();
 
-    const R maxNorm = Norm( A, MAX_NORM );
-    const R oneNorm = Norm( A, ONE_NORM );
-    const R infNorm = Norm( A, INFINITY_NORM );
+    // Compute all of the norms with a single reduction
+    std::vector<NormType> types(3);
+    types[0] = MAX_NORM;
+    types[1] = ONE_NORM;
+    types[2] = INFINITY_NORM;
+    std::vector<R> norms;
+    Norms( A, types, norms );
+    const R maxNorm = norms[0];
+    const R oneNorm = norms[1];
+    const R infNorm = norms[2];
 
     R upperBound = std::min( Sqrt(m*n)*maxNorm, Sqrt(m)*infNorm );
     upperBound = std::min( upperBound, Sqrt(n)*oneNorm );
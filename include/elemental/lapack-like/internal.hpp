@@ -32,6 +32,32 @@ template<typename F>
 void LocalTriangularInverse
 ( UpperOrLower uplo, UnitOrNonUnit diag, DistMatrix<F,STAR,STAR>& A );
 
+//----------------------------------------------------------------------------//
+// Tiled factorizations of local matrices                                     //
+//----------------------------------------------------------------------------//
+
+// Whether the sequential factorizations of a height x width matrix should run
+// as a graph of OpenMP tasks over tiles of size GetLocalTileSize()
+bool UseLocalTiles( int height, int width );
+
+// A task which throws records the failure so that the remaining tasks can be
+// skipped and a single exception can be thrown once the tasks are complete
+bool TileFailed( const bool& failed );
+void RecordTileFailure( bool& failed );
+
+template<typename F>
+void CholeskyLTiled( Matrix<F>& A );
+template<typename F>
+void CholeskyUTiled( Matrix<F>& A );
+
+template<typename F>
+void LUTiled( Matrix<F>& A );
+
+template<typename R>
+void QRTiled( Matrix<R>& A );
+template<typename R>
+void QRTiled( Matrix<Complex<R> >& A, Matrix<Complex<R> >& t );
+
 //----------------------------------------------------------------------------//
 // Cholesky helpers                                                           //
 //----------------------------------------------------------------------------//
@@ -124,6 +150,12 @@ void PanelLU
   DistMatrix<int,STAR,STAR>& p, 
   int pivotOffset=0 );
 
+template<typename F>
+void TournamentPivots
+( const DistMatrix<F,VC,STAR>& A, 
+  DistMatrix<int,STAR,STAR>& p, 
+  int pivotOffset=0 );
+
 template<typename F> mpi::Op PivotOp();
 template<> mpi::Op PivotOp<float>();
 template<> mpi::Op PivotOp<double>();
@@ -134,6 +166,28 @@ template<typename F>
 void PivotFunc
 ( void* inData, void* outData, int* length, mpi::Datatype* datatype );
 
+//----------------------------------------------------------------------------//
+// Norms                                                                      //
+//----------------------------------------------------------------------------//
+
+// Combines arrays of (scale,scaledSquare) pairs, stored as Complex<R>, in the
+// manner of LAPACK's xLASSQ: the result represents the sum of the squares
+template<typename R> void CreateScaledSquareOp();
+template<> void CreateScaledSquareOp<float>();
+template<> void CreateScaledSquareOp<double>();
+
+template<typename R> void DestroyScaledSquareOp();
+template<> void DestroyScaledSquareOp<float>();
+template<> void DestroyScaledSquareOp<double>();
+
+template<typename R> mpi::Op ScaledSquareOp();
+template<> mpi::Op ScaledSquareOp<float>();
+template<> mpi::Op ScaledSquareOp<double>();
+
+template<typename R>
+void ScaledSquareFunc
+( void* inData, void* outData, int* length, mpi::Datatype* datatype );
+
 //----------------------------------------------------------------------------//
 // LQ                                                                         //
 //----------------------------------------------------------------------------//
@@ -164,6 +218,12 @@ template<typename R>
 void PanelQR
 ( DistMatrix<Complex<R> >& A, DistMatrix<Complex<R>,MD,STAR>& t );
 
+template<typename R>
+void PanelTSQR( DistMatrix<R>& A );
+template<typename R>
+void PanelTSQR
+( DistMatrix<Complex<R> >& A, DistMatrix<Complex<R>,MD,STAR>& t );
+
 //----------------------------------------------------------------------------//
 // Reflector                                                                  //
 //----------------------------------------------------------------------------//
@@ -237,6 +297,18 @@ void PanelBidiagU
   DistMatrix<Complex<R>,MC,  STAR>& AColPan_MC_STAR,
   DistMatrix<Complex<R>,STAR,MR  >& ARowPan_STAR_MR );
 
+template<typename R>
+void BidiagTwoStage
+( DistMatrix<R>& A, 
+  DistMatrix<R,STAR,VR>& VLeft, DistMatrix<R,STAR,VR>& VRight );
+template<typename R>
+void BidiagTwoStage
+( DistMatrix<Complex<R> >& A,
+  DistMatrix<Complex<R>,STAR,STAR>& tP,
+  DistMatrix<Complex<R>,STAR,STAR>& tQ,
+  DistMatrix<Complex<R>,STAR,VR>& VLeft,
+  DistMatrix<Complex<R>,STAR,VR>& VRight );
+
 //----------------------------------------------------------------------------//
 // HermitianTridiag                                                           //
 //----------------------------------------------------------------------------//
@@ -340,6 +412,40 @@ void HermitianTridiagUSquare
 ( DistMatrix<Complex<R> >& A, 
   DistMatrix<Complex<R>,STAR,STAR>& t );
 
+inline int TwoStageNumReflectors( int n, int b );
+
+template<typename R>
+void HermitianTridiagTwoStage
+( UpperOrLower uplo, DistMatrix<R>& A, DistMatrix<R,STAR,VR>& V );
+template<typename R>
+void HermitianTridiagTwoStage
+( UpperOrLower uplo,
+  DistMatrix<Complex<R> >& A,
+  DistMatrix<Complex<R>,STAR,STAR>& t,
+  DistMatrix<Complex<R>,STAR,VR>& V );
+
+template<typename R>
+void ApplyTwoStageReflectors
+( const DistMatrix<R>& A, const DistMatrix<R,STAR,VR>& V,
+  DistMatrix<R>& Z );
+template<typename R>
+void ApplyTwoStageReflectors
+( const DistMatrix<Complex<R> >& A,
+  const DistMatrix<Complex<R>,STAR,STAR>& t,
+  const DistMatrix<Complex<R>,STAR,VR>& V,
+        DistMatrix<Complex<R> >& Z );
+
+//----------------------------------------------------------------------------//
+// HermitianTridiagEig                                                        //
+//----------------------------------------------------------------------------//
+
+#ifndef WITHOUT_PMRRR
+template<typename R>
+void TridiagEigPMRRR
+( const std::vector<R>& d, const std::vector<R>& e, int a, int b,
+  std::vector<R>& w, DistMatrix<R,STAR,VR>& Z );
+#endif // WITHOUT_PMRRR
+
 //----------------------------------------------------------------------------//
 // HPD Inverse                                                                //
 //----------------------------------------------------------------------------//
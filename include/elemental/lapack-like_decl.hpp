@@ -157,9 +157,25 @@ typename Base<F>::type TwoNormLowerBound( const Matrix<F>& A );
 template<typename F>
 typename Base<F>::type TwoNormUpperBound( const Matrix<F>& A );
 template<typename F>
-typename Base<F>::type TwoNormLowerBound( const Matrix<F>& A );
+typename Base<F>::type TwoNormLowerBound( const DistMatrix<F>& A );
 template<typename F>
-typename Base<F>::type TwoNormUpperBound( const Matrix<F>& A );
+typename Base<F>::type TwoNormUpperBound( const DistMatrix<F>& A );
+
+//
+// Norms
+//
+// Computes norms[k] = Norm( A, types[k] ). The distributed version fuses the
+// one, infinity, max, and Frobenius norms into a single pass over the local
+// data and a single AllReduce; the other norm types are not supported.
+//
+template<typename F>
+void Norms
+( const Matrix<F>& A, const std::vector<NormType>& types,
+  std::vector<typename Base<F>::type>& norms );
+template<typename F,Distribution U,Distribution V>
+void Norms
+( const DistMatrix<F,U,V>& A, const std::vector<NormType>& types,
+  std::vector<typename Base<F>::type>& norms );
 
 //
 // HermitianNorm
@@ -227,7 +243,10 @@ void GaussianElimination( DistMatrix<F>& A, DistMatrix<F>& B );
 // Overwrite the lower triangle of A with L and d with the diagonal entries 
 // of D, so that A = L D L^H.
 //
-// Partial pivoting is not yet supported.                                     //
+// The variants which return dSub and p use Bunch-Kaufman pivoting, so that 
+// P A P^T = L D L^H, where D is quasi-diagonal with 1x1 and 2x2 blocks. The 
+// diagonal of A is then overwritten with the diagonal of D, dSub holds the 
+// subdiagonal of D, and p holds the row which was swapped with each row.
 //
 
 // NOTE: Currently unblocked
@@ -241,13 +260,21 @@ void LDLH( DistMatrix<F>& A );
 template<typename F>
 void LDLH( DistMatrix<F>& A, DistMatrix<F,MC,STAR>& d );
 
+template<typename F>
+void LDLH( Matrix<F>& A, Matrix<F>& dSub, Matrix<int>& p );
+template<typename F>
+void LDLH
+( DistMatrix<F>& A, 
+  DistMatrix<F,MC,STAR>& dSub, DistMatrix<int,VC,STAR>& p );
+
 //
 // LDLT (LDL^T factorization): 
 //
 // Overwrite the lower triangle of A with L and d with the diagonal entries 
 // of D, so that A = L D L^T. 
 //
-// Partial pivoting is not yet supported. 
+// The variants which return dSub and p use Bunch-Kaufman pivoting, so that 
+// P A P^T = L D L^T; see LDLH.
 //
 
 // NOTE: Currently unblocked
@@ -261,6 +288,13 @@ void LDLT( DistMatrix<F>& A );
 template<typename F>
 void LDLT( DistMatrix<F>& A, DistMatrix<F,MC,STAR>& d );
 
+template<typename F>
+void LDLT( Matrix<F>& A, Matrix<F>& dSub, Matrix<int>& p );
+template<typename F>
+void LDLT
+( DistMatrix<F>& A, 
+  DistMatrix<F,MC,STAR>& dSub, DistMatrix<int,VC,STAR>& p );
+
 //
 // LU (LU factorization): 
 //
@@ -375,6 +409,11 @@ void ExplicitQR( Matrix<F>& A, Matrix<F>& R );
 template<typename F>
 void ExplicitQR( DistMatrix<F>& A, DistMatrix<F>& R );
 
+// Tall-skinny QR, which overwrites A with the explicit Q and returns R on
+// every process, using a reduction tree over all of the processes
+template<typename F>
+void TSQR( DistMatrix<F,VC,STAR>& A, DistMatrix<F,STAR,STAR>& R );
+
 //----------------------------------------------------------------------------//
 // Linear solvers                                                             //
 //----------------------------------------------------------------------------//
@@ -421,6 +460,26 @@ void HouseholderSolve
   const DistMatrix<Complex<R> >& B, 
         DistMatrix<Complex<R> >& X );
 
+//
+// RefinedGaussianElimination/RefinedCholeskySolve:
+//
+// Overwrite B := inv(A) B using an LU (or Cholesky) factorization of a copy 
+// of A in single precision, followed by iterative refinement with residuals 
+// computed in the working precision, so that most of the work and 
+// communication is spent on half as many bytes. If a refinement step fails 
+// to halve the residual, or maxRefineIts steps are exceeded, the system is 
+// instead solved with a factorization in the working precision. The number 
+// of refinement steps is returned, or -1 if the fallback was used. A is left
+// unchanged, and RefinedCholeskySolve only accesses its 'uplo' triangle.
+//
+template<typename F>
+int RefinedGaussianElimination
+( const DistMatrix<F>& A, DistMatrix<F>& B, int maxRefineIts=30 );
+template<typename F>
+int RefinedCholeskySolve
+( UpperOrLower uplo, const DistMatrix<F>& A, DistMatrix<F>& B, 
+  int maxRefineIts=30 );
+
 //
 // SolveAfterCholesky (solve after having perfored a Cholesky fact. of A):
 //
@@ -434,6 +493,24 @@ void SolveAfterCholesky
 ( UpperOrLower uplo, Orientation orientation, 
   const DistMatrix<F>& A, DistMatrix<F>& B );
 
+//
+// SolveAfterLDL (solve after a pivoted LDL^T or LDL^H factorization of A):
+//
+// A, dSub, and p are as returned by the pivoted LDLT or LDLH, and orientation
+// must respectively be TRANSPOSE or ADJOINT.
+//
+
+template<typename F>
+void SolveAfterLDL
+( Orientation orientation, 
+  const Matrix<F>& A, const Matrix<F>& dSub, const Matrix<int>& p, 
+  Matrix<F>& B );
+template<typename F>
+void SolveAfterLDL
+( Orientation orientation,
+  const DistMatrix<F>& A, const DistMatrix<F,MC,STAR>& dSub, 
+  const DistMatrix<int,VC,STAR>& p, DistMatrix<F>& B );
+
 //
 // SolveAfterLU (solve after having perfored an LU factorization of A):
 //
@@ -514,6 +591,10 @@ void Bidiag
   Matrix<Complex<R> >& tQ );
 
 // WARNING: Not yet finished
+//
+// The BIDIAG_TWO_STAGE approach (see the tuning parameters below) is only 
+// used by the SVD routines, so the parallel Bidiag routines always use the
+// normal approach.
 template<typename R>
 void Bidiag( DistMatrix<R>& A );
 template<typename R>
@@ -537,6 +618,12 @@ void Bidiag
 // in Householder transform early-exit approaches for the serial and parallel
 // routines.
 //
+// The HERMITIAN_TRIDIAG_TWO_STAGE approach is only used by HermitianEig, 
+// which keeps the second-stage transforms for backtransforming the 
+// eigenvectors. Since they cannot be returned from the parallel routines 
+// below, these fall back to the HERMITIAN_TRIDIAG_DEFAULT approach so that
+// A and t always describe the complete transformation.
+//
 
 // NOTE: Currently unblocked
 template<typename R>
@@ -563,11 +650,28 @@ void HermitianTridiag
 
 // TODO: Serial version
 
-#ifndef WITHOUT_PMRRR
+// The eigenvectors of the tridiagonal matrix are computed with PMRRR unless 
+// TRIDIAG_EIG_DIVIDE_AND_CONQUER is requested, in which case the tridiagonal
+// problem is recursively torn in half and the two halves are merged with 
+// distributed Gemm's (see HermitianTridiagEig). Divide and conquer always
+// computes the full spectrum of the tridiagonal matrix, but only the requested
+// eigenvectors are backtransformed. Without PMRRR, divide and conquer is the
+// default, and only the eigenpair routines are available.
+namespace tridiag_eig_alg_wrapper {
+enum TridiagEigAlg
+{
+    TRIDIAG_EIG_MRRR,               // Relatively robust representations
+    TRIDIAG_EIG_DIVIDE_AND_CONQUER, // Cuppen's divide and conquer
+    TRIDIAG_EIG_DEFAULT             // MRRR if it is available
+};
+}
+using namespace tridiag_eig_alg_wrapper;
+
 // Grab the full set of eigenpairs of the real, symmetric matrix A
 void HermitianEig
 ( UpperOrLower uplo, DistMatrix<double>& A, 
-  DistMatrix<double,VR,STAR>& w, DistMatrix<double>& Z );
+  DistMatrix<double,VR,STAR>& w, DistMatrix<double>& Z,
+  TridiagEigAlg alg=TRIDIAG_EIG_DEFAULT );
 // Grab a partial set of eigenpairs of the real, symmetric n x n matrix A. 
 // The partial set is determined by the inclusive zero-indexed range 
 //   a,a+1,...,b    ; a >= 0, b < n  
@@ -575,32 +679,18 @@ void HermitianEig
 void HermitianEig
 ( UpperOrLower uplo, DistMatrix<double>& A,
   DistMatrix<double,VR,STAR>& w, DistMatrix<double>& Z,
-  int a, int b );
+  int a, int b, TridiagEigAlg alg=TRIDIAG_EIG_DEFAULT );
 // Grab a partial set of eigenpairs of the real, symmetric n x n matrix A. 
 // The partial set is determined by the half-open interval (a,b]
 void HermitianEig
 ( UpperOrLower uplo, DistMatrix<double>& A,
   DistMatrix<double,VR,STAR>& w, DistMatrix<double>& Z,
-  double a, double b );
-// Grab the full set of eigenvalues of the real, symmetric matrix A
-void HermitianEig
-( UpperOrLower uplo, DistMatrix<double>& A, DistMatrix<double,VR,STAR>& w );
-// Grab a partial set of eigenvalues of the real, symmetric n x n matrix A. 
-// The partial set is determined by the inclusive zero-indexed range 
-//   a,a+1,...,b    ; a >= 0, b < n  
-// of the n eigenpairs sorted from smallest to largest eigenvalues.  
-void HermitianEig
-( UpperOrLower uplo, DistMatrix<double>& A, DistMatrix<double,VR,STAR>& w,
-  int a, int b );
-// Grab a partial set of eigenvalues of the real, symmetric n x n matrix A. 
-// The partial set is determined by the half-open interval (a,b]
-void HermitianEig
-( UpperOrLower uplo, DistMatrix<double>& A, DistMatrix<double,VR,STAR>& w,
-  double a, double b );
+  double a, double b, TridiagEigAlg alg=TRIDIAG_EIG_DEFAULT );
 // Grab the full set of eigenpairs of the complex, Hermitian matrix A
 void HermitianEig    
 ( UpperOrLower uplo, DistMatrix<Complex<double> >& A,
-  DistMatrix<double,VR,STAR>& w, DistMatrix<Complex<double> >& Z );
+  DistMatrix<double,VR,STAR>& w, DistMatrix<Complex<double> >& Z,
+  TridiagEigAlg alg=TRIDIAG_EIG_DEFAULT );
 // Grab a partial set of eigenpairs of the complex, Hermitian n x n matrix A. 
 // The partial set is determined by the inclusive zero-indexed range 
 //   a,a+1,...,b    ; a >= 0, b < n  
@@ -608,12 +698,28 @@ void HermitianEig
 void HermitianEig
 ( UpperOrLower uplo, DistMatrix<Complex<double> >& A,
   DistMatrix<double,VR,STAR>& w, DistMatrix<Complex<double> >& Z,
-  int a, int b );
+  int a, int b, TridiagEigAlg alg=TRIDIAG_EIG_DEFAULT );
 // Grab a partial set of eigenpairs of the complex, Hermitian n x n matrix A. 
 // The partial set is determined by the half-open interval (a,b]
 void HermitianEig
 ( UpperOrLower uplo, DistMatrix<Complex<double> >& A,
   DistMatrix<double,VR,STAR>& w, DistMatrix<Complex<double> >& Z,
+  double a, double b, TridiagEigAlg alg=TRIDIAG_EIG_DEFAULT );
+#ifndef WITHOUT_PMRRR
+// Grab the full set of eigenvalues of the real, symmetric matrix A
+void HermitianEig
+( UpperOrLower uplo, DistMatrix<double>& A, DistMatrix<double,VR,STAR>& w );
+// Grab a partial set of eigenvalues of the real, symmetric n x n matrix A. 
+// The partial set is determined by the inclusive zero-indexed range 
+//   a,a+1,...,b    ; a >= 0, b < n  
+// of the n eigenpairs sorted from smallest to largest eigenvalues.  
+void HermitianEig
+( UpperOrLower uplo, DistMatrix<double>& A, DistMatrix<double,VR,STAR>& w,
+  int a, int b );
+// Grab a partial set of eigenvalues of the real, symmetric n x n matrix A. 
+// The partial set is determined by the half-open interval (a,b]
+void HermitianEig
+( UpperOrLower uplo, DistMatrix<double>& A, DistMatrix<double,VR,STAR>& w,
   double a, double b );
 // Grab the full set of eigenvalues of the complex, Hermitian matrix A
 void HermitianEig
@@ -635,6 +741,23 @@ void HermitianEig
   double a, double b );
 #endif // WITHOUT_PMRRR
 
+//
+// HermitianTridiagEig (Hermitian tridiagonal eigensolver)
+//
+// Computes the full set of eigenpairs of the real symmetric tridiagonal 
+// matrix with diagonal d and subdiagonal e using Cuppen's divide and conquer.
+// Each merge deflates the rank-one update, solves the secular equation 
+// redundantly, and then updates the [MC,MR] eigenvectors with two Gemm's.
+// Subproblems of size at most Blocksize() are solved by every process with
+// LAPACK. The eigenvalues are returned in ascending order.
+//
+template<typename R>
+void HermitianTridiagEig
+( const DistMatrix<R,STAR,STAR>& d,
+  const DistMatrix<R,STAR,STAR>& e,
+  DistMatrix<R,VR,STAR>& w,
+  DistMatrix<R>& Z );
+
 //
 // SortEig
 //
@@ -978,6 +1101,57 @@ void SingularValues
   DistMatrix<typename Base<F>::type,VR,STAR>& s,
   double heightRatio=1.2 );
 
+//
+// RandomizedRangeFinder: Overwrite Q with an orthonormal basis for the 
+//                        approximate range of A formed from A applied to 
+//                        numColumns Gaussian random vectors, followed by 
+//                        numPowerIts applications of A A^H
+//
+// AdaptiveRangeFinder: Grow the orthonormal basis Q in blocks of blocksize 
+//                      random samples until, with probability at least 
+//                      1 - 10^(-blocksize), ||(I - Q Q^H) A||_2 <= tol, or 
+//                      until Q has maxColumns columns (0 means min(m,n))
+//
+template<typename F>
+void RandomizedRangeFinder
+( const DistMatrix<F>& A, DistMatrix<F>& Q, 
+  int numColumns, int numPowerIts=1 );
+template<typename F>
+void AdaptiveRangeFinder
+( const DistMatrix<F>& A, DistMatrix<F>& Q,
+  typename Base<F>::type tol, int maxColumns=0, 
+  int blocksize=10, int numPowerIts=1 );
+
+//
+// RandomizedSVD: Find the leading rank singular triplets of A, 
+//                A ~= U diag(s) V^H, from the SVD of the projection of A 
+//                onto a random subspace of dimension rank+oversample. The 
+//                accuracy improves with both the amount of oversampling and 
+//                the number of power iterations, the latter being important
+//                when the singular values of A decay slowly.
+//
+// AdaptiveRandomizedSVD: Instead choose the rank so that, with high 
+//                        probability, ||A - U diag(s) V^H||_2 <= 2 tol and 
+//                        every returned singular value exceeds tol
+//
+// Note: Unlike SVD, A is left unchanged.
+//
+template<typename F>
+void RandomizedSVD
+( const DistMatrix<F>& A, 
+  DistMatrix<F>& U,
+  DistMatrix<typename Base<F>::type,VR,STAR>& s, 
+  DistMatrix<F>& V,
+  int rank, int oversample=10, int numPowerIts=1 );
+template<typename F>
+void AdaptiveRandomizedSVD
+( const DistMatrix<F>& A, 
+  DistMatrix<F>& U,
+  DistMatrix<typename Base<F>::type,VR,STAR>& s, 
+  DistMatrix<F>& V,
+  typename Base<F>::type tol, int maxRank=0, 
+  int blocksize=10, int numPowerIts=1 );
+
 //
 // Pseudoinverse:
 //
@@ -1192,6 +1366,154 @@ void ExpandPackedReflectors
   int offset,
   DistMatrix<Complex<R> >& H, const DistMatrix<Complex<R>,STAR,STAR>& t );
 
+//----------------------------------------------------------------------------//
+// Batched routines for many small, independent matrices                      //
+//----------------------------------------------------------------------------//
+
+//
+// AttachBatch:
+//
+// Resize 'storage' to height x (batchSize*width) and make batch[k] a view of 
+// its k'th block of columns, so that the entire batch is contiguous. The views
+// are invalidated if 'storage' is resized or freed.
+//
+
+template<typename T>
+void AttachBatch
+( int batchSize, int height, int width, 
+  Matrix<T>& storage, std::vector<Matrix<T> >& batch );
+
+//
+// AllGatherBatch:
+//
+// Give every process of 'comm' the entire batch, where each process holds 
+// the portion ALocal, and the portions are ordered by rank. The exchange is 
+// performed in rounds of bounded size, so the batch may hold more than 2^31 
+// entries in total.
+//
+
+template<typename T>
+void AllGatherBatch
+( const std::vector<Matrix<T> >& ALocal, std::vector<Matrix<T> >& A,
+  mpi::Comm comm );
+
+//
+// Each of the following routines performs the sequential routine of the same
+// name on every member of the batch, calling BLAS and LAPACK directly and 
+// spreading the members over the OpenMP threads. Outputs which are views 
+// (e.g., from AttachBatch) must already be the correct size; all others are 
+// resized. If any member fails (e.g., it is not HPD), the rest of the batch 
+// is still processed before an exception naming the first failure is thrown.
+//
+// In the versions which accept a communicator, each process holds only its 
+// own, contiguous portion of the batch, with the portions ordered by rank. 
+// Only the first failure is agreed upon (and named by its index within the 
+// entire batch); the results stay with the process which computed them unless
+// they are explicitly combined with AllGatherBatch.
+//
+// The pivots from BatchedLU are zero-based, as in LU(A,p), and BatchedQR 
+// returns the Householder scalars in t for both real and complex matrices, 
+// following LAPACK's xGEQRF (and therefore QR(A,t), except that a column 
+// which is already reduced yields tau=0 rather than tau=2).
+//
+
+template<typename F>
+void BatchedCholesky( UpperOrLower uplo, std::vector<Matrix<F> >& A );
+template<typename F>
+void BatchedCholesky
+( UpperOrLower uplo, std::vector<Matrix<F> >& A, mpi::Comm comm );
+
+template<typename F>
+void BatchedLU( std::vector<Matrix<F> >& A, std::vector<Matrix<int> >& p );
+template<typename F>
+void BatchedLU
+( std::vector<Matrix<F> >& A, std::vector<Matrix<int> >& p, mpi::Comm comm );
+
+template<typename F>
+void BatchedQR( std::vector<Matrix<F> >& A, std::vector<Matrix<F> >& t );
+template<typename F>
+void BatchedQR
+( std::vector<Matrix<F> >& A, std::vector<Matrix<F> >& t, mpi::Comm comm );
+
+// Compute the eigenvalues, in ascending order, of each Hermitian member of 
+// the batch, which is overwritten
+template<typename F>
+void BatchedHermitianEig
+( UpperOrLower uplo, std::vector<Matrix<F> >& A,
+  std::vector<Matrix<typename Base<F>::type> >& w );
+template<typename F>
+void BatchedHermitianEig
+( UpperOrLower uplo, std::vector<Matrix<F> >& A,
+  std::vector<Matrix<typename Base<F>::type> >& w, mpi::Comm comm );
+// Also compute the eigenvectors, in which case A is left unchanged
+template<typename F>
+void BatchedHermitianEig
+( UpperOrLower uplo, const std::vector<Matrix<F> >& A,
+  std::vector<Matrix<typename Base<F>::type> >& w,
+  std::vector<Matrix<F> >& Z );
+template<typename F>
+void BatchedHermitianEig
+( UpperOrLower uplo, const std::vector<Matrix<F> >& A,
+  std::vector<Matrix<typename Base<F>::type> >& w,
+  std::vector<Matrix<F> >& Z, mpi::Comm comm );
+
+template<typename T>
+void BatchedGemm
+( Orientation orientationOfA, Orientation orientationOfB,
+  T alpha, const std::vector<Matrix<T> >& A,
+           const std::vector<Matrix<T> >& B,
+  T beta,        std::vector<Matrix<T> >& C );
+template<typename T>
+void BatchedGemm
+( Orientation orientationOfA, Orientation orientationOfB,
+  T alpha, const std::vector<Matrix<T> >& A,
+           const std::vector<Matrix<T> >& B,
+  T beta,        std::vector<Matrix<T> >& C, mpi::Comm comm );
+
+template<typename F>
+void BatchedTrsm
+( LeftOrRight side, UpperOrLower uplo,
+  Orientation orientation, UnitOrNonUnit diag,
+  F alpha, const std::vector<Matrix<F> >& A, std::vector<Matrix<F> >& B );
+template<typename F>
+void BatchedTrsm
+( LeftOrRight side, UpperOrLower uplo,
+  Orientation orientation, UnitOrNonUnit diag,
+  F alpha, const std::vector<Matrix<F> >& A, std::vector<Matrix<F> >& B,
+  mpi::Comm comm );
+
+//----------------------------------------------------------------------------//
+// Out-of-core routines for matrices stored on disk                           //
+//----------------------------------------------------------------------------//
+
+//
+// Each of the following routines performs the distributed routine of the same
+// name on matrices which are kept in DiskMatrix stores (which must be 
+// distinct and over the same grid), so that only a few blocks of each 
+// operand are in memory at once. The blocks are the tiles of the output 
+// (and the same size along the inner dimension), they are passed through the
+// in-core distributed routines, and the next block of each streamed operand 
+// is read in the background while the current one is being used. 
+//
+// OutOfCoreHerk and OutOfCoreCholesky only access the 'uplo' triangle of C 
+// and A, as with Herk and Cholesky. If A is not HPD, the columns (or rows) 
+// which were already factored are left overwritten.
+//
+
+template<typename T>
+void OutOfCoreGemm
+( Orientation orientationOfA, Orientation orientationOfB,
+  T alpha, const DiskMatrix<T>& A, const DiskMatrix<T>& B,
+  T beta,        DiskMatrix<T>& C );
+
+template<typename T>
+void OutOfCoreHerk
+( UpperOrLower uplo, Orientation orientation,
+  T alpha, const DiskMatrix<T>& A, T beta, DiskMatrix<T>& C );
+
+template<typename F>
+void OutOfCoreCholesky( UpperOrLower uplo, DiskMatrix<F>& A );
+
 //----------------------------------------------------------------------------//
 // Tuning parameters                                                          //
 //----------------------------------------------------------------------------//
@@ -1201,7 +1523,8 @@ enum HermitianTridiagApproach
 {
     HERMITIAN_TRIDIAG_NORMAL, // Keep the current grid
     HERMITIAN_TRIDIAG_SQUARE, // Drop to a square process grid
-    HERMITIAN_TRIDIAG_DEFAULT // Square grid algorithm only if already square
+    HERMITIAN_TRIDIAG_DEFAULT, // Square grid algorithm only if already square
+    HERMITIAN_TRIDIAG_TWO_STAGE // Reduce to a band, then chase the bulges
 };
 }
 using namespace hermitian_tridiag_approach_wrapper;
@@ -1215,4 +1538,88 @@ HermitianTridiagApproach GetHermitianTridiagApproach();
 void SetHermitianTridiagGridOrder( GridOrder order );
 GridOrder GetHermitianTridiagGridOrder();
 
+// The eigenpair routines of HermitianEig which compute a subset of the 
+// spectrum with PMRRR may split the requested eigenpairs into slices with 
+// numbers of eigenvalues proportional to the sizes of their subgrids (value
+// ranges are first converted to index ranges with Sturm counts), and then 
+// solve and backtransform each slice on an independent subgrid, which holds
+// its own copy of the Householder transforms.
+// Setting the number of slices to one (the default) disables slicing.
+void SetHermitianEigNumSlices( int numSlices );
+int GetHermitianEigNumSlices();
+
+namespace lu_pivoting_wrapper {
+enum LUPivoting
+{
+    LU_PARTIAL_PIVOTING,   // Search for each pivot within its panel column
+    LU_TOURNAMENT_PIVOTING // Choose all of the pivots of a panel at once
+};
+}
+using namespace lu_pivoting_wrapper;
+
+// Tournament pivoting (as in communication-avoiding LU) selects the pivot rows
+// of each panel with a reduction tree over the entire process grid, so that
+// a panel requires O(log p) messages rather than O(nb log r). The pivots are
+// returned in the same format as with partial pivoting.
+void SetLUPivoting( LUPivoting pivoting );
+LUPivoting GetLUPivoting();
+
+namespace qr_approach_wrapper {
+enum QRApproach
+{
+    QR_HOUSEHOLDER, // Compute one Householder reflector per panel column
+    QR_CAQR         // Factor each panel with TSQR
+};
+}
+using namespace qr_approach_wrapper;
+
+// The communication-avoiding approach factors each panel of the distributed
+// QR with TSQR and then reconstructs its Householder vectors, so that the
+// output (and the trailing update) is the same as for QR_HOUSEHOLDER
+void SetQRApproach( QRApproach approach );
+QRApproach GetQRApproach();
+
+namespace bidiag_approach_wrapper {
+enum BidiagApproach
+{
+    BIDIAG_NORMAL,   // Reduce directly to bidiagonal form
+    BIDIAG_TWO_STAGE // Reduce to an upper band, then chase the bulges
+};
+}
+using namespace bidiag_approach_wrapper;
+
+// The two-stage approach only applies to matrices which are at least as tall
+// as they are wide, and only the SVD routines use it, since they keep the 
+// second-stage transforms for backtransforming the singular vectors.
+void SetBidiagApproach( BidiagApproach approach );
+BidiagApproach GetBidiagApproach();
+
+namespace bidiag_svd_approach_wrapper {
+enum BidiagSVDApproach
+{
+    BIDIAG_SVD_QR,                  // Redundant QR algorithm on each process
+    BIDIAG_SVD_MRRR,                // PMRRR on the Golub-Kahan tridiagonal
+    BIDIAG_SVD_DIVIDE_AND_CONQUER,  // Divide and conquer on the same matrix
+    BIDIAG_SVD_DEFAULT              // MRRR if it is available
+};
+}
+using namespace bidiag_svd_approach_wrapper;
+
+// The singular vectors of the bidiagonal matrix computed within the parallel 
+// SVD are either found by every process running the QR algorithm on the 
+// entire problem, or by distributing the eigenvectors of the 2k x 2k 
+// Golub-Kahan tridiagonal matrix, which are interleavings of the left and 
+// right singular vectors. If the two halves of any eigenvector cannot be 
+// cleanly separated (e.g., due to multiple zero singular values), then the 
+// QR algorithm is used instead.
+void SetBidiagSVDApproach( BidiagSVDApproach approach );
+BidiagSVDApproach GetBidiagSVDApproach();
+
+// The sequential Cholesky, LU (without pivoting), and QR factorizations of
+// matrices whose dimensions both exceed the tile size are run as a graph of
+// OpenMP tasks over tiles of this size when more than one thread is available
+// (and OpenMP supports task dependencies). A tile size of zero disables this.
+void SetLocalTileSize( int tileSize );
+int GetLocalTileSize();
+
 } // namespace elem
@@ -11,6 +11,7 @@
 #include "./lapack-like/ApplyPackedReflectors.hpp"
 #include "./lapack-like/ApplyColumnPivots.hpp"
 #include "./lapack-like/ApplyRowPivots.hpp"
+#include "./lapack-like/Batched.hpp"
 #include "./lapack-like/Bidiag.hpp"
 #include "./lapack-like/Cholesky.hpp"
 #include "./lapack-like/CholeskySolve.hpp"
@@ -31,6 +32,7 @@
 #include "./lapack-like/HermitianQDWH.hpp"
 #include "./lapack-like/HermitianSVD.hpp"
 #include "./lapack-like/HermitianTridiag.hpp"
+#include "./lapack-like/HermitianTridiagEig.hpp"
 #include "./lapack-like/HilbertSchmidt.hpp"
 #include "./lapack-like/HouseholderSolve.hpp"
 #include "./lapack-like/HPDDeterminant.hpp"
@@ -44,14 +46,18 @@
 #include "./lapack-like/LQ.hpp"
 #include "./lapack-like/LU.hpp"
 #include "./lapack-like/Norm.hpp"
+#include "./lapack-like/OutOfCore.hpp"
 #include "./lapack-like/PivotParity.hpp"
 #include "./lapack-like/Polar.hpp"
 #include "./lapack-like/Pseudoinverse.hpp"
 #include "./lapack-like/QDWH.hpp"
 #include "./lapack-like/QR.hpp"
+#include "./lapack-like/RandomizedSVD.hpp"
+#include "./lapack-like/RefinedSolve.hpp"
 #include "./lapack-like/Reflector.hpp"
 #include "./lapack-like/SkewHermitianEig.hpp"
 #include "./lapack-like/SolveAfterCholesky.hpp"
+#include "./lapack-like/SolveAfterLDL.hpp"
 #include "./lapack-like/SolveAfterLU.hpp"
 #include "./lapack-like/SortEig.hpp"
 #include "./lapack-like/SymmetricNorm.hpp"
@@ -0,0 +1,108 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace elem {
+
+// Draw each entry from a normal PDF with the given mean and standard deviation
+template<typename T>
+inline void
+MakeGaussian( Matrix<T>& A, T mean, typename Base<T>::type stddev )
+{
+#ifndef RELEASE
+    PushCallStack("MakeGaussian");
+#endif
+    const int m = A.Height();
+    const int n = A.Width();
+    for( int j=0; j<n; ++j )
+        for( int i=0; i<m; ++i )
+            A.Set( i, j, mean+stddev*SampleNormal<T>() );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename T>
+inline void
+Gaussian
+( int m, int n, Matrix<T>& A, T mean, typename Base<T>::type stddev )
+{
+#ifndef RELEASE
+    PushCallStack("Gaussian");
+#endif
+    A.ResizeTo( m, n );
+    MakeGaussian( A, mean, stddev );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+namespace internal {
+
+// Every entry of an [MC,MR] matrix is owned by exactly one process, so each
+// process can sample its local entries independently. All other
+// distributions are handled by redistributing such a matrix, which keeps
+// any replicated entries consistent.
+template<typename T,Distribution U,Distribution V>
+struct MakeGaussianHelper
+{
+    static void Func
+    ( DistMatrix<T,U,V>& A, T mean, typename Base<T>::type stddev )
+    {
+        DistMatrix<T> B( A.Height(), A.Width(), A.Grid() );
+        MakeGaussianHelper<T,MC,MR>::Func( B, mean, stddev );
+        A = B;
+    }
+};
+
+template<typename T>
+struct MakeGaussianHelper<T,MC,MR>
+{
+    static void Func
+    ( DistMatrix<T,MC,MR>& A, T mean, typename Base<T>::type stddev )
+    {
+        const int localHeight = A.LocalHeight();
+        const int localWidth = A.LocalWidth();
+        for( int jLocal=0; jLocal<localWidth; ++jLocal )
+            for( int iLocal=0; iLocal<localHeight; ++iLocal )
+                A.SetLocal( iLocal, jLocal, mean+stddev*SampleNormal<T>() );
+    }
+};
+
+} // namespace internal
+
+template<typename T,Distribution U,Distribution V>
+inline void
+MakeGaussian
+( DistMatrix<T,U,V>& A, T mean, typename Base<T>::type stddev )
+{
+#ifndef RELEASE
+    PushCallStack("MakeGaussian");
+#endif
+    internal::MakeGaussianHelper<T,U,V>::Func( A, mean, stddev );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename T,Distribution U,Distribution V>
+inline void
+Gaussian
+( int m, int n, DistMatrix<T,U,V>& A, T mean, typename Base<T>::type stddev )
+{
+#ifndef RELEASE
+    PushCallStack("Gaussian");
+#endif
+    A.ResizeTo( m, n );
+    MakeGaussian( A, mean, stddev );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+} // namespace elem
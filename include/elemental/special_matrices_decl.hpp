@@ -246,6 +246,22 @@ template<typename R,Distribution U,Distribution V>
 void MakeNormalUniformSpectrum
 ( DistMatrix<Complex<R>,U,V>& A, Complex<R> center=0, R radius=1 );
 
-// TODO: Gaussian random matrices
+// Draw each entry from a normal PDF with the specified mean and standard 
+// deviation
+template<typename T>
+void Gaussian
+( int m, int n, Matrix<T>& A, 
+  T mean=0, typename Base<T>::type stddev=1 );
+template<typename T,Distribution U,Distribution V>
+void Gaussian
+( int m, int n, DistMatrix<T,U,V>& A, 
+  T mean=0, typename Base<T>::type stddev=1 );
+// Turn the existing matrix into a Gaussian random matrix
+template<typename T>
+void MakeGaussian
+( Matrix<T>& A, T mean=0, typename Base<T>::type stddev=1 );
+template<typename T,Distribution U,Distribution V>
+void MakeGaussian
+( DistMatrix<T,U,V>& A, T mean=0, typename Base<T>::type stddev=1 );
 
 } // namespace elem
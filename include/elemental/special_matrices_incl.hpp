@@ -31,8 +31,7 @@
 // Random
 //
 
+#include "./special_matrices/Gaussian.hpp"
 #include "./special_matrices/Uniform.hpp"
 #include "./special_matrices/HermitianUniformSpectrum.hpp"
 #include "./special_matrices/NormalUniformSpectrum.hpp"
-
-// TODO: Gaussian
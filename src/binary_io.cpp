@@ -0,0 +1,113 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "elemental.hpp"
+#ifdef HAVE_PREAD
+# include <cerrno>
+# include <fcntl.h>
+# include <sys/stat.h>
+# include <unistd.h>
+#endif
+
+namespace elem {
+
+#ifdef HAVE_PREAD
+
+BinaryFile::BinaryFile( std::string filename )
+: filename_(filename)
+{
+#ifndef RELEASE
+    PushCallStack("BinaryFile::BinaryFile");
+#endif
+    descriptor_ = open( filename.c_str(), O_RDONLY );
+    if( descriptor_ < 0 )
+        throw std::runtime_error
+        ("Could not open "+filename+": "+std::strerror(errno));
+    struct stat status;
+    if( fstat( descriptor_, &status ) != 0 )
+    {
+        close( descriptor_ );
+        throw std::runtime_error
+        ("Could not query "+filename+": "+std::strerror(errno));
+    }
+    size_ = status.st_size;
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+BinaryFile::~BinaryFile()
+{ close( descriptor_ ); }
+
+void
+BinaryFile::Read( byte* buffer, std::size_t numBytes, long long offset )
+{
+#ifndef RELEASE
+    PushCallStack("BinaryFile::Read");
+#endif
+    // pread may return fewer bytes than requested, e.g., when interrupted
+    while( numBytes > 0 )
+    {
+        const ssize_t numRead = pread( descriptor_, buffer, numBytes, offset );
+        if( numRead < 0 && errno == EINTR )
+            continue;
+        if( numRead < 0 )
+            throw std::runtime_error
+            ("Could not read "+filename_+": "+std::strerror(errno));
+        if( numRead == 0 )
+            throw std::runtime_error(filename_+": unexpected end of file");
+        buffer += numRead;
+        numBytes -= numRead;
+        offset += numRead;
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+#else // ifdef HAVE_PREAD
+
+BinaryFile::BinaryFile( std::string filename )
+: filename_(filename), stream_(filename.c_str(), std::ios::binary)
+{
+#ifndef RELEASE
+    PushCallStack("BinaryFile::BinaryFile");
+#endif
+    if( !stream_.is_open() )
+        throw std::runtime_error("Could not open "+filename);
+    stream_.seekg( 0, std::ios::end );
+    size_ = stream_.tellg();
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+BinaryFile::~BinaryFile()
+{ }
+
+void
+BinaryFile::Read( byte* buffer, std::size_t numBytes, long long offset )
+{
+#ifndef RELEASE
+    PushCallStack("BinaryFile::Read");
+#endif
+    stream_.seekg( offset );
+    if( !stream_.read( (char*)buffer, numBytes ) )
+        throw std::runtime_error(filename_+": unexpected end of file");
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+#endif // ifdef HAVE_PREAD
+
+long long
+BinaryFile::Size() const
+{ return size_; }
+
+} // namespace elem
@@ -0,0 +1,234 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "elemental.hpp"
+
+namespace {
+
+using namespace elem;
+
+// Rough defaults for a commodity cluster: 5 microsecond latency, 1 GB/s of
+// bandwidth, and a local Gemm which runs at 5 GFlops
+const double defaultLatency = 5e-6;
+const double defaultSecondsPerByte = 1e-9;
+const double defaultSecondsPerFlop = 2e-10;
+
+// The cost models are keyed on the shape of the process grid
+std::map<std::pair<int,int>,GemmCostModel> costModels;
+
+bool gemmAutotuning = false;
+std::string gemmTuningFile;
+std::map<std::string,GemmAlgorithm> gemmTunings;
+
+const char* AlgorithmName( GemmAlgorithm alg )
+{
+    switch( alg )
+    {
+    case GEMM_SUMMA_A:   return "A";
+    case GEMM_SUMMA_B:   return "B";
+    case GEMM_SUMMA_C:   return "C";
+    case GEMM_SUMMA_DOT: return "Dot";
+    default:             return "Default";
+    }
+}
+
+bool AlgorithmFromName( const std::string& name, GemmAlgorithm& alg )
+{
+    if( name == "A" )
+        alg = GEMM_SUMMA_A;
+    else if( name == "B" )
+        alg = GEMM_SUMMA_B;
+    else if( name == "C" )
+        alg = GEMM_SUMMA_C;
+    else if( name == "Dot" )
+        alg = GEMM_SUMMA_DOT;
+    else
+        return false;
+    return true;
+}
+
+// Each line of a tuning file holds a key followed by the name of its winner,
+// and later lines take precedence over earlier ones
+void ParseTunings( const std::string& contents )
+{
+    std::istringstream stream( contents );
+    std::string line;
+    while( std::getline( stream, line ) )
+    {
+        const std::size_t lastSpace = line.rfind( ' ' );
+        if( line.empty() || line[0] == '#' || lastSpace == std::string::npos )
+            continue;
+        GemmAlgorithm alg;
+        if( AlgorithmFromName( line.substr(lastSpace+1), alg ) )
+            ::gemmTunings[line.substr(0,lastSpace)] = alg;
+    }
+}
+
+} // anonymous namespace
+
+namespace elem {
+
+void SetGemmCostModel( const Grid& g, const GemmCostModel& model )
+{ ::costModels[std::make_pair(g.Height(),g.Width())] = model; }
+
+GemmCostModel GetGemmCostModel( const Grid& g )
+{
+    std::map<std::pair<int,int>,GemmCostModel>::const_iterator it =
+        ::costModels.find( std::make_pair(g.Height(),g.Width()) );
+    if( it != ::costModels.end() )
+        return it->second;
+    GemmCostModel model;
+    model.latency = defaultLatency;
+    model.secondsPerByte = defaultSecondsPerByte;
+    model.secondsPerFlop = defaultSecondsPerFlop;
+    return model;
+}
+
+GemmCostModel CalibrateGemmCostModel( const Grid& g )
+{
+#ifndef RELEASE
+    PushCallStack("CalibrateGemmCostModel");
+#endif
+    const int p = g.Size();
+    const mpi::Comm comm = g.Comm();
+    const int numTrials = 10;
+    GemmCostModel model = GetGemmCostModel( g );
+
+    // Time a local Gemm which is large enough to run near the peak rate
+    const int n = 256;
+    std::vector<double> A( n*n, 1 ), B( n*n, 1 ), C( n*n, 0 );
+    blas::Gemm
+    ( 'N', 'N', n, n, n, 1., &A[0], n, &B[0], n, 0., &C[0], n );
+    double startTime = mpi::Time();
+    blas::Gemm
+    ( 'N', 'N', n, n, n, 1., &A[0], n, &B[0], n, 0., &C[0], n );
+    model.secondsPerFlop = (mpi::Time()-startTime) / (2.*n*n*n);
+
+    if( p > 1 )
+    {
+        double logSize = 0;
+        for( int q=1; q<p; q*=2 )
+            ++logSize;
+
+        // Tiny AllGathers are dominated by latency
+        std::vector<double> sendBuf( 1, 0 ), recvBuf( p );
+        mpi::Barrier( comm );
+        startTime = mpi::Time();
+        for( int trial=0; trial<numTrials; ++trial )
+            mpi::AllGather( &sendBuf[0], 1, &recvBuf[0], 1, comm );
+        const double smallTime = (mpi::Time()-startTime) / numTrials;
+        model.latency = smallTime / logSize;
+
+        // Large AllGathers are dominated by bandwidth
+        const int localSize = 1<<16;
+        sendBuf.resize( localSize );
+        recvBuf.resize( p*localSize );
+        mpi::Barrier( comm );
+        startTime = mpi::Time();
+        for( int trial=0; trial<numTrials; ++trial )
+            mpi::AllGather
+            ( &sendBuf[0], localSize, &recvBuf[0], localSize, comm );
+        const double largeTime = (mpi::Time()-startTime) / numTrials;
+        const double numBytes = (p-1.)*localSize*sizeof(double);
+        model.secondsPerByte =
+            std::max( largeTime-smallTime, smallTime ) / numBytes;
+    }
+
+    // Every process must make the same choices, so use the slowest rates
+    double localParams[3] =
+        { model.latency, model.secondsPerByte, model.secondsPerFlop };
+    double params[3];
+    mpi::AllReduce( localParams, params, 3, mpi::MAX, comm );
+    model.latency = params[0];
+    model.secondsPerByte = params[1];
+    model.secondsPerFlop = params[2];
+    SetGemmCostModel( g, model );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+    return model;
+}
+
+void SetGemmAutotuning( bool autotune )
+{ ::gemmAutotuning = autotune; }
+
+bool GemmAutotuning()
+{ return ::gemmAutotuning; }
+
+void SetGemmTuningFile( std::string filename )
+{
+#ifndef RELEASE
+    PushCallStack("SetGemmTuningFile");
+#endif
+    ::gemmTuningFile = filename;
+
+    // Read the file from a single process so that all processes agree
+    std::string contents;
+    const int commRank = mpi::CommRank( mpi::COMM_WORLD );
+    if( commRank == 0 && filename != "" )
+    {
+        std::ifstream file( filename.c_str() );
+        if( file.is_open() )
+        {
+            std::ostringstream stream;
+            stream << file.rdbuf();
+            contents = stream.str();
+        }
+    }
+    int size = contents.size();
+    mpi::Broadcast( &size, 1, 0, mpi::COMM_WORLD );
+    std::vector<byte> buffer( std::max(size,1) );
+    if( commRank == 0 )
+        std::memcpy( &buffer[0], contents.data(), size );
+    mpi::Broadcast( &buffer[0], size, 0, mpi::COMM_WORLD );
+    ParseTunings( std::string( (const char*)&buffer[0], size ) );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+std::string GemmTuningFile()
+{ return ::gemmTuningFile; }
+
+void ClearGemmTuning()
+{ ::gemmTunings.clear(); }
+
+namespace internal {
+
+bool FindGemmTuning( const std::string& key, GemmAlgorithm& alg )
+{
+    std::map<std::string,GemmAlgorithm>::const_iterator it =
+        ::gemmTunings.find( key );
+    if( it == ::gemmTunings.end() )
+        return false;
+    alg = it->second;
+    return true;
+}
+
+void RecordGemmTuning( const std::string& key, GemmAlgorithm alg, bool root )
+{
+#ifndef RELEASE
+    PushCallStack("internal::RecordGemmTuning");
+#endif
+    ::gemmTunings[key] = alg;
+    if( root && ::gemmTuningFile != "" )
+    {
+        // Appending a single line allows several grids to share one file
+        std::ofstream file
+        ( ::gemmTuningFile.c_str(), std::ios::out | std::ios::app );
+        if( !file.is_open() )
+            throw std::runtime_error("Could not open Gemm tuning file");
+        file << key << " " << AlgorithmName( alg ) << std::endl;
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+} // namespace internal
+} // namespace elem
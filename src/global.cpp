@@ -42,10 +42,23 @@ int localTrrkDoubleBlocksize = 64;
 int localTrrkComplexFloatBlocksize = 64;
 int localTrrkComplexDoubleBlocksize = 64;
 
+bool gemmPipelining = false;
+
+// Blocksizes tuned for particular routines, datatypes, and grid shapes, along
+// with the stack of the registered routines which are currently active
+std::map<std::string,int> blocksizeRegistry;
+std::vector<std::string> tunedRoutines;
+
 // Tuning parameters for advanced routines
 using namespace elem;
 HermitianTridiagApproach tridiagApproach = HERMITIAN_TRIDIAG_DEFAULT;
 GridOrder gridOrder = ROW_MAJOR;
+int hermitianEigNumSlices = 1;
+LUPivoting luPivoting = LU_PARTIAL_PIVOTING;
+QRApproach qrApproach = QR_HOUSEHOLDER;
+BidiagApproach bidiagApproach = BIDIAG_NORMAL;
+BidiagSVDApproach bidiagSVDApproach = BIDIAG_SVD_DEFAULT;
+int localTileSize = 128;
 }
 
 namespace elem {
@@ -96,6 +109,11 @@ void Initialize( int& argc, char**& argv )
         ::blocksizeStack.pop();
     ::blocksizeStack.push( 128 );
 
+    // Load the tuned blocksizes, if they were requested
+    const char* blocksizeFile = std::getenv( "ELEM_BLOCKSIZE_FILE" );
+    if( blocksizeFile != 0 )
+        LoadBlocksizeRegistry( blocksizeFile );
+
     // Build the default grid
     defaultGrid = new Grid( mpi::COMM_WORLD );
 
@@ -105,6 +123,10 @@ void Initialize( int& argc, char**& argv )
     internal::CreatePivotOp<Complex<float> >();
     internal::CreatePivotOp<Complex<double> >();
 
+    // Build the reduction operation needed by the fused norms
+    internal::CreateScaledSquareOp<float>();
+    internal::CreateScaledSquareOp<double>();
+
     // Seed the parallel random number generator, PLCG
     plcg::UInt64 seed;
     seed.d[0] = time(0);
@@ -143,6 +165,10 @@ void Finalize()
             internal::DestroyPivotOp<Complex<float> >();
             internal::DestroyPivotOp<Complex<double> >();
 
+            // Destroy the reduction operation needed by the fused norms
+            internal::DestroyScaledSquareOp<float>();
+            internal::DestroyScaledSquareOp<double>();
+
             // Delete the default grid
             delete ::defaultGrid;
             ::defaultGrid = 0;
@@ -154,6 +180,9 @@ void Finalize()
         ::defaultGrid = 0;
         while( ! ::blocksizeStack.empty() )
             ::blocksizeStack.pop();
+
+        // Return the cached buffers to the system
+        ReleaseMemoryPool();
     }
 #ifndef RELEASE
     PopCallStack();
@@ -179,6 +208,176 @@ void PushBlocksizeStack( int blocksize )
 void PopBlocksizeStack()
 { ::blocksizeStack.pop(); }
 
+template<typename T>
+char DataTypeChar()
+{
+    typedef typename Base<T>::type R;
+    if( std::numeric_limits<R>::is_integer )
+        return 'i';
+    else if( sizeof(R) == sizeof(float) )
+        return ( IsComplex<T>::val ? 'c' : 's' );
+    else
+        return ( IsComplex<T>::val ? 'z' : 'd' );
+}
+
+template<typename T>
+std::string BlocksizeKey( std::string routine, const Grid& g )
+{
+    std::ostringstream key;
+    key << routine << " " << DataTypeChar<T>() << " "
+        << g.Height() << " " << g.Width();
+    return key.str();
+}
+
+template<typename T>
+int Blocksize( std::string routine, const Grid& g )
+{
+    std::map<std::string,int>::const_iterator it =
+        ::blocksizeRegistry.find( BlocksizeKey<T>( routine, g ) );
+    return ( it == ::blocksizeRegistry.end() ? Blocksize() : it->second );
+}
+
+template<typename T>
+void SetBlocksize( std::string routine, const Grid& g, int blocksize )
+{
+#ifndef RELEASE
+    PushCallStack("SetBlocksize");
+    if( blocksize < 1 )
+        throw std::logic_error("Blocksizes must be positive");
+    PopCallStack();
+#endif
+    ::blocksizeRegistry[BlocksizeKey<T>( routine, g )] = blocksize;
+}
+
+template<typename T>
+void PushBlocksizeStack( std::string routine, const Grid& g )
+{
+    // The outermost registered routine determines the blocksize
+    if( ::tunedRoutines.empty() )
+        PushBlocksizeStack( Blocksize<T>( routine, g ) );
+    else
+        PushBlocksizeStack( Blocksize() );
+    ::tunedRoutines.push_back( routine );
+}
+
+void PopBlocksizeStack( std::string routine )
+{
+#ifndef RELEASE
+    PushCallStack("PopBlocksizeStack");
+    if( ::tunedRoutines.empty() || ::tunedRoutines.back() != routine )
+        throw std::logic_error("Mismatched registered blocksize push and pop");
+    PopCallStack();
+#endif
+    ::tunedRoutines.pop_back();
+    PopBlocksizeStack();
+}
+
+StackDepths GetStackDepths()
+{
+    StackDepths depths;
+#ifndef RELEASE
+    depths.callStack = ::callStack.size();
+#else
+    depths.callStack = 0;
+#endif
+    depths.profileRegions = ProfileRegionDepth();
+    depths.blocksizeStack = ::blocksizeStack.size();
+    depths.tunedRoutines = ::tunedRoutines.size();
+    return depths;
+}
+
+void RestoreStackDepths( const StackDepths& depths )
+{
+#ifndef RELEASE
+    while( (int)::callStack.size() > depths.callStack )
+        ::callStack.pop();
+#endif
+    for( int k=ProfileRegionDepth(); k>depths.profileRegions; --k )
+        PopProfileRegion();
+    while( (int)::blocksizeStack.size() > depths.blocksizeStack )
+        ::blocksizeStack.pop();
+    if( (int)::tunedRoutines.size() > depths.tunedRoutines )
+        ::tunedRoutines.resize( depths.tunedRoutines );
+}
+
+void ClearBlocksizeRegistry()
+{ ::blocksizeRegistry.clear(); }
+
+void LoadBlocksizeRegistry( std::string filename )
+{
+#ifndef RELEASE
+    PushCallStack("LoadBlocksizeRegistry");
+#endif
+    // Read the file from a single process so that all processes agree
+    std::string contents;
+    const int commRank = mpi::CommRank( mpi::COMM_WORLD );
+    int size = 0;
+    if( commRank == 0 )
+    {
+        std::ifstream file( filename.c_str() );
+        if( file.is_open() )
+        {
+            std::ostringstream stream;
+            stream << file.rdbuf();
+            contents = stream.str();
+            size = contents.size();
+        }
+        else
+            size = -1;
+    }
+    mpi::Broadcast( &size, 1, 0, mpi::COMM_WORLD );
+    if( size < 0 )
+        throw std::runtime_error("Could not open blocksize file "+filename);
+    std::vector<byte> buffer( std::max(size,1) );
+    if( commRank == 0 )
+        std::memcpy( &buffer[0], contents.data(), size );
+    mpi::Broadcast( &buffer[0], size, 0, mpi::COMM_WORLD );
+
+    // Each line holds a routine, a datatype, a grid height and width, and a
+    // blocksize, e.g., "Cholesky d 2 4 96"
+    std::istringstream stream( std::string( (const char*)&buffer[0], size ) );
+    std::string line;
+    while( std::getline( stream, line ) )
+    {
+        std::istringstream lineStream( line );
+        std::string routine;
+        char dataType;
+        int gridHeight, gridWidth, blocksize;
+        if( line.empty() || line[0] == '#' )
+            continue;
+        if( !(lineStream >> routine >> dataType >> gridHeight >> gridWidth
+                         >> blocksize) || blocksize < 1 )
+            throw std::runtime_error("Invalid line in blocksize file: "+line);
+        std::ostringstream key;
+        key << routine << " " << dataType << " "
+            << gridHeight << " " << gridWidth;
+        ::blocksizeRegistry[key.str()] = blocksize;
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void SaveBlocksizeRegistry( std::string filename )
+{
+#ifndef RELEASE
+    PushCallStack("SaveBlocksizeRegistry");
+#endif
+    if( mpi::CommRank( mpi::COMM_WORLD ) == 0 )
+    {
+        std::ofstream file( filename.c_str() );
+        if( !file.is_open() )
+            throw std::runtime_error("Could not open blocksize file");
+        std::map<std::string,int>::const_iterator it;
+        for( it=::blocksizeRegistry.begin();
+             it!=::blocksizeRegistry.end(); ++it )
+            file << it->first << " " << it->second << "\n";
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
 const Grid& DefaultGrid()
 {
 #ifndef RELEASE
@@ -201,6 +400,8 @@ void PushCallStack( std::string s )
         return;
 #endif // HAVE_OPENMP
     ::callStack.push(s); 
+    if( Profiling() )
+        PushProfileRegion( s );
 }
 
 void PopCallStack()
@@ -210,6 +411,8 @@ void PopCallStack()
         return;
 #endif // HAVE_OPENMP
     ::callStack.pop(); 
+    if( Profiling() )
+        PopProfileRegion();
 }
 
 void DumpCallStack()
@@ -352,6 +555,12 @@ template<>
 int LocalTrrkBlocksize<Complex<double> >()
 { return ::localTrrkComplexDoubleBlocksize; }
 
+void SetGemmPipelining( bool pipelining )
+{ ::gemmPipelining = pipelining; }
+
+bool GemmPipelining()
+{ return ::gemmPipelining; }
+
 void SetHermitianTridiagApproach( HermitianTridiagApproach approach )
 { ::tridiagApproach = approach; }
 
@@ -364,4 +573,128 @@ void SetHermitianTridiagGridOrder( GridOrder order )
 GridOrder GetHermitianTridiagGridOrder()
 { return ::gridOrder; }
 
+void SetHermitianEigNumSlices( int numSlices )
+{
+    if( numSlices < 1 )
+        throw std::logic_error("The number of slices must be positive");
+    ::hermitianEigNumSlices = numSlices;
+}
+
+int GetHermitianEigNumSlices()
+{ return ::hermitianEigNumSlices; }
+
+void SetLUPivoting( LUPivoting pivoting )
+{ ::luPivoting = pivoting; }
+
+LUPivoting GetLUPivoting()
+{ return ::luPivoting; }
+
+void SetQRApproach( QRApproach approach )
+{ ::qrApproach = approach; }
+
+QRApproach GetQRApproach()
+{ return ::qrApproach; }
+
+void SetBidiagApproach( BidiagApproach approach )
+{ ::bidiagApproach = approach; }
+
+BidiagApproach GetBidiagApproach()
+{ return ::bidiagApproach; }
+
+void SetBidiagSVDApproach( BidiagSVDApproach approach )
+{
+#ifdef WITHOUT_PMRRR
+    if( approach == BIDIAG_SVD_MRRR )
+        throw std::logic_error("PMRRR is not available");
+#endif
+    ::bidiagSVDApproach = approach;
+}
+
+BidiagSVDApproach GetBidiagSVDApproach()
+{ return ::bidiagSVDApproach; }
+
+void SetLocalTileSize( int tileSize )
+{
+    if( tileSize < 0 )
+        throw std::logic_error("The tile size must be non-negative");
+    ::localTileSize = tileSize;
+}
+
+int GetLocalTileSize()
+{ return ::localTileSize; }
+
+namespace internal {
+
+bool UseLocalTiles( int height, int width )
+{
+#ifdef HAVE_OMP_TASK_DEPEND
+    return ::localTileSize > 0 &&
+           std::min(height,width) > ::localTileSize &&
+           omp_get_max_threads() > 1 && !omp_in_parallel();
+#else
+    return false;
+#endif
+}
+
+bool TileFailed( const bool& failed )
+{
+    bool value;
+#ifdef HAVE_OMP_TASK_DEPEND
+    #pragma omp atomic read
+#endif
+    value = failed;
+    return value;
+}
+
+void RecordTileFailure( bool& failed )
+{
+#ifdef HAVE_OMP_TASK_DEPEND
+    #pragma omp atomic write
+#endif
+    failed = true;
+}
+
+} // namespace internal
+
 } // namespace elem
+
+// Integer matrices (e.g., for Gemm over DistMatrix<int>) share the registry
+template char elem::DataTypeChar<int>();
+template int elem::Blocksize<int>
+( std::string routine, const elem::Grid& g );
+template void elem::SetBlocksize<int>
+( std::string routine, const elem::Grid& g, int blocksize );
+template void elem::PushBlocksizeStack<int>
+( std::string routine, const elem::Grid& g );
+
+template char elem::DataTypeChar<float>();
+template int elem::Blocksize<float>
+( std::string routine, const elem::Grid& g );
+template void elem::SetBlocksize<float>
+( std::string routine, const elem::Grid& g, int blocksize );
+template void elem::PushBlocksizeStack<float>
+( std::string routine, const elem::Grid& g );
+
+template char elem::DataTypeChar<double>();
+template int elem::Blocksize<double>
+( std::string routine, const elem::Grid& g );
+template void elem::SetBlocksize<double>
+( std::string routine, const elem::Grid& g, int blocksize );
+template void elem::PushBlocksizeStack<double>
+( std::string routine, const elem::Grid& g );
+
+template char elem::DataTypeChar<elem::Complex<float> >();
+template int elem::Blocksize<elem::Complex<float> >
+( std::string routine, const elem::Grid& g );
+template void elem::SetBlocksize<elem::Complex<float> >
+( std::string routine, const elem::Grid& g, int blocksize );
+template void elem::PushBlocksizeStack<elem::Complex<float> >
+( std::string routine, const elem::Grid& g );
+
+template char elem::DataTypeChar<elem::Complex<double> >();
+template int elem::Blocksize<elem::Complex<double> >
+( std::string routine, const elem::Grid& g );
+template void elem::SetBlocksize<elem::Complex<double> >
+( std::string routine, const elem::Grid& g, int blocksize );
+template void elem::PushBlocksizeStack<elem::Complex<double> >
+( std::string routine, const elem::Grid& g );
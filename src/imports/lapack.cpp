@@ -125,6 +125,72 @@ void LAPACK(zhseqr)
   elem::dcomplex* w, elem::dcomplex* Z, const int* ldz,
   elem::dcomplex* work, const int* lwork, int* info );
 
+// Symmetric tridiagonal QR algorithm
+void LAPACK(ssteqr)
+( const char* compz, const int* n, float* d, float* e, 
+  float* Z, const int* ldz, float* work, int* info );
+void LAPACK(dsteqr)
+( const char* compz, const int* n, double* d, double* e, 
+  double* Z, const int* ldz, double* work, int* info );
+
+// Cholesky factorization
+void LAPACK(spotrf)
+( const char* uplo, const int* n, float* A, const int* lda, int* info );
+void LAPACK(dpotrf)
+( const char* uplo, const int* n, double* A, const int* lda, int* info );
+void LAPACK(cpotrf)
+( const char* uplo, const int* n, elem::scomplex* A, const int* lda,
+  int* info );
+void LAPACK(zpotrf)
+( const char* uplo, const int* n, elem::dcomplex* A, const int* lda,
+  int* info );
+
+// LU factorization with partial pivoting
+void LAPACK(sgetrf)
+( const int* m, const int* n, float* A, const int* lda, int* p, int* info );
+void LAPACK(dgetrf)
+( const int* m, const int* n, double* A, const int* lda, int* p, int* info );
+void LAPACK(cgetrf)
+( const int* m, const int* n, elem::scomplex* A, const int* lda,
+  int* p, int* info );
+void LAPACK(zgetrf)
+( const int* m, const int* n, elem::dcomplex* A, const int* lda,
+  int* p, int* info );
+
+// Householder QR factorization
+void LAPACK(sgeqrf)
+( const int* m, const int* n, float* A, const int* lda, float* t,
+  float* work, const int* lwork, int* info );
+void LAPACK(dgeqrf)
+( const int* m, const int* n, double* A, const int* lda, double* t,
+  double* work, const int* lwork, int* info );
+void LAPACK(cgeqrf)
+( const int* m, const int* n, elem::scomplex* A, const int* lda,
+  elem::scomplex* t, elem::scomplex* work, const int* lwork, int* info );
+void LAPACK(zgeqrf)
+( const int* m, const int* n, elem::dcomplex* A, const int* lda,
+  elem::dcomplex* t, elem::dcomplex* work, const int* lwork, int* info );
+
+// Divide and conquer Hermitian eigensolver
+void LAPACK(ssyevd)
+( const char* jobz, const char* uplo, const int* n, float* A, const int* lda,
+  float* w, float* work, const int* lwork, int* iwork, const int* liwork,
+  int* info );
+void LAPACK(dsyevd)
+( const char* jobz, const char* uplo, const int* n, double* A, const int* lda,
+  double* w, double* work, const int* lwork, int* iwork, const int* liwork,
+  int* info );
+void LAPACK(cheevd)
+( const char* jobz, const char* uplo, const int* n,
+  elem::scomplex* A, const int* lda, float* w,
+  elem::scomplex* work, const int* lwork, float* rwork, const int* lrwork,
+  int* iwork, const int* liwork, int* info );
+void LAPACK(zheevd)
+( const char* jobz, const char* uplo, const int* n,
+  elem::dcomplex* A, const int* lda, double* w,
+  elem::dcomplex* work, const int* lwork, double* rwork, const int* lrwork,
+  int* iwork, const int* liwork, int* info );
+
 } // extern "C"
 
 namespace elem {
@@ -1164,5 +1230,631 @@ void HessenbergEig( int n, dcomplex* H, int ldh, dcomplex* w )
 #endif
 }
 
+//
+// Compute the eigenpairs of a symmetric tridiagonal matrix
+//
+
+void SymmetricTridiagEig( int n, float* d, float* e, float* Z, int ldz )
+{
+#ifndef RELEASE
+    PushCallStack("lapack::SymmetricTridiagEig");
+#endif
+    if( n == 0 )
+    {
+#ifndef RELEASE
+        PopCallStack();
+#endif
+        return;
+    }
+
+    const char compz='I';
+    int info;
+    std::vector<float> work( std::max(1,2*n-2) );
+    LAPACK(ssteqr)( &compz, &n, d, e, Z, &ldz, &work[0], &info );
+    if( info < 0 )
+    {
+        std::ostringstream msg;
+        msg << "Argument " << -info << " had illegal value";
+        throw std::logic_error( msg.str().c_str() );
+    }
+    else if( info > 0 )
+    {
+        std::ostringstream msg;
+        msg << "ssteqr had " << info << " elements of e not converge";
+        throw std::runtime_error( msg.str().c_str() );
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void SymmetricTridiagEig( int n, double* d, double* e, double* Z, int ldz )
+{
+#ifndef RELEASE
+    PushCallStack("lapack::SymmetricTridiagEig");
+#endif
+    if( n == 0 )
+    {
+#ifndef RELEASE
+        PopCallStack();
+#endif
+        return;
+    }
+
+    const char compz='I';
+    int info;
+    std::vector<double> work( std::max(1,2*n-2) );
+    LAPACK(dsteqr)( &compz, &n, d, e, Z, &ldz, &work[0], &info );
+    if( info < 0 )
+    {
+        std::ostringstream msg;
+        msg << "Argument " << -info << " had illegal value";
+        throw std::logic_error( msg.str().c_str() );
+    }
+    else if( info > 0 )
+    {
+        std::ostringstream msg;
+        msg << "dsteqr had " << info << " elements of e not converge";
+        throw std::runtime_error( msg.str().c_str() );
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+//
+// Cholesky factorization
+//
+
+void Cholesky( char uplo, int n, float* A, int lda )
+{
+#ifndef RELEASE
+    PushCallStack("lapack::Cholesky");
+#endif
+    if( n == 0 )
+    {
+#ifndef RELEASE
+        PopCallStack();
+#endif
+        return;
+    }
+
+    int info;
+    LAPACK(spotrf)( &uplo, &n, A, &lda, &info );
+    if( info < 0 )
+    {
+        std::ostringstream msg;
+        msg << "Argument " << -info << " had illegal value";
+        throw std::logic_error( msg.str().c_str() );
+    }
+    else if( info > 0 )
+        throw NonHPDMatrixException();
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void Cholesky( char uplo, int n, double* A, int lda )
+{
+#ifndef RELEASE
+    PushCallStack("lapack::Cholesky");
+#endif
+    if( n == 0 )
+    {
+#ifndef RELEASE
+        PopCallStack();
+#endif
+        return;
+    }
+
+    int info;
+    LAPACK(dpotrf)( &uplo, &n, A, &lda, &info );
+    if( info < 0 )
+    {
+        std::ostringstream msg;
+        msg << "Argument " << -info << " had illegal value";
+        throw std::logic_error( msg.str().c_str() );
+    }
+    else if( info > 0 )
+        throw NonHPDMatrixException();
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void Cholesky( char uplo, int n, scomplex* A, int lda )
+{
+#ifndef RELEASE
+    PushCallStack("lapack::Cholesky");
+#endif
+    if( n == 0 )
+    {
+#ifndef RELEASE
+        PopCallStack();
+#endif
+        return;
+    }
+
+    int info;
+    LAPACK(cpotrf)( &uplo, &n, A, &lda, &info );
+    if( info < 0 )
+    {
+        std::ostringstream msg;
+        msg << "Argument " << -info << " had illegal value";
+        throw std::logic_error( msg.str().c_str() );
+    }
+    else if( info > 0 )
+        throw NonHPDMatrixException();
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void Cholesky( char uplo, int n, dcomplex* A, int lda )
+{
+#ifndef RELEASE
+    PushCallStack("lapack::Cholesky");
+#endif
+    if( n == 0 )
+    {
+#ifndef RELEASE
+        PopCallStack();
+#endif
+        return;
+    }
+
+    int info;
+    LAPACK(zpotrf)( &uplo, &n, A, &lda, &info );
+    if( info < 0 )
+    {
+        std::ostringstream msg;
+        msg << "Argument " << -info << " had illegal value";
+        throw std::logic_error( msg.str().c_str() );
+    }
+    else if( info > 0 )
+        throw NonHPDMatrixException();
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+//
+// LU factorization with partial pivoting
+//
+
+void LU( int m, int n, float* A, int lda, int* p )
+{
+#ifndef RELEASE
+    PushCallStack("lapack::LU");
+#endif
+    if( m == 0 || n == 0 )
+    {
+#ifndef RELEASE
+        PopCallStack();
+#endif
+        return;
+    }
+
+    int info;
+    LAPACK(sgetrf)( &m, &n, A, &lda, p, &info );
+    if( info < 0 )
+    {
+        std::ostringstream msg;
+        msg << "Argument " << -info << " had illegal value";
+        throw std::logic_error( msg.str().c_str() );
+    }
+    else if( info > 0 )
+        throw SingularMatrixException();
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void LU( int m, int n, double* A, int lda, int* p )
+{
+#ifndef RELEASE
+    PushCallStack("lapack::LU");
+#endif
+    if( m == 0 || n == 0 )
+    {
+#ifndef RELEASE
+        PopCallStack();
+#endif
+        return;
+    }
+
+    int info;
+    LAPACK(dgetrf)( &m, &n, A, &lda, p, &info );
+    if( info < 0 )
+    {
+        std::ostringstream msg;
+        msg << "Argument " << -info << " had illegal value";
+        throw std::logic_error( msg.str().c_str() );
+    }
+    else if( info > 0 )
+        throw SingularMatrixException();
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void LU( int m, int n, scomplex* A, int lda, int* p )
+{
+#ifndef RELEASE
+    PushCallStack("lapack::LU");
+#endif
+    if( m == 0 || n == 0 )
+    {
+#ifndef RELEASE
+        PopCallStack();
+#endif
+        return;
+    }
+
+    int info;
+    LAPACK(cgetrf)( &m, &n, A, &lda, p, &info );
+    if( info < 0 )
+    {
+        std::ostringstream msg;
+        msg << "Argument " << -info << " had illegal value";
+        throw std::logic_error( msg.str().c_str() );
+    }
+    else if( info > 0 )
+        throw SingularMatrixException();
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void LU( int m, int n, dcomplex* A, int lda, int* p )
+{
+#ifndef RELEASE
+    PushCallStack("lapack::LU");
+#endif
+    if( m == 0 || n == 0 )
+    {
+#ifndef RELEASE
+        PopCallStack();
+#endif
+        return;
+    }
+
+    int info;
+    LAPACK(zgetrf)( &m, &n, A, &lda, p, &info );
+    if( info < 0 )
+    {
+        std::ostringstream msg;
+        msg << "Argument " << -info << " had illegal value";
+        throw std::logic_error( msg.str().c_str() );
+    }
+    else if( info > 0 )
+        throw SingularMatrixException();
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+//
+// Householder QR factorization
+//
+
+void QR( int m, int n, float* A, int lda, float* t )
+{
+#ifndef RELEASE
+    PushCallStack("lapack::QR");
+#endif
+    if( m == 0 || n == 0 )
+    {
+#ifndef RELEASE
+        PopCallStack();
+#endif
+        return;
+    }
+
+    int lwork=-1, info;
+    float dummyWork;
+    LAPACK(sgeqrf)( &m, &n, A, &lda, t, &dummyWork, &lwork, &info );
+
+    lwork = dummyWork;
+    std::vector<float> work(lwork);
+    LAPACK(sgeqrf)( &m, &n, A, &lda, t, &work[0], &lwork, &info );
+    if( info < 0 )
+    {
+        std::ostringstream msg;
+        msg << "Argument " << -info << " had illegal value";
+        throw std::logic_error( msg.str().c_str() );
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void QR( int m, int n, double* A, int lda, double* t )
+{
+#ifndef RELEASE
+    PushCallStack("lapack::QR");
+#endif
+    if( m == 0 || n == 0 )
+    {
+#ifndef RELEASE
+        PopCallStack();
+#endif
+        return;
+    }
+
+    int lwork=-1, info;
+    double dummyWork;
+    LAPACK(dgeqrf)( &m, &n, A, &lda, t, &dummyWork, &lwork, &info );
+
+    lwork = dummyWork;
+    std::vector<double> work(lwork);
+    LAPACK(dgeqrf)( &m, &n, A, &lda, t, &work[0], &lwork, &info );
+    if( info < 0 )
+    {
+        std::ostringstream msg;
+        msg << "Argument " << -info << " had illegal value";
+        throw std::logic_error( msg.str().c_str() );
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void QR( int m, int n, scomplex* A, int lda, scomplex* t )
+{
+#ifndef RELEASE
+    PushCallStack("lapack::QR");
+#endif
+    if( m == 0 || n == 0 )
+    {
+#ifndef RELEASE
+        PopCallStack();
+#endif
+        return;
+    }
+
+    int lwork=-1, info;
+    scomplex dummyWork;
+    LAPACK(cgeqrf)( &m, &n, A, &lda, t, &dummyWork, &lwork, &info );
+
+    lwork = dummyWork.real;
+    std::vector<scomplex> work(lwork);
+    LAPACK(cgeqrf)( &m, &n, A, &lda, t, &work[0], &lwork, &info );
+    if( info < 0 )
+    {
+        std::ostringstream msg;
+        msg << "Argument " << -info << " had illegal value";
+        throw std::logic_error( msg.str().c_str() );
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void QR( int m, int n, dcomplex* A, int lda, dcomplex* t )
+{
+#ifndef RELEASE
+    PushCallStack("lapack::QR");
+#endif
+    if( m == 0 || n == 0 )
+    {
+#ifndef RELEASE
+        PopCallStack();
+#endif
+        return;
+    }
+
+    int lwork=-1, info;
+    dcomplex dummyWork;
+    LAPACK(zgeqrf)( &m, &n, A, &lda, t, &dummyWork, &lwork, &info );
+
+    lwork = dummyWork.real;
+    std::vector<dcomplex> work(lwork);
+    LAPACK(zgeqrf)( &m, &n, A, &lda, t, &work[0], &lwork, &info );
+    if( info < 0 )
+    {
+        std::ostringstream msg;
+        msg << "Argument " << -info << " had illegal value";
+        throw std::logic_error( msg.str().c_str() );
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+//
+// Hermitian eigensolver
+//
+
+void HermitianEig
+( char uplo, int n, float* A, int lda, float* w, bool computeVectors )
+{
+#ifndef RELEASE
+    PushCallStack("lapack::HermitianEig");
+#endif
+    if( n == 0 )
+    {
+#ifndef RELEASE
+        PopCallStack();
+#endif
+        return;
+    }
+
+    const char jobz = ( computeVectors ? 'V' : 'N' );
+    int lwork=-1, liwork=-1, info;
+    float dummyWork;
+    int dummyIWork;
+    LAPACK(ssyevd)
+    ( &jobz, &uplo, &n, A, &lda, w, 
+      &dummyWork, &lwork, &dummyIWork, &liwork, &info );
+
+    lwork = dummyWork;
+    liwork = dummyIWork;
+    std::vector<float> work(lwork);
+    std::vector<int> iwork(liwork);
+    LAPACK(ssyevd)
+    ( &jobz, &uplo, &n, A, &lda, w, 
+      &work[0], &lwork, &iwork[0], &liwork, &info );
+    if( info < 0 )
+    {
+        std::ostringstream msg;
+        msg << "Argument " << -info << " had illegal value";
+        throw std::logic_error( msg.str().c_str() );
+    }
+    else if( info > 0 )
+    {
+        std::ostringstream msg;
+        msg << "ssyevd failed to converge (info=" << info << ")";
+        throw std::runtime_error( msg.str().c_str() );
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void HermitianEig
+( char uplo, int n, double* A, int lda, double* w, bool computeVectors )
+{
+#ifndef RELEASE
+    PushCallStack("lapack::HermitianEig");
+#endif
+    if( n == 0 )
+    {
+#ifndef RELEASE
+        PopCallStack();
+#endif
+        return;
+    }
+
+    const char jobz = ( computeVectors ? 'V' : 'N' );
+    int lwork=-1, liwork=-1, info;
+    double dummyWork;
+    int dummyIWork;
+    LAPACK(dsyevd)
+    ( &jobz, &uplo, &n, A, &lda, w, 
+      &dummyWork, &lwork, &dummyIWork, &liwork, &info );
+
+    lwork = dummyWork;
+    liwork = dummyIWork;
+    std::vector<double> work(lwork);
+    std::vector<int> iwork(liwork);
+    LAPACK(dsyevd)
+    ( &jobz, &uplo, &n, A, &lda, w, 
+      &work[0], &lwork, &iwork[0], &liwork, &info );
+    if( info < 0 )
+    {
+        std::ostringstream msg;
+        msg << "Argument " << -info << " had illegal value";
+        throw std::logic_error( msg.str().c_str() );
+    }
+    else if( info > 0 )
+    {
+        std::ostringstream msg;
+        msg << "dsyevd failed to converge (info=" << info << ")";
+        throw std::runtime_error( msg.str().c_str() );
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void HermitianEig
+( char uplo, int n, scomplex* A, int lda, float* w, bool computeVectors )
+{
+#ifndef RELEASE
+    PushCallStack("lapack::HermitianEig");
+#endif
+    if( n == 0 )
+    {
+#ifndef RELEASE
+        PopCallStack();
+#endif
+        return;
+    }
+
+    const char jobz = ( computeVectors ? 'V' : 'N' );
+    int lwork=-1, lrwork=-1, liwork=-1, info;
+    scomplex dummyWork;
+    float dummyRWork;
+    int dummyIWork;
+    LAPACK(cheevd)
+    ( &jobz, &uplo, &n, A, &lda, w, &dummyWork, &lwork, 
+      &dummyRWork, &lrwork, &dummyIWork, &liwork, &info );
+
+    lwork = dummyWork.real;
+    lrwork = dummyRWork;
+    liwork = dummyIWork;
+    std::vector<scomplex> work(lwork);
+    std::vector<float> rwork(lrwork);
+    std::vector<int> iwork(liwork);
+    LAPACK(cheevd)
+    ( &jobz, &uplo, &n, A, &lda, w, &work[0], &lwork, 
+      &rwork[0], &lrwork, &iwork[0], &liwork, &info );
+    if( info < 0 )
+    {
+        std::ostringstream msg;
+        msg << "Argument " << -info << " had illegal value";
+        throw std::logic_error( msg.str().c_str() );
+    }
+    else if( info > 0 )
+    {
+        std::ostringstream msg;
+        msg << "cheevd failed to converge (info=" << info << ")";
+        throw std::runtime_error( msg.str().c_str() );
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void HermitianEig
+( char uplo, int n, dcomplex* A, int lda, double* w, bool computeVectors )
+{
+#ifndef RELEASE
+    PushCallStack("lapack::HermitianEig");
+#endif
+    if( n == 0 )
+    {
+#ifndef RELEASE
+        PopCallStack();
+#endif
+        return;
+    }
+
+    const char jobz = ( computeVectors ? 'V' : 'N' );
+    int lwork=-1, lrwork=-1, liwork=-1, info;
+    dcomplex dummyWork;
+    double dummyRWork;
+    int dummyIWork;
+    LAPACK(zheevd)
+    ( &jobz, &uplo, &n, A, &lda, w, &dummyWork, &lwork, 
+      &dummyRWork, &lrwork, &dummyIWork, &liwork, &info );
+
+    lwork = dummyWork.real;
+    lrwork = dummyRWork;
+    liwork = dummyIWork;
+    std::vector<dcomplex> work(lwork);
+    std::vector<double> rwork(lrwork);
+    std::vector<int> iwork(liwork);
+    LAPACK(zheevd)
+    ( &jobz, &uplo, &n, A, &lda, w, &work[0], &lwork, 
+      &rwork[0], &lrwork, &iwork[0], &liwork, &info );
+    if( info < 0 )
+    {
+        std::ostringstream msg;
+        msg << "Argument " << -info << " had illegal value";
+        throw std::logic_error( msg.str().c_str() );
+    }
+    else if( info > 0 )
+    {
+        std::ostringstream msg;
+        msg << "zheevd failed to converge (info=" << info << ")";
+        throw std::runtime_error( msg.str().c_str() );
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
 } // namespace lapack
 } // namespace elem
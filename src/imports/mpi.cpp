@@ -24,6 +24,116 @@ SafeMpi( int mpiError )
 #endif
 }
 
+// File I/O can fail for reasons outside of the program's control, so, unlike 
+// SafeMpi, the error checks are not disabled in RELEASE mode
+inline void
+SafeFileIO( int mpiError, std::string context )
+{
+    if( mpiError != MPI_SUCCESS )
+    {
+        char errorString[MPI_MAX_ERROR_STRING];
+        int lengthOfErrorString;
+        MPI_Error_string( mpiError, errorString, &lengthOfErrorString );
+        throw std::runtime_error
+        ( context+": "+std::string(errorString,lengthOfErrorString) );
+    }
+}
+
+// The communication statistics of each routine over each communicator, 
+// where the communicators are keyed on both their handle and their name since
+// a freed handle may be reused
+bool commAccounting = false;
+typedef std::pair<elem::mpi::Comm,std::string> CommKey;
+typedef std::map<std::string,elem::mpi::CommStats> RoutineStats;
+std::map<CommKey,RoutineStats> commStats;
+
+std::string RawCommName( elem::mpi::Comm comm )
+{
+    char name[MPI_MAX_OBJECT_NAME];
+    int length;
+    MPI_Comm_get_name( comm, name, &length );
+    return std::string( name, length );
+}
+
+// Records the communication of a wrapper for the profiler and, if enabled, 
+// the communication accounting. The wrappers which are called from within 
+// other wrappers (e.g., as a fallback) are not counted again.
+int commProfileDepth = 0;
+#ifdef HAVE_OPENMP
+#pragma omp threadprivate(commProfileDepth)
+#endif
+
+class CommProfile
+{
+public:
+    CommProfile
+    ( const char* routine, elem::mpi::Comm comm, std::size_t numBytes )
+    : stats_(0)
+    {
+        if( commProfileDepth++ != 0 )
+            return;
+        elem::ProfileCommunication( numBytes );
+        if( commAccounting )
+        {
+            const CommKey key( comm, RawCommName(comm) );
+#ifdef HAVE_OPENMP
+            #pragma omp critical(ElemCommAccounting)
+#endif
+            {
+                elem::mpi::CommStats& stats = commStats[key][routine];
+                ++stats.numCalls;
+                stats.numBytes += numBytes;
+                stats_ = &stats;
+            }
+            startTime_ = MPI_Wtime();
+        }
+    }
+
+    ~CommProfile()
+    {
+        if( stats_ != 0 )
+        {
+            const double elapsed = MPI_Wtime() - startTime_;
+#ifdef HAVE_OPENMP
+            #pragma omp critical(ElemCommAccounting)
+#endif
+            stats_->time += elapsed;
+        }
+        --commProfileDepth;
+    }
+
+private:
+    elem::mpi::CommStats* stats_;
+    double startTime_;
+};
+
+// These avoid the wrappers so that they do not appear in profiles
+inline int
+Size( elem::mpi::Comm comm )
+{
+    int size;
+    MPI_Comm_size( comm, &size );
+    return size;
+}
+
+inline int
+Rank( elem::mpi::Comm comm )
+{
+    int rank;
+    MPI_Comm_rank( comm, &rank );
+    return rank;
+}
+
+inline int
+Sum( const int* counts, elem::mpi::Comm comm )
+{
+    const int size = Size( comm );
+    int sum = 0;
+    for( int q=0; q<size; ++q )
+        sum += counts[q];
+    return sum;
+}
+
 } // anonymous namespace
 
 namespace elem {
@@ -196,6 +306,20 @@ void ErrorHandlerSet( Comm comm, ErrorHandler errorHandler )
 #endif
 }
 
+void SetCommName( Comm comm, std::string name )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::SetCommName");
+#endif
+    SafeMpi( MPI_Comm_set_name( comm, const_cast<char*>(name.c_str()) ) );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+std::string CommName( Comm comm )
+{ return RawCommName( comm ); }
+
 //---------------------------------//
 // Cartesian communicator routines //
 //---------------------------------//
@@ -370,6 +494,18 @@ void Wait( Request& request, Status& status )
 #endif
 }
 
+// Ensure that several requests finish before continuing
+void WaitAll( int numRequests, Request* requests )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::WaitAll");
+#endif
+    SafeMpi( MPI_Waitall( numRequests, requests, MPI_STATUSES_IGNORE ) );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
 // Ensure that several requests finish before continuing
 void WaitAll( int numRequests, Request* requests, Status* statuses )
 {
@@ -485,6 +621,7 @@ void Send( const byte* buf, int count, int to, int tag, Comm comm )
 #ifndef RELEASE
     PushCallStack("mpi::Send");
 #endif
+    CommProfile profile( "Send", comm, sizeof(byte)*count );
     SafeMpi( 
         MPI_Send
         ( const_cast<byte*>(buf), count, MPI_UNSIGNED_CHAR, to, tag, comm ) 
@@ -500,6 +637,7 @@ void ISend
 #ifndef RELEASE
     PushCallStack("mpi::ISend");
 #endif
+    CommProfile profile( "ISend", comm, sizeof(byte)*count );
     SafeMpi( 
         MPI_Isend
         ( const_cast<byte*>(buf), count, MPI_UNSIGNED_CHAR, to, tag, comm,
@@ -516,6 +654,7 @@ void ISSend
 #ifndef RELEASE
     PushCallStack("mpi::ISSend");
 #endif
+    CommProfile profile( "ISSend", comm, sizeof(byte)*count );
     SafeMpi(
         MPI_Issend
         ( const_cast<byte*>(buf), count, MPI_UNSIGNED_CHAR, to, tag, comm, 
@@ -531,6 +670,7 @@ void Send( const int* buf, int count, int to, int tag, Comm comm )
 #ifndef RELEASE
     PushCallStack("mpi::Send");
 #endif
+    CommProfile profile( "Send", comm, sizeof(int)*count );
     SafeMpi( 
         MPI_Send( const_cast<int*>(buf), count, MPI_INT, to, tag, comm ) 
     );
@@ -545,6 +685,7 @@ void ISend
 #ifndef RELEASE
     PushCallStack("mpi::ISend");
 #endif
+    CommProfile profile( "ISend", comm, sizeof(int)*count );
     SafeMpi( 
         MPI_Isend
         ( const_cast<int*>(buf), count, MPI_INT, to, tag, comm, &request ) 
@@ -560,6 +701,7 @@ void ISSend
 #ifndef RELEASE
     PushCallStack("mpi::ISSend");
 #endif
+    CommProfile profile( "ISSend", comm, sizeof(int)*count );
     SafeMpi(
         MPI_Issend
         ( const_cast<int*>(buf), count, MPI_INT, to, tag, comm, &request )
@@ -574,6 +716,7 @@ void Send( const float* buf, int count, int to, int tag, Comm comm )
 #ifndef RELEASE
     PushCallStack("mpi::Send");
 #endif
+    CommProfile profile( "Send", comm, sizeof(float)*count );
     SafeMpi( 
         MPI_Send( const_cast<float*>(buf), count, MPI_FLOAT, to, tag, comm ) 
     );
@@ -588,6 +731,7 @@ void ISend
 #ifndef RELEASE
     PushCallStack("mpi::ISend");
 #endif
+    CommProfile profile( "ISend", comm, sizeof(float)*count );
     SafeMpi( 
         MPI_Isend
         ( const_cast<float*>(buf), count, MPI_FLOAT, to, tag, comm, &request ) 
@@ -603,6 +747,7 @@ void ISSend
 #ifndef RELEASE
     PushCallStack("mpi::ISSend");
 #endif
+    CommProfile profile( "ISSend", comm, sizeof(float)*count );
     SafeMpi(
         MPI_Issend
         ( const_cast<float*>(buf), count, MPI_FLOAT, to, tag, comm, &request )
@@ -617,6 +762,7 @@ void Send( const double* buf, int count, int to, int tag, Comm comm )
 #ifndef RELEASE
     PushCallStack("mpi::Send");
 #endif
+    CommProfile profile( "Send", comm, sizeof(double)*count );
     SafeMpi( 
         MPI_Send( const_cast<double*>(buf), count, MPI_DOUBLE, to, tag, comm ) 
     );
@@ -631,6 +777,7 @@ void ISend
 #ifndef RELEASE
     PushCallStack("mpi::ISend");
 #endif
+    CommProfile profile( "ISend", comm, sizeof(double)*count );
     SafeMpi( 
         MPI_Isend
         ( const_cast<double*>(buf), count, MPI_DOUBLE, to, tag, comm, &request )
@@ -646,6 +793,7 @@ void ISSend
 #ifndef RELEASE
     PushCallStack("mpi::ISSend");
 #endif
+    CommProfile profile( "ISSend", comm, sizeof(double)*count );
     SafeMpi(
         MPI_Issend
         ( const_cast<double*>(buf), count, MPI_DOUBLE, to, tag, comm, &request )
@@ -660,6 +808,7 @@ void Send( const scomplex* buf, int count, int to, int tag, Comm comm )
 #ifndef RELEASE
     PushCallStack("mpi::Send");
 #endif
+    CommProfile profile( "Send", comm, sizeof(scomplex)*count );
 #ifdef AVOID_COMPLEX_MPI
     SafeMpi(
         MPI_Send
@@ -682,6 +831,7 @@ void ISend
 #ifndef RELEASE
     PushCallStack("mpi::ISend");
 #endif
+    CommProfile profile( "ISend", comm, sizeof(scomplex)*count );
 #ifdef AVOID_COMPLEX_MPI
     SafeMpi(
         MPI_Isend
@@ -706,6 +856,7 @@ void ISSend
 #ifndef RELEASE
     PushCallStack("mpi::ISSend");
 #endif
+    CommProfile profile( "ISSend", comm, sizeof(scomplex)*count );
 #ifdef AVOID_COMPLEX_MPI
     SafeMpi(
         MPI_Issend
@@ -729,6 +880,7 @@ void Send( const dcomplex* buf, int count, int to, int tag, Comm comm )
 #ifndef RELEASE
     PushCallStack("mpi::Send");
 #endif
+    CommProfile profile( "Send", comm, sizeof(dcomplex)*count );
 #ifdef AVOID_COMPLEX_MPI
     SafeMpi(
         MPI_Send
@@ -751,6 +903,7 @@ void ISend
 #ifndef RELEASE
     PushCallStack("mpi::ISend");
 #endif
+    CommProfile profile( "ISend", comm, sizeof(dcomplex)*count );
 #ifdef AVOID_COMPLEX_MPI
     SafeMpi(
         MPI_Isend
@@ -775,6 +928,7 @@ void ISSend
 #ifndef RELEASE
     PushCallStack("mpi::ISSend");
 #endif
+    CommProfile profile( "ISSend", comm, sizeof(dcomplex)*count );
 #ifdef AVOID_COMPLEX_MPI
     SafeMpi(
         MPI_Issend
@@ -798,6 +952,7 @@ void Recv( byte* buf, int count, int from, int tag, Comm comm )
 #ifndef RELEASE
     PushCallStack("mpi::Recv");
 #endif
+    CommProfile profile( "Recv", comm, sizeof(byte)*count );
     Status status;
     SafeMpi( 
         MPI_Recv( buf, count, MPI_UNSIGNED_CHAR, from, tag, comm, &status ) 
@@ -813,6 +968,7 @@ void IRecv
 #ifndef RELEASE
     PushCallStack("mpi::IRecv");
 #endif
+    CommProfile profile( "IRecv", comm, sizeof(byte)*count );
     SafeMpi( 
         MPI_Irecv( buf, count, MPI_UNSIGNED_CHAR, from, tag, comm, &request ) 
     );
@@ -826,6 +982,7 @@ void Recv( int* buf, int count, int from, int tag, Comm comm )
 #ifndef RELEASE
     PushCallStack("mpi::Recv");
 #endif
+    CommProfile profile( "Recv", comm, sizeof(int)*count );
     Status status;
     SafeMpi( MPI_Recv( buf, count, MPI_INT, from, tag, comm, &status ) );
 #ifndef RELEASE
@@ -839,6 +996,7 @@ void IRecv
 #ifndef RELEASE
     PushCallStack("mpi::IRecv");
 #endif
+    CommProfile profile( "IRecv", comm, sizeof(int)*count );
     SafeMpi( MPI_Irecv( buf, count, MPI_INT, from, tag, comm, &request ) );
 #ifndef RELEASE
     PopCallStack();
@@ -850,6 +1008,7 @@ void Recv( float* buf, int count, int from, int tag, Comm comm )
 #ifndef RELEASE
     PushCallStack("mpi::Recv");
 #endif
+    CommProfile profile( "Recv", comm, sizeof(float)*count );
     Status status;
     SafeMpi( MPI_Recv( buf, count, MPI_FLOAT, from, tag, comm, &status ) );
 #ifndef RELEASE
@@ -863,6 +1022,7 @@ void IRecv
 #ifndef RELEASE
     PushCallStack("mpi::IRecv");
 #endif
+    CommProfile profile( "IRecv", comm, sizeof(float)*count );
     SafeMpi( MPI_Irecv( buf, count, MPI_FLOAT, from, tag, comm, &request ) );
 #ifndef RELEASE
     PopCallStack();
@@ -874,6 +1034,7 @@ void Recv( double* buf, int count, int from, int tag, Comm comm )
 #ifndef RELEASE
     PushCallStack("mpi::Recv");
 #endif
+    CommProfile profile( "Recv", comm, sizeof(double)*count );
     Status status;
     SafeMpi( MPI_Recv( buf, count, MPI_DOUBLE, from, tag, comm, &status ) );
 #ifndef RELEASE
@@ -887,6 +1048,7 @@ void IRecv
 #ifndef RELEASE
     PushCallStack("mpi::IRecv");
 #endif
+    CommProfile profile( "IRecv", comm, sizeof(double)*count );
     SafeMpi( MPI_Irecv( buf, count, MPI_DOUBLE, from, tag, comm, &request ) );
 #ifndef RELEASE
     PopCallStack();
@@ -898,6 +1060,7 @@ void Recv( scomplex* buf, int count, int from, int tag, Comm comm )
 #ifndef RELEASE
     PushCallStack("mpi::Recv");
 #endif
+    CommProfile profile( "Recv", comm, sizeof(scomplex)*count );
     Status status;
 #ifdef AVOID_COMPLEX_MPI
     SafeMpi( MPI_Recv( buf, 2*count, MPI_FLOAT, from, tag, comm, &status ) );
@@ -915,6 +1078,7 @@ void IRecv
 #ifndef RELEASE
     PushCallStack("mpi::IRecv");
 #endif
+    CommProfile profile( "IRecv", comm, sizeof(scomplex)*count );
 #ifdef AVOID_COMPLEX_MPI
     SafeMpi( MPI_Irecv( buf, 2*count, MPI_FLOAT, from, tag, comm, &request ) );
 #else
@@ -930,6 +1094,7 @@ void Recv( dcomplex* buf, int count, int from, int tag, Comm comm )
 #ifndef RELEASE
     PushCallStack("mpi::Recv");
 #endif
+    CommProfile profile( "Recv", comm, sizeof(dcomplex)*count );
     Status status;
 #ifdef AVOID_COMPLEX_MPI
     SafeMpi(
@@ -951,6 +1116,7 @@ void IRecv
 #ifndef RELEASE
     PushCallStack("mpi::IRecv");
 #endif
+    CommProfile profile( "IRecv", comm, sizeof(dcomplex)*count );
 #ifdef AVOID_COMPLEX_MPI
     SafeMpi(
         MPI_Irecv( buf, 2*count, MPI_DOUBLE, from, tag, comm, &request )
@@ -972,6 +1138,7 @@ void SendRecv
 #ifndef RELEASE
     PushCallStack("mpi::SendRecv");
 #endif
+    CommProfile profile( "SendRecv", comm, sizeof(byte)*(sc+rc) );
     Status status;
     SafeMpi( 
         MPI_Sendrecv
@@ -990,6 +1157,7 @@ void SendRecv
 #ifndef RELEASE
     PushCallStack("mpi::SendRecv");
 #endif
+    CommProfile profile( "SendRecv", comm, sizeof(int)*(sc+rc) );
     Status status;
     SafeMpi( 
         MPI_Sendrecv
@@ -1008,6 +1176,7 @@ void SendRecv
 #ifndef RELEASE
     PushCallStack("mpi::SendRecv");
 #endif
+    CommProfile profile( "SendRecv", comm, sizeof(float)*(sc+rc) );
     Status status;
     SafeMpi( 
         MPI_Sendrecv
@@ -1026,6 +1195,7 @@ void SendRecv
 #ifndef RELEASE
     PushCallStack("mpi::SendRecv");
 #endif
+    CommProfile profile( "SendRecv", comm, sizeof(double)*(sc+rc) );
     Status status;
     SafeMpi( 
         MPI_Sendrecv
@@ -1044,6 +1214,7 @@ void SendRecv
 #ifndef RELEASE
     PushCallStack("mpi::SendRecv");
 #endif
+    CommProfile profile( "SendRecv", comm, sizeof(scomplex)*(sc+rc) );
     Status status;
 #ifdef AVOID_COMPLEX_MPI
     SafeMpi(
@@ -1072,6 +1243,7 @@ void SendRecv
 #ifndef RELEASE
     PushCallStack("mpi::SendRecv");
 #endif
+    CommProfile profile( "SendRecv", comm, sizeof(dcomplex)*(sc+rc) );
     Status status;
 #ifdef AVOID_COMPLEX_MPI
     SafeMpi(
@@ -1098,6 +1270,7 @@ void Broadcast( byte* buf, int count, int root, Comm comm )
 #ifndef RELEASE
     PushCallStack("mpi::Broadcast");
 #endif
+    CommProfile profile( "Broadcast", comm, sizeof(byte)*count );
     SafeMpi( MPI_Bcast( buf, count, MPI_UNSIGNED_CHAR, root, comm ) );
 #ifndef RELEASE
     PopCallStack();
@@ -1109,6 +1282,7 @@ void Broadcast( int* buf, int count, int root, Comm comm )
 #ifndef RELEASE
     PushCallStack("mpi::Broadcast");
 #endif
+    CommProfile profile( "Broadcast", comm, sizeof(int)*count );
     SafeMpi( MPI_Bcast( buf, count, MPI_INT, root, comm ) );
 #ifndef RELEASE
     PopCallStack();
@@ -1120,6 +1294,7 @@ void Broadcast( float* buf, int count, int root, Comm comm )
 #ifndef RELEASE
     PushCallStack("mpi::Broadcast");
 #endif
+    CommProfile profile( "Broadcast", comm, sizeof(float)*count );
     SafeMpi( MPI_Bcast( buf, count, MPI_FLOAT, root, comm ) );
 #ifndef RELEASE
     PopCallStack();
@@ -1131,6 +1306,7 @@ void Broadcast( double* buf, int count, int root, Comm comm )
 #ifndef RELEASE
     PushCallStack("mpi::Broadcast");
 #endif
+    CommProfile profile( "Broadcast", comm, sizeof(double)*count );
     SafeMpi( MPI_Bcast( buf, count, MPI_DOUBLE, root, comm ) );
 #ifndef RELEASE
     PopCallStack();
@@ -1142,6 +1318,7 @@ void Broadcast( scomplex* buf, int count, int root, Comm comm )
 #ifndef RELEASE
     PushCallStack("mpi::Broadcast");
 #endif
+    CommProfile profile( "Broadcast", comm, sizeof(scomplex)*count );
 #ifdef AVOID_COMPLEX_MPI
     SafeMpi( MPI_Bcast( buf, 2*count, MPI_FLOAT, root, comm ) );
 #else
@@ -1157,6 +1334,7 @@ void Broadcast( dcomplex* buf, int count, int root, Comm comm )
 #ifndef RELEASE
     PushCallStack("mpi::Broadcast");
 #endif
+    CommProfile profile( "Broadcast", comm, sizeof(dcomplex)*count );
 #ifdef AVOID_COMPLEX_MPI
     SafeMpi( MPI_Bcast( buf, 2*count, MPI_DOUBLE, root, comm ) );
 #else
@@ -1167,48 +1345,85 @@ void Broadcast( dcomplex* buf, int count, int root, Comm comm )
 #endif
 }
 
-#ifdef HAVE_NONBLOCKING_COLLECTIVES
-void IBroadcast( byte* buf, int count, int root, Comm comm, Request& request )
+void IBroadcast
+( byte* buf, int count, int root, Comm comm, Request& request )
 {
 #ifndef RELEASE
     PushCallStack("mpi::IBroadcast");
 #endif
+    CommProfile profile( "IBroadcast", comm, sizeof(byte)*count );
+#ifdef HAVE_NONBLOCKING_COLLECTIVES
     SafeMpi( 
-        MPI_Ibcast( buf, count, MPI_UNSIGNED_CHAR, root, comm, &request ) 
+        NONBLOCKING_COLL(Ibcast)
+        ( buf, count, MPI_UNSIGNED_CHAR, root, comm, &request ) 
     );
+#else
+    Broadcast( buf, count, root, comm );
+    request = REQUEST_NULL;
+#endif
 #ifndef RELEASE
     PopCallStack();
 #endif
 }
 
-void IBroadcast( int* buf, int count, int root, Comm comm, Request& request )
+void IBroadcast
+( int* buf, int count, int root, Comm comm, Request& request )
 {
 #ifndef RELEASE
     PushCallStack("mpi::IBroadcast");
 #endif
-    SafeMpi( MPI_Ibcast( buf, count, MPI_INT, root, comm, &request ) );
+    CommProfile profile( "IBroadcast", comm, sizeof(int)*count );
+#ifdef HAVE_NONBLOCKING_COLLECTIVES
+    SafeMpi( 
+        NONBLOCKING_COLL(Ibcast)
+        ( buf, count, MPI_INT, root, comm, &request ) 
+    );
+#else
+    Broadcast( buf, count, root, comm );
+    request = REQUEST_NULL;
+#endif
 #ifndef RELEASE
     PopCallStack();
 #endif
 }
 
-void IBroadcast( float* buf, int count, int root, Comm comm, Request& request )
+void IBroadcast
+( float* buf, int count, int root, Comm comm, Request& request )
 {
 #ifndef RELEASE
     PushCallStack("mpi::IBroadcast");
 #endif
-    SafeMpi( MPI_Ibcast( buf, count, MPI_FLOAT, root, comm, &request ) );
+    CommProfile profile( "IBroadcast", comm, sizeof(float)*count );
+#ifdef HAVE_NONBLOCKING_COLLECTIVES
+    SafeMpi( 
+        NONBLOCKING_COLL(Ibcast)
+        ( buf, count, MPI_FLOAT, root, comm, &request ) 
+    );
+#else
+    Broadcast( buf, count, root, comm );
+    request = REQUEST_NULL;
+#endif
 #ifndef RELEASE
     PopCallStack();
 #endif
 }
 
-void IBroadcast( double* buf, int count, int root, Comm comm, Request& request )
+void IBroadcast
+( double* buf, int count, int root, Comm comm, Request& request )
 {
 #ifndef RELEASE
     PushCallStack("mpi::IBroadcast");
 #endif
-    SafeMpi( MPI_Ibcast( buf, count, MPI_DOUBLE, root, comm, &request ) );
+    CommProfile profile( "IBroadcast", comm, sizeof(double)*count );
+#ifdef HAVE_NONBLOCKING_COLLECTIVES
+    SafeMpi( 
+        NONBLOCKING_COLL(Ibcast)
+        ( buf, count, MPI_DOUBLE, root, comm, &request ) 
+    );
+#else
+    Broadcast( buf, count, root, comm );
+    request = REQUEST_NULL;
+#endif
 #ifndef RELEASE
     PopCallStack();
 #endif
@@ -1220,10 +1435,22 @@ void IBroadcast
 #ifndef RELEASE
     PushCallStack("mpi::IBroadcast");
 #endif
-#ifdef AVOID_COMPLEX_MPI
-    SafeMpi( MPI_Ibcast( buf, 2*count, MPI_FLOAT, root, comm, &request ) );
+    CommProfile profile( "IBroadcast", comm, sizeof(scomplex)*count );
+#ifdef HAVE_NONBLOCKING_COLLECTIVES
+# ifdef AVOID_COMPLEX_MPI
+    SafeMpi( 
+        NONBLOCKING_COLL(Ibcast)
+        ( buf, 2*count, MPI_FLOAT, root, comm, &request ) 
+    );
+# else
+    SafeMpi( 
+        NONBLOCKING_COLL(Ibcast)
+        ( buf, count, MPI_COMPLEX, root, comm, &request ) 
+    );
+# endif
 #else
-    SafeMpi( MPI_Ibcast( buf, count, MPI_COMPLEX, root, comm, &request ) );
+    Broadcast( buf, count, root, comm );
+    request = REQUEST_NULL;
 #endif
 #ifndef RELEASE
     PopCallStack();
@@ -1236,18 +1463,27 @@ void IBroadcast
 #ifndef RELEASE
     PushCallStack("mpi::IBroadcast");
 #endif
-#ifdef AVOID_COMPLEX_MPI
-    SafeMpi( MPI_Ibcast( buf, 2*count, MPI_DOUBLE, root, comm, &request ) );
-#else
+    CommProfile profile( "IBroadcast", comm, sizeof(dcomplex)*count );
+#ifdef HAVE_NONBLOCKING_COLLECTIVES
+# ifdef AVOID_COMPLEX_MPI
+    SafeMpi( 
+        NONBLOCKING_COLL(Ibcast)
+        ( buf, 2*count, MPI_DOUBLE, root, comm, &request ) 
+    );
+# else
     SafeMpi( 
-        MPI_Ibcast( buf, count, MPI_DOUBLE_COMPLEX, root, comm, &request ) 
+        NONBLOCKING_COLL(Ibcast)
+        ( buf, count, MPI_DOUBLE_COMPLEX, root, comm, &request ) 
     );
+# endif
+#else
+    Broadcast( buf, count, root, comm );
+    request = REQUEST_NULL;
 #endif
 #ifndef RELEASE
     PopCallStack();
 #endif
 }
-#endif // ifdef HAVE_NONBLOCKING_COLLECTIVES
 
 void Gather
 ( const byte* sbuf, int sc,
@@ -1256,6 +1492,9 @@ void Gather
 #ifndef RELEASE
     PushCallStack("mpi::Gather");
 #endif
+    CommProfile profile
+    ( "Gather", comm, 
+      sizeof(byte)*(sc+(Rank(comm)==root ? rc*Size(comm) : 0)) );
     SafeMpi( 
         MPI_Gather
         ( const_cast<byte*>(sbuf), sc, MPI_UNSIGNED_CHAR,
@@ -1273,6 +1512,8 @@ void Gather
 #ifndef RELEASE
     PushCallStack("mpi::Gather");
 #endif
+    CommProfile profile
+    ( "Gather", comm, sizeof(int)*(sc+(Rank(comm)==root ? rc*Size(comm) : 0)) );
     SafeMpi( 
         MPI_Gather
         ( const_cast<int*>(sbuf), sc, MPI_INT,
@@ -1290,6 +1531,9 @@ void Gather
 #ifndef RELEASE
     PushCallStack("mpi::Gather");
 #endif
+    CommProfile profile
+    ( "Gather", comm, 
+      sizeof(float)*(sc+(Rank(comm)==root ? rc*Size(comm) : 0)) );
     SafeMpi( 
         MPI_Gather
         ( const_cast<float*>(sbuf), sc, MPI_FLOAT,
@@ -1307,6 +1551,9 @@ void Gather
 #ifndef RELEASE
     PushCallStack("mpi::Gather");
 #endif
+    CommProfile profile
+    ( "Gather", comm, 
+      sizeof(double)*(sc+(Rank(comm)==root ? rc*Size(comm) : 0)) );
     SafeMpi( 
         MPI_Gather
         ( const_cast<double*>(sbuf), sc, MPI_DOUBLE,
@@ -1324,6 +1571,9 @@ void Gather
 #ifndef RELEASE
     PushCallStack("mpi::Gather");
 #endif
+    CommProfile profile
+    ( "Gather", comm, 
+      sizeof(scomplex)*(sc+(Rank(comm)==root ? rc*Size(comm) : 0)) );
 #ifdef AVOID_COMPLEX_MPI
     SafeMpi(
         MPI_Gather
@@ -1349,6 +1599,9 @@ void Gather
 #ifndef RELEASE
     PushCallStack("mpi::Gather");
 #endif
+    CommProfile profile
+    ( "Gather", comm, 
+      sizeof(dcomplex)*(sc+(Rank(comm)==root ? rc*Size(comm) : 0)) );
 #ifdef AVOID_COMPLEX_MPI
     SafeMpi(
         MPI_Gather
@@ -1375,8 +1628,11 @@ void IGather
 #ifndef RELEASE
     PushCallStack("mpi::IGather");
 #endif
+    CommProfile profile
+    ( "IGather", comm, 
+      sizeof(byte)*(sc+(Rank(comm)==root ? rc*Size(comm) : 0)) );
     SafeMpi( 
-        MPI_Igather
+        NONBLOCKING_COLL(Igather)
         ( const_cast<byte*>(sbuf), sc, MPI_UNSIGNED_CHAR,
           rbuf,                    rc, MPI_UNSIGNED_CHAR, 
           root, comm, &request ) 
@@ -1393,8 +1649,11 @@ void IGather
 #ifndef RELEASE
     PushCallStack("mpi::IGather");
 #endif
+    CommProfile profile
+    ( "IGather", comm, 
+      sizeof(int)*(sc+(Rank(comm)==root ? rc*Size(comm) : 0)) );
     SafeMpi( 
-        MPI_Igather
+        NONBLOCKING_COLL(Igather)
         ( const_cast<int*>(sbuf), sc, MPI_INT,
           rbuf,                   rc, MPI_INT, 
           root, comm, &request ) 
@@ -1404,15 +1663,18 @@ void IGather
 #endif
 }
 
-void Igather
+void IGather
 ( const float* sbuf, int sc,
         float* rbuf, int rc, int root, Comm comm, Request& request )
 {
 #ifndef RELEASE
     PushCallStack("mpi::IGather");
 #endif
+    CommProfile profile
+    ( "IGather", comm, 
+      sizeof(float)*(sc+(Rank(comm)==root ? rc*Size(comm) : 0)) );
     SafeMpi( 
-        MPI_Igather
+        NONBLOCKING_COLL(Igather)
         ( const_cast<float*>(sbuf), sc, MPI_FLOAT,
           rbuf,                     rc, MPI_FLOAT, 
           root, comm, &request ) 
@@ -1429,8 +1691,11 @@ void IGather
 #ifndef RELEASE
     PushCallStack("mpi::IGather");
 #endif
+    CommProfile profile
+    ( "IGather", comm, 
+      sizeof(double)*(sc+(Rank(comm)==root ? rc*Size(comm) : 0)) );
     SafeMpi( 
-        MPI_Igather
+        NONBLOCKING_COLL(Igather)
         ( const_cast<double*>(sbuf), sc, MPI_DOUBLE,
           rbuf,                      rc, MPI_DOUBLE, 
           root, comm, &request ) 
@@ -1447,16 +1712,19 @@ void IGather
 #ifndef RELEASE
     PushCallStack("mpi::IGather");
 #endif
+    CommProfile profile
+    ( "IGather", comm, 
+      sizeof(scomplex)*(sc+(Rank(comm)==root ? rc*Size(comm) : 0)) );
 #ifdef AVOID_COMPLEX_MPI
     SafeMpi(
-        MPI_Igather
+        NONBLOCKING_COLL(Igather)
         ( const_cast<scomplex*>(sbuf), 2*sc, MPI_FLOAT,
           rbuf,                        2*rc, MPI_FLOAT, 
           root, comm, &request )
     );
 #else
     SafeMpi( 
-        MPI_Igather
+        NONBLOCKING_COLL(Igather)
         ( const_cast<scomplex*>(sbuf), sc, MPI_COMPLEX,
           rbuf,                        rc, MPI_COMPLEX, 
           root, comm, &request ) 
@@ -1474,16 +1742,19 @@ void IGather
 #ifndef RELEASE
     PushCallStack("mpi::IGather");
 #endif
+    CommProfile profile
+    ( "IGather", comm, 
+      sizeof(dcomplex)*(sc+(Rank(comm)==root ? rc*Size(comm) : 0)) );
 #ifdef AVOID_COMPLEX_MPI
     SafeMpi(
-        MPI_Igather
+        NONBLOCKING_COLL(Igather)
         ( const_cast<dcomplex*>(sbuf), 2*sc, MPI_DOUBLE,
           rbuf,                        2*rc, MPI_DOUBLE, 
           root, comm, &request )
     );
 #else
     SafeMpi( 
-        MPI_Igather
+        NONBLOCKING_COLL(Igather)
         ( const_cast<dcomplex*>(sbuf), sc, MPI_DOUBLE_COMPLEX,
           rbuf,                        rc, MPI_DOUBLE_COMPLEX, 
           root, comm, &request )
@@ -1502,6 +1773,9 @@ void Gather
 #ifndef RELEASE
     PushCallStack("mpi::Gather");
 #endif
+    CommProfile profile
+    ( "Gather", comm, 
+      sizeof(byte)*(sc+(Rank(comm)==root ? Sum(rcs,comm) : 0)) );
     SafeMpi( 
         MPI_Gatherv
         ( const_cast<byte*>(sbuf), 
@@ -1526,6 +1800,8 @@ void Gather
 #ifndef RELEASE
     PushCallStack("mpi::Gather");
 #endif
+    CommProfile profile
+    ( "Gather", comm, sizeof(int)*(sc+(Rank(comm)==root ? Sum(rcs,comm) : 0)) );
     SafeMpi( 
         MPI_Gatherv
         ( const_cast<int*>(sbuf), 
@@ -1550,6 +1826,9 @@ void Gather
 #ifndef RELEASE
     PushCallStack("mpi::Gather");
 #endif
+    CommProfile profile
+    ( "Gather", comm, 
+      sizeof(float)*(sc+(Rank(comm)==root ? Sum(rcs,comm) : 0)) );
     SafeMpi( 
         MPI_Gatherv
         ( const_cast<float*>(sbuf), 
@@ -1574,6 +1853,9 @@ void Gather
 #ifndef RELEASE
     PushCallStack("mpi::Gather");
 #endif
+    CommProfile profile
+    ( "Gather", comm, 
+      sizeof(double)*(sc+(Rank(comm)==root ? Sum(rcs,comm) : 0)) );
     SafeMpi( 
         MPI_Gatherv
         ( const_cast<double*>(sbuf), 
@@ -1598,6 +1880,9 @@ void Gather
 #ifndef RELEASE
     PushCallStack("mpi::Gather");
 #endif
+    CommProfile profile
+    ( "Gather", comm, 
+      sizeof(scomplex)*(sc+(Rank(comm)==root ? Sum(rcs,comm) : 0)) );
 #ifdef AVOID_COMPLEX_MPI
     const int commRank = CommRank( comm );
     const int commSize = CommSize( comm );
@@ -1644,6 +1929,9 @@ void Gather
 #ifndef RELEASE
     PushCallStack("mpi::Gather");
 #endif
+    CommProfile profile
+    ( "Gather", comm, 
+      sizeof(dcomplex)*(sc+(Rank(comm)==root ? Sum(rcs,comm) : 0)) );
 #ifdef AVOID_COMPLEX_MPI
     const int commRank = CommRank( comm );
     const int commSize = CommSize( comm );
@@ -1690,6 +1978,7 @@ void AllGather
 #ifndef RELEASE
     PushCallStack("mpi::AllGather");
 #endif
+    CommProfile profile( "AllGather", comm, sizeof(byte)*(sc+rc*Size(comm)) );
     SafeMpi( 
         MPI_Allgather
         ( const_cast<byte*>(sbuf), sc, MPI_UNSIGNED_CHAR, 
@@ -1707,6 +1996,7 @@ void AllGather
 #ifndef RELEASE
     PushCallStack("mpi::AllGather");
 #endif
+    CommProfile profile( "AllGather", comm, sizeof(int)*(sc+rc*Size(comm)) );
 #ifdef USE_BYTE_ALLGATHERS
     SafeMpi( 
         MPI_Allgather
@@ -1732,6 +2022,7 @@ void AllGather
 #ifndef RELEASE
     PushCallStack("mpi::AllGather");
 #endif
+    CommProfile profile( "AllGather", comm, sizeof(float)*(sc+rc*Size(comm)) );
 #ifdef USE_BYTE_ALLGATHERS
     SafeMpi( 
         MPI_Allgather
@@ -1757,6 +2048,7 @@ void AllGather
 #ifndef RELEASE
     PushCallStack("mpi::AllGather");
 #endif
+    CommProfile profile( "AllGather", comm, sizeof(double)*(sc+rc*Size(comm)) );
 #ifdef USE_BYTE_ALLGATHERS
     SafeMpi( 
         MPI_Allgather
@@ -1783,6 +2075,8 @@ void AllGather
 #ifndef RELEASE
     PushCallStack("mpi::AllGather");
 #endif
+    CommProfile profile
+    ( "AllGather", comm, sizeof(scomplex)*(sc+rc*Size(comm)) );
 #ifdef USE_BYTE_ALLGATHERS
     SafeMpi( 
         MPI_Allgather
@@ -1817,6 +2111,8 @@ void AllGather
 #ifndef RELEASE
     PushCallStack("mpi::AllGather");
 #endif
+    CommProfile profile
+    ( "AllGather", comm, sizeof(dcomplex)*(sc+rc*Size(comm)) );
 #ifdef USE_BYTE_ALLGATHERS
     SafeMpi( 
         MPI_Allgather
@@ -1851,6 +2147,7 @@ void AllGather
 #ifndef RELEASE
     PushCallStack("mpi::AllGather");
 #endif
+    CommProfile profile( "AllGather", comm, sizeof(byte)*(sc+Sum(rcs,comm)) );
     SafeMpi( 
         MPI_Allgatherv
         ( const_cast<byte*>(sbuf), 
@@ -1874,6 +2171,7 @@ void AllGather
 #ifndef RELEASE
     PushCallStack("mpi::AllGather");
 #endif
+    CommProfile profile( "AllGather", comm, sizeof(int)*(sc+Sum(rcs,comm)) );
 #ifdef USE_BYTE_ALLGATHERS
     const int commSize = mpi::CommSize( comm );
     std::vector<int> byteRcs( commSize ), byteRds( commSize );
@@ -1912,6 +2210,7 @@ void AllGather
 #ifndef RELEASE
     PushCallStack("mpi::AllGather");
 #endif
+    CommProfile profile( "AllGather", comm, sizeof(float)*(sc+Sum(rcs,comm)) );
 #ifdef USE_BYTE_ALLGATHERS
     const int commSize = mpi::CommSize( comm );
     std::vector<int> byteRcs( commSize ), byteRds( commSize );
@@ -1950,6 +2249,7 @@ void AllGather
 #ifndef RELEASE
     PushCallStack("mpi::AllGather");
 #endif
+    CommProfile profile( "AllGather", comm, sizeof(double)*(sc+Sum(rcs,comm)) );
 #ifdef USE_BYTE_ALLGATHERS
     const int commSize = mpi::CommSize( comm );
     std::vector<int> byteRcs( commSize ), byteRds( commSize );
@@ -1988,6 +2288,8 @@ void AllGather
 #ifndef RELEASE
     PushCallStack("mpi::AllGather");
 #endif
+    CommProfile profile
+    ( "AllGather", comm, sizeof(scomplex)*(sc+Sum(rcs,comm)) );
 #ifdef USE_BYTE_ALLGATHERS
     const int commSize = mpi::CommSize( comm );
     std::vector<int> byteRcs( commSize ), byteRds( commSize );
@@ -2041,6 +2343,8 @@ void AllGather
 #ifndef RELEASE
     PushCallStack("mpi::AllGather");
 #endif
+    CommProfile profile
+    ( "AllGather", comm, sizeof(dcomplex)*(sc+Sum(rcs,comm)) );
 #ifdef USE_BYTE_ALLGATHERS
     const int commSize = mpi::CommSize( comm );
     std::vector<int> byteRcs( commSize ), byteRds( commSize );
@@ -2087,6 +2391,208 @@ void AllGather
 #endif
 }
 
+void IAllGather
+( const byte* sbuf, int sc,
+        byte* rbuf, int rc, Comm comm, Request& request )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::IAllGather");
+#endif
+    CommProfile profile( "IAllGather", comm, sizeof(byte)*(sc+rc*Size(comm)) );
+#ifdef HAVE_NONBLOCKING_COLLECTIVES
+    SafeMpi( 
+        NONBLOCKING_COLL(Iallgather)
+        ( const_cast<byte*>(sbuf), sc, MPI_UNSIGNED_CHAR,
+          rbuf,                    rc, MPI_UNSIGNED_CHAR, comm, &request ) 
+    );
+#else
+    AllGather( sbuf, sc, rbuf, rc, comm );
+    request = REQUEST_NULL;
+#endif
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void IAllGather
+( const int* sbuf, int sc,
+        int* rbuf, int rc, Comm comm, Request& request )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::IAllGather");
+#endif
+    CommProfile profile( "IAllGather", comm, sizeof(int)*(sc+rc*Size(comm)) );
+#ifdef HAVE_NONBLOCKING_COLLECTIVES
+# ifdef USE_BYTE_ALLGATHERS
+    SafeMpi( 
+        NONBLOCKING_COLL(Iallgather)
+        ( const_cast<int*>(sbuf), sizeof(int)*sc, MPI_UNSIGNED_CHAR,
+          rbuf,                   sizeof(int)*rc, MPI_UNSIGNED_CHAR,
+          comm, &request ) 
+    );
+# else
+    SafeMpi( 
+        NONBLOCKING_COLL(Iallgather)
+        ( const_cast<int*>(sbuf), sc, MPI_INT,
+          rbuf,                   rc, MPI_INT, comm, &request ) 
+    );
+# endif
+#else
+    AllGather( sbuf, sc, rbuf, rc, comm );
+    request = REQUEST_NULL;
+#endif
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void IAllGather
+( const float* sbuf, int sc,
+        float* rbuf, int rc, Comm comm, Request& request )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::IAllGather");
+#endif
+    CommProfile profile( "IAllGather", comm, sizeof(float)*(sc+rc*Size(comm)) );
+#ifdef HAVE_NONBLOCKING_COLLECTIVES
+# ifdef USE_BYTE_ALLGATHERS
+    SafeMpi( 
+        NONBLOCKING_COLL(Iallgather)
+        ( const_cast<float*>(sbuf), sizeof(float)*sc, MPI_UNSIGNED_CHAR,
+          rbuf,                     sizeof(float)*rc, MPI_UNSIGNED_CHAR,
+          comm, &request ) 
+    );
+# else
+    SafeMpi( 
+        NONBLOCKING_COLL(Iallgather)
+        ( const_cast<float*>(sbuf), sc, MPI_FLOAT,
+          rbuf,                     rc, MPI_FLOAT, comm, &request ) 
+    );
+# endif
+#else
+    AllGather( sbuf, sc, rbuf, rc, comm );
+    request = REQUEST_NULL;
+#endif
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void IAllGather
+( const double* sbuf, int sc,
+        double* rbuf, int rc, Comm comm, Request& request )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::IAllGather");
+#endif
+    CommProfile profile
+    ( "IAllGather", comm, sizeof(double)*(sc+rc*Size(comm)) );
+#ifdef HAVE_NONBLOCKING_COLLECTIVES
+# ifdef USE_BYTE_ALLGATHERS
+    SafeMpi( 
+        NONBLOCKING_COLL(Iallgather)
+        ( const_cast<double*>(sbuf), sizeof(double)*sc, MPI_UNSIGNED_CHAR,
+          rbuf,                      sizeof(double)*rc, MPI_UNSIGNED_CHAR,
+          comm, &request ) 
+    );
+# else
+    SafeMpi( 
+        NONBLOCKING_COLL(Iallgather)
+        ( const_cast<double*>(sbuf), sc, MPI_DOUBLE,
+          rbuf,                      rc, MPI_DOUBLE, comm, &request ) 
+    );
+# endif
+#else
+    AllGather( sbuf, sc, rbuf, rc, comm );
+    request = REQUEST_NULL;
+#endif
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void IAllGather
+( const scomplex* sbuf, int sc,
+        scomplex* rbuf, int rc, Comm comm, Request& request )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::IAllGather");
+#endif
+    CommProfile profile
+    ( "IAllGather", comm, sizeof(scomplex)*(sc+rc*Size(comm)) );
+#ifdef HAVE_NONBLOCKING_COLLECTIVES
+# ifdef USE_BYTE_ALLGATHERS
+    SafeMpi( 
+        NONBLOCKING_COLL(Iallgather)
+        ( const_cast<scomplex*>(sbuf), 2*sizeof(float)*sc, MPI_UNSIGNED_CHAR,
+          rbuf,                        2*sizeof(float)*rc, MPI_UNSIGNED_CHAR,
+          comm, &request ) 
+    );
+# else
+#  ifdef AVOID_COMPLEX_MPI
+    SafeMpi( 
+        NONBLOCKING_COLL(Iallgather)
+        ( const_cast<scomplex*>(sbuf), 2*sc, MPI_FLOAT,
+          rbuf,                        2*rc, MPI_FLOAT, comm, &request ) 
+    );
+#  else
+    SafeMpi( 
+        NONBLOCKING_COLL(Iallgather)
+        ( const_cast<scomplex*>(sbuf), sc, MPI_COMPLEX,
+          rbuf,                        rc, MPI_COMPLEX, comm, &request ) 
+    );
+#  endif
+# endif
+#else
+    AllGather( sbuf, sc, rbuf, rc, comm );
+    request = REQUEST_NULL;
+#endif
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void IAllGather
+( const dcomplex* sbuf, int sc,
+        dcomplex* rbuf, int rc, Comm comm, Request& request )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::IAllGather");
+#endif
+    CommProfile profile
+    ( "IAllGather", comm, sizeof(dcomplex)*(sc+rc*Size(comm)) );
+#ifdef HAVE_NONBLOCKING_COLLECTIVES
+# ifdef USE_BYTE_ALLGATHERS
+    SafeMpi( 
+        NONBLOCKING_COLL(Iallgather)
+        ( const_cast<dcomplex*>(sbuf), 2*sizeof(double)*sc, MPI_UNSIGNED_CHAR,
+          rbuf,                        2*sizeof(double)*rc, MPI_UNSIGNED_CHAR,
+          comm, &request ) 
+    );
+# else
+#  ifdef AVOID_COMPLEX_MPI
+    SafeMpi( 
+        NONBLOCKING_COLL(Iallgather)
+        ( const_cast<dcomplex*>(sbuf), 2*sc, MPI_DOUBLE,
+          rbuf,                        2*rc, MPI_DOUBLE, comm, &request ) 
+    );
+#  else
+    SafeMpi( 
+        NONBLOCKING_COLL(Iallgather)
+        ( const_cast<dcomplex*>(sbuf), sc, MPI_DOUBLE_COMPLEX,
+          rbuf,                        rc, MPI_DOUBLE_COMPLEX, comm, &request ) 
+    );
+#  endif
+# endif
+#else
+    AllGather( sbuf, sc, rbuf, rc, comm );
+    request = REQUEST_NULL;
+#endif
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
 void Scatter
 ( const byte* sbuf, int sc,
         byte* rbuf, int rc, int root, Comm comm )
@@ -2094,6 +2600,9 @@ void Scatter
 #ifndef RELEASE
     PushCallStack("mpi::Scatter");
 #endif
+    CommProfile profile
+    ( "Scatter", comm, 
+      sizeof(byte)*((Rank(comm)==root ? sc*Size(comm) : 0)+rc) );
     SafeMpi( 
         MPI_Scatter
         ( const_cast<byte*>(sbuf), sc, MPI_UNSIGNED_CHAR,
@@ -2111,6 +2620,9 @@ void Scatter
 #ifndef RELEASE
     PushCallStack("mpi::Scatter");
 #endif
+    CommProfile profile
+    ( "Scatter", comm, 
+      sizeof(int)*((Rank(comm)==root ? sc*Size(comm) : 0)+rc) );
     SafeMpi( 
         MPI_Scatter
         ( const_cast<int*>(sbuf), sc, MPI_INT,
@@ -2128,6 +2640,9 @@ void Scatter
 #ifndef RELEASE
     PushCallStack("mpi::Scatter");
 #endif
+    CommProfile profile
+    ( "Scatter", comm, 
+      sizeof(float)*((Rank(comm)==root ? sc*Size(comm) : 0)+rc) );
     SafeMpi( 
         MPI_Scatter
         ( const_cast<float*>(sbuf), sc, MPI_FLOAT,
@@ -2145,6 +2660,9 @@ void Scatter
 #ifndef RELEASE
     PushCallStack("mpi::Scatter");
 #endif
+    CommProfile profile
+    ( "Scatter", comm, 
+      sizeof(double)*((Rank(comm)==root ? sc*Size(comm) : 0)+rc) );
     SafeMpi( 
         MPI_Scatter
         ( const_cast<double*>(sbuf), sc, MPI_DOUBLE,
@@ -2162,6 +2680,9 @@ void Scatter
 #ifndef RELEASE
     PushCallStack("mpi::Scatter");
 #endif
+    CommProfile profile
+    ( "Scatter", comm, 
+      sizeof(scomplex)*((Rank(comm)==root ? sc*Size(comm) : 0)+rc) );
 #ifdef AVOID_COMPLEX_MPI
     SafeMpi(
         MPI_Scatter
@@ -2187,6 +2708,9 @@ void Scatter
 #ifndef RELEASE
     PushCallStack("mpi::Scatter");
 #endif
+    CommProfile profile
+    ( "Scatter", comm, 
+      sizeof(dcomplex)*((Rank(comm)==root ? sc*Size(comm) : 0)+rc) );
 #ifdef AVOID_COMPLEX_MPI
     SafeMpi(
         MPI_Scatter
@@ -2210,6 +2734,9 @@ void Scatter( byte* buf, int sc, int rc, int root, Comm comm )
 #ifndef RELEASE
     PushCallStack("mpi::Scatter");
 #endif
+    CommProfile profile
+    ( "Scatter", comm, 
+      sizeof(byte)*((Rank(comm)==root ? sc*Size(comm) : 0)+rc) );
     const int commRank = CommRank( comm );
     if( commRank == root )
     {
@@ -2248,6 +2775,9 @@ void Scatter( int* buf, int sc, int rc, int root, Comm comm )
 #ifndef RELEASE
     PushCallStack("mpi::Scatter");
 #endif
+    CommProfile profile
+    ( "Scatter", comm, 
+      sizeof(int)*((Rank(comm)==root ? sc*Size(comm) : 0)+rc) );
     const int commRank = CommRank( comm );
     if( commRank == root )
     {
@@ -2286,6 +2816,9 @@ void Scatter( float* buf, int sc, int rc, int root, Comm comm )
 #ifndef RELEASE
     PushCallStack("mpi::Scatter");
 #endif
+    CommProfile profile
+    ( "Scatter", comm, 
+      sizeof(float)*((Rank(comm)==root ? sc*Size(comm) : 0)+rc) );
     const int commRank = CommRank( comm );
     if( commRank == root )
     {
@@ -2324,6 +2857,9 @@ void Scatter( double* buf, int sc, int rc, int root, Comm comm )
 #ifndef RELEASE
     PushCallStack("mpi::Scatter");
 #endif
+    CommProfile profile
+    ( "Scatter", comm, 
+      sizeof(double)*((Rank(comm)==root ? sc*Size(comm) : 0)+rc) );
     const int commRank = CommRank( comm );
     if( commRank == root )
     {
@@ -2362,6 +2898,9 @@ void Scatter( scomplex* buf, int sc, int rc, int root, Comm comm )
 #ifndef RELEASE
     PushCallStack("mpi::Scatter");
 #endif
+    CommProfile profile
+    ( "Scatter", comm, 
+      sizeof(scomplex)*((Rank(comm)==root ? sc*Size(comm) : 0)+rc) );
     const int commRank = CommRank( comm );
     if( commRank == root )
     {
@@ -2427,6 +2966,9 @@ void Scatter( dcomplex* buf, int sc, int rc, int root, Comm comm )
 #ifndef RELEASE
     PushCallStack("mpi::Scatter");
 #endif
+    CommProfile profile
+    ( "Scatter", comm, 
+      sizeof(dcomplex)*((Rank(comm)==root ? sc*Size(comm) : 0)+rc) );
     const int commRank = CommRank( comm );
     if( commRank == root )
     {
@@ -2494,6 +3036,7 @@ void AllToAll
 #ifndef RELEASE
     PushCallStack("mpi::AllToAll");
 #endif
+    CommProfile profile( "AllToAll", comm, sizeof(byte)*(sc+rc)*Size(comm) );
     SafeMpi( 
         MPI_Alltoall
         ( const_cast<byte*>(sbuf), sc, MPI_UNSIGNED_CHAR,
@@ -2511,6 +3054,7 @@ void AllToAll
 #ifndef RELEASE
     PushCallStack("mpi::AllToAll");
 #endif
+    CommProfile profile( "AllToAll", comm, sizeof(int)*(sc+rc)*Size(comm) );
     SafeMpi( 
         MPI_Alltoall
         ( const_cast<int*>(sbuf), sc, MPI_INT,
@@ -2528,6 +3072,7 @@ void AllToAll
 #ifndef RELEASE
     PushCallStack("mpi::AllToAll");
 #endif
+    CommProfile profile( "AllToAll", comm, sizeof(float)*(sc+rc)*Size(comm) );
     SafeMpi( 
         MPI_Alltoall
         ( const_cast<float*>(sbuf), sc, MPI_FLOAT,
@@ -2545,6 +3090,7 @@ void AllToAll
 #ifndef RELEASE
     PushCallStack("mpi::AllToAll");
 #endif
+    CommProfile profile( "AllToAll", comm, sizeof(double)*(sc+rc)*Size(comm) );
     SafeMpi( 
         MPI_Alltoall
         ( const_cast<double*>(sbuf), sc, MPI_DOUBLE,
@@ -2562,6 +3108,8 @@ void AllToAll
 #ifndef RELEASE
     PushCallStack("mpi::AllToAll");
 #endif
+    CommProfile profile
+    ( "AllToAll", comm, sizeof(scomplex)*(sc+rc)*Size(comm) );
 #ifdef AVOID_COMPLEX_MPI
     SafeMpi(
         MPI_Alltoall
@@ -2587,6 +3135,8 @@ void AllToAll
 #ifndef RELEASE
     PushCallStack("mpi::AllToAll");
 #endif
+    CommProfile profile
+    ( "AllToAll", comm, sizeof(dcomplex)*(sc+rc)*Size(comm) );
 #ifdef AVOID_COMPLEX_MPI
     SafeMpi(
         MPI_Alltoall
@@ -2605,43 +3155,203 @@ void AllToAll
 #endif
 }
 
-void AllToAll
-( const byte* sbuf, const int* scs, const int* sds, 
-        byte* rbuf, const int* rcs, const int* rds, Comm comm )
+void IAllToAll
+( const byte* sbuf, int sc,
+        byte* rbuf, int rc, Comm comm, Request& request )
 {
 #ifndef RELEASE
-    PushCallStack("mpi::AllToAll");
+    PushCallStack("mpi::IAllToAll");
 #endif
+    CommProfile profile( "IAllToAll", comm, sizeof(byte)*(sc+rc)*Size(comm) );
+#ifdef HAVE_NONBLOCKING_COLLECTIVES
     SafeMpi( 
-        MPI_Alltoallv
-        ( const_cast<byte*>(sbuf), 
-          const_cast<int*>(scs), 
-          const_cast<int*>(sds), 
-          MPI_UNSIGNED_CHAR,
-          rbuf, 
-          const_cast<int*>(rcs), 
-          const_cast<int*>(rds), 
-          MPI_UNSIGNED_CHAR, 
-          comm ) 
-    ); 
+        NONBLOCKING_COLL(Ialltoall)
+        ( const_cast<byte*>(sbuf), sc, MPI_UNSIGNED_CHAR,
+          rbuf,                    rc, MPI_UNSIGNED_CHAR, comm, &request ) 
+    );
+#else
+    AllToAll( sbuf, sc, rbuf, rc, comm );
+    request = REQUEST_NULL;
+#endif
 #ifndef RELEASE
     PopCallStack();
 #endif
 }
 
-void AllToAll
-( const int* sbuf, const int* scs, const int* sds, 
-        int* rbuf, const int* rcs, const int* rds, Comm comm )
+void IAllToAll
+( const int* sbuf, int sc,
+        int* rbuf, int rc, Comm comm, Request& request )
 {
 #ifndef RELEASE
-    PushCallStack("mpi::AllToAll");
+    PushCallStack("mpi::IAllToAll");
 #endif
+    CommProfile profile( "IAllToAll", comm, sizeof(int)*(sc+rc)*Size(comm) );
+#ifdef HAVE_NONBLOCKING_COLLECTIVES
     SafeMpi( 
-        MPI_Alltoallv
-        ( const_cast<int*>(sbuf), 
-          const_cast<int*>(scs), 
-          const_cast<int*>(sds), 
-          MPI_INT,
+        NONBLOCKING_COLL(Ialltoall)
+        ( const_cast<int*>(sbuf), sc, MPI_INT,
+          rbuf,                   rc, MPI_INT, comm, &request ) 
+    );
+#else
+    AllToAll( sbuf, sc, rbuf, rc, comm );
+    request = REQUEST_NULL;
+#endif
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void IAllToAll
+( const float* sbuf, int sc,
+        float* rbuf, int rc, Comm comm, Request& request )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::IAllToAll");
+#endif
+    CommProfile profile( "IAllToAll", comm, sizeof(float)*(sc+rc)*Size(comm) );
+#ifdef HAVE_NONBLOCKING_COLLECTIVES
+    SafeMpi( 
+        NONBLOCKING_COLL(Ialltoall)
+        ( const_cast<float*>(sbuf), sc, MPI_FLOAT,
+          rbuf,                     rc, MPI_FLOAT, comm, &request ) 
+    );
+#else
+    AllToAll( sbuf, sc, rbuf, rc, comm );
+    request = REQUEST_NULL;
+#endif
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void IAllToAll
+( const double* sbuf, int sc,
+        double* rbuf, int rc, Comm comm, Request& request )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::IAllToAll");
+#endif
+    CommProfile profile( "IAllToAll", comm, sizeof(double)*(sc+rc)*Size(comm) );
+#ifdef HAVE_NONBLOCKING_COLLECTIVES
+    SafeMpi( 
+        NONBLOCKING_COLL(Ialltoall)
+        ( const_cast<double*>(sbuf), sc, MPI_DOUBLE,
+          rbuf,                      rc, MPI_DOUBLE, comm, &request ) 
+    );
+#else
+    AllToAll( sbuf, sc, rbuf, rc, comm );
+    request = REQUEST_NULL;
+#endif
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void IAllToAll
+( const scomplex* sbuf, int sc,
+        scomplex* rbuf, int rc, Comm comm, Request& request )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::IAllToAll");
+#endif
+    CommProfile profile
+    ( "IAllToAll", comm, sizeof(scomplex)*(sc+rc)*Size(comm) );
+#ifdef HAVE_NONBLOCKING_COLLECTIVES
+# ifdef AVOID_COMPLEX_MPI
+    SafeMpi( 
+        NONBLOCKING_COLL(Ialltoall)
+        ( const_cast<scomplex*>(sbuf), 2*sc, MPI_FLOAT,
+          rbuf,                        2*rc, MPI_FLOAT, comm, &request ) 
+    );
+# else
+    SafeMpi( 
+        NONBLOCKING_COLL(Ialltoall)
+        ( const_cast<scomplex*>(sbuf), sc, MPI_COMPLEX,
+          rbuf,                        rc, MPI_COMPLEX, comm, &request ) 
+    );
+# endif
+#else
+    AllToAll( sbuf, sc, rbuf, rc, comm );
+    request = REQUEST_NULL;
+#endif
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void IAllToAll
+( const dcomplex* sbuf, int sc,
+        dcomplex* rbuf, int rc, Comm comm, Request& request )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::IAllToAll");
+#endif
+    CommProfile profile
+    ( "IAllToAll", comm, sizeof(dcomplex)*(sc+rc)*Size(comm) );
+#ifdef HAVE_NONBLOCKING_COLLECTIVES
+# ifdef AVOID_COMPLEX_MPI
+    SafeMpi( 
+        NONBLOCKING_COLL(Ialltoall)
+        ( const_cast<dcomplex*>(sbuf), 2*sc, MPI_DOUBLE,
+          rbuf,                        2*rc, MPI_DOUBLE, comm, &request ) 
+    );
+# else
+    SafeMpi( 
+        NONBLOCKING_COLL(Ialltoall)
+        ( const_cast<dcomplex*>(sbuf), sc, MPI_DOUBLE_COMPLEX,
+          rbuf,                        rc, MPI_DOUBLE_COMPLEX, comm, &request ) 
+    );
+# endif
+#else
+    AllToAll( sbuf, sc, rbuf, rc, comm );
+    request = REQUEST_NULL;
+#endif
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void AllToAll
+( const byte* sbuf, const int* scs, const int* sds, 
+        byte* rbuf, const int* rcs, const int* rds, Comm comm )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::AllToAll");
+#endif
+    CommProfile profile
+    ( "AllToAll", comm, sizeof(byte)*(Sum(scs,comm)+Sum(rcs,comm)) );
+    SafeMpi( 
+        MPI_Alltoallv
+        ( const_cast<byte*>(sbuf), 
+          const_cast<int*>(scs), 
+          const_cast<int*>(sds), 
+          MPI_UNSIGNED_CHAR,
+          rbuf, 
+          const_cast<int*>(rcs), 
+          const_cast<int*>(rds), 
+          MPI_UNSIGNED_CHAR, 
+          comm ) 
+    ); 
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void AllToAll
+( const int* sbuf, const int* scs, const int* sds, 
+        int* rbuf, const int* rcs, const int* rds, Comm comm )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::AllToAll");
+#endif
+    CommProfile profile
+    ( "AllToAll", comm, sizeof(int)*(Sum(scs,comm)+Sum(rcs,comm)) );
+    SafeMpi( 
+        MPI_Alltoallv
+        ( const_cast<int*>(sbuf), 
+          const_cast<int*>(scs), 
+          const_cast<int*>(sds), 
+          MPI_INT,
           rbuf, 
           const_cast<int*>(rcs), 
           const_cast<int*>(rds), 
@@ -2660,6 +3370,8 @@ void AllToAll
 #ifndef RELEASE
     PushCallStack("mpi::AllToAll");
 #endif
+    CommProfile profile
+    ( "AllToAll", comm, sizeof(float)*(Sum(scs,comm)+Sum(rcs,comm)) );
     SafeMpi( 
         MPI_Alltoallv
         ( const_cast<float*>(sbuf), 
@@ -2684,6 +3396,8 @@ void AllToAll
 #ifndef RELEASE
     PushCallStack("mpi::AllToAll");
 #endif
+    CommProfile profile
+    ( "AllToAll", comm, sizeof(double)*(Sum(scs,comm)+Sum(rcs,comm)) );
     SafeMpi( 
         MPI_Alltoallv
         ( const_cast<double*>(sbuf), 
@@ -2708,6 +3422,8 @@ void AllToAll
 #ifndef RELEASE
     PushCallStack("mpi::AllToAll");
 #endif
+    CommProfile profile
+    ( "AllToAll", comm, sizeof(scomplex)*(Sum(scs,comm)+Sum(rcs,comm)) );
 #ifdef AVOID_COMPLEX_MPI
     int p;
     MPI_Comm_size( comm, &p );
@@ -2755,6 +3471,8 @@ void AllToAll
 #ifndef RELEASE
     PushCallStack("mpi::AllToAll");
 #endif
+    CommProfile profile
+    ( "AllToAll", comm, sizeof(dcomplex)*(Sum(scs,comm)+Sum(rcs,comm)) );
 #ifdef AVOID_COMPLEX_MPI
     int p;
     MPI_Comm_size( comm, &p );
@@ -2801,6 +3519,8 @@ void Reduce
 #ifndef RELEASE
     PushCallStack("mpi::Reduce");
 #endif
+    CommProfile profile
+    ( "Reduce", comm, sizeof(byte)*count*(Rank(comm)==root ? 2 : 1) );
     if( count != 0 )
     {
         SafeMpi( 
@@ -2819,6 +3539,8 @@ void Reduce( byte* buf, int count, Op op, int root, Comm comm )
 #ifndef RELEASE
     PushCallStack("mpi::Reduce");
 #endif
+    CommProfile profile
+    ( "Reduce", comm, sizeof(byte)*count*(Rank(comm)==root ? 2 : 1) );
     if( count != 0 )
     {
         const int commRank = CommRank( comm );
@@ -2855,6 +3577,8 @@ void Reduce
 #ifndef RELEASE
     PushCallStack("mpi::Reduce");
 #endif
+    CommProfile profile
+    ( "Reduce", comm, sizeof(int)*count*(Rank(comm)==root ? 2 : 1) );
     if( count != 0 )
     {
         SafeMpi( 
@@ -2872,6 +3596,8 @@ void Reduce( int* buf, int count, Op op, int root, Comm comm )
 #ifndef RELEASE
     PushCallStack("mpi::Reduce");
 #endif
+    CommProfile profile
+    ( "Reduce", comm, sizeof(int)*count*(Rank(comm)==root ? 2 : 1) );
     if( count != 0 )
     {
         const int commRank = CommRank( comm );
@@ -2907,6 +3633,8 @@ void Reduce
 #ifndef RELEASE
     PushCallStack("mpi::Reduce");
 #endif
+    CommProfile profile
+    ( "Reduce", comm, sizeof(float)*count*(Rank(comm)==root ? 2 : 1) );
     if( count != 0 )
     {
         SafeMpi( 
@@ -2924,6 +3652,8 @@ void Reduce( float* buf, int count, Op op, int root, Comm comm )
 #ifndef RELEASE
     PushCallStack("mpi::Reduce");
 #endif
+    CommProfile profile
+    ( "Reduce", comm, sizeof(float)*count*(Rank(comm)==root ? 2 : 1) );
     if( count != 0 )
     {
         const int commRank = CommRank( comm );
@@ -2959,6 +3689,8 @@ void Reduce
 #ifndef RELEASE
     PushCallStack("mpi::Reduce");
 #endif
+    CommProfile profile
+    ( "Reduce", comm, sizeof(double)*count*(Rank(comm)==root ? 2 : 1) );
     if( count != 0 )
     {
         SafeMpi( 
@@ -2977,6 +3709,8 @@ void Reduce( double* buf, int count, Op op, int root, Comm comm )
 #ifndef RELEASE
     PushCallStack("mpi::Reduce");
 #endif
+    CommProfile profile
+    ( "Reduce", comm, sizeof(double)*count*(Rank(comm)==root ? 2 : 1) );
     if( count != 0 )
     {
         const int commRank = CommRank( comm );
@@ -3013,6 +3747,8 @@ void Reduce
 #ifndef RELEASE
     PushCallStack("mpi::Reduce");
 #endif
+    CommProfile profile
+    ( "Reduce", comm, sizeof(scomplex)*count*(Rank(comm)==root ? 2 : 1) );
     if( count != 0 )
     {
 #ifdef AVOID_COMPLEX_MPI
@@ -3050,6 +3786,8 @@ void Reduce( scomplex* buf, int count, Op op, int root, Comm comm )
 #ifndef RELEASE
     PushCallStack("mpi::Reduce");
 #endif
+    CommProfile profile
+    ( "Reduce", comm, sizeof(scomplex)*count*(Rank(comm)==root ? 2 : 1) );
     if( count != 0 )
     {
         const int commRank = CommRank( comm );
@@ -3137,6 +3875,8 @@ void Reduce
 #ifndef RELEASE
     PushCallStack("mpi::Reduce");
 #endif
+    CommProfile profile
+    ( "Reduce", comm, sizeof(dcomplex)*count*(Rank(comm)==root ? 2 : 1) );
     if( count != 0 )
     {
 #ifdef AVOID_COMPLEX_MPI
@@ -3174,6 +3914,8 @@ void Reduce( dcomplex* buf, int count, Op op, int root, Comm comm )
 #ifndef RELEASE
     PushCallStack("mpi::Reduce");
 #endif
+    CommProfile profile
+    ( "Reduce", comm, sizeof(dcomplex)*count*(Rank(comm)==root ? 2 : 1) );
     if( count != 0 )
     {
         const int commRank = CommRank( comm );
@@ -3262,6 +4004,7 @@ void AllReduce( const byte* sbuf, byte* rbuf, int count, Op op, Comm comm )
 #ifndef RELEASE
     PushCallStack("mpi::AllReduce");
 #endif
+    CommProfile profile( "AllReduce", comm, 2*sizeof(byte)*count );
     if( count != 0 )
     {
         SafeMpi( 
@@ -3280,6 +4023,7 @@ void AllReduce( byte* buf, int count, Op op, Comm comm )
 #ifndef RELEASE
     PushCallStack("mpi::AllReduce");
 #endif
+    CommProfile profile( "AllReduce", comm, 2*sizeof(byte)*count );
     if( count != 0 )
     {
 #ifdef HAVE_MPI_IN_PLACE
@@ -3306,6 +4050,7 @@ void AllReduce( const int* sbuf, int* rbuf, int count, Op op, Comm comm )
 #ifndef RELEASE
     PushCallStack("mpi::AllReduce");
 #endif
+    CommProfile profile( "AllReduce", comm, 2*sizeof(int)*count );
     if( count != 0 )
     {
         SafeMpi( 
@@ -3323,6 +4068,7 @@ void AllReduce( int* buf, int count, Op op, Comm comm )
 #ifndef RELEASE
     PushCallStack("mpi::AllReduce");
 #endif
+    CommProfile profile( "AllReduce", comm, 2*sizeof(int)*count );
     if( count != 0 )
     {
 #ifdef HAVE_MPI_IN_PLACE
@@ -3347,6 +4093,7 @@ void AllReduce( const float* sbuf, float* rbuf, int count, Op op, Comm comm )
 #ifndef RELEASE
     PushCallStack("mpi::AllReduce");
 #endif
+    CommProfile profile( "AllReduce", comm, 2*sizeof(float)*count );
     if( count != 0 )
     {
         SafeMpi( 
@@ -3364,6 +4111,7 @@ void AllReduce( float* buf, int count, Op op, Comm comm )
 #ifndef RELEASE
     PushCallStack("mpi::AllReduce");
 #endif
+    CommProfile profile( "AllReduce", comm, 2*sizeof(float)*count );
     if( count != 0 )
     {
 #ifdef HAVE_MPI_IN_PLACE
@@ -3388,6 +4136,7 @@ void AllReduce( const double* sbuf, double* rbuf, int count, Op op, Comm comm )
 #ifndef RELEASE
     PushCallStack("mpi::AllReduce");
 #endif
+    CommProfile profile( "AllReduce", comm, 2*sizeof(double)*count );
     if( count != 0 )
     {
         SafeMpi( 
@@ -3405,6 +4154,7 @@ void AllReduce( double* buf, int count, Op op, Comm comm )
 #ifndef RELEASE
     PushCallStack("mpi::AllReduce");
 #endif
+    CommProfile profile( "AllReduce", comm, 2*sizeof(double)*count );
     if( count != 0 )
     {
 #ifdef HAVE_MPI_IN_PLACE
@@ -3430,6 +4180,7 @@ void AllReduce
 #ifndef RELEASE
     PushCallStack("mpi::AllReduce");
 #endif
+    CommProfile profile( "AllReduce", comm, 2*sizeof(scomplex)*count );
     if( count != 0 )
     {
 #ifdef AVOID_COMPLEX_MPI
@@ -3467,6 +4218,7 @@ void AllReduce( scomplex* buf, int count, Op op, Comm comm )
 #ifndef RELEASE
     PushCallStack("mpi::AllReduce");
 #endif
+    CommProfile profile( "AllReduce", comm, 2*sizeof(scomplex)*count );
     if( count != 0 )
     {
 #ifdef AVOID_COMPLEX_MPI
@@ -3523,6 +4275,7 @@ void AllReduce
 #ifndef RELEASE
     PushCallStack("mpi::AllReduce");
 #endif
+    CommProfile profile( "AllReduce", comm, 2*sizeof(dcomplex)*count );
     if( count != 0 )
     {
 #ifdef AVOID_COMPLEX_MPI
@@ -3560,6 +4313,7 @@ void AllReduce( dcomplex* buf, int count, Op op, Comm comm )
 #ifndef RELEASE
     PushCallStack("mpi::AllReduce");
 #endif
+    CommProfile profile( "AllReduce", comm, 2*sizeof(dcomplex)*count );
     if( count != 0 )
     {
 #ifdef AVOID_COMPLEX_MPI
@@ -3616,11 +4370,207 @@ void AllReduce( dcomplex* buf, int count, Op op, Comm comm )
 #endif
 }
 
+void IAllReduce
+( const byte* sbuf, byte* rbuf, int count, 
+  Op op, Comm comm, Request& request )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::IAllReduce");
+#endif
+    CommProfile profile( "IAllReduce", comm, 2*sizeof(byte)*count );
+    request = REQUEST_NULL;
+    if( count != 0 )
+    {
+#ifdef HAVE_NONBLOCKING_COLLECTIVES
+        SafeMpi( 
+            NONBLOCKING_COLL(Iallreduce)
+            ( const_cast<byte*>(sbuf), rbuf, count, MPI_UNSIGNED_CHAR, op,
+              comm, &request ) 
+        );
+#else
+        AllReduce( sbuf, rbuf, count, op, comm );
+#endif
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void IAllReduce
+( const int* sbuf, int* rbuf, int count, 
+  Op op, Comm comm, Request& request )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::IAllReduce");
+#endif
+    CommProfile profile( "IAllReduce", comm, 2*sizeof(int)*count );
+    request = REQUEST_NULL;
+    if( count != 0 )
+    {
+#ifdef HAVE_NONBLOCKING_COLLECTIVES
+        SafeMpi( 
+            NONBLOCKING_COLL(Iallreduce)
+            ( const_cast<int*>(sbuf), rbuf, count, MPI_INT, op,
+              comm, &request ) 
+        );
+#else
+        AllReduce( sbuf, rbuf, count, op, comm );
+#endif
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void IAllReduce
+( const float* sbuf, float* rbuf, int count, 
+  Op op, Comm comm, Request& request )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::IAllReduce");
+#endif
+    CommProfile profile( "IAllReduce", comm, 2*sizeof(float)*count );
+    request = REQUEST_NULL;
+    if( count != 0 )
+    {
+#ifdef HAVE_NONBLOCKING_COLLECTIVES
+        SafeMpi( 
+            NONBLOCKING_COLL(Iallreduce)
+            ( const_cast<float*>(sbuf), rbuf, count, MPI_FLOAT, op,
+              comm, &request ) 
+        );
+#else
+        AllReduce( sbuf, rbuf, count, op, comm );
+#endif
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void IAllReduce
+( const double* sbuf, double* rbuf, int count, 
+  Op op, Comm comm, Request& request )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::IAllReduce");
+#endif
+    CommProfile profile( "IAllReduce", comm, 2*sizeof(double)*count );
+    request = REQUEST_NULL;
+    if( count != 0 )
+    {
+#ifdef HAVE_NONBLOCKING_COLLECTIVES
+        SafeMpi( 
+            NONBLOCKING_COLL(Iallreduce)
+            ( const_cast<double*>(sbuf), rbuf, count, MPI_DOUBLE, op,
+              comm, &request ) 
+        );
+#else
+        AllReduce( sbuf, rbuf, count, op, comm );
+#endif
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void IAllReduce
+( const scomplex* sbuf, scomplex* rbuf, int count, 
+  Op op, Comm comm, Request& request )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::IAllReduce");
+#endif
+    CommProfile profile( "IAllReduce", comm, 2*sizeof(scomplex)*count );
+    request = REQUEST_NULL;
+    if( count != 0 )
+    {
+#ifdef HAVE_NONBLOCKING_COLLECTIVES
+# ifdef AVOID_COMPLEX_MPI
+        if( op == SUM )
+        {
+            SafeMpi( 
+                NONBLOCKING_COLL(Iallreduce)
+                ( const_cast<scomplex*>(sbuf), rbuf, 2*count, MPI_FLOAT, op,
+                  comm, &request ) 
+            );
+        }
+        else
+        {
+            SafeMpi( 
+                NONBLOCKING_COLL(Iallreduce)
+                ( const_cast<scomplex*>(sbuf), rbuf, count, MPI_COMPLEX, op,
+                  comm, &request ) 
+            );
+        }
+# else
+        SafeMpi( 
+            NONBLOCKING_COLL(Iallreduce)
+            ( const_cast<scomplex*>(sbuf), rbuf, count, MPI_COMPLEX, op,
+              comm, &request ) 
+        );
+# endif
+#else
+        AllReduce( sbuf, rbuf, count, op, comm );
+#endif
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void IAllReduce
+( const dcomplex* sbuf, dcomplex* rbuf, int count, 
+  Op op, Comm comm, Request& request )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::IAllReduce");
+#endif
+    CommProfile profile( "IAllReduce", comm, 2*sizeof(dcomplex)*count );
+    request = REQUEST_NULL;
+    if( count != 0 )
+    {
+#ifdef HAVE_NONBLOCKING_COLLECTIVES
+# ifdef AVOID_COMPLEX_MPI
+        if( op == SUM )
+        {
+            SafeMpi( 
+                NONBLOCKING_COLL(Iallreduce)
+                ( const_cast<dcomplex*>(sbuf), rbuf, 2*count, MPI_DOUBLE, op,
+                  comm, &request ) 
+            );
+        }
+        else
+        {
+            SafeMpi( 
+                NONBLOCKING_COLL(Iallreduce)
+                ( const_cast<dcomplex*>(sbuf), 
+                  rbuf, count, MPI_DOUBLE_COMPLEX, op, comm, &request ) 
+            );
+        }
+# else
+        SafeMpi( 
+            NONBLOCKING_COLL(Iallreduce)
+            ( const_cast<dcomplex*>(sbuf), rbuf, count, MPI_DOUBLE_COMPLEX, op,
+              comm, &request ) 
+        );
+# endif
+#else
+        AllReduce( sbuf, rbuf, count, op, comm );
+#endif
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
 void ReduceScatter( byte* sbuf, byte* rbuf, int rc, Op op, Comm comm )
 {
 #ifndef RELEASE
     PushCallStack("mpi::ReduceScatter");
 #endif
+    CommProfile profile
+    ( "ReduceScatter", comm, sizeof(byte)*rc*(Size(comm)+1) );
 #ifdef HAVE_REDUCE_SCATTER_BLOCK
     SafeMpi( 
         MPI_Reduce_scatter_block( sbuf, rbuf, rc, MPI_UNSIGNED_CHAR, op, comm )
@@ -3645,6 +4595,7 @@ void ReduceScatter( int* sbuf, int* rbuf, int rc, Op op, Comm comm )
 #ifndef RELEASE
     PushCallStack("mpi::ReduceScatter");
 #endif
+    CommProfile profile( "ReduceScatter", comm, sizeof(int)*rc*(Size(comm)+1) );
 #ifdef HAVE_REDUCE_SCATTER_BLOCK
     SafeMpi( 
         MPI_Reduce_scatter_block( sbuf, rbuf, rc, MPI_INT, op, comm )
@@ -3669,6 +4620,8 @@ void ReduceScatter( float* sbuf, float* rbuf, int rc, Op op, Comm comm )
 #ifndef RELEASE
     PushCallStack("mpi::ReduceScatter");
 #endif
+    CommProfile profile
+    ( "ReduceScatter", comm, sizeof(float)*rc*(Size(comm)+1) );
 #ifdef HAVE_REDUCE_SCATTER_BLOCK
     SafeMpi( 
         MPI_Reduce_scatter_block( sbuf, rbuf, rc, MPI_FLOAT, op, comm )
@@ -3693,6 +4646,8 @@ void ReduceScatter( double* sbuf, double* rbuf, int rc, Op op, Comm comm )
 #ifndef RELEASE
     PushCallStack("mpi::ReduceScatter");
 #endif
+    CommProfile profile
+    ( "ReduceScatter", comm, sizeof(double)*rc*(Size(comm)+1) );
 #ifdef HAVE_REDUCE_SCATTER_BLOCK
     SafeMpi( 
         MPI_Reduce_scatter_block( sbuf, rbuf, rc, MPI_DOUBLE, op, comm )
@@ -3717,6 +4672,8 @@ void ReduceScatter( scomplex* sbuf, scomplex* rbuf, int rc, Op op, Comm comm )
 #ifndef RELEASE
     PushCallStack("mpi::ReduceScatter");
 #endif
+    CommProfile profile
+    ( "ReduceScatter", comm, sizeof(scomplex)*rc*(Size(comm)+1) );
 #ifdef HAVE_REDUCE_SCATTER_BLOCK
 # ifdef AVOID_COMPLEX_MPI
     SafeMpi(
@@ -3749,6 +4706,8 @@ void ReduceScatter( dcomplex* sbuf, dcomplex* rbuf, int rc, Op op, Comm comm )
 #ifndef RELEASE
     PushCallStack("mpi::ReduceScatter");
 #endif
+    CommProfile profile
+    ( "ReduceScatter", comm, sizeof(dcomplex)*rc*(Size(comm)+1) );
 #ifdef HAVE_REDUCE_SCATTER_BLOCK
 # ifdef AVOID_COMPLEX_MPI
     SafeMpi(
@@ -3776,11 +4735,159 @@ void ReduceScatter( dcomplex* sbuf, dcomplex* rbuf, int rc, Op op, Comm comm )
 #endif
 }
 
+void IReduceScatter
+( byte* sbuf, byte* rbuf, int rc, Op op, Comm comm, Request& request )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::IReduceScatter");
+#endif
+    CommProfile profile
+    ( "IReduceScatter", comm, sizeof(byte)*rc*(Size(comm)+1) );
+#ifdef HAVE_NONBLOCKING_COLLECTIVES
+    SafeMpi( 
+        NONBLOCKING_COLL(Ireduce_scatter_block)
+        ( sbuf, rbuf, rc, MPI_UNSIGNED_CHAR, op, comm, &request ) 
+    );
+#else
+    ReduceScatter( sbuf, rbuf, rc, op, comm );
+    request = REQUEST_NULL;
+#endif
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void IReduceScatter
+( int* sbuf, int* rbuf, int rc, Op op, Comm comm, Request& request )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::IReduceScatter");
+#endif
+    CommProfile profile
+    ( "IReduceScatter", comm, sizeof(int)*rc*(Size(comm)+1) );
+#ifdef HAVE_NONBLOCKING_COLLECTIVES
+    SafeMpi( 
+        NONBLOCKING_COLL(Ireduce_scatter_block)
+        ( sbuf, rbuf, rc, MPI_INT, op, comm, &request ) 
+    );
+#else
+    ReduceScatter( sbuf, rbuf, rc, op, comm );
+    request = REQUEST_NULL;
+#endif
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void IReduceScatter
+( float* sbuf, float* rbuf, int rc, Op op, Comm comm, Request& request )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::IReduceScatter");
+#endif
+    CommProfile profile
+    ( "IReduceScatter", comm, sizeof(float)*rc*(Size(comm)+1) );
+#ifdef HAVE_NONBLOCKING_COLLECTIVES
+    SafeMpi( 
+        NONBLOCKING_COLL(Ireduce_scatter_block)
+        ( sbuf, rbuf, rc, MPI_FLOAT, op, comm, &request ) 
+    );
+#else
+    ReduceScatter( sbuf, rbuf, rc, op, comm );
+    request = REQUEST_NULL;
+#endif
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void IReduceScatter
+( double* sbuf, double* rbuf, int rc, Op op, Comm comm, Request& request )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::IReduceScatter");
+#endif
+    CommProfile profile
+    ( "IReduceScatter", comm, sizeof(double)*rc*(Size(comm)+1) );
+#ifdef HAVE_NONBLOCKING_COLLECTIVES
+    SafeMpi( 
+        NONBLOCKING_COLL(Ireduce_scatter_block)
+        ( sbuf, rbuf, rc, MPI_DOUBLE, op, comm, &request ) 
+    );
+#else
+    ReduceScatter( sbuf, rbuf, rc, op, comm );
+    request = REQUEST_NULL;
+#endif
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void IReduceScatter
+( scomplex* sbuf, scomplex* rbuf, int rc, Op op, Comm comm, Request& request )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::IReduceScatter");
+#endif
+    CommProfile profile
+    ( "IReduceScatter", comm, sizeof(scomplex)*rc*(Size(comm)+1) );
+#ifdef HAVE_NONBLOCKING_COLLECTIVES
+# ifdef AVOID_COMPLEX_MPI
+    SafeMpi( 
+        NONBLOCKING_COLL(Ireduce_scatter_block)
+        ( sbuf, rbuf, 2*rc, MPI_FLOAT, op, comm, &request ) 
+    );
+# else
+    SafeMpi( 
+        NONBLOCKING_COLL(Ireduce_scatter_block)
+        ( sbuf, rbuf, rc, MPI_COMPLEX, op, comm, &request ) 
+    );
+# endif
+#else
+    ReduceScatter( sbuf, rbuf, rc, op, comm );
+    request = REQUEST_NULL;
+#endif
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void IReduceScatter
+( dcomplex* sbuf, dcomplex* rbuf, int rc, Op op, Comm comm, Request& request )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::IReduceScatter");
+#endif
+    CommProfile profile
+    ( "IReduceScatter", comm, sizeof(dcomplex)*rc*(Size(comm)+1) );
+#ifdef HAVE_NONBLOCKING_COLLECTIVES
+# ifdef AVOID_COMPLEX_MPI
+    SafeMpi( 
+        NONBLOCKING_COLL(Ireduce_scatter_block)
+        ( sbuf, rbuf, 2*rc, MPI_DOUBLE, op, comm, &request ) 
+    );
+# else
+    SafeMpi( 
+        NONBLOCKING_COLL(Ireduce_scatter_block)
+        ( sbuf, rbuf, rc, MPI_DOUBLE_COMPLEX, op, comm, &request ) 
+    );
+# endif
+#else
+    ReduceScatter( sbuf, rbuf, rc, op, comm );
+    request = REQUEST_NULL;
+#endif
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
 void ReduceScatter( byte* buf, int rc, Op op, Comm comm )
 {
 #ifndef RELEASE
     PushCallStack("mpi::ReduceScatter");
 #endif
+    CommProfile profile
+    ( "ReduceScatter", comm, sizeof(byte)*rc*(Size(comm)+1) );
 #ifdef HAVE_REDUCE_SCATTER_BLOCK
 # ifdef HAVE_MPI_IN_PLACE
     SafeMpi( 
@@ -3817,6 +4924,7 @@ void ReduceScatter( int* buf, int rc, Op op, Comm comm )
 #ifndef RELEASE
     PushCallStack("mpi::ReduceScatter");
 #endif
+    CommProfile profile( "ReduceScatter", comm, sizeof(int)*rc*(Size(comm)+1) );
 #ifdef HAVE_REDUCE_SCATTER_BLOCK
 # ifdef HAVE_MPI_IN_PLACE
     SafeMpi( 
@@ -3851,6 +4959,8 @@ void ReduceScatter( float* buf, int rc, Op op, Comm comm )
 #ifndef RELEASE
     PushCallStack("mpi::ReduceScatter");
 #endif
+    CommProfile profile
+    ( "ReduceScatter", comm, sizeof(float)*rc*(Size(comm)+1) );
 #ifdef HAVE_REDUCE_SCATTER_BLOCK
 # ifdef HAVE_MPI_IN_PLACE
     SafeMpi( 
@@ -3885,6 +4995,8 @@ void ReduceScatter( double* buf, int rc, Op op, Comm comm )
 #ifndef RELEASE
     PushCallStack("mpi::ReduceScatter");
 #endif
+    CommProfile profile
+    ( "ReduceScatter", comm, sizeof(double)*rc*(Size(comm)+1) );
 #ifdef HAVE_REDUCE_SCATTER_BLOCK
 # ifdef HAVE_MPI_IN_PLACE
     SafeMpi( 
@@ -3919,6 +5031,8 @@ void ReduceScatter( scomplex* buf, int rc, Op op, Comm comm )
 #ifndef RELEASE
     PushCallStack("mpi::ReduceScatter");
 #endif
+    CommProfile profile
+    ( "ReduceScatter", comm, sizeof(scomplex)*rc*(Size(comm)+1) );
 #ifdef HAVE_REDUCE_SCATTER_BLOCK
 # ifdef AVOID_COMPLEX_MPI
 #  ifdef HAVE_MPI_IN_PLACE
@@ -3970,6 +5084,8 @@ void ReduceScatter( dcomplex* buf, int rc, Op op, Comm comm )
 #ifndef RELEASE
     PushCallStack("mpi::ReduceScatter");
 #endif
+    CommProfile profile
+    ( "ReduceScatter", comm, sizeof(dcomplex)*rc*(Size(comm)+1) );
 #ifdef HAVE_REDUCE_SCATTER_BLOCK
 # ifdef AVOID_COMPLEX_MPI
 #  ifdef HAVE_MPI_IN_PLACE
@@ -4023,6 +5139,8 @@ void ReduceScatter
 #ifndef RELEASE
     PushCallStack("mpi::ReduceScatter");
 #endif
+    CommProfile profile
+    ( "ReduceScatter", comm, sizeof(byte)*(Sum(rcs,comm)+rcs[Rank(comm)]) );
     SafeMpi( 
         MPI_Reduce_scatter
         ( const_cast<byte*>(sbuf), 
@@ -4039,6 +5157,8 @@ void ReduceScatter
 #ifndef RELEASE
     PushCallStack("mpi::ReduceScatter");
 #endif
+    CommProfile profile
+    ( "ReduceScatter", comm, sizeof(int)*(Sum(rcs,comm)+rcs[Rank(comm)]) );
     SafeMpi( 
         MPI_Reduce_scatter
         ( const_cast<int*>(sbuf), 
@@ -4055,6 +5175,8 @@ void ReduceScatter
 #ifndef RELEASE
     PushCallStack("mpi::ReduceScatter");
 #endif
+    CommProfile profile
+    ( "ReduceScatter", comm, sizeof(float)*(Sum(rcs,comm)+rcs[Rank(comm)]) );
     SafeMpi( 
         MPI_Reduce_scatter
         ( const_cast<float*>(sbuf), 
@@ -4071,6 +5193,8 @@ void ReduceScatter
 #ifndef RELEASE
     PushCallStack("mpi::ReduceScatter");
 #endif
+    CommProfile profile
+    ( "ReduceScatter", comm, sizeof(double)*(Sum(rcs,comm)+rcs[Rank(comm)]) );
     SafeMpi( 
         MPI_Reduce_scatter
         ( const_cast<double*>(sbuf), 
@@ -4087,6 +5211,8 @@ void ReduceScatter
 #ifndef RELEASE
     PushCallStack("mpi::ReduceScatter");
 #endif
+    CommProfile profile
+    ( "ReduceScatter", comm, sizeof(scomplex)*(Sum(rcs,comm)+rcs[Rank(comm)]) );
 #ifdef AVOID_COMPLEX_MPI
     if( op == SUM )
     {
@@ -4127,6 +5253,8 @@ void ReduceScatter
 #ifndef RELEASE
     PushCallStack("mpi::ReduceScatter");
 #endif
+    CommProfile profile
+    ( "ReduceScatter", comm, sizeof(dcomplex)*(Sum(rcs,comm)+rcs[Rank(comm)]) );
 #ifdef AVOID_COMPLEX_MPI
     if( op == SUM )
     {
@@ -4161,5 +5289,313 @@ void ReduceScatter
 #endif
 }
 
+//-------------------//
+// Derived datatypes //
+//-------------------//
+
+void TypeContiguous( int count, Datatype oldType, Datatype& newType )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::TypeContiguous");
+#endif
+    SafeMpi( MPI_Type_contiguous( count, oldType, &newType ) );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void TypeVector
+( int count, int blockLength, int stride, Datatype oldType, 
+  Datatype& newType )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::TypeVector");
+#endif
+    SafeMpi
+    ( MPI_Type_vector( count, blockLength, stride, oldType, &newType ) );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void TypeCreateHVector
+( int count, int blockLength, Aint stride, Datatype oldType, 
+  Datatype& newType )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::TypeCreateHVector");
+#endif
+    SafeMpi
+    ( MPI_Type_create_hvector
+      ( count, blockLength, stride, oldType, &newType ) );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void TypeCommit( Datatype& type )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::TypeCommit");
+#endif
+    SafeMpi( MPI_Type_commit( &type ) );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void TypeFree( Datatype& type )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::TypeFree");
+#endif
+    SafeMpi( MPI_Type_free( &type ) );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+//-------------------//
+// Parallel file I/O //
+//-------------------//
+
+void FileOpen( Comm comm, std::string filename, int mode, File& file )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::FileOpen");
+#endif
+    SafeFileIO
+    ( MPI_File_open
+      ( comm, const_cast<char*>(filename.c_str()), mode, MPI_INFO_NULL, 
+        &file ), filename );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void FileClose( File& file )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::FileClose");
+#endif
+    SafeFileIO( MPI_File_close( &file ), "mpi::FileClose" );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void FileSetSize( File file, Offset size )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::FileSetSize");
+#endif
+    SafeFileIO( MPI_File_set_size( file, size ), "mpi::FileSetSize" );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void FileSync( File file )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::FileSync");
+#endif
+    SafeFileIO( MPI_File_sync( file ), "mpi::FileSync" );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void FileSetView
+( File file, Offset displacement, Datatype entryType, Datatype fileType )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::FileSetView");
+#endif
+    SafeFileIO
+    ( MPI_File_set_view
+      ( file, displacement, entryType, fileType, 
+        const_cast<char*>("native"), MPI_INFO_NULL ), "mpi::FileSetView" );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void FileReadAtAll( File file, Offset offset, byte* buf, int count )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::FileReadAtAll");
+#endif
+    Status status;
+    SafeFileIO
+    ( MPI_File_read_at_all( file, offset, buf, count, MPI_BYTE, &status ),
+      "mpi::FileReadAtAll" );
+    int numRead;
+    MPI_Get_count( &status, MPI_BYTE, &numRead );
+    if( numRead != count )
+        throw std::runtime_error
+        ("mpi::FileReadAtAll: unexpected end of file");
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void FileWriteAt( File file, Offset offset, const byte* buf, int count )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::FileWriteAt");
+#endif
+    Status status;
+    SafeFileIO
+    ( MPI_File_write_at
+      ( file, offset, const_cast<byte*>(buf), count, MPI_BYTE, &status ),
+      "mpi::FileWriteAt" );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void FileReadAll( File file, byte* buf, int count, Datatype type )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::FileReadAll");
+#endif
+    Status status;
+    SafeFileIO
+    ( MPI_File_read_all( file, buf, count, type, &status ), 
+      "mpi::FileReadAll" );
+    int numRead;
+    MPI_Get_count( &status, type, &numRead );
+    if( numRead != count )
+        throw std::runtime_error
+        ("mpi::FileReadAll: unexpected end of file");
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void FileWriteAll( File file, const byte* buf, int count, Datatype type )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::FileWriteAll");
+#endif
+    Status status;
+    SafeFileIO
+    ( MPI_File_write_all
+      ( file, const_cast<byte*>(buf), count, type, &status ), 
+      "mpi::FileWriteAll" );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void FileIReadAt
+( File file, Offset offset, byte* buf, int count, Request& request )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::FileIReadAt");
+#endif
+    SafeFileIO
+    ( MPI_File_iread_at( file, offset, buf, count, MPI_BYTE, &request ),
+      "mpi::FileIReadAt" );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void FileIWriteAt
+( File file, Offset offset, const byte* buf, int count, Request& request )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::FileIWriteAt");
+#endif
+    SafeFileIO
+    ( MPI_File_iwrite_at
+      ( file, offset, const_cast<byte*>(buf), count, MPI_BYTE, &request ),
+      "mpi::FileIWriteAt" );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+//--------------------------//
+// Communication accounting //
+//--------------------------//
+
+void EnableCommAccounting()
+{ ::commAccounting = true; }
+
+void DisableCommAccounting()
+{ ::commAccounting = false; }
+
+bool CommAccounting()
+{ return ::commAccounting; }
+
+void ResetCommAccounting()
+{ ::commStats.clear(); }
+
+CommStats GetCommStats( Comm comm, std::string routine )
+{
+    CommStats total;
+    total.numCalls = 0;
+    total.numBytes = 0;
+    total.time = 0;
+    std::map<CommKey,RoutineStats>::const_iterator commIt =
+        ::commStats.find( CommKey(comm,RawCommName(comm)) );
+    if( commIt == ::commStats.end() )
+        return total;
+    const RoutineStats& routineStats = commIt->second;
+    for( RoutineStats::const_iterator it=routineStats.begin();
+         it!=routineStats.end(); ++it )
+    {
+        if( routine == "" || routine == it->first )
+        {
+            total.numCalls += it->second.numCalls;
+            total.numBytes += it->second.numBytes;
+            total.time += it->second.time;
+        }
+    }
+    return total;
+}
+
+void PrintCommStats( std::ostream& os )
+{
+    // Combine the communicators which share a name
+    std::map<std::string,RoutineStats> namedStats;
+    for( std::map<CommKey,RoutineStats>::const_iterator commIt=
+         ::commStats.begin(); commIt!=::commStats.end(); ++commIt )
+    {
+        const std::string name =
+            ( commIt->first.second == "" ? "(unnamed)" : commIt->first.second );
+        const RoutineStats& routineStats = commIt->second;
+        for( RoutineStats::const_iterator it=routineStats.begin();
+             it!=routineStats.end(); ++it )
+        {
+            CommStats& stats = namedStats[name][it->first];
+            stats.numCalls += it->second.numCalls;
+            stats.numBytes += it->second.numBytes;
+            stats.time += it->second.time;
+        }
+    }
+
+    std::ostringstream msg;
+    for( std::map<std::string,RoutineStats>::const_iterator commIt=
+         namedStats.begin(); commIt!=namedStats.end(); ++commIt )
+    {
+        msg << commIt->first << "\n";
+        const RoutineStats& routineStats = commIt->second;
+        for( RoutineStats::const_iterator it=routineStats.begin();
+             it!=routineStats.end(); ++it )
+        {
+            msg << "  " << it->first << ": " 
+                << it->second.numCalls << " calls, " 
+                << it->second.numBytes << " bytes, " 
+                << it->second.time << " seconds\n";
+        }
+    }
+    os << msg.str();
+    os.flush();
+}
+
 } // namespace mpi
 } // namespace elem
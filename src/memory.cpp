@@ -0,0 +1,355 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "elemental.hpp"
+
+namespace {
+
+// Four size classes per power of two, starting from one cache line
+const std::size_t minClassBytes = 64;
+const int numSubclasses = 4;
+const int numSizeClasses = 4*48;
+
+// The number of free blocks of each size class which each thread may keep
+// without touching the shared pool
+const std::size_t threadCacheDepth = 4;
+
+struct BlockHeader
+{
+    void* rawBuffer;
+    int sizeClass;
+};
+
+struct ThreadCache
+{
+    std::vector<void*> freeBlocks[numSizeClasses];
+};
+
+struct PoolState
+{
+    bool pooling;
+    std::size_t alignment, capBytes;
+
+    std::vector<void*> freeBlocks[numSizeClasses];
+    std::vector<ThreadCache*> threadCaches;
+
+    unsigned long long numRequests, numPoolHits;
+    unsigned long long bytesInUse, peakBytesInUse, bytesCached;
+
+    PoolState()
+    : pooling(true), alignment(64), capBytes(std::size_t(1)<<28),
+      numRequests(0), numPoolHits(0),
+      bytesInUse(0), peakBytesInUse(0), bytesCached(0)
+    { }
+};
+
+// The pool is intentionally never destroyed so that Memory<G> instances with
+// static storage duration may safely free their buffers at exit
+PoolState& State()
+{
+    static PoolState* state = new PoolState;
+    return *state;
+}
+
+ThreadCache* threadCache = 0;
+#ifdef HAVE_OPENMP
+#pragma omp threadprivate(threadCache)
+#endif
+
+ThreadCache& LocalCache()
+{
+    if( threadCache == 0 )
+    {
+        threadCache = new ThreadCache;
+#ifdef HAVE_OPENMP
+        #pragma omp critical(ElemMemoryPool)
+#endif
+        State().threadCaches.push_back( threadCache );
+    }
+    return *threadCache;
+}
+
+std::size_t ClassBytes( int sizeClass )
+{
+    const int exponent = sizeClass / numSubclasses;
+    const int subclass = sizeClass % numSubclasses;
+    return ((minClassBytes<<exponent)/numSubclasses)*(numSubclasses+subclass);
+}
+
+int SizeClass( std::size_t numBytes )
+{
+    if( numBytes <= minClassBytes )
+        return 0;
+    int exponent = 0;
+    while( (minClassBytes<<(exponent+1)) < numBytes )
+        ++exponent;
+    int sizeClass = numSubclasses*exponent;
+    while( ClassBytes(sizeClass) < numBytes )
+        ++sizeClass;
+    if( sizeClass >= numSizeClasses )
+        throw std::bad_alloc();
+    return sizeClass;
+}
+
+BlockHeader* Header( void* buffer )
+{ return static_cast<BlockHeader*>(buffer) - 1; }
+
+void* SystemAllocate( int sizeClass, std::size_t alignment )
+{
+    const std::size_t numBytes =
+        ClassBytes(sizeClass) + alignment + sizeof(BlockHeader);
+    void* rawBuffer = std::malloc( numBytes );
+    if( rawBuffer == 0 )
+        throw std::bad_alloc();
+
+    // Leave room for the header directly before the aligned buffer
+    const std::size_t rawAddress = reinterpret_cast<std::size_t>(rawBuffer);
+    const std::size_t alignedAddress =
+        (rawAddress+sizeof(BlockHeader)+alignment-1) & ~(alignment-1);
+    void* buffer = reinterpret_cast<void*>(alignedAddress);
+    Header(buffer)->rawBuffer = rawBuffer;
+    Header(buffer)->sizeClass = sizeClass;
+    return buffer;
+}
+
+void SystemFree( void* buffer )
+{ std::free( Header(buffer)->rawBuffer ); }
+
+void AddInUse( unsigned long long numBytes )
+{
+    PoolState& state = State();
+#ifdef HAVE_OPENMP
+    #pragma omp atomic
+#endif
+    state.bytesInUse += numBytes;
+    // The peak is only approximate if threads are simultaneously allocating
+    if( state.bytesInUse > state.peakBytesInUse )
+    {
+#ifdef HAVE_OPENMP
+        #pragma omp critical(ElemMemoryPoolPeak)
+#endif
+        state.peakBytesInUse =
+            std::max( state.peakBytesInUse, state.bytesInUse );
+    }
+}
+
+void RemoveInUse( unsigned long long numBytes )
+{
+    PoolState& state = State();
+#ifdef HAVE_OPENMP
+    #pragma omp atomic
+#endif
+    state.bytesInUse -= numBytes;
+}
+
+} // anonymous namespace
+
+namespace elem {
+
+void SetMemoryPooling( bool pooling )
+{
+    State().pooling = pooling;
+    if( !pooling )
+        ReleaseMemoryPool();
+}
+
+bool MemoryPooling()
+{ return State().pooling; }
+
+void SetMemoryAlignment( std::size_t alignment )
+{
+#ifndef RELEASE
+    PushCallStack("SetMemoryAlignment");
+#endif
+    if( alignment < minClassBytes || (alignment & (alignment-1)) != 0 )
+        throw std::logic_error
+        ("Alignment must be a power of two which is at least 64");
+    // The cached blocks may not satisfy the new alignment
+    ReleaseMemoryPool();
+    State().alignment = alignment;
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+std::size_t MemoryAlignment()
+{ return State().alignment; }
+
+void SetMemoryPoolCap( std::size_t capBytes )
+{
+    State().capBytes = capBytes;
+    if( State().bytesCached > capBytes )
+        ReleaseMemoryPool();
+}
+
+std::size_t MemoryPoolCap()
+{ return State().capBytes; }
+
+void* PoolAllocate( std::size_t numBytes )
+{
+    PoolState& state = State();
+    const int sizeClass = SizeClass( numBytes );
+    const std::size_t classBytes = ClassBytes( sizeClass );
+#ifdef HAVE_OPENMP
+    #pragma omp atomic
+#endif
+    ++state.numRequests;
+
+    void* buffer = 0;
+    if( state.pooling )
+    {
+        // Try the cache of this thread before the shared free list
+        std::vector<void*>& localBlocks = LocalCache().freeBlocks[sizeClass];
+        if( !localBlocks.empty() )
+        {
+            buffer = localBlocks.back();
+            localBlocks.pop_back();
+        }
+        else
+        {
+#ifdef HAVE_OPENMP
+            #pragma omp critical(ElemMemoryPool)
+#endif
+            {
+                std::vector<void*>& sharedBlocks = state.freeBlocks[sizeClass];
+                if( !sharedBlocks.empty() )
+                {
+                    buffer = sharedBlocks.back();
+                    sharedBlocks.pop_back();
+                }
+            }
+        }
+    }
+    if( buffer != 0 )
+    {
+#ifdef HAVE_OPENMP
+        #pragma omp atomic
+#endif
+        ++state.numPoolHits;
+#ifdef HAVE_OPENMP
+        #pragma omp atomic
+#endif
+        state.bytesCached -= classBytes;
+    }
+    else
+    {
+        try { buffer = SystemAllocate( sizeClass, state.alignment ); }
+        catch( std::bad_alloc& exception )
+        {
+            // Give the cached blocks back to the system and try once more
+#ifdef HAVE_OPENMP
+            if( omp_in_parallel() )
+                throw exception;
+#endif
+            ReleaseMemoryPool();
+            buffer = SystemAllocate( sizeClass, state.alignment );
+        }
+    }
+    AddInUse( classBytes );
+    return buffer;
+}
+
+void PoolFree( void* buffer )
+{
+    if( buffer == 0 )
+        return;
+    PoolState& state = State();
+    const int sizeClass = Header(buffer)->sizeClass;
+    const std::size_t classBytes = ClassBytes( sizeClass );
+    RemoveInUse( classBytes );
+
+    // Return the block to the system if it would exceed the cap or if it was
+    // allocated before the alignment was increased
+    const std::size_t address = reinterpret_cast<std::size_t>(buffer);
+    if( !state.pooling || state.bytesCached + classBytes > state.capBytes ||
+        (address & (state.alignment-1)) != 0 )
+    {
+        SystemFree( buffer );
+        return;
+    }
+#ifdef HAVE_OPENMP
+    #pragma omp atomic
+#endif
+    state.bytesCached += classBytes;
+    std::vector<void*>& localBlocks = LocalCache().freeBlocks[sizeClass];
+    if( localBlocks.size() < threadCacheDepth )
+    {
+        localBlocks.push_back( buffer );
+    }
+    else
+    {
+#ifdef HAVE_OPENMP
+        #pragma omp critical(ElemMemoryPool)
+#endif
+        state.freeBlocks[sizeClass].push_back( buffer );
+    }
+}
+
+void ReleaseMemoryPool()
+{
+    PoolState& state = State();
+#ifdef HAVE_OPENMP
+    #pragma omp critical(ElemMemoryPool)
+#endif
+    {
+        for( int sizeClass=0; sizeClass<numSizeClasses; ++sizeClass )
+        {
+            std::vector<void*>& sharedBlocks = state.freeBlocks[sizeClass];
+            for( std::size_t k=0; k<sharedBlocks.size(); ++k )
+                SystemFree( sharedBlocks[k] );
+            sharedBlocks.clear();
+
+            for( std::size_t t=0; t<state.threadCaches.size(); ++t )
+            {
+                std::vector<void*>& localBlocks =
+                    state.threadCaches[t]->freeBlocks[sizeClass];
+                for( std::size_t k=0; k<localBlocks.size(); ++k )
+                    SystemFree( localBlocks[k] );
+                localBlocks.clear();
+            }
+        }
+        state.bytesCached = 0;
+    }
+}
+
+MemoryPoolStats GetMemoryPoolStats()
+{
+    const PoolState& state = State();
+    MemoryPoolStats stats;
+    stats.numRequests = state.numRequests;
+    stats.numPoolHits = state.numPoolHits;
+    stats.bytesInUse = state.bytesInUse;
+    stats.peakBytesInUse = state.peakBytesInUse;
+    stats.bytesCached = state.bytesCached;
+    return stats;
+}
+
+void ResetMemoryPoolStats()
+{
+    PoolState& state = State();
+    state.numRequests = 0;
+    state.numPoolHits = 0;
+    state.peakBytesInUse = state.bytesInUse;
+}
+
+void PrintMemoryPoolStats( std::ostream& os, const std::string msg )
+{
+    if( msg != "" )
+        os << msg << std::endl;
+    const MemoryPoolStats stats = GetMemoryPoolStats();
+    os << "  requests:          " << stats.numRequests << "\n"
+       << "  served from pool:  " << stats.numPoolHits << "\n"
+       << "  bytes in use:      " << stats.bytesInUse << "\n"
+       << "  peak bytes in use: " << stats.peakBytesInUse << "\n"
+       << "  bytes cached:      " << stats.bytesCached << std::endl;
+}
+
+void PrintMemoryPoolStats( const std::string msg )
+{ PrintMemoryPoolStats( std::cout, msg ); }
+
+} // namespace elem
@@ -17,6 +17,11 @@ elem::mpi::Op pivotOpFloat;
 elem::mpi::Op pivotOpDouble;
 elem::mpi::Op pivotOpScomplex;
 elem::mpi::Op pivotOpDcomplex;
+
+bool createdScaledSquareOpFloat = false;
+bool createdScaledSquareOpDouble = false;
+elem::mpi::Op scaledSquareOpFloat;
+elem::mpi::Op scaledSquareOpDouble;
 }   
 
 namespace elem {
@@ -49,6 +54,32 @@ internal::PivotFunc
     }
 }
 
+template<typename R>
+void
+internal::ScaledSquareFunc
+( void* inData, void* outData, int* length, mpi::Datatype* datatype )
+{
+    const Complex<R>* inPairs = (const Complex<R>*)inData;
+    Complex<R>* outPairs = (Complex<R>*)outData;
+    for( int k=0; k<*length; ++k )
+    {
+        const R inScale = inPairs[k].real;
+        const R outScale = outPairs[k].real;
+        if( inScale > outScale )
+        {
+            const R relScale = outScale/inScale;
+            outPairs[k].imag = 
+                inPairs[k].imag + outPairs[k].imag*relScale*relScale;
+            outPairs[k].real = inScale;
+        }
+        else if( inScale != 0 )
+        {
+            const R relScale = inScale/outScale;
+            outPairs[k].imag += inPairs[k].imag*relScale*relScale;
+        }
+    }
+}
+
 template<>
 void internal::CreatePivotOp<float>()
 {
@@ -227,6 +258,96 @@ mpi::Op internal::PivotOp<Complex<double> >()
     return ::pivotOpDcomplex;
 }
 
+template<>
+void internal::CreateScaledSquareOp<float>()
+{
+#ifndef RELEASE
+    PushCallStack("internal::CreateScaledSquareOp<float>");
+    if( ::createdScaledSquareOpFloat )
+        throw std::logic_error("Already created scaled square op");
+#endif
+    mpi::OpCreate
+    ( (mpi::UserFunction*)ScaledSquareFunc<float>, true, 
+      ::scaledSquareOpFloat );
+    ::createdScaledSquareOpFloat = true;
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<>
+void internal::CreateScaledSquareOp<double>()
+{
+#ifndef RELEASE
+    PushCallStack("internal::CreateScaledSquareOp<double>");
+    if( ::createdScaledSquareOpDouble )
+        throw std::logic_error("Already created scaled square op");
+#endif
+    mpi::OpCreate
+    ( (mpi::UserFunction*)ScaledSquareFunc<double>, true, 
+      ::scaledSquareOpDouble );
+    ::createdScaledSquareOpDouble = true;
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<>
+void internal::DestroyScaledSquareOp<float>()
+{
+#ifndef RELEASE
+    PushCallStack("internal::DestroyScaledSquareOp<float>");
+    if( ! ::createdScaledSquareOpFloat )
+        throw std::logic_error("Have not created this scaled square op");
+#endif
+    if( ::createdScaledSquareOpFloat )
+        mpi::OpFree( ::scaledSquareOpFloat );
+    ::createdScaledSquareOpFloat = false;
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<>
+void internal::DestroyScaledSquareOp<double>()
+{
+#ifndef RELEASE
+    PushCallStack("internal::DestroyScaledSquareOp<double>");
+    if( ! ::createdScaledSquareOpDouble )
+        throw std::logic_error("Have not created this scaled square op");
+#endif
+    if( ::createdScaledSquareOpDouble )
+        mpi::OpFree( ::scaledSquareOpDouble );
+    ::createdScaledSquareOpDouble = false;
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<>
+mpi::Op internal::ScaledSquareOp<float>()
+{
+#ifndef RELEASE
+    PushCallStack("internal::ScaledSquareOp<float>");
+    if( ! ::createdScaledSquareOpFloat )
+        throw std::logic_error("Tried to return uncreated scaled square op");
+    PopCallStack();
+#endif
+    return ::scaledSquareOpFloat;
+}
+
+template<>
+mpi::Op internal::ScaledSquareOp<double>()
+{
+#ifndef RELEASE
+    PushCallStack("internal::ScaledSquareOp<double>");
+    if( ! ::createdScaledSquareOpDouble )
+        throw std::logic_error("Tried to return uncreated scaled square op");
+    PopCallStack();
+#endif
+    return ::scaledSquareOpDouble;
+}
+
 } // namespace elem
 
 template void
@@ -244,3 +365,11 @@ elem::internal::PivotFunc<elem::Complex<float> >
 template void
 elem::internal::PivotFunc<elem::Complex<double> >
 ( void* inData, void* outData, int* length, mpi::Datatype* datatype );
+
+template void
+elem::internal::ScaledSquareFunc<float>
+( void* inData, void* outData, int* length, mpi::Datatype* datatype );
+
+template void
+elem::internal::ScaledSquareFunc<double>
+( void* inData, void* outData, int* length, mpi::Datatype* datatype );
@@ -0,0 +1,319 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "elemental.hpp"
+
+namespace {
+
+// Separates the names within a call-stack path
+const char pathSeparator = '\x1f';
+
+struct ProfileNode
+{
+    std::string name;
+    int parent;
+    std::map<std::string,int> children;
+    unsigned long long numCalls, numBytes;
+    double inclusiveTime, exclusiveTime;
+
+    ProfileNode( std::string nodeName, int nodeParent )
+    : name(nodeName), parent(nodeParent),
+      numCalls(0), numBytes(0), inclusiveTime(0), exclusiveTime(0)
+    { }
+};
+
+struct ProfileFrame
+{
+    int node;
+    double startTime, childTime;
+    unsigned long long numBytes;
+};
+
+struct TraceEvent
+{
+    int node;
+    double startTime, duration;
+    unsigned long long numBytes;
+};
+
+bool profiling = false;
+bool tracing = false;
+double profileStartTime = 0;
+// The first node is the root of the call tree and is never reported
+std::vector<ProfileNode> profileNodes( 1, ProfileNode("",-1) );
+std::vector<ProfileFrame> profileFrames;
+std::vector<TraceEvent> traceEvents;
+
+bool MasterThread()
+{
+#ifdef HAVE_OPENMP
+    return omp_get_thread_num() == 0;
+#else
+    return true;
+#endif
+}
+
+std::string Path( int node )
+{
+    std::string path = profileNodes[node].name;
+    for( int k=profileNodes[node].parent; k>0; k=profileNodes[k].parent )
+        path = profileNodes[k].name + pathSeparator + path;
+    return path;
+}
+
+std::string Escape( const std::string& s )
+{
+    std::string escaped;
+    for( std::size_t k=0; k<s.size(); ++k )
+    {
+        if( s[k] == '"' || s[k] == '\\' )
+            escaped += '\\';
+        escaped += s[k];
+    }
+    return escaped;
+}
+
+} // anonymous namespace
+
+namespace elem {
+
+void EnableProfiling( bool traceTimeline )
+{
+    if( !::profiling )
+        ::profileFrames.clear();
+    if( traceTimeline && !::tracing )
+        ::profileStartTime = mpi::Time();
+    ::profiling = true;
+    ::tracing = traceTimeline;
+}
+
+void DisableProfiling()
+{
+    ::profiling = false;
+    ::tracing = false;
+    ::profileFrames.clear();
+}
+
+bool Profiling()
+{ return ::profiling; }
+
+void ResetProfile()
+{
+    ::profileNodes.assign( 1, ProfileNode("",-1) );
+    ::profileFrames.clear();
+    ::traceEvents.clear();
+    ::profileStartTime = mpi::Time();
+}
+
+void PushProfileRegion( std::string name )
+{
+    if( !::profiling || !MasterThread() )
+        return;
+    const int parent =
+        ( ::profileFrames.empty() ? 0 : ::profileFrames.back().node );
+    std::map<std::string,int>::iterator it =
+        ::profileNodes[parent].children.find( name );
+    int node;
+    if( it == ::profileNodes[parent].children.end() )
+    {
+        node = ::profileNodes.size();
+        ::profileNodes[parent].children[name] = node;
+        ::profileNodes.push_back( ProfileNode(name,parent) );
+    }
+    else
+        node = it->second;
+
+    ProfileFrame frame;
+    frame.node = node;
+    frame.childTime = 0;
+    frame.numBytes = 0;
+    frame.startTime = mpi::Time();
+    ::profileFrames.push_back( frame );
+}
+
+void PopProfileRegion()
+{
+    // Ignore the regions which were entered before profiling was enabled
+    if( !::profiling || !MasterThread() || ::profileFrames.empty() )
+        return;
+    const ProfileFrame frame = ::profileFrames.back();
+    ::profileFrames.pop_back();
+    const double duration = mpi::Time() - frame.startTime;
+
+    ProfileNode& node = ::profileNodes[frame.node];
+    ++node.numCalls;
+    node.inclusiveTime += duration;
+    node.exclusiveTime += duration - frame.childTime;
+    node.numBytes += frame.numBytes;
+    if( !::profileFrames.empty() )
+    {
+        ::profileFrames.back().childTime += duration;
+        ::profileFrames.back().numBytes += frame.numBytes;
+    }
+
+    if( ::tracing )
+    {
+        TraceEvent event;
+        event.node = frame.node;
+        event.startTime = frame.startTime - ::profileStartTime;
+        event.duration = duration;
+        event.numBytes = frame.numBytes;
+        ::traceEvents.push_back( event );
+    }
+}
+
+int ProfileRegionDepth()
+{ return ::profileFrames.size(); }
+
+void ProfileCommunication( std::size_t numBytes )
+{
+    if( !::profiling || !MasterThread() || ::profileFrames.empty() )
+        return;
+    ::profileFrames.back().numBytes += numBytes;
+}
+
+void PrintProfile( mpi::Comm comm, std::ostream& os )
+{
+    // Do not profile the reduction of the profile
+    const bool wasProfiling = ::profiling;
+    ::profiling = false;
+#ifndef RELEASE
+    PushCallStack("PrintProfile");
+#endif
+    const int commRank = mpi::CommRank( comm );
+    const int commSize = mpi::CommSize( comm );
+
+    // Form the union of the call-stack paths of all of the processes
+    std::string localPaths;
+    const int numLocalNodes = ::profileNodes.size();
+    for( int k=1; k<numLocalNodes; ++k )
+    {
+        localPaths += Path( k );
+        localPaths += '\0';
+    }
+    const int localSize = localPaths.size();
+    std::vector<int> sizes( commSize ), offsets( commSize );
+    mpi::AllGather( &localSize, 1, &sizes[0], 1, comm );
+    int totalSize = 0;
+    for( int q=0; q<commSize; ++q )
+    {
+        offsets[q] = totalSize;
+        totalSize += sizes[q];
+    }
+    std::vector<byte> allPaths( std::max(totalSize,1) );
+    mpi::AllGather
+    ( (const byte*)localPaths.data(), localSize,
+      &allPaths[0], &sizes[0], &offsets[0], comm );
+    // Since the separator precedes all printable characters, sorting the
+    // paths places each region directly after its parent
+    std::map<std::string,int> pathIndices;
+    std::size_t start = 0;
+    for( int k=0; k<totalSize; ++k )
+    {
+        if( allPaths[k] == '\0' )
+        {
+            const std::string path
+            ( (const char*)&allPaths[start], k-start );
+            pathIndices[path] = 0;
+            start = k+1;
+        }
+    }
+    const int numPaths = pathIndices.size();
+    std::vector<std::string> paths;
+    for( std::map<std::string,int>::iterator it=pathIndices.begin();
+         it!=pathIndices.end(); ++it )
+    {
+        it->second = paths.size();
+        paths.push_back( it->first );
+    }
+
+    // Reduce the statistics of each path
+    const int numStats = 4;
+    std::vector<double> localStats( numStats*std::max(numPaths,1), 0 );
+    for( int k=1; k<numLocalNodes; ++k )
+    {
+        const ProfileNode& node = ::profileNodes[k];
+        const int index = pathIndices[Path(k)];
+        localStats[index*numStats+0] = node.numCalls;
+        localStats[index*numStats+1] = node.inclusiveTime;
+        localStats[index*numStats+2] = node.exclusiveTime;
+        localStats[index*numStats+3] = node.numBytes;
+    }
+    const int numEntries = localStats.size();
+    std::vector<double> minStats( numEntries ), maxStats( numEntries ),
+                        sumStats( numEntries );
+    mpi::Reduce( &localStats[0], &minStats[0], numEntries, mpi::MIN, 0, comm );
+    mpi::Reduce( &localStats[0], &maxStats[0], numEntries, mpi::MAX, 0, comm );
+    mpi::Reduce( &localStats[0], &sumStats[0], numEntries, mpi::SUM, 0, comm );
+
+    if( commRank == 0 )
+    {
+        std::ostringstream msg;
+        msg << "Profile over " << commSize << " processes "
+            << "(min/avg/max of calls, seconds, and bytes)\n";
+        for( int k=0; k<numPaths; ++k )
+        {
+            const std::string& path = paths[k];
+            const std::size_t lastSep = path.rfind( pathSeparator );
+            const int depth = std::count
+                ( path.begin(), path.end(), pathSeparator );
+            const std::string name =
+                ( lastSep == std::string::npos ? path :
+                  path.substr(lastSep+1) );
+            msg << std::string(2*depth,' ') << name << "\n";
+            const char* labels[numStats] =
+                { "calls", "inclusive", "exclusive", "bytes" };
+            for( int stat=0; stat<numStats; ++stat )
+            {
+                const int i = k*numStats + stat;
+                msg << std::string(2*depth+2,' ') << labels[stat] << ": "
+                    << minStats[i] << " / " << sumStats[i]/commSize << " / "
+                    << maxStats[i] << "\n";
+            }
+        }
+        os << msg.str() << std::endl;
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+    ::profiling = wasProfiling;
+}
+
+void WriteProfileTrace( std::string basename )
+{
+#ifndef RELEASE
+    PushCallStack("WriteProfileTrace");
+#endif
+    const int commRank = mpi::CommRank( mpi::COMM_WORLD );
+    std::ostringstream filename;
+    filename << basename << "-" << commRank << ".json";
+    std::ofstream file( filename.str().c_str() );
+    if( !file.is_open() )
+        throw std::runtime_error("Could not open profile trace file");
+
+    // Chrome trace timestamps and durations are in microseconds
+    file << "{\"traceEvents\":[\n";
+    const int numEvents = ::traceEvents.size();
+    for( int k=0; k<numEvents; ++k )
+    {
+        const TraceEvent& event = ::traceEvents[k];
+        file << "{\"name\":\"" << Escape(::profileNodes[event.node].name)
+             << "\",\"cat\":\"elemental\",\"ph\":\"X\""
+             << ",\"ts\":" << 1e6*event.startTime
+             << ",\"dur\":" << 1e6*event.duration
+             << ",\"pid\":" << commRank << ",\"tid\":0"
+             << ",\"args\":{\"bytes\":" << event.numBytes << "}}"
+             << ( k+1<numEvents ? ",\n" : "\n" );
+    }
+    file << "]}" << std::endl;
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+} // namespace elem
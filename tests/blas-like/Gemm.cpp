@@ -138,6 +138,50 @@ void TestGemm
         msg << "C := " << alpha << " A B + " << beta << " C";
         C.Print( msg.str() );
     }
+    const double stationaryTime = runTime;
+
+    // Test the variant of Gemm that keeps C stationary and overlaps the 
+    // AllGathers of the next panels with the local updates
+    if( g.Rank() == 0 )
+        cout << endl << "Pipelined Stationary C Algorithm:" << endl;
+    MakeUniform( A );
+    MakeUniform( B );
+    MakeUniform( C );
+    if( print )
+    {
+        A.Print("A");
+        B.Print("B");
+        C.Print("C");
+    }
+    if( g.Rank() == 0 )
+    {
+        cout << "  Starting Gemm...";
+        cout.flush();
+    }
+    SetGemmPipelining( true );
+    mpi::Barrier( g.Comm() );
+    startTime = mpi::Time();
+    internal::GemmC( orientA, orientB, alpha, A, B, beta, C );
+    mpi::Barrier( g.Comm() );
+    runTime = mpi::Time() - startTime;
+    SetGemmPipelining( false );
+    realGFlops = 2.*double(m)*double(n)*double(k)/(1.e9*runTime);
+    gFlops = ( IsComplex<T>::val ? 4*realGFlops : realGFlops );
+    if( g.Rank() == 0 )
+    {
+        cout << "DONE. " << endl
+             << "  Time = " << runTime << " seconds. GFlops = " 
+             << gFlops << endl
+             << "  Overlap = " 
+             << 100.*(stationaryTime-runTime)/stationaryTime 
+             << "% of the stationary C time was hidden" << endl;
+    }
+    if( print )
+    {
+        ostringstream msg;
+        msg << "C := " << alpha << " A B + " << beta << " C";
+        C.Print( msg.str() );
+    }
     
     if( orientA == NORMAL && orientB == NORMAL )
     {
@@ -178,6 +222,49 @@ void TestGemm
             C.Print( msg.str() );
         }
     }
+
+    // Test the algorithm chosen by the cost model (or by autotuning)
+    const GemmAlgorithm alg =
+        internal::SelectGemmAlgorithm<T>( orientA, orientB, m, n, k, g );
+    if( g.Rank() == 0 )
+    {
+        const char* algNames[] = { "Default", "A", "B", "C", "Dot" };
+        cout << endl << "Automatically Selected Algorithm:" << endl
+             << "  Selected the " << algNames[alg] << " algorithm" << endl;
+    }
+    MakeUniform( A );
+    MakeUniform( B );
+    MakeUniform( C );
+    if( print )
+    {
+        A.Print("A");
+        B.Print("B");
+        C.Print("C");
+    }
+    if( g.Rank() == 0 )
+    {
+        cout << "  Starting Gemm...";
+        cout.flush();
+    }
+    mpi::Barrier( g.Comm() );
+    startTime = mpi::Time();
+    Gemm( orientA, orientB, alpha, A, B, beta, C );
+    mpi::Barrier( g.Comm() );
+    runTime = mpi::Time() - startTime;
+    realGFlops = 2.*double(m)*double(n)*double(k)/(1.e9*runTime);
+    gFlops = ( IsComplex<T>::val ? 4*realGFlops : realGFlops );
+    if( g.Rank() == 0 )
+    {
+        cout << "DONE. " << endl
+             << "  Time = " << runTime << " seconds. GFlops = " 
+             << gFlops << endl;
+    }
+    if( print )
+    {
+        ostringstream msg;
+        msg << "C := " << alpha << " A B + " << beta << " C";
+        C.Print( msg.str() );
+    }
 }
 
 int 
@@ -198,6 +285,11 @@ main( int argc, char* argv[] )
         const int k = Input("--k","inner dimension",100);
         const int nb = Input("--nb","algorithmic blocksize",96);
         const bool print = Input("--print","print matrices?",false);
+        const bool calibrate =
+            Input("--calibrate","calibrate the Gemm cost model?",false);
+        const bool autotune = Input("--autotune","autotune Gemm?",false);
+        const string tuningFile =
+            Input("--tuningFile","file of autotuned Gemm winners",string(""));
         ProcessInput();
         PrintInputReport();
 
@@ -208,6 +300,19 @@ main( int argc, char* argv[] )
         const Orientation orientA = CharToOrientation( transA );
         const Orientation orientB = CharToOrientation( transB );
         SetBlocksize( nb );
+        SetGemmAutotuning( autotune );
+        if( tuningFile != "" )
+            SetGemmTuningFile( tuningFile );
+        if( calibrate )
+        {
+            const GemmCostModel model = CalibrateGemmCostModel( g );
+            if( commRank == 0 )
+                cout << "Calibrated Gemm cost model:\n"
+                     << "  latency:          " << model.latency << "\n"
+                     << "  seconds per byte: " << model.secondsPerByte << "\n"
+                     << "  seconds per flop: " << model.secondsPerFlop
+                     << endl;
+        }
 
 #ifndef RELEASE
         if( commRank == 0 )
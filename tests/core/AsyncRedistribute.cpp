@@ -0,0 +1,187 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "elemental.hpp"
+using namespace elem;
+
+// Independent local work to overlap with the redistribution
+template<typename T>
+void
+LocalWork( Matrix<T>& X, const Matrix<T>& Y, const Matrix<T>& Z )
+{ Gemm( NORMAL, NORMAL, T(1), Y, Z, T(0), X ); }
+
+template<typename T, Distribution AColDist, Distribution ARowDist,
+                     Distribution BColDist, Distribution BRowDist>
+void
+Check
+( DistMatrix<T,AColDist,ARowDist>& A,
+  DistMatrix<T,BColDist,BRowDist>& B, int workSize )
+{
+#ifndef RELEASE
+    PushCallStack("Check");
+#endif
+    const Grid& g = A.Grid();
+    const int commRank = g.Rank();
+    if( commRank == 0 )
+    {
+        std::cout << "Testing [" << DistToString(AColDist) << ","
+                                 << DistToString(ARowDist) << "]"
+                  << " <- ["     << DistToString(BColDist) << ","
+                                 << DistToString(BRowDist) << "]...";
+        std::cout.flush();
+    }
+
+    Matrix<T> X( workSize, workSize ), Y, Z;
+    Uniform( workSize, workSize, Y );
+    Uniform( workSize, workSize, Z );
+
+    // Time the synchronous redistribution and the local work on their own
+    DistMatrix<T,AColDist,ARowDist> ACopy(g);
+    mpi::Barrier( g.Comm() );
+    double startTime = mpi::Time();
+    ACopy = B;
+    mpi::Barrier( g.Comm() );
+    const double redistTime = mpi::Time() - startTime;
+
+    startTime = mpi::Time();
+    LocalWork( X, Y, Z );
+    mpi::Barrier( g.Comm() );
+    const double workTime = mpi::Time() - startTime;
+
+    // Time the asynchronous redistribution overlapped with the local work
+    mpi::Barrier( g.Comm() );
+    startTime = mpi::Time();
+    A.BeginRedistribute( B );
+    LocalWork( X, Y, Z );
+    A.FinishRedistribute();
+    mpi::Barrier( g.Comm() );
+    const double overlapTime = mpi::Time() - startTime;
+
+    // Ensure that both redistributions agree
+    DistMatrix<T,STAR,STAR> A_STAR_STAR(g), ACopy_STAR_STAR(g);
+    A_STAR_STAR = A;
+    ACopy_STAR_STAR = ACopy;
+    int myErrorFlag = 0;
+    for( int j=0; j<B.Width(); ++j )
+        for( int i=0; i<B.Height(); ++i )
+            if( A_STAR_STAR.GetLocal(i,j) != ACopy_STAR_STAR.GetLocal(i,j) )
+                myErrorFlag = 1;
+    int summedErrorFlag;
+    mpi::AllReduce( &myErrorFlag, &summedErrorFlag, 1, mpi::SUM, g.Comm() );
+    if( summedErrorFlag != 0 )
+        throw std::logic_error("Asynchronous redistribution failed");
+
+    if( commRank == 0 )
+    {
+        const double hiddenTime = redistTime + workTime - overlapTime;
+        std::cout << "PASSED\n"
+                  << "  redist time  = " << redistTime << " seconds\n"
+                  << "  work time    = " << workTime << " seconds\n"
+                  << "  overlap time = " << overlapTime << " seconds\n"
+                  << "  hidden       = " << 100.*hiddenTime/redistTime
+                  << "% of the redistribution latency" << std::endl;
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename T>
+void
+AsyncRedistributeTest( int m, int n, int workSize, const Grid& g )
+{
+#ifndef RELEASE
+    PushCallStack("AsyncRedistributeTest");
+#endif
+    DistMatrix<T,MC,  MR  > A_MC_MR(g);
+    DistMatrix<T,MC,  STAR> A_MC_STAR(g);
+    DistMatrix<T,STAR,MR  > A_STAR_MR(g);
+    DistMatrix<T,MR,  MC  > A_MR_MC(g);
+    DistMatrix<T,MR,  STAR> A_MR_STAR(g);
+    DistMatrix<T,STAR,MC  > A_STAR_MC(g);
+    DistMatrix<T,VC,  STAR> A_VC_STAR(g);
+    DistMatrix<T,STAR,VR  > A_STAR_VR(g);
+    DistMatrix<T,STAR,STAR> A_STAR_STAR(g);
+
+    // Communicate from A[MC,MR]
+    Uniform( m, n, A_MC_MR );
+    Check( A_MC_STAR, A_MC_MR, workSize );
+    Check( A_STAR_MR, A_MC_MR, workSize );
+
+    // Communicate from A[MR,MC]
+    Uniform( m, n, A_MR_MC );
+    Check( A_MR_STAR, A_MR_MC, workSize );
+    Check( A_STAR_MC, A_MR_MC, workSize );
+
+    // Communicate into A[*,*]
+    Check( A_STAR_STAR, A_MC_STAR, workSize );
+    Check( A_STAR_STAR, A_STAR_MR, workSize );
+    Check( A_STAR_STAR, A_MR_STAR, workSize );
+    Check( A_STAR_STAR, A_STAR_MC, workSize );
+    Uniform( m, n, A_VC_STAR );
+    Check( A_STAR_STAR, A_VC_STAR, workSize );
+    Uniform( m, n, A_STAR_VR );
+    Check( A_STAR_STAR, A_STAR_VR, workSize );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+    const int commSize = mpi::CommSize( comm );
+
+    try
+    {
+        int r = Input("--gridHeight","height of process grid",0);
+        const int m = Input("--height","height of matrix",1000);
+        const int n = Input("--width","width of matrix",1000);
+        const int workSize =
+            Input("--workSize","size of local Gemm to overlap",200);
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const int c = commSize / r;
+        const Grid g( comm, r, c );
+
+        if( commRank == 0 )
+        {
+            std::cout << "---------------------\n"
+                      << "Testing with doubles:\n"
+                      << "---------------------" << std::endl;
+        }
+        AsyncRedistributeTest<double>( m, n, workSize, g );
+
+        if( commRank == 0 )
+        {
+            std::cout << "--------------------------------------\n"
+                      << "Testing with double-precision complex:\n"
+                      << "--------------------------------------" << std::endl;
+        }
+        AsyncRedistributeTest<Complex<double> >( m, n, workSize, g );
+    }
+    catch( ArgException& e ) { }
+    catch( std::exception& e )
+    {
+        std::ostringstream os;
+        os << "Process " << commRank << " caught error message:\n" << e.what()
+           << std::endl;
+        std::cerr << os.str();
+#ifndef RELEASE
+        DumpCallStack();
+#endif
+    }
+    Finalize();
+    return 0;
+}
@@ -0,0 +1,277 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <cstdio>
+#include "elemental.hpp"
+using namespace elem;
+
+// Checks that B, once gathered, matches the replicated matrix AFull
+template<typename T,Distribution U,Distribution V>
+void
+CheckRestore
+( const Matrix<T>& AFull, const DistMatrix<T,U,V>& B, std::string name,
+  bool print )
+{
+    const Grid& g = B.Grid();
+    DistMatrix<T,STAR,STAR> BFull( g );
+    BFull = B;
+    if( print )
+        BFull.Print( name );
+
+    int mismatch = 0;
+    if( g.InGrid() )
+    {
+        if( BFull.Height() != AFull.Height() ||
+            BFull.Width() != AFull.Width() )
+            mismatch = 1;
+        else
+            for( int j=0; j<AFull.Width(); ++j )
+                for( int i=0; i<AFull.Height(); ++i )
+                    if( BFull.GetLocal(i,j) != AFull.Get(i,j) )
+                        mismatch = 1;
+    }
+    int anyMismatch;
+    mpi::AllReduce( &mismatch, &anyMismatch, 1, mpi::MAX, mpi::COMM_WORLD );
+    if( anyMismatch )
+        throw std::logic_error(name+" did not match the checkpoint");
+    if( mpi::WorldRank() == 0 )
+        std::cout << "  " << name << " PASSED" << std::endl;
+}
+
+template<typename T,Distribution U,Distribution V>
+void
+RestoreAndCheck
+( const Matrix<T>& AFull, const Grid& g, std::string filename,
+  std::string name, bool print )
+{
+    DistMatrix<T,U,V> B( g );
+    B.ReadBinary( filename );
+    CheckRestore( AFull, B, name, print );
+}
+
+template<typename T>
+void
+RestoreEverywhere
+( const Matrix<T>& AFull, const Grid& g, std::string filename,
+  std::string gridName, bool print )
+{
+    RestoreAndCheck<T,MC,  MR  >
+    ( AFull, g, filename, "[MC,MR] on "+gridName, print );
+    RestoreAndCheck<T,MC,  STAR>
+    ( AFull, g, filename, "[MC,* ] on "+gridName, print );
+    RestoreAndCheck<T,STAR,MR  >
+    ( AFull, g, filename, "[* ,MR] on "+gridName, print );
+    RestoreAndCheck<T,MR,  MC  >
+    ( AFull, g, filename, "[MR,MC] on "+gridName, print );
+    RestoreAndCheck<T,MD,  STAR>
+    ( AFull, g, filename, "[MD,* ] on "+gridName, print );
+    RestoreAndCheck<T,VC,  STAR>
+    ( AFull, g, filename, "[VC,* ] on "+gridName, print );
+    RestoreAndCheck<T,STAR,VR  >
+    ( AFull, g, filename, "[* ,VR] on "+gridName, print );
+    RestoreAndCheck<T,STAR,STAR>
+    ( AFull, g, filename, "[* ,* ] on "+gridName, print );
+}
+
+template<typename T>
+void
+CheckpointTest
+( int m, int n, const Grid& g, const Grid& otherGrid, const Grid& subGrid,
+  std::string filename, bool print )
+{
+#ifndef RELEASE
+    PushCallStack("CheckpointTest");
+#endif
+    const int commRank = mpi::WorldRank();
+
+    DistMatrix<T> A( g );
+    Uniform( m, n, A );
+    DistMatrix<T,STAR,STAR> AFull( g );
+    AFull = A;
+    if( print )
+        A.Print("A");
+
+    // Write from [MC,MR] and restore onto every grid and distribution
+    if( commRank == 0 )
+        std::cout << "Written from [MC,MR]:" << std::endl;
+    A.WriteBinary( filename );
+    RestoreEverywhere( AFull.LockedLocalMatrix(), g, filename, "g", print );
+    RestoreEverywhere
+    ( AFull.LockedLocalMatrix(), otherGrid, filename, "other g", print );
+    RestoreEverywhere
+    ( AFull.LockedLocalMatrix(), subGrid, filename, "sub g", print );
+
+    // Write from distributions which are replicated over part of the grid
+    if( commRank == 0 )
+        std::cout << "Written from [MC,* ] and [* ,VR]:" << std::endl;
+    {
+        DistMatrix<T,MC,STAR> A_MC_STAR( g );
+        A_MC_STAR = A;
+        A_MC_STAR.WriteBinary( filename );
+        RestoreAndCheck<T,MC,MR>
+        ( AFull.LockedLocalMatrix(), otherGrid, filename,
+          "[MC,MR] on other g", print );
+        DistMatrix<T,STAR,VR> A_STAR_VR( g );
+        A_STAR_VR = A;
+        A_STAR_VR.WriteBinary( filename );
+        RestoreAndCheck<T,VC,STAR>
+        ( AFull.LockedLocalMatrix(), otherGrid, filename,
+          "[VC,* ] on other g", print );
+    }
+
+    // Write a view into the interior of A, which has nonzero shifts
+    if( commRank == 0 )
+        std::cout << "Written from a view:" << std::endl;
+    if( m > 2 && n > 2 )
+    {
+        DistMatrix<T> ASub( g );
+        LockedView( ASub, A, 1, 2, m-2, n-2 );
+        ASub.WriteBinary( filename );
+        Matrix<T> ASubFull;
+        LockedView( ASubFull, AFull.LockedLocalMatrix(), 1, 2, m-2, n-2 );
+        RestoreAndCheck<T,MC,MR>
+        ( ASubFull, otherGrid, filename, "[MC,MR] on other g", print );
+    }
+
+    // Sequential matrices share the format with distributed matrices
+    if( commRank == 0 )
+        std::cout << "Sequential matrices:" << std::endl;
+    {
+        A.WriteBinary( filename );
+        Matrix<T> B;
+        B.ReadBinary( filename );
+        CheckRestore( B, A, "Matrix restored from [MC,MR]", print );
+        mpi::Barrier( mpi::COMM_WORLD );
+        if( commRank == 0 )
+            AFull.LockedLocalMatrix().WriteBinary( filename );
+        mpi::Barrier( mpi::COMM_WORLD );
+        RestoreAndCheck<T,MC,MR>
+        ( AFull.LockedLocalMatrix(), otherGrid, filename,
+          "[MC,MR] restored from Matrix", print );
+    }
+
+    // Restoring into a different datatype must fail
+    bool caught = false;
+    try
+    {
+        DistMatrix<int,VC,STAR> p( g );
+        p.ReadBinary( filename );
+    }
+    catch( std::runtime_error& e ) { caught = true; }
+    if( !caught )
+        throw std::logic_error("Restoring into the wrong datatype succeeded");
+    if( commRank == 0 )
+        std::cout << "  Datatype mismatch PASSED" << std::endl;
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+// Checkpoints an LU factorization, with its pivots, and restores it onto a
+// different grid
+void
+LUCheckpointTest
+( int m, const Grid& g, const Grid& otherGrid, std::string filename,
+  bool print )
+{
+    DistMatrix<double> A( g );
+    DistMatrix<int,VC,STAR> p( g );
+    Uniform( m, m, A );
+    LU( A, p );
+    DistMatrix<double,STAR,STAR> AFull( g );
+    DistMatrix<int,STAR,STAR> pFull( g );
+    AFull = A;
+    pFull = p;
+
+    if( mpi::WorldRank() == 0 )
+        std::cout << "LU factors and pivots:" << std::endl;
+    A.WriteBinary( filename );
+    RestoreAndCheck<double,MC,MR>
+    ( AFull.LockedLocalMatrix(), otherGrid, filename, "[MC,MR] factors",
+      print );
+    p.WriteBinary( filename );
+    RestoreAndCheck<int,VC,STAR>
+    ( pFull.LockedLocalMatrix(), otherGrid, filename, "[VC,* ] pivots",
+      print );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+    const int commSize = mpi::CommSize( comm );
+
+    try
+    {
+        const int m = Input("--height","height of matrix",100);
+        const int n = Input("--width","width of matrix",70);
+        const std::string filename =
+            Input("--filename","checkpoint file",std::string("checkpoint.bin"));
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        // The default grid, a grid of a different shape, and a grid over a
+        // subset of the processes
+        const Grid g( comm );
+        const int otherHeight = ( g.Height() == commSize ? 1 : commSize );
+        const Grid otherGrid( comm, otherHeight, commSize/otherHeight );
+        const int commSqrt = int(sqrt(double(commSize)));
+        std::vector<int> sqrtRanks(commSqrt*commSqrt);
+        for( int i=0; i<commSqrt*commSqrt; ++i )
+            sqrtRanks[i] = i;
+        mpi::Group group, sqrtGroup;
+        mpi::CommGroup( comm, group );
+        mpi::GroupIncl( group, sqrtRanks.size(), &sqrtRanks[0], sqrtGroup );
+        const Grid subGrid( comm, sqrtGroup );
+
+        if( commRank == 0 )
+        {
+            std::cout << "---------------------\n"
+                      << "Testing with doubles:\n"
+                      << "---------------------" << std::endl;
+        }
+        CheckpointTest<double>( m, n, g, otherGrid, subGrid, filename, print );
+
+        if( commRank == 0 )
+        {
+            std::cout << "--------------------------------------\n"
+                      << "Testing with double-precision complex:\n"
+                      << "--------------------------------------" << std::endl;
+        }
+        CheckpointTest<Complex<double> >
+        ( m, n, g, otherGrid, subGrid, filename, print );
+
+        if( commRank == 0 )
+        {
+            std::cout << "--------------------------\n"
+                      << "Testing an LU checkpoint:\n"
+                      << "--------------------------" << std::endl;
+        }
+        LUCheckpointTest( m, g, otherGrid, filename, print );
+
+        mpi::Barrier( comm );
+        if( commRank == 0 )
+            std::remove( filename.c_str() );
+    }
+    catch( ArgException& e ) { }
+    catch( std::exception& e )
+    {
+        std::ostringstream os;
+        os << "Process " << commRank << " caught error message:\n" << e.what()
+           << std::endl;
+        std::cerr << os.str();
+#ifndef RELEASE
+        DumpCallStack();
+#endif
+    }
+    Finalize();
+    return 0;
+}
@@ -0,0 +1,138 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "elemental.hpp"
+using namespace elem;
+
+// Mimic the redistributions of a right-looking blocked algorithm, which
+// repeatedly requests and releases panel-sized buffers
+template<typename T>
+double
+BlockedSweep( const DistMatrix<T>& A, int blocksize )
+{
+#ifndef RELEASE
+    PushCallStack("BlockedSweep");
+#endif
+    const Grid& g = A.Grid();
+    mpi::Barrier( g.Comm() );
+    const double startTime = mpi::Time();
+    const int n = A.Width();
+    for( int k=0; k<n; k+=blocksize )
+    {
+        const int nb = std::min(blocksize,n-k);
+        DistMatrix<T> A1(g);
+        LockedView( A1, A, 0, k, A.Height(), nb );
+
+        DistMatrix<T,MC,STAR> A1_MC_STAR(g);
+        DistMatrix<T,VC,STAR> A1_VC_STAR(g);
+        DistMatrix<T,STAR,STAR> A1_STAR_STAR(g);
+        A1_MC_STAR.AlignWith( A );
+        A1_MC_STAR = A1;
+        A1_VC_STAR = A1;
+        A1_STAR_STAR = A1_VC_STAR;
+    }
+    mpi::Barrier( g.Comm() );
+    const double runTime = mpi::Time() - startTime;
+#ifndef RELEASE
+    PopCallStack();
+#endif
+    return runTime;
+}
+
+template<typename T>
+void
+MemoryPoolTest( int m, int n, int blocksize, const Grid& g )
+{
+#ifndef RELEASE
+    PushCallStack("MemoryPoolTest");
+#endif
+    const int commRank = g.Rank();
+    DistMatrix<T> A(g);
+    Uniform( m, n, A );
+
+    for( int pooling=0; pooling<2; ++pooling )
+    {
+        SetMemoryPooling( pooling );
+        const MemoryPoolStats before = GetMemoryPoolStats();
+        ResetMemoryPoolStats();
+        const double runTime = BlockedSweep( A, blocksize );
+        const MemoryPoolStats after = GetMemoryPoolStats();
+
+        // Every buffer requested within the sweep should have been returned
+        if( after.bytesInUse != before.bytesInUse )
+            throw std::logic_error("Buffers were leaked by the sweep");
+        if( !pooling && after.numPoolHits != 0 )
+            throw std::logic_error("Disabled pool served a request");
+        if( pooling && n > 2*blocksize && after.numPoolHits == 0 )
+            throw std::logic_error("Pool never reused a buffer");
+
+        if( commRank == 0 )
+        {
+            std::ostringstream msg;
+            msg << (pooling ? "With" : "Without") << " pooling: "
+                << runTime << " seconds";
+            PrintMemoryPoolStats( msg.str() );
+        }
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+    const int commSize = mpi::CommSize( comm );
+
+    try
+    {
+        int r = Input("--gridHeight","height of process grid",0);
+        const int m = Input("--height","height of matrix",1000);
+        const int n = Input("--width","width of matrix",1000);
+        const int nb = Input("--nb","algorithmic blocksize",64);
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const int c = commSize / r;
+        const Grid g( comm, r, c );
+
+        if( commRank == 0 )
+        {
+            std::cout << "---------------------\n"
+                      << "Testing with doubles:\n"
+                      << "---------------------" << std::endl;
+        }
+        MemoryPoolTest<double>( m, n, nb, g );
+
+        if( commRank == 0 )
+        {
+            std::cout << "--------------------------------------\n"
+                      << "Testing with double-precision complex:\n"
+                      << "--------------------------------------" << std::endl;
+        }
+        MemoryPoolTest<Complex<double> >( m, n, nb, g );
+    }
+    catch( ArgException& e ) { }
+    catch( std::exception& e )
+    {
+        std::ostringstream os;
+        os << "Process " << commRank << " caught error message:\n" << e.what()
+           << std::endl;
+        std::cerr << os.str();
+#ifndef RELEASE
+        DumpCallStack();
+#endif
+    }
+    Finalize();
+    return 0;
+}
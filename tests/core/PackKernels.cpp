@@ -0,0 +1,266 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "elemental.hpp"
+using namespace elem;
+
+// The loops which the redistributions used before the pack kernels, kept here
+// as the reference that the kernels are checked and timed against
+
+template<typename T>
+void
+LoopGather
+( int height, int width, int stride, const T* A, int ALDim, T* B )
+{
+#ifdef HAVE_OPENMP
+    #pragma omp parallel for
+#endif
+    for( int jLocal=0; jLocal<width; ++jLocal )
+    {
+        T* destCol = &B[jLocal*height];
+        const T* sourceCol = &A[jLocal*ALDim];
+        for( int iLocal=0; iLocal<height; ++iLocal )
+            destCol[iLocal] = sourceCol[iLocal*stride];
+    }
+}
+
+template<typename T>
+void
+LoopScatter
+( int height, int width, int stride, const T* A, T* B, int BLDim )
+{
+#ifdef HAVE_OPENMP
+    #pragma omp parallel for
+#endif
+    for( int jLocal=0; jLocal<width; ++jLocal )
+    {
+        T* destCol = &B[jLocal*BLDim];
+        const T* sourceCol = &A[jLocal*height];
+        for( int iLocal=0; iLocal<height; ++iLocal )
+            destCol[iLocal*stride] = sourceCol[iLocal];
+    }
+}
+
+template<typename T>
+void
+LoopTranspose
+( int height, int width, const T* A, int ALDim, T* B, int BLDim,
+  bool conjugate )
+{
+    if( conjugate )
+    {
+#ifdef HAVE_OPENMP
+        #pragma omp parallel for
+#endif
+        for( int jLocal=0; jLocal<width; ++jLocal )
+        {
+            T* destCol = &B[jLocal*BLDim];
+            const T* sourceCol = &A[jLocal];
+            for( int iLocal=0; iLocal<height; ++iLocal )
+                destCol[iLocal] = Conj( sourceCol[iLocal*ALDim] );
+        }
+    }
+    else
+    {
+#ifdef HAVE_OPENMP
+        #pragma omp parallel for
+#endif
+        for( int jLocal=0; jLocal<width; ++jLocal )
+        {
+            T* destCol = &B[jLocal*BLDim];
+            const T* sourceCol = &A[jLocal];
+            for( int iLocal=0; iLocal<height; ++iLocal )
+                destCol[iLocal] = sourceCol[iLocal*ALDim];
+        }
+    }
+}
+
+template<typename T>
+void
+KernelGather
+( int height, int width, int stride, const T* A, int ALDim, T* B )
+{
+    InterleaveMatrix( height, width, A, stride, ALDim, B, 1, height );
+}
+
+template<typename T>
+void
+KernelScatter
+( int height, int width, int stride, const T* A, T* B, int BLDim )
+{
+    InterleaveMatrix( height, width, A, 1, height, B, stride, BLDim );
+}
+
+template<typename T>
+void
+KernelTranspose
+( int height, int width, const T* A, int ALDim, T* B, int BLDim,
+  bool conjugate )
+{
+    if( conjugate )
+        ConjInterleaveMatrix( height, width, A, ALDim, 1, B, 1, BLDim );
+    else
+        InterleaveMatrix( height, width, A, ALDim, 1, B, 1, BLDim );
+}
+
+template<typename T>
+void
+CheckEqual( const Matrix<T>& B, const Matrix<T>& BRef, std::string name )
+{
+    for( int j=0; j<B.Width(); ++j )
+        for( int i=0; i<B.Height(); ++i )
+            if( B.Get(i,j) != BRef.Get(i,j) )
+                throw std::logic_error(name+" did not match the loops");
+}
+
+void
+Report( std::string name, double bytes, double loopTime, double kernelTime )
+{
+    std::cout << "  " << name << ": loops " << bytes/loopTime/1.e9
+              << " GB/s, kernels " << bytes/kernelTime/1.e9 << " GB/s"
+              << std::endl;
+}
+
+template<typename T>
+void
+PackKernelsTest( int m, int n, int stride, int numReps, bool print )
+{
+#ifndef RELEASE
+    PushCallStack("PackKernelsTest");
+#endif
+    const int localHeight = m / stride;
+    const double packBytes = 2.*localHeight*n*sizeof(T);
+    const double transposeBytes = 2.*m*n*sizeof(T);
+
+    Matrix<T> A, B, BRef;
+    Uniform( m, n, A );
+    double startTime;
+
+    // Pack every stride'th row of A, as in [MC,MR] <- [STAR,MR]
+    Zeros( localHeight, n, B );
+    Zeros( localHeight, n, BRef );
+    startTime = mpi::Time();
+    for( int rep=0; rep<numReps; ++rep )
+        LoopGather
+        ( localHeight, n, stride, A.LockedBuffer(), A.LDim(), BRef.Buffer() );
+    const double loopGatherTime = (mpi::Time()-startTime) / numReps;
+    startTime = mpi::Time();
+    for( int rep=0; rep<numReps; ++rep )
+        KernelGather
+        ( localHeight, n, stride, A.LockedBuffer(), A.LDim(), B.Buffer() );
+    const double kernelGatherTime = (mpi::Time()-startTime) / numReps;
+    CheckEqual( B, BRef, "Gather" );
+
+    // Unpack a packed buffer into every stride'th row, the reverse
+    Matrix<T> C, CRef;
+    Zeros( m, n, C );
+    Zeros( m, n, CRef );
+    startTime = mpi::Time();
+    for( int rep=0; rep<numReps; ++rep )
+        LoopScatter
+        ( localHeight, n, stride, B.LockedBuffer(), CRef.Buffer(),
+          CRef.LDim() );
+    const double loopScatterTime = (mpi::Time()-startTime) / numReps;
+    startTime = mpi::Time();
+    for( int rep=0; rep<numReps; ++rep )
+        KernelScatter
+        ( localHeight, n, stride, B.LockedBuffer(), C.Buffer(), C.LDim() );
+    const double kernelScatterTime = (mpi::Time()-startTime) / numReps;
+    CheckEqual( C, CRef, "Scatter" );
+
+    // Transpose and adjoint, as in [MC,MR].TransposeFrom( [MR,STAR] )
+    double loopTransposeTime[2], kernelTransposeTime[2];
+    for( int conjugate=0; conjugate<2; ++conjugate )
+    {
+        Zeros( n, m, B );
+        Zeros( n, m, BRef );
+        startTime = mpi::Time();
+        for( int rep=0; rep<numReps; ++rep )
+            LoopTranspose
+            ( n, m, A.LockedBuffer(), A.LDim(), BRef.Buffer(), BRef.LDim(),
+              conjugate );
+        loopTransposeTime[conjugate] = (mpi::Time()-startTime) / numReps;
+        startTime = mpi::Time();
+        for( int rep=0; rep<numReps; ++rep )
+            KernelTranspose
+            ( n, m, A.LockedBuffer(), A.LDim(), B.Buffer(), B.LDim(),
+              conjugate );
+        kernelTransposeTime[conjugate] = (mpi::Time()-startTime) / numReps;
+        CheckEqual( B, BRef, conjugate ? "Adjoint" : "Transpose" );
+        if( print && mpi::WorldRank() == 0 )
+            B.Print( conjugate ? "A^H" : "A^T" );
+    }
+
+    if( mpi::WorldRank() == 0 )
+    {
+        Report( "Gather   ", packBytes, loopGatherTime, kernelGatherTime );
+        Report( "Scatter  ", packBytes, loopScatterTime, kernelScatterTime );
+        Report
+        ( "Transpose", transposeBytes,
+          loopTransposeTime[0], kernelTransposeTime[0] );
+        Report
+        ( "Adjoint  ", transposeBytes,
+          loopTransposeTime[1], kernelTransposeTime[1] );
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+
+    try
+    {
+        const int m = Input("--height","height of local matrix",1000);
+        const int n = Input("--width","width of local matrix",1000);
+        const int stride = Input("--stride","stride of packed rows",2);
+        const int numReps = Input("--reps","number of repetitions",10);
+        const bool print = Input("--print","print transposes?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        if( stride < 1 )
+            throw std::logic_error("stride must be positive");
+        if( numReps < 1 )
+            throw std::logic_error("reps must be positive");
+
+        if( commRank == 0 )
+        {
+            std::cout << "---------------------\n"
+                      << "Testing with doubles:\n"
+                      << "---------------------" << std::endl;
+        }
+        PackKernelsTest<double>( m, n, stride, numReps, print );
+
+        if( commRank == 0 )
+        {
+            std::cout << "--------------------------------------\n"
+                      << "Testing with double-precision complex:\n"
+                      << "--------------------------------------" << std::endl;
+        }
+        PackKernelsTest<Complex<double> >( m, n, stride, numReps, print );
+    }
+    catch( ArgException& e ) { }
+    catch( std::exception& e )
+    {
+        std::ostringstream os;
+        os << "Process " << commRank << " caught error message:\n" << e.what()
+           << std::endl;
+        std::cerr << os.str();
+#ifndef RELEASE
+        DumpCallStack();
+#endif
+    }
+    Finalize();
+    return 0;
+}
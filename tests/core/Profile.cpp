@@ -0,0 +1,67 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "elemental.hpp"
+using namespace elem;
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+    const int commSize = mpi::CommSize( comm );
+
+    try
+    {
+        int r = Input("--gridHeight","height of process grid",0);
+        const int n = Input("--size","size of matrices",500);
+        const int nb = Input("--nb","algorithmic blocksize",64);
+        const bool trace = Input("--trace","write Chrome traces?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const int c = commSize / r;
+        const Grid g( comm, r, c );
+        SetBlocksize( nb );
+
+        DistMatrix<double> A(g), B(g), C(g);
+        DistMatrix<int,VC,STAR> p(g);
+        Uniform( n, n, A );
+        Uniform( n, n, B );
+        Zeros( n, n, C );
+
+        EnableProfiling( trace );
+        Gemm( NORMAL, NORMAL, 1., A, B, 0., C );
+        LU( C, p );
+        DisableProfiling();
+
+        PrintProfile( comm );
+        if( trace )
+            WriteProfileTrace( "Profile" );
+
+        // Profiling should be transparent to the profiled routines
+        ResetProfile();
+        PrintProfile( comm );
+    }
+    catch( ArgException& e ) { }
+    catch( std::exception& e )
+    {
+        std::ostringstream os;
+        os << "Process " << commRank << " caught error message:\n" << e.what()
+           << std::endl;
+        std::cerr << os.str();
+#ifndef RELEASE
+        DumpCallStack();
+#endif
+    }
+    Finalize();
+    return 0;
+}
@@ -0,0 +1,161 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <cstdio>
+#include "elemental.hpp"
+using namespace elem;
+
+template<typename T,Distribution U,Distribution V>
+void
+CheckEqual
+( const DistMatrix<T>& A, const DistMatrix<T,U,V>& B, std::string name )
+{
+    DistMatrix<T,U,V> ACopy( A.Grid() );
+    ACopy.AlignWith( B );
+    ACopy = A;
+    int mismatch = 0;
+    for( int jLocal=0; jLocal<B.LocalWidth(); ++jLocal )
+        for( int iLocal=0; iLocal<B.LocalHeight(); ++iLocal )
+            if( B.GetLocal(iLocal,jLocal) != ACopy.GetLocal(iLocal,jLocal) )
+                mismatch = 1;
+    int anyMismatch;
+    mpi::AllReduce( &mismatch, &anyMismatch, 1, mpi::MAX, mpi::COMM_WORLD );
+    if( anyMismatch )
+        throw std::logic_error(name+" did not match the file");
+}
+
+// Reports the rate at which the file was ingested, using the slowest process
+void
+Report( std::string name, double fileBytes, double localTime, int numReps )
+{
+    double time;
+    mpi::AllReduce( &localTime, &time, 1, mpi::MAX, mpi::COMM_WORLD );
+    time /= numReps;
+    if( mpi::WorldRank() == 0 )
+        std::cout << "  " << name << ": " << time << " seconds, "
+                  << fileBytes/time/1.e9 << " GB/s" << std::endl;
+}
+
+template<typename T,Distribution U,Distribution V>
+void
+TimeColumnMajor
+( const DistMatrix<T>& A, std::string filename, int numReps,
+  std::string name )
+{
+    const Grid& g = A.Grid();
+    const int m = A.Height();
+    const int n = A.Width();
+    DistMatrix<T,U,V> B( g );
+    mpi::Barrier( mpi::COMM_WORLD );
+    const double startTime = mpi::Time();
+    for( int rep=0; rep<numReps; ++rep )
+        ReadColumnMajor( B, filename, m, n, BINARY_HEADER_SIZE );
+    const double localTime = mpi::Time() - startTime;
+    CheckEqual( A, B, name );
+    Report( name, double(m)*n*sizeof(T), localTime, numReps );
+}
+
+template<typename T>
+void
+ReadColumnMajorTest( int m, int n, std::string filename, int numReps )
+{
+#ifndef RELEASE
+    PushCallStack("ReadColumnMajorTest");
+#endif
+    const Grid g( mpi::COMM_WORLD );
+    DistMatrix<T> A( g );
+    Uniform( m, n, A );
+    A.WriteBinary( filename );
+    const double fileBytes = double(m)*n*sizeof(T);
+
+    TimeColumnMajor<T,MC,  MR  >( A, filename, numReps, "[MC,MR] ");
+    TimeColumnMajor<T,VC,  STAR>( A, filename, numReps, "[VC,* ] ");
+    TimeColumnMajor<T,STAR,VR  >( A, filename, numReps, "[* ,VR] ");
+
+    // For comparison, collective MPI-IO reads and the old approach of
+    // reading the full matrix into [* ,* ] and then redistributing
+    DistMatrix<T> B( g );
+    mpi::Barrier( mpi::COMM_WORLD );
+    double startTime = mpi::Time();
+    for( int rep=0; rep<numReps; ++rep )
+        B.ReadBinary( filename );
+    double localTime = mpi::Time() - startTime;
+    CheckEqual( A, B, "ReadBinary" );
+    Report( "ReadBinary into [MC,MR]", fileBytes, localTime, numReps );
+
+    mpi::Barrier( mpi::COMM_WORLD );
+    startTime = mpi::Time();
+    for( int rep=0; rep<numReps; ++rep )
+    {
+        DistMatrix<T,STAR,STAR> B_STAR_STAR( g );
+        B_STAR_STAR.ResizeTo( m, n );
+        B_STAR_STAR.LocalMatrix().ReadBinary( filename );
+        B = B_STAR_STAR;
+    }
+    localTime = mpi::Time() - startTime;
+    CheckEqual( A, B, "[* ,* ] staging" );
+    Report( "[* ,* ] staging into [MC,MR]", fileBytes, localTime, numReps );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+
+    try
+    {
+        const int m = Input("--height","height of matrix",2000);
+        const int n = Input("--width","width of matrix",2000);
+        const int numReps = Input("--reps","number of repetitions",3);
+        const std::string filename =
+            Input("--filename","matrix file",std::string("matrix.bin"));
+        ProcessInput();
+        PrintInputReport();
+
+        if( numReps < 1 )
+            throw std::logic_error("reps must be positive");
+
+        if( commRank == 0 )
+        {
+            std::cout << "---------------------\n"
+                      << "Testing with doubles:\n"
+                      << "---------------------" << std::endl;
+        }
+        ReadColumnMajorTest<double>( m, n, filename, numReps );
+
+        if( commRank == 0 )
+        {
+            std::cout << "--------------------------------------\n"
+                      << "Testing with double-precision complex:\n"
+                      << "--------------------------------------" << std::endl;
+        }
+        ReadColumnMajorTest<Complex<double> >( m, n, filename, numReps );
+
+        mpi::Barrier( comm );
+        if( commRank == 0 )
+            std::remove( filename.c_str() );
+    }
+    catch( ArgException& e ) { }
+    catch( std::exception& e )
+    {
+        std::ostringstream os;
+        os << "Process " << commRank << " caught error message:\n" << e.what()
+           << std::endl;
+        std::cerr << os.str();
+#ifndef RELEASE
+        DumpCallStack();
+#endif
+    }
+    Finalize();
+    return 0;
+}
@@ -0,0 +1,190 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "elemental.hpp"
+using namespace std;
+using namespace elem;
+
+// Sweeps the blocksizes of the registered routines on the current machine and
+// saves the fastest into a file which may be loaded by setting the
+// environment variable ELEM_BLOCKSIZE_FILE
+
+template<typename R>
+void RunQR( DistMatrix<R>& A )
+{ QR( A ); }
+
+template<typename R>
+void RunQR( DistMatrix<Complex<R> >& A )
+{
+    DistMatrix<Complex<R>,MD,STAR> t( A.Grid() );
+    QR( A, t );
+}
+
+template<typename R>
+void RunHermitianTridiag( DistMatrix<R>& A )
+{ HermitianTridiag( LOWER, A ); }
+
+template<typename R>
+void RunHermitianTridiag( DistMatrix<Complex<R> >& A )
+{
+    DistMatrix<Complex<R>,STAR,STAR> t( A.Grid() );
+    HermitianTridiag( LOWER, A, t );
+}
+
+template<typename R>
+void RunBidiag( DistMatrix<R>& A )
+{ Bidiag( A ); }
+
+template<typename R>
+void RunBidiag( DistMatrix<Complex<R> >& A )
+{
+    DistMatrix<Complex<R>,STAR,STAR> tP( A.Grid() ), tQ( A.Grid() );
+    Bidiag( A, tP, tQ );
+}
+
+template<typename F>
+double
+TimeRoutine( string routine, int n, const Grid& g )
+{
+    DistMatrix<F> A(g), B(g), C(g);
+    DistMatrix<int,VC,STAR> p(g);
+    if( routine == "Cholesky" || routine == "HermitianTridiag" )
+        HermitianUniformSpectrum( n, A, 1, 10 );
+    else
+        Uniform( n, n, A );
+    if( routine == "Gemm" )
+    {
+        Uniform( n, n, B );
+        Zeros( n, n, C );
+    }
+
+    mpi::Barrier( g.Comm() );
+    const double startTime = mpi::Time();
+    if( routine == "Gemm" )
+        Gemm( NORMAL, NORMAL, F(1), A, B, F(0), C );
+    else if( routine == "Cholesky" )
+        Cholesky( LOWER, A );
+    else if( routine == "LU" )
+        LU( A, p );
+    else if( routine == "QR" )
+        RunQR( A );
+    else if( routine == "HermitianTridiag" )
+        RunHermitianTridiag( A );
+    else
+        RunBidiag( A );
+    const double localTime = mpi::Time() - startTime;
+    double runTime;
+    mpi::AllReduce( &localTime, &runTime, 1, mpi::MAX, g.Comm() );
+    return runTime;
+}
+
+template<typename F>
+void
+TuneBlocksizes
+( int n, int minBlocksize, int maxBlocksize, int step, const Grid& g )
+{
+    const int numRoutines = 6;
+    const string routines[numRoutines] =
+        { "Gemm", "Cholesky", "LU", "QR", "HermitianTridiag", "Bidiag" };
+    for( int j=0; j<numRoutines; ++j )
+    {
+        const string& routine = routines[j];
+        if( g.Rank() == 0 )
+            cout << routine << ":" << endl;
+        int bestBlocksize = minBlocksize;
+        double bestTime = 0;
+        for( int nb=minBlocksize; nb<=maxBlocksize; nb+=step )
+        {
+            SetBlocksize<F>( routine, g, nb );
+            const double runTime = TimeRoutine<F>( routine, n, g );
+            if( g.Rank() == 0 )
+                cout << "  nb=" << nb << ": " << runTime << " seconds"
+                     << endl;
+            if( nb == minBlocksize || runTime < bestTime )
+            {
+                bestBlocksize = nb;
+                bestTime = runTime;
+            }
+        }
+        SetBlocksize<F>( routine, g, bestBlocksize );
+        if( g.Rank() == 0 )
+            cout << "  chose nb=" << bestBlocksize << endl;
+    }
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+    const int commSize = mpi::CommSize( comm );
+
+    try
+    {
+        int r = Input("--gridHeight","height of process grid",0);
+        const int n = Input("--size","size of matrices",500);
+        const int minNb = Input("--minBlocksize","smallest blocksize",32);
+        const int maxNb = Input("--maxBlocksize","largest blocksize",128);
+        const int step = Input("--step","blocksize increment",32);
+        const bool testComplex = Input("--complex","also tune complex?",false);
+        const string filename =
+            Input("--file","file to save blocksizes to",
+                  string("blocksizes.txt"));
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const int c = commSize / r;
+        const Grid g( comm, r, c );
+
+        if( commRank == 0 )
+        {
+            cout << "-------------------\n"
+                 << "Tuning for doubles:\n"
+                 << "-------------------" << endl;
+        }
+        TuneBlocksizes<double>( n, minNb, maxNb, step, g );
+        if( testComplex )
+        {
+            if( commRank == 0 )
+            {
+                cout << "-------------------------------------\n"
+                     << "Tuning for double-precision complex:\n"
+                     << "-------------------------------------" << endl;
+            }
+            TuneBlocksizes<Complex<double> >( n, minNb, maxNb, step, g );
+        }
+        SaveBlocksizeRegistry( filename );
+
+        // Ensure that the saved registry reproduces the tuned blocksizes
+        const int choleskyBlocksize = Blocksize<double>( "Cholesky", g );
+        const int luBlocksize = Blocksize<double>( "LU", g );
+        ClearBlocksizeRegistry();
+        LoadBlocksizeRegistry( filename );
+        if( Blocksize<double>( "Cholesky", g ) != choleskyBlocksize ||
+            Blocksize<double>( "LU", g ) != luBlocksize )
+            throw std::logic_error("Reloaded blocksizes did not match");
+        if( commRank == 0 )
+            cout << "Saved the tuned blocksizes to " << filename << endl;
+    }
+    catch( ArgException& e ) { }
+    catch( std::exception& e )
+    {
+        std::ostringstream os;
+        os << "Process " << commRank << " caught error message:\n" << e.what()
+           << std::endl;
+        std::cerr << os.str();
+#ifndef RELEASE
+        DumpCallStack();
+#endif
+    }
+    Finalize();
+    return 0;
+}
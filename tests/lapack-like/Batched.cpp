@@ -0,0 +1,339 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <ctime>
+#include "elemental.hpp"
+using namespace std;
+using namespace elem;
+
+// Returns the maximum over the batch of ||E[k]||_F / ||A[k]||_F
+template<typename F>
+typename Base<F>::type
+MaxRelativeError
+( const std::vector<Matrix<F> >& E, const std::vector<Matrix<F> >& A )
+{
+    typedef typename Base<F>::type R;
+    R maxError = 0;
+    for( unsigned k=0; k<E.size(); ++k )
+        maxError = std::max
+        ( maxError, Norm( E[k], FROBENIUS_NORM )/Norm( A[k], FROBENIUS_NORM ) );
+    return maxError;
+}
+
+template<typename F>
+typename Base<F>::type
+MaxDifference
+( const std::vector<Matrix<F> >& A, const std::vector<Matrix<F> >& B )
+{
+    typedef typename Base<F>::type R;
+    R maxDiff = 0;
+    for( unsigned k=0; k<A.size(); ++k )
+    {
+        Matrix<F> E( A[k] );
+        Axpy( F(-1), B[k], E );
+        maxDiff = std::max( maxDiff, Norm( E, MAX_NORM ) );
+    }
+    return maxDiff;
+}
+
+template<typename F>
+void
+CopyBatch
+( const Matrix<F>& storage, int batchSize, int height, int width,
+  Matrix<F>& storageCopy, std::vector<Matrix<F> >& batchCopy )
+{
+    AttachBatch( batchSize, height, width, storageCopy, batchCopy );
+    storageCopy = storage;
+}
+
+template<typename F>
+void TestBatched
+( bool print, int batchSize, int n, int numRhs, mpi::Comm comm )
+{
+    typedef typename Base<F>::type R;
+    const int commRank = mpi::CommRank( comm );
+
+    // Every process needs the same batch for the distributed versions
+    Matrix<F> AStorage;
+    std::vector<Matrix<F> > A;
+    AttachBatch( batchSize, n, n, AStorage, A );
+    MakeUniform( AStorage );
+    mpi::Broadcast( AStorage.Buffer(), n*n*batchSize, 0, comm );
+    if( print )
+        A[0].Print("A[0]");
+
+    Matrix<F> XStorage, YStorage, LUStorage;
+    std::vector<Matrix<F> > X, Y, ALU;
+    std::vector<Matrix<int> > p;
+    AttachBatch( batchSize, n, numRhs, XStorage, X );
+    MakeUniform( XStorage );
+    CopyBatch( AStorage, batchSize, n, n, LUStorage, ALU );
+    CopyBatch( XStorage, batchSize, n, numRhs, YStorage, Y );
+
+    // Solve A Y = X using BatchedLU and BatchedTrsm, then form X - A Y
+    if( commRank == 0 )
+    {
+        cout << "  Starting BatchedLU...";
+        cout.flush();
+    }
+    double startTime = mpi::Time();
+    BatchedLU( ALU, p );
+    double runTime = mpi::Time() - startTime;
+    if( commRank == 0 )
+        cout << "DONE. " << runTime << " seconds" << endl;
+    for( int k=0; k<batchSize; ++k )
+        ApplyRowPivots( Y[k], p[k] );
+    BatchedTrsm( LEFT, LOWER, NORMAL, UNIT, F(1), ALU, Y );
+    BatchedTrsm( LEFT, UPPER, NORMAL, NON_UNIT, F(1), ALU, Y );
+    BatchedGemm( NORMAL, NORMAL, F(-1), A, Y, F(1), X );
+    const R luError = MaxRelativeError( X, Y );
+    if( commRank == 0 )
+        cout << "    max_k ||X - A inv(A) X||_F / ||inv(A) X||_F = "
+             << luError << endl;
+
+    // Form HPD matrices H = A A^H + n I and test BatchedCholesky
+    Matrix<F> HStorage, LStorage, EStorage;
+    std::vector<Matrix<F> > H, L, E;
+    AttachBatch( batchSize, n, n, HStorage, H );
+    BatchedGemm( NORMAL, ADJOINT, F(1), A, A, F(0), H );
+    for( int k=0; k<batchSize; ++k )
+        for( int j=0; j<n; ++j )
+            H[k].Update( j, j, F(n) );
+    CopyBatch( HStorage, batchSize, n, n, LStorage, L );
+    if( commRank == 0 )
+    {
+        cout << "  Starting BatchedCholesky...";
+        cout.flush();
+    }
+    startTime = mpi::Time();
+    BatchedCholesky( LOWER, L );
+    runTime = mpi::Time() - startTime;
+    if( commRank == 0 )
+        cout << "DONE. " << runTime << " seconds" << endl;
+    for( int k=0; k<batchSize; ++k )
+        MakeTriangular( LOWER, L[k] );
+    CopyBatch( HStorage, batchSize, n, n, EStorage, E );
+    BatchedGemm( NORMAL, ADJOINT, F(-1), L, L, F(1), E );
+    const R cholError = MaxRelativeError( E, H );
+
+    if( commRank == 0 )
+    {
+        cout << "  Starting sequential Cholesky...";
+        cout.flush();
+    }
+    std::vector<Matrix<F> > HSeq( H.begin(), H.end() );
+    startTime = mpi::Time();
+    for( int k=0; k<batchSize; ++k )
+        Cholesky( LOWER, HSeq[k] );
+    runTime = mpi::Time() - startTime;
+    if( commRank == 0 )
+        cout << "DONE. " << runTime << " seconds\n"
+             << "    max_k ||H - L L^H||_F / ||H||_F = " << cholError << endl;
+
+    // The R from a QR factorization satisfies R^H R = A^H A
+    Matrix<F> QRStorage;
+    std::vector<Matrix<F> > AQR, t;
+    CopyBatch( AStorage, batchSize, n, n, QRStorage, AQR );
+    if( commRank == 0 )
+    {
+        cout << "  Starting BatchedQR...";
+        cout.flush();
+    }
+    startTime = mpi::Time();
+    BatchedQR( AQR, t );
+    runTime = mpi::Time() - startTime;
+    if( commRank == 0 )
+        cout << "DONE. " << runTime << " seconds" << endl;
+    for( int k=0; k<batchSize; ++k )
+        MakeTriangular( UPPER, AQR[k] );
+    std::vector<Matrix<F> > AHA;
+    AttachBatch( batchSize, n, n, EStorage, E );
+    AttachBatch( batchSize, n, n, HStorage, AHA );
+    BatchedGemm( ADJOINT, NORMAL, F(1), A, A, F(0), AHA );
+    E = AHA;
+    BatchedGemm( ADJOINT, NORMAL, F(-1), AQR, AQR, F(1), E );
+    const R qrError = MaxRelativeError( E, AHA );
+    if( commRank == 0 )
+        cout << "    max_k ||A^H A - R^H R||_F / ||A^H A||_F = "
+             << qrError << endl;
+
+    // Test the eigenpairs of the Hermitian matrices H = A + A^H
+    std::vector<Matrix<F> > Z;
+    std::vector<Matrix<R> > w;
+    AttachBatch( batchSize, n, n, HStorage, H );
+    for( int k=0; k<batchSize; ++k )
+    {
+        Adjoint( A[k], H[k] );
+        Axpy( F(1), A[k], H[k] );
+    }
+    if( commRank == 0 )
+    {
+        cout << "  Starting BatchedHermitianEig...";
+        cout.flush();
+    }
+    startTime = mpi::Time();
+    BatchedHermitianEig( LOWER, H, w, Z );
+    runTime = mpi::Time() - startTime;
+    if( commRank == 0 )
+        cout << "DONE. " << runTime << " seconds" << endl;
+    std::vector<Matrix<F> > ZW( Z.begin(), Z.end() );
+    for( int k=0; k<batchSize; ++k )
+        for( int j=0; j<n; ++j )
+            for( int i=0; i<n; ++i )
+                ZW[k].Set( i, j, ZW[k].Get(i,j)*w[k].Get(j,0) );
+    BatchedGemm( NORMAL, NORMAL, F(1), H, Z, F(-1), ZW );
+    const R eigError = MaxRelativeError( ZW, H );
+    std::vector<Matrix<F> > I( batchSize );
+    for( int k=0; k<batchSize; ++k )
+        Identity( n, n, I[k] );
+    BatchedGemm( ADJOINT, NORMAL, F(-1), Z, Z, F(1), I );
+    R orthogError = 0;
+    for( int k=0; k<batchSize; ++k )
+        orthogError = std::max( orthogError, Norm( I[k], FROBENIUS_NORM ) );
+    if( commRank == 0 )
+        cout << "    max_k ||H Z - Z W||_F / ||H||_F = " << eigError << "\n"
+             << "    max_k ||I - Z^H Z||_F         = " << orthogError
+             << endl;
+
+    // The distributed versions, applied to this process's portion of the 
+    // batch, should exactly reproduce the results once they are gathered
+    const int commSize = mpi::CommSize( comm );
+    const int kBeg = (commRank*batchSize)/commSize;
+    const int kEnd = ((commRank+1)*batchSize)/commSize;
+    std::vector<Matrix<F> > ALULocal( A.begin()+kBeg, A.begin()+kEnd ),
+                            HLocal( H.begin()+kBeg, H.begin()+kEnd ), ZLocal;
+    std::vector<Matrix<int> > pLocal;
+    std::vector<Matrix<R> > wLocal;
+    if( commRank == 0 )
+    {
+        cout << "  Starting distributed BatchedLU and BatchedHermitianEig...";
+        cout.flush();
+    }
+    mpi::Barrier( comm );
+    startTime = mpi::Time();
+    BatchedLU( ALULocal, pLocal, comm );
+    BatchedHermitianEig( LOWER, HLocal, wLocal, ZLocal, comm );
+    mpi::Barrier( comm );
+    runTime = mpi::Time() - startTime;
+    if( commRank == 0 )
+    {
+        cout << "DONE. " << runTime << " seconds\n"
+             << "  Starting AllGatherBatch...";
+        cout.flush();
+    }
+    std::vector<Matrix<F> > ALUDist, ZDist;
+    std::vector<Matrix<int> > pDist;
+    std::vector<Matrix<R> > wDist;
+    mpi::Barrier( comm );
+    startTime = mpi::Time();
+    AllGatherBatch( ALULocal, ALUDist, comm );
+    AllGatherBatch( pLocal, pDist, comm );
+    AllGatherBatch( wLocal, wDist, comm );
+    AllGatherBatch( ZLocal, ZDist, comm );
+    mpi::Barrier( comm );
+    runTime = mpi::Time() - startTime;
+    int numPivotDiffs = 0;
+    for( int k=0; k<batchSize; ++k )
+        for( int i=0; i<n; ++i )
+            if( p[k].Get(i,0) != pDist[k].Get(i,0) )
+                ++numPivotDiffs;
+    const R luDiff = MaxDifference( ALU, ALUDist );
+    const R wDiff = MaxDifference( w, wDist );
+    const R ZDiff = MaxDifference( Z, ZDist );
+    if( commRank == 0 )
+        cout << "DONE. " << runTime << " seconds\n"
+             << "    max difference in LU factors   = " << luDiff << "\n"
+             << "    number of differing pivots     = " << numPivotDiffs << "\n"
+             << "    max difference in eigenvalues  = " << wDiff << "\n"
+             << "    max difference in eigenvectors = " << ZDiff << endl;
+
+    // A failure in one member should be reported without affecting the rest
+    const int kFail = batchSize/2;
+    std::vector<Matrix<F> > LLocal( L.begin()+kBeg, L.begin()+kEnd );
+    if( kFail >= kBeg && kFail < kEnd )
+        LLocal[kFail-kBeg].Set( 0, 0, F(-1) );
+    bool caught = false;
+    const StackDepths depths = GetStackDepths();
+    try { BatchedCholesky( LOWER, LLocal, comm ); }
+    catch( std::runtime_error& e )
+    {
+        caught = true;
+        if( commRank == 0 )
+            cout << "  Expected failure: " << e.what() << endl;
+    }
+    if( !caught )
+        throw std::logic_error("BatchedCholesky did not report a failure");
+    // Only the entry of BatchedCholesky itself, which threw, may remain
+    const StackDepths newDepths = GetStackDepths();
+    if( newDepths.callStack > depths.callStack+1 ||
+        newDepths.profileRegions > depths.profileRegions+1 ||
+        newDepths.blocksizeStack != depths.blocksizeStack ||
+        newDepths.tunedRoutines != depths.tunedRoutines )
+        throw std::logic_error
+        ("The failed member left entries on the call, profile, or blocksize "
+         "stacks");
+    RestoreStackDepths( depths );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+
+    try
+    {
+        const int batchSize = Input("--batchSize","number of matrices",1000);
+        const int n = Input("--size","size of each matrix",32);
+        const int numRhs = Input("--numRhs","number of right-hand sides",4);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+#ifndef RELEASE
+        if( commRank == 0 )
+        {
+            cout << "==========================================\n"
+                 << " In debug mode! Performance will be poor! \n"
+                 << "==========================================" << endl;
+        }
+#endif
+        if( commRank == 0 )
+            cout << "Will test batched routines" << endl;
+
+        if( commRank == 0 )
+        {
+            cout << "---------------------\n"
+                 << "Testing with doubles:\n"
+                 << "---------------------" << endl;
+        }
+        TestBatched<double>( print, batchSize, n, numRhs, comm );
+
+        if( commRank == 0 )
+        {
+            cout << "--------------------------------------\n"
+                 << "Testing with double-precision complex:\n"
+                 << "--------------------------------------" << endl;
+        }
+        TestBatched<Complex<double> >( print, batchSize, n, numRhs, comm );
+    }
+    catch( ArgException& e ) { }
+    catch( exception& e )
+    {
+        ostringstream os;
+        os << "Process " << commRank << " caught error message:\n" << e.what()
+           << endl;
+        cerr << os.str();
+#ifndef RELEASE
+        DumpCallStack();
+#endif
+    }
+    Finalize();
+    return 0;
+}
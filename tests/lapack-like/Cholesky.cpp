@@ -83,7 +83,7 @@ void TestCorrectness
 
 template<typename F> 
 void TestCholesky
-( bool testCorrectness, bool printMatrices, 
+( bool testCorrectness, bool printMatrices, bool commStats,
   UpperOrLower uplo, int m, const Grid& g )
 {
     DistMatrix<F> A(g), AOrig(g);
@@ -110,7 +110,13 @@ void TestCholesky
     }
     mpi::Barrier( g.Comm() );
     const double startTime = mpi::Time();
+    if( commStats )
+    {
+        mpi::ResetCommAccounting();
+        mpi::EnableCommAccounting();
+    }
     Cholesky( uplo, A );
+    mpi::DisableCommAccounting();
     mpi::Barrier( g.Comm() );
     const double runTime = mpi::Time() - startTime;
     const double realGFlops = 1./3.*Pow(double(m),3.)/(1.e9*runTime);
@@ -120,6 +126,11 @@ void TestCholesky
         cout << "DONE.\n"
              << "  Time = " << runTime << " seconds. GFlops = " 
              << gFlops << endl;
+        if( commStats )
+        {
+            cout << "  Communication of process 0:\n";
+            mpi::PrintCommStats( cout );
+        }
     }
     if( printMatrices )
         A.Print("A after factorization");
@@ -145,6 +156,8 @@ main( int argc, char* argv[] )
         const bool testCorrectness = Input
             ("--correctness","test correctness?",true);
         const bool printMatrices = Input("--print","print matrices?",false);
+        const bool commStats = 
+            Input("--commStats","print communication statistics?",false);
         ProcessInput();
         PrintInputReport();
 
@@ -174,7 +187,7 @@ main( int argc, char* argv[] )
                  << "---------------------" << endl;
         }
         TestCholesky<double>
-        ( testCorrectness, printMatrices, uplo, m, g );
+        ( testCorrectness, printMatrices, commStats, uplo, m, g );
 
         if( commRank == 0 )
         {
@@ -183,7 +196,7 @@ main( int argc, char* argv[] )
                  << "--------------------------------------" << endl;
         }
         TestCholesky<Complex<double> >
-        ( testCorrectness, printMatrices, uplo, m, g );
+        ( testCorrectness, printMatrices, commStats, uplo, m, g );
     }
     catch( ArgException& e ) { }
     catch( exception& e )
@@ -0,0 +1,142 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "elemental.hpp"
+using namespace std;
+using namespace elem;
+
+template<typename F,Distribution U,Distribution V>
+void TestNorms( const DistMatrix<F>& A, const string& label )
+{
+    typedef typename Base<F>::type R;
+    const Grid& g = A.Grid();
+    DistMatrix<F,U,V> ARedist(g);
+    ARedist = A;
+
+    vector<NormType> types(4);
+    types[0] = ONE_NORM;
+    types[1] = INFINITY_NORM;
+    types[2] = MAX_NORM;
+    types[3] = FROBENIUS_NORM;
+    vector<R> norms;
+    mpi::Barrier( g.Comm() );
+    double startTime = mpi::Time();
+    Norms( ARedist, types, norms );
+    mpi::Barrier( g.Comm() );
+    const double fusedTime = mpi::Time() - startTime;
+
+    R maxRelError = 0;
+    startTime = mpi::Time();
+    for( int k=0; k<4; ++k )
+    {
+        const R norm = Norm( ARedist, types[k] );
+        maxRelError = max( maxRelError, Abs(norms[k]-norm)/norm );
+    }
+    mpi::Barrier( g.Comm() );
+    const double separateTime = mpi::Time() - startTime;
+    if( g.Rank() == 0 )
+        cout << "  " << label << ": max relative error = " << maxRelError
+             << ", fused time = " << fusedTime << ", separate time = "
+             << separateTime << endl;
+}
+
+template<typename F>
+void TestFusedReductions( int m, int n, const Grid& g )
+{
+    typedef typename Base<F>::type R;
+    DistMatrix<F> A(g), X(g), Y(g);
+    Uniform( m, n, A );
+    TestNorms<F,MC,  MR  >( A, "[MC,MR]" );
+    TestNorms<F,VC,  STAR>( A, "[VC,* ]" );
+    TestNorms<F,STAR,VR  >( A, "[* ,VR]" );
+    TestNorms<F,STAR,STAR>( A, "[* ,* ]" );
+
+    // Check the bounds against the two-norm
+    const R twoNorm = Norm( A, TWO_NORM );
+    const R lowerBound = TwoNormLowerBound( A );
+    const R upperBound = TwoNormUpperBound( A );
+    if( g.Rank() == 0 )
+        cout << "  " << lowerBound << " <= ||A||_2 = " << twoNorm << " <= "
+             << upperBound << endl;
+    if( lowerBound > twoNorm*(1+m*lapack::MachineEpsilon<R>()) ||
+        upperBound < twoNorm*(1-m*lapack::MachineEpsilon<R>()) )
+        throw logic_error("Two-norm bounds were violated");
+
+    // Compare the fused inner products against individual ones, with X
+    // misaligned with Y so that it must be redistributed
+    X.AlignWith( A );
+    Uniform( m, n, X );
+    Y.Align( g.Height()-1, g.Width()-1 );
+    Uniform( m, n, Y );
+    vector<F> dots;
+    MultiDot( X, Y, dots );
+    R maxRelError = 0;
+    DistMatrix<F> x(g), y(g);
+    for( int j=0; j<n; ++j )
+    {
+        LockedView( x, X, 0, j, m, 1 );
+        LockedView( y, Y, 0, j, m, 1 );
+        const F dot = Dot( x, y );
+        maxRelError = max( maxRelError, Abs(dots[j]-dot)/Abs(dot) );
+    }
+    if( g.Rank() == 0 )
+        cout << "  MultiDot: max relative error = " << maxRelError << endl;
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+    const int commSize = mpi::CommSize( comm );
+
+    try
+    {
+        int r = Input("--gridHeight","process grid height",0);
+        const int m = Input("--height","height of matrix",100);
+        const int n = Input("--width","width of matrix",100);
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const int c = commSize / r;
+        const Grid g( comm, r, c );
+
+        if( commRank == 0 )
+        {
+            cout << "---------------------\n"
+                 << "Testing with doubles:\n"
+                 << "---------------------" << endl;
+        }
+        TestFusedReductions<double>( m, n, g );
+
+        if( commRank == 0 )
+        {
+            cout << "--------------------------------------\n"
+                 << "Testing with double-precision complex:\n"
+                 << "--------------------------------------" << endl;
+        }
+        TestFusedReductions<Complex<double> >( m, n, g );
+    }
+    catch( ArgException& e ) { }
+    catch( exception& e )
+    {
+        ostringstream os;
+        os << "Process " << commRank << " caught error message:\n" << e.what()
+           << endl;
+        cerr << os.str();
+#ifndef RELEASE
+        DumpCallStack();
+#endif
+    }
+
+    Finalize();
+    return 0;
+}
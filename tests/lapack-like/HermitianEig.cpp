@@ -169,7 +169,7 @@ void TestCorrectness
 void TestHermitianEigDouble
 ( bool testCorrectness, bool print,
   bool onlyEigvals, char range, bool clustered, UpperOrLower uplo, int m, 
-  double vl, double vu, int il, int iu, const Grid& g )
+  double vl, double vu, int il, int iu, TridiagEigAlg alg, const Grid& g )
 {
     DistMatrix<double> A(g), AOrig(g), Z(g);
     DistMatrix<double,VR,STAR> w(g);
@@ -211,11 +211,11 @@ void TestHermitianEigDouble
     else
     {
         if( range == 'A' )
-            HermitianEig( uplo, A, w, Z );
+            HermitianEig( uplo, A, w, Z, alg );
         else if( range == 'I' )
-            HermitianEig( uplo, A, w, Z, il, iu );
+            HermitianEig( uplo, A, w, Z, il, iu, alg );
         else
-            HermitianEig( uplo, A, w, Z, vl, vu );
+            HermitianEig( uplo, A, w, Z, vl, vu, alg );
     }
     mpi::Barrier( g.Comm() );
     const double runTime = mpi::Time() - startTime;
@@ -237,7 +237,7 @@ void TestHermitianEigDouble
 void TestHermitianEigDoubleComplex
 ( bool testCorrectness, bool print,
   bool onlyEigvals, char range, bool clustered, UpperOrLower uplo, int m, 
-  double vl, double vu, int il, int iu, const Grid& g )
+  double vl, double vu, int il, int iu, TridiagEigAlg alg, const Grid& g )
 {
     DistMatrix<Complex<double> > A(g), AOrig(g), Z(g);
     DistMatrix<double,VR,STAR> w(g);
@@ -279,11 +279,11 @@ void TestHermitianEigDoubleComplex
     else
     {
         if( range == 'A' )
-            HermitianEig( uplo, A, w, Z );
+            HermitianEig( uplo, A, w, Z, alg );
         else if( range == 'I' )
-            HermitianEig( uplo, A, w, Z, il, iu );
+            HermitianEig( uplo, A, w, Z, il, iu, alg );
         else
-            HermitianEig( uplo, A, w, Z, vl, vu );
+            HermitianEig( uplo, A, w, Z, vl, vu, alg );
     }
     mpi::Barrier( g.Comm() );
     const double runTime = mpi::Time() - startTime;
@@ -325,6 +325,11 @@ main( int argc, char* argv[] )
         const double vu = Input("--vu","upper bound of value range",100.);
         const bool clustered = Input
             ("--cluster","force clustered eigenvalues?",false);
+        const bool divideAndConquer = Input
+            ("--dc","use divide and conquer for the tridiagonal problem?",
+             false);
+        const int numSlices = Input
+            ("--slices","number of spectrum slices for partial problems",1);
         const char uploChar = Input("--uplo","upper or lower storage: L/U",'L');
         const int m = Input("--height","height of matrix",100);
         const int nb = Input("--nb","algorithmic blocksize",96);
@@ -340,8 +345,12 @@ main( int argc, char* argv[] )
         const int c = commSize / r;
         const Grid g( comm, r, c );
         const UpperOrLower uplo = CharToUpperOrLower( uploChar );
+        const TridiagEigAlg alg = 
+            ( divideAndConquer ? TRIDIAG_EIG_DIVIDE_AND_CONQUER 
+                               : TRIDIAG_EIG_DEFAULT );
         SetBlocksize( nb );
         SetLocalSymvBlocksize<double>( nbLocal );
+        SetHermitianEigNumSlices( numSlices );
         SetLocalHemvBlocksize<Complex<double> >( nbLocal );
         if( range != 'A' && range != 'I' && range != 'V' )
             throw logic_error("'range' must be 'A', 'I', or 'V'");
@@ -367,7 +376,7 @@ main( int argc, char* argv[] )
         SetHermitianTridiagApproach( HERMITIAN_TRIDIAG_NORMAL );
         TestHermitianEigDouble
         ( testCorrectness, print, 
-          onlyEigvals, range, clustered, uplo, m, vl, vu, il, iu, g );
+          onlyEigvals, range, clustered, uplo, m, vl, vu, il, iu, alg, g );
 
         if( commRank == 0 )
         {
@@ -380,7 +389,7 @@ main( int argc, char* argv[] )
         SetHermitianTridiagGridOrder( ROW_MAJOR );
         TestHermitianEigDouble
         ( testCorrectness, print, 
-          onlyEigvals, range, clustered, uplo, m, vl, vu, il, iu, g );
+          onlyEigvals, range, clustered, uplo, m, vl, vu, il, iu, alg, g );
  
         if( commRank == 0 )
         {
@@ -393,7 +402,18 @@ main( int argc, char* argv[] )
         SetHermitianTridiagGridOrder( COLUMN_MAJOR );
         TestHermitianEigDouble
         ( testCorrectness, print, 
-          onlyEigvals, range, clustered, uplo, m, vl, vu, il, iu, g );
+          onlyEigvals, range, clustered, uplo, m, vl, vu, il, iu, alg, g );
+
+        if( commRank == 0 )
+        {
+            cout << "---------------------------------------------\n"
+                 << "Double-precision two-stage tridiag algorithm:\n"
+                 << "---------------------------------------------" << endl;
+        }
+        SetHermitianTridiagApproach( HERMITIAN_TRIDIAG_TWO_STAGE );
+        TestHermitianEigDouble
+        ( testCorrectness, print, 
+          onlyEigvals, range, clustered, uplo, m, vl, vu, il, iu, alg, g );
 
         if( commRank == 0 )
         {
@@ -405,7 +425,7 @@ main( int argc, char* argv[] )
         SetHermitianTridiagApproach( HERMITIAN_TRIDIAG_NORMAL );
         TestHermitianEigDoubleComplex
         ( testCorrectness, print, 
-          onlyEigvals, range, clustered, uplo, m, vl, vu, il, iu, g );
+          onlyEigvals, range, clustered, uplo, m, vl, vu, il, iu, alg, g );
 
         if( commRank == 0 )
         {
@@ -419,7 +439,7 @@ main( int argc, char* argv[] )
         SetHermitianTridiagGridOrder( ROW_MAJOR );
         TestHermitianEigDoubleComplex
         ( testCorrectness, print, 
-          onlyEigvals, range, clustered, uplo, m, vl, vu, il, iu, g );
+          onlyEigvals, range, clustered, uplo, m, vl, vu, il, iu, alg, g );
 
         if( commRank == 0 )
         {
@@ -433,7 +453,19 @@ main( int argc, char* argv[] )
         SetHermitianTridiagGridOrder( COLUMN_MAJOR );
         TestHermitianEigDoubleComplex
         ( testCorrectness, print, 
-          onlyEigvals, range, clustered, uplo, m, vl, vu, il, iu, g );
+          onlyEigvals, range, clustered, uplo, m, vl, vu, il, iu, alg, g );
+
+        if( commRank == 0 )
+        {
+            cout << "-----------------------------------------------------\n"
+                 << "Double-precision complex two-stage tridiag algorithm:\n"
+                 << "-----------------------------------------------------"
+                 << endl;
+        }
+        SetHermitianTridiagApproach( HERMITIAN_TRIDIAG_TWO_STAGE );
+        TestHermitianEigDoubleComplex
+        ( testCorrectness, print, 
+          onlyEigvals, range, clustered, uplo, m, vl, vu, il, iu, alg, g );
     }
     catch( ArgException& e ) { }
     catch( exception& e )
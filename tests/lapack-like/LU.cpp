@@ -7,6 +7,7 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include <ctime>
+#include <iomanip>
 #include "elemental.hpp"
 using namespace std;
 using namespace elem;
@@ -116,6 +117,51 @@ void TestLU
         TestCorrectness( pivot, print, A, p, ARef );
 }
 
+// Compares the runtimes of partial and tournament pivoting as the number of
+// processes is doubled, using the first 1, 2, 4, ... processes
+template<typename F>
+void ScalingBenchmark( int m, mpi::Comm comm )
+{
+    const int commRank = mpi::CommRank( comm );
+    const int commSize = mpi::CommSize( comm );
+    if( commRank == 0 )
+        cout << "    p      partial (s)   tournament (s)   speedup" << endl;
+    for( int q=1; q<=commSize; q*=2 )
+    {
+        mpi::Comm subComm;
+        const int color = ( commRank < q ? 0 : mpi::UNDEFINED );
+        mpi::CommSplit( comm, color, commRank, subComm );
+        if( commRank < q )
+        {
+            const int r = Grid::FindFactor( q );
+            const Grid g( subComm, r, q/r );
+            DistMatrix<F> A(g), AOrig(g);
+            DistMatrix<int,VC,STAR> p(g);
+            Uniform( m, m, AOrig );
+
+            double runTimes[2];
+            for( int approach=0; approach<2; ++approach )
+            {
+                SetLUPivoting
+                ( approach == 0 ? LU_PARTIAL_PIVOTING
+                                : LU_TOURNAMENT_PIVOTING );
+                A = AOrig;
+                mpi::Barrier( subComm );
+                const double startTime = mpi::Time();
+                LU( A, p );
+                mpi::Barrier( subComm );
+                runTimes[approach] = mpi::Time() - startTime;
+            }
+            if( commRank == 0 )
+                cout << setw(5) << q << "   " << setw(12) << runTimes[0]
+                     << "   " << setw(14) << runTimes[1] << "   " 
+                     << setw(7) << runTimes[0]/runTimes[1] << endl;
+            mpi::CommFree( subComm );
+        }
+        mpi::Barrier( comm );
+    }
+}
+
 int 
 main( int argc, char* argv[] )
 {
@@ -130,6 +176,11 @@ main( int argc, char* argv[] )
         const int m = Input("--height","height of matrix",100);
         const int nb = Input("--nb","algorithmic blocksize",96);
         const bool pivot = Input("--pivot","pivoted LU?",true);
+        const bool tournament = Input
+            ("--tournament","use tournament pivoting?",false);
+        const bool scaling = Input
+            ("--scaling","compare pivoting strategies over 1,2,4,... procs?",
+             false);
         const bool testCorrectness = Input
             ("--correctness","test correctness?",true);
         const bool print = Input("--print","print matrices?",false);
@@ -141,6 +192,8 @@ main( int argc, char* argv[] )
         const int c = commSize / r;
         const Grid g( comm, r, c );
         SetBlocksize( nb );
+        SetLUPivoting
+        ( tournament ? LU_TOURNAMENT_PIVOTING : LU_PARTIAL_PIVOTING );
 #ifndef RELEASE
         if( commRank == 0 )
         {
@@ -149,9 +202,25 @@ main( int argc, char* argv[] )
                  << "==========================================" << endl;
         }
 #endif
+        if( scaling )
+        {
+            if( commRank == 0 )
+                cout << "Comparing partial and tournament pivoting for "
+                     << "doubles:" << endl;
+            ScalingBenchmark<double>( m, comm );
+            SetLUPivoting
+            ( tournament ? LU_TOURNAMENT_PIVOTING : LU_PARTIAL_PIVOTING );
+        }
+
         if( commRank == 0 )
-            cout << "Will test LU" 
-                 << ( pivot ? " with partial pivoting" : " " ) << endl;
+        {
+            if( !pivot )
+                cout << "Will test LU" << endl;
+            else if( tournament )
+                cout << "Will test LU with tournament pivoting" << endl;
+            else
+                cout << "Will test LU with partial pivoting" << endl;
+        }
 
         if( commRank == 0 )
         {
@@ -0,0 +1,207 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <cstdio>
+#include "elemental.hpp"
+using namespace std;
+using namespace elem;
+
+// Reads back the entire store X and returns ||X - XRef||_F / ||XRef||_F
+template<typename F>
+typename Base<F>::type
+RelativeError( const DiskMatrix<F>& X, const DistMatrix<F>& XRef, bool print )
+{
+    DistMatrix<F> XRead( X.Grid() );
+    X.Read( 0, 0, X.Height(), X.Width(), XRead );
+    if( print )
+        XRead.Print("Result read from disk");
+    Axpy( F(-1), XRef, XRead );
+    return Norm( XRead, FROBENIUS_NORM ) / Norm( XRef, FROBENIUS_NORM );
+}
+
+template<typename F>
+void Report( string name, double runTime, typename Base<F>::type error )
+{
+    if( mpi::WorldRank() == 0 )
+        cout << "  " << name << ": " << runTime << " seconds, "
+             << "||X_ooc - X||_F / ||X||_F = " << error << endl;
+}
+
+template<typename F>
+void TestGemm
+( Orientation orientA, Orientation orientB, int m, int n, int k,
+  int tileSize, const Grid& g, string prefix, bool print )
+{
+    DistMatrix<F> A(g), B(g), C(g);
+    if( orientA == NORMAL )
+        Uniform( m, k, A );
+    else
+        Uniform( k, m, A );
+    if( orientB == NORMAL )
+        Uniform( k, n, B );
+    else
+        Uniform( n, k, B );
+    Uniform( m, n, C );
+
+    DiskMatrix<F> ADisk
+    ( prefix+"A.bin", A.Height(), A.Width(), tileSize, g );
+    DiskMatrix<F> BDisk
+    ( prefix+"B.bin", B.Height(), B.Width(), tileSize, g );
+    DiskMatrix<F> CDisk( prefix+"C.bin", m, n, tileSize, g );
+    ADisk.Write( 0, 0, A );
+    BDisk.Write( 0, 0, B );
+    CDisk.Write( 0, 0, C );
+
+    const F alpha = F(3), beta = F(-2);
+    mpi::Barrier( g.Comm() );
+    const double startTime = mpi::Time();
+    OutOfCoreGemm( orientA, orientB, alpha, ADisk, BDisk, beta, CDisk );
+    const double runTime = mpi::Time() - startTime;
+    Gemm( orientA, orientB, alpha, A, B, beta, C );
+
+    ostringstream name;
+    name << "OutOfCoreGemm " << OrientationToChar(orientA)
+         << OrientationToChar(orientB);
+    Report<F>( name.str(), runTime, RelativeError( CDisk, C, print ) );
+}
+
+template<typename F>
+void TestHerk
+( UpperOrLower uplo, Orientation orient, int n, int k, int tileSize,
+  const Grid& g, string prefix, bool print )
+{
+    DistMatrix<F> A(g), C(g);
+    if( orient == NORMAL )
+        Uniform( n, k, A );
+    else
+        Uniform( k, n, A );
+    Uniform( n, n, C );
+
+    DiskMatrix<F> ADisk
+    ( prefix+"A.bin", A.Height(), A.Width(), tileSize, g );
+    DiskMatrix<F> CDisk( prefix+"C.bin", n, n, tileSize, g );
+    ADisk.Write( 0, 0, A );
+    CDisk.Write( 0, 0, C );
+
+    const F alpha = F(3), beta = F(-2);
+    mpi::Barrier( g.Comm() );
+    const double startTime = mpi::Time();
+    OutOfCoreHerk( uplo, orient, alpha, ADisk, beta, CDisk );
+    const double runTime = mpi::Time() - startTime;
+    // Only the 'uplo' triangle is updated by either routine
+    Herk( uplo, orient, alpha, A, beta, C );
+
+    ostringstream name;
+    name << "OutOfCoreHerk " << UpperOrLowerToChar(uplo)
+         << OrientationToChar(orient);
+    Report<F>( name.str(), runTime, RelativeError( CDisk, C, print ) );
+}
+
+template<typename F>
+void TestCholesky
+( UpperOrLower uplo, int n, int tileSize, const Grid& g, string prefix,
+  bool print )
+{
+    // Form the HPD matrix A = B B^H + n I
+    DistMatrix<F> A(g), B(g);
+    Uniform( n, n, B );
+    Zeros( n, n, A );
+    Herk( uplo, NORMAL, F(1), B, F(0), A );
+    MakeTriangular( uplo, A );
+    for( int j=0; j<n; ++j )
+        A.Update( j, j, F(n) );
+
+    DiskMatrix<F> ADisk( prefix+"A.bin", n, n, tileSize, g );
+    ADisk.Write( 0, 0, A );
+
+    mpi::Barrier( g.Comm() );
+    const double startTime = mpi::Time();
+    OutOfCoreCholesky( uplo, ADisk );
+    const double runTime = mpi::Time() - startTime;
+    Cholesky( uplo, A );
+
+    ostringstream name;
+    name << "OutOfCoreCholesky " << UpperOrLowerToChar(uplo) << " ";
+    Report<F>( name.str(), runTime, RelativeError( ADisk, A, print ) );
+}
+
+template<typename F>
+void TestOutOfCore
+( int m, int n, int k, int tileSize, const Grid& g, string prefix,
+  bool print )
+{
+    TestGemm<F>( NORMAL, NORMAL, m, n, k, tileSize, g, prefix, print );
+    TestGemm<F>( NORMAL, ADJOINT, m, n, k, tileSize, g, prefix, print );
+    TestGemm<F>( ADJOINT, NORMAL, m, n, k, tileSize, g, prefix, print );
+    TestGemm<F>( TRANSPOSE, TRANSPOSE, m, n, k, tileSize, g, prefix, print );
+    TestHerk<F>( LOWER, NORMAL, n, k, tileSize, g, prefix, print );
+    TestHerk<F>( LOWER, ADJOINT, n, k, tileSize, g, prefix, print );
+    TestHerk<F>( UPPER, NORMAL, n, k, tileSize, g, prefix, print );
+    TestHerk<F>( UPPER, ADJOINT, n, k, tileSize, g, prefix, print );
+    TestCholesky<F>( LOWER, n, tileSize, g, prefix, print );
+    TestCholesky<F>( UPPER, n, tileSize, g, prefix, print );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+
+    try
+    {
+        const int m = Input("--m","height of C",100);
+        const int n = Input("--n","width of C",70);
+        const int k = Input("--k","inner dimension",50);
+        const int tileSize = Input("--tile","tile size of the stores",16);
+        const string prefix =
+            Input("--prefix","prefix of the store files",string("ooc"));
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        if( commRank == 0 )
+        {
+            cout << "---------------------\n"
+                 << "Testing with doubles:\n"
+                 << "---------------------" << endl;
+        }
+        TestOutOfCore<double>( m, n, k, tileSize, g, prefix, print );
+
+        if( commRank == 0 )
+        {
+            cout << "--------------------------------------\n"
+                 << "Testing with double-precision complex:\n"
+                 << "--------------------------------------" << endl;
+        }
+        TestOutOfCore<Complex<double> >( m, n, k, tileSize, g, prefix, print );
+
+        mpi::Barrier( comm );
+        if( commRank == 0 )
+        {
+            std::remove( (prefix+"A.bin").c_str() );
+            std::remove( (prefix+"B.bin").c_str() );
+            std::remove( (prefix+"C.bin").c_str() );
+        }
+    }
+    catch( ArgException& e ) { }
+    catch( exception& e )
+    {
+        ostringstream os;
+        os << "Process " << commRank << " caught error message:\n" << e.what()
+           << endl;
+        cerr << os.str();
+#ifndef RELEASE
+        DumpCallStack();
+#endif
+    }
+    Finalize();
+    return 0;
+}
@@ -0,0 +1,188 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "elemental.hpp"
+using namespace std;
+using namespace elem;
+
+// Returns ||B - A X||_F / (||A||_F ||X||_F), where only the lower triangle of
+// the symmetric (or Hermitian) A is referenced
+template<typename F>
+typename Base<F>::type
+Residual
+( bool conjugated, const DistMatrix<F>& A, const DistMatrix<F>& X,
+  const DistMatrix<F>& B )
+{
+    DistMatrix<F> R( B );
+    if( conjugated )
+        Hemm( LEFT, LOWER, F(-1), A, X, F(1), R );
+    else
+        Symm( LEFT, LOWER, F(-1), A, X, F(1), R );
+    return Norm( R, FROBENIUS_NORM ) /
+           (HermitianNorm( LOWER, A, FROBENIUS_NORM )*
+            Norm( X, FROBENIUS_NORM ));
+}
+
+template<typename F>
+void TestPivotedLDL
+( bool conjugated, bool print, int m, int numRhs, const Grid& g )
+{
+    typedef typename Base<F>::type R;
+    const Orientation orientation = ( conjugated ? ADJOINT : TRANSPOSE );
+
+    // Indefinite matrices with eigenvalues of both signs, so that the
+    // unpivoted LDL is unstable
+    DistMatrix<F> A(g), AOrig(g), B(g), X(g);
+    if( conjugated )
+        HermitianUniformSpectrum( m, A, -100, 100 );
+    else
+        Uniform( m, m, A );
+    AOrig = A;
+    Uniform( m, numRhs, B );
+    X = B;
+    if( print )
+        A.Print("A");
+
+    if( g.Rank() == 0 )
+    {
+        cout << "  Starting pivoted LDL^" << (conjugated ? "H" : "T")
+             << " factorization...";
+        cout.flush();
+    }
+    DistMatrix<F,MC,STAR> dSub(g);
+    DistMatrix<int,VC,STAR> p(g);
+    mpi::Barrier( g.Comm() );
+    double startTime = mpi::Time();
+    if( conjugated )
+        LDLH( A, dSub, p );
+    else
+        LDLT( A, dSub, p );
+    mpi::Barrier( g.Comm() );
+    const double ldlTime = mpi::Time() - startTime;
+    const double realGFlops = 1./3.*Pow(double(m),3.)/(1.e9*ldlTime);
+    const double gFlops = ( IsComplex<F>::val ? 4*realGFlops : realGFlops );
+    if( g.Rank() == 0 )
+        cout << "DONE.\n"
+             << "  Time = " << ldlTime << " seconds. GFlops = "
+             << gFlops << endl;
+    if( print )
+    {
+        A.Print("A after factorization");
+        dSub.Print("dSub");
+        p.Print("p");
+    }
+
+    SolveAfterLDL( orientation, A, dSub, p, X );
+    const R residual = Residual( conjugated, AOrig, X, B );
+
+    // The sequential factorization, run redundantly on every process
+    DistMatrix<F,STAR,STAR> A_STAR_STAR(g), B_STAR_STAR(g);
+    A_STAR_STAR = AOrig;
+    B_STAR_STAR = B;
+    Matrix<F> dSubSeq;
+    Matrix<int> pSeq;
+    if( conjugated )
+        LDLH( A_STAR_STAR.LocalMatrix(), dSubSeq, pSeq );
+    else
+        LDLT( A_STAR_STAR.LocalMatrix(), dSubSeq, pSeq );
+    SolveAfterLDL
+    ( orientation, A_STAR_STAR.LockedLocalMatrix(), dSubSeq, pSeq,
+      B_STAR_STAR.LocalMatrix() );
+    DistMatrix<F> XSeq(g);
+    XSeq = B_STAR_STAR;
+    const R residualSeq = Residual( conjugated, AOrig, XSeq, B );
+
+    // For comparison, Gaussian elimination on the full matrix
+    DistMatrix<F> AFull( AOrig ), XGE( B );
+    if( conjugated )
+        MakeHermitian( LOWER, AFull );
+    else
+        MakeSymmetric( LOWER, AFull );
+    mpi::Barrier( g.Comm() );
+    startTime = mpi::Time();
+    GaussianElimination( AFull, XGE );
+    mpi::Barrier( g.Comm() );
+    const double geTime = mpi::Time() - startTime;
+    const R residualGE = Residual( conjugated, AOrig, XGE, B );
+
+    if( g.Rank() == 0 )
+        cout << "  ||B - A X||_F / (||A||_F ||X||_F):\n"
+             << "    distributed LDL         = " << residual << "\n"
+             << "    sequential LDL          = " << residualSeq << "\n"
+             << "    Gaussian elimination    = " << residualGE << "\n"
+             << "  GaussianElimination time  = " << geTime << " seconds"
+             << endl;
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+    const int commSize = mpi::CommSize( comm );
+
+    try
+    {
+        int r = Input("--gridHeight","process grid height",0);
+        const int m = Input("--height","height of matrix",100);
+        const int numRhs = Input("--numRhs","number of right-hand sides",10);
+        const int nb = Input("--nb","algorithmic blocksize",96);
+        const int nbLocal = Input("--nbLocal","local blocksize",32);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const int c = commSize / r;
+        const Grid g( comm, r, c );
+        SetBlocksize( nb );
+        SetLocalTrrkBlocksize<double>( nbLocal );
+        SetLocalTrrkBlocksize<Complex<double> >( nbLocal );
+#ifndef RELEASE
+        if( commRank == 0 )
+        {
+            cout << "==========================================\n"
+                 << " In debug mode! Performance will be poor! \n"
+                 << "==========================================" << endl;
+        }
+#endif
+
+        if( commRank == 0 )
+        {
+            cout << "---------------------\n"
+                 << "Testing with doubles:\n"
+                 << "---------------------" << endl;
+        }
+        TestPivotedLDL<double>( false, print, m, numRhs, g );
+
+        if( commRank == 0 )
+        {
+            cout << "--------------------------------------\n"
+                 << "Testing with double-precision complex:\n"
+                 << "--------------------------------------" << endl;
+        }
+        TestPivotedLDL<Complex<double> >( false, print, m, numRhs, g );
+        TestPivotedLDL<Complex<double> >( true, print, m, numRhs, g );
+    }
+    catch( ArgException& e ) { }
+    catch( exception& e )
+    {
+        ostringstream os;
+        os << "Process " << commRank << " caught error message:\n" << e.what()
+           << endl;
+        cerr << os.str();
+#ifndef RELEASE
+        DumpCallStack();
+#endif
+    }
+
+    Finalize();
+    return 0;
+}
@@ -249,6 +249,62 @@ void TestComplexQR
         TestCorrectness( print, A, t, AOrig );
 }
 
+template<typename F>
+void TestTSQR
+( bool testCorrectness, bool print,
+  int m, int n, const Grid& g )
+{
+    typedef typename Base<F>::type R;
+    DistMatrix<F,VC,STAR> A(g), AOrig(g);
+    DistMatrix<F,STAR,STAR> RFactor(g);
+
+    Uniform( m, n, A );
+    if( testCorrectness )
+        AOrig = A;
+    if( print )
+        A.Print("A");
+
+    if( g.Rank() == 0 )
+    {
+        cout << "  Starting TSQR factorization...";
+        cout.flush();
+    }
+    mpi::Barrier( g.Comm() );
+    const double startTime = mpi::Time();
+    TSQR( A, RFactor );
+    mpi::Barrier( g.Comm() );
+    const double runTime = mpi::Time() - startTime;
+    if( g.Rank() == 0 )
+    {
+        cout << "DONE. " << endl
+             << "  Time = " << runTime << " seconds." << endl;
+    }
+    if( print )
+    {
+        A.Print("Q");
+        RFactor.Print("R");
+    }
+    if( testCorrectness )
+    {
+        DistMatrix<F> Q(g), RDist(g), AError(g), Z(g);
+        Q = A;
+        RDist = RFactor;
+        AError = AOrig;
+        Identity( n, n, Z );
+        Herk( UPPER, ADJOINT, F(-1), Q, F(1), Z );
+        const R orthogError = HermitianNorm( UPPER, Z, FROBENIUS_NORM );
+        Gemm( NORMAL, NORMAL, F(-1), Q, RDist, F(1), AError );
+        const R frobNormOfA = Norm( AOrig, FROBENIUS_NORM );
+        const R frobNormOfError = Norm( AError, FROBENIUS_NORM );
+        if( g.Rank() == 0 )
+        {
+            cout << "    ||Q^H Q - I||_F  = " << orthogError << "\n"
+                 << "    ||A||_F          = " << frobNormOfA << "\n"
+                 << "    ||A - QR||_F     = " << frobNormOfError << endl;
+        }
+    }
+}
+
 int 
 main( int argc, char* argv[] )
 {
@@ -263,6 +319,8 @@ main( int argc, char* argv[] )
         const int m = Input("--height","height of matrix",100);
         const int n = Input("--width","width of matrix",100);
         const int nb = Input("--nb","algorithmic blocksize",96);
+        const bool caqr = Input("--caqr","factor panels with TSQR?",false);
+        const bool tsqr = Input("--tsqr","also test explicit TSQR?",false);
         const bool testCorrectness = Input
             ("--correctness","test correctness?",true);
         const bool print = Input("--print","print matrices?",false);
@@ -274,6 +332,7 @@ main( int argc, char* argv[] )
         const int c = commSize / r;
         const Grid g( comm, r, c );
         SetBlocksize( nb );
+        SetQRApproach( caqr ? QR_CAQR : QR_HOUSEHOLDER );
 #ifndef RELEASE
         if( commRank == 0 )
         {
@@ -283,7 +342,8 @@ main( int argc, char* argv[] )
         }
 #endif
         if( commRank == 0 )
-            cout << "Will test QR" << endl;
+            cout << "Will test QR"
+                 << ( caqr ? " with TSQR panels" : "" ) << endl;
 
         if( commRank == 0 )
         {
@@ -300,6 +360,25 @@ main( int argc, char* argv[] )
                  << "--------------------------------------" << endl;
         }
         TestComplexQR<double>( testCorrectness, print, m, n, g );
+
+        if( tsqr && m >= n )
+        {
+            if( commRank == 0 )
+            {
+                cout << "--------------------------\n"
+                     << "Testing TSQR with doubles:\n"
+                     << "--------------------------" << endl;
+            }
+            TestTSQR<double>( testCorrectness, print, m, n, g );
+
+            if( commRank == 0 )
+            {
+                cout << "-------------------------------------------\n"
+                     << "Testing TSQR with double-precision complex:\n"
+                     << "-------------------------------------------" << endl;
+            }
+            TestTSQR<Complex<double> >( testCorrectness, print, m, n, g );
+        }
     }
     catch( ArgException& e ) { }
     catch( exception& e )
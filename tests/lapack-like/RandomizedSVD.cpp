@@ -0,0 +1,240 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <ctime>
+#include "elemental.hpp"
+using namespace std;
+using namespace elem;
+
+template<typename F>
+void TestCorrectness
+( bool print,
+  const DistMatrix<F>& U,
+  const DistMatrix<typename Base<F>::type,VR,STAR>& s,
+  const DistMatrix<F>& V,
+  const DistMatrix<F>& A,
+  const std::vector<typename Base<F>::type>& sigma )
+{
+    typedef typename Base<F>::type R;
+    const Grid& g = U.Grid();
+    const int m = A.Height();
+    const int k = s.Height();
+    const int minDim = sigma.size();
+
+    if( g.Rank() == 0 )
+        cout << "  Testing orthogonality of U and V..." << endl;
+    DistMatrix<F> X(g);
+    Identity( k, k, X );
+    Herk( LOWER, ADJOINT, F(-1), U, F(1), X );
+    const R frobNormOfUError = HermitianNorm( LOWER, X, FROBENIUS_NORM );
+    Identity( k, k, X );
+    Herk( LOWER, ADJOINT, F(-1), V, F(1), X );
+    const R frobNormOfVError = HermitianNorm( LOWER, X, FROBENIUS_NORM );
+    if( g.Rank() == 0 )
+    {
+        cout << "    ||U^H U - I||_F  = " << frobNormOfUError << "\n"
+             << "    ||V^H V - I||_F  = " << frobNormOfVError << endl;
+    }
+
+    if( g.Rank() == 0 )
+        cout << "  Testing the accuracy of the singular values..." << endl;
+    DistMatrix<R,STAR,STAR> s_STAR_STAR( s );
+    R maxRelError = 0;
+    for( int j=0; j<k; ++j )
+    {
+        const R error = Abs(s_STAR_STAR.GetLocal(j,0)-sigma[j]) / sigma[j];
+        maxRelError = std::max(maxRelError,error);
+    }
+    if( g.Rank() == 0 )
+        cout << "    max_j |s_j-sigma_j|/sigma_j = " << maxRelError << endl;
+
+    if( g.Rank() == 0 )
+        cout << "  Testing if A ~= U S V^H..." << endl;
+    DistMatrix<F> US( U );
+    for( int j=0; j<k; ++j )
+    {
+        DistMatrix<F> u(g);
+        View( u, US, 0, j, m, 1 );
+        Scal( F(s_STAR_STAR.GetLocal(j,0)), u );
+    }
+    DistMatrix<F> E( A );
+    Gemm( NORMAL, ADJOINT, F(1), US, V, F(-1), E );
+    const R frobNormOfError = Norm( E, FROBENIUS_NORM );
+
+    // The best rank-k approximation has a Frobenius-norm error of the
+    // two-norm of the trailing singular values
+    R optimalError = 0;
+    for( int j=k; j<minDim; ++j )
+        optimalError += sigma[j]*sigma[j];
+    optimalError = Sqrt(optimalError);
+    if( g.Rank() == 0 )
+    {
+        cout << "    rank                 = " << k << "\n"
+             << "    ||A - U S V^H||_F    = " << frobNormOfError << "\n"
+             << "    optimal error        = " << optimalError << endl;
+    }
+    if( print )
+        s.Print("s");
+}
+
+// Forms A = X diag(sigma) Y^H, where X and Y have orthonormal columns and the
+// singular values decay geometrically
+template<typename F>
+void MakeDecayingMatrix
+( int m, int n, typename Base<F>::type decay,
+  DistMatrix<F>& A, std::vector<typename Base<F>::type>& sigma )
+{
+    const Grid& g = A.Grid();
+    const int minDim = std::min(m,n);
+    sigma.resize( minDim );
+    for( int j=0; j<minDim; ++j )
+        sigma[j] = Pow( decay, typename Base<F>::type(j) );
+
+    DistMatrix<F> X(g), Y(g);
+    Gaussian( m, minDim, X );
+    Gaussian( n, minDim, Y );
+    ExplicitQR( X );
+    ExplicitQR( Y );
+    for( int j=0; j<minDim; ++j )
+    {
+        DistMatrix<F> y(g);
+        View( y, Y, 0, j, n, 1 );
+        Scal( F(sigma[j]), y );
+    }
+    Zeros( m, n, A );
+    Gemm( NORMAL, ADJOINT, F(1), X, Y, F(0), A );
+}
+
+template<typename F>
+void TestRandomizedSVD
+( bool testCorrectness, bool print, int m, int n, int rank, int oversample,
+  int numPowerIts, double decay, double tol, const Grid& g )
+{
+    typedef typename Base<F>::type R;
+    DistMatrix<F> A(g), U(g), V(g);
+    DistMatrix<R,VR,STAR> s(g);
+    std::vector<R> sigma;
+    MakeDecayingMatrix( m, n, R(decay), A, sigma );
+    if( print )
+        A.Print("A");
+
+    if( g.Rank() == 0 )
+    {
+        cout << "  Starting RandomizedSVD...";
+        cout.flush();
+    }
+    mpi::Barrier( g.Comm() );
+    double startTime = mpi::Time();
+    RandomizedSVD( A, U, s, V, rank, oversample, numPowerIts );
+    mpi::Barrier( g.Comm() );
+    double runTime = mpi::Time() - startTime;
+    if( g.Rank() == 0 )
+    {
+        cout << "DONE. " << endl
+             << "  Time = " << runTime << " seconds." << endl;
+    }
+    if( testCorrectness )
+        TestCorrectness( print, U, s, V, A, sigma );
+
+    if( g.Rank() == 0 )
+    {
+        cout << "  Starting AdaptiveRandomizedSVD...";
+        cout.flush();
+    }
+    mpi::Barrier( g.Comm() );
+    startTime = mpi::Time();
+    AdaptiveRandomizedSVD( A, U, s, V, R(tol), 0, oversample, numPowerIts );
+    mpi::Barrier( g.Comm() );
+    runTime = mpi::Time() - startTime;
+    if( g.Rank() == 0 )
+    {
+        cout << "DONE. " << endl
+             << "  Time = " << runTime << " seconds." << endl;
+    }
+    if( testCorrectness )
+        TestCorrectness( print, U, s, V, A, sigma );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+    const int commSize = mpi::CommSize( comm );
+
+    try
+    {
+        int r = Input("--gridHeight","height of process grid",0);
+        const int m = Input("--height","height of matrix",300);
+        const int n = Input("--width","width of matrix",200);
+        const int rank = Input("--rank","number of singular triplets",20);
+        const int oversample = Input("--oversample","oversampling",10);
+        const int numPowerIts = Input
+            ("--powerIts","number of power iterations",1);
+        const double decay = Input
+            ("--decay","ratio of consecutive singular values",0.8);
+        const double tol = Input
+            ("--tol","tolerance for the adaptive scheme",1e-6);
+        const int nb = Input("--nb","algorithmic blocksize",96);
+        const bool testCorrectness = Input
+            ("--correctness","test correctness?",true);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const int c = commSize / r;
+        const Grid g( comm, r, c );
+        SetBlocksize( nb );
+#ifndef RELEASE
+        if( commRank == 0 )
+        {
+            cout << "==========================================\n"
+                 << " In debug mode! Performance will be poor! \n"
+                 << "==========================================" << endl;
+        }
+#endif
+        if( commRank == 0 )
+            cout << "Will test RandomizedSVD" << endl;
+
+        if( commRank == 0 )
+        {
+            cout << "---------------------\n"
+                 << "Testing with doubles:\n"
+                 << "---------------------" << endl;
+        }
+        TestRandomizedSVD<double>
+        ( testCorrectness, print, m, n, rank, oversample, numPowerIts,
+          decay, tol, g );
+
+        if( commRank == 0 )
+        {
+            cout << "--------------------------------------\n"
+                 << "Testing with double-precision complex:\n"
+                 << "--------------------------------------" << endl;
+        }
+        TestRandomizedSVD<Complex<double> >
+        ( testCorrectness, print, m, n, rank, oversample, numPowerIts,
+          decay, tol, g );
+    }
+    catch( ArgException& e ) { }
+    catch( exception& e )
+    {
+        ostringstream os;
+        os << "Process " << commRank << " caught error message:\n" << e.what()
+           << endl;
+        cerr << os.str();
+#ifndef RELEASE
+        DumpCallStack();
+#endif
+    }
+    Finalize();
+    return 0;
+}
@@ -0,0 +1,236 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <ctime>
+#include "elemental.hpp"
+using namespace std;
+using namespace elem;
+
+template<typename F>
+void TestCorrectness
+( const DistMatrix<F>& A, const DistMatrix<F>& X, const DistMatrix<F>& B )
+{
+    typedef typename Base<F>::type R;
+    const Grid& g = A.Grid();
+
+    DistMatrix<F> E( B );
+    Gemm( NORMAL, NORMAL, F(-1), A, X, F(1), E );
+    const R frobNormOfA = Norm( A, FROBENIUS_NORM );
+    const R frobNormOfX = Norm( X, FROBENIUS_NORM );
+    const R frobNormOfError = Norm( E, FROBENIUS_NORM );
+    if( g.Rank() == 0 )
+    {
+        cout << "    ||B - A X||_F / (||A||_F ||X||_F) = "
+             << frobNormOfError/(frobNormOfA*frobNormOfX) << endl;
+    }
+}
+
+// Forms the HPD matrix A = Q diag(lambda) Q^H, where Q is a random unitary
+// matrix and the eigenvalues are logarithmically spaced between 1/cond and 1
+template<typename F>
+void MakeConditionedHPD( int n, double cond, DistMatrix<F>& A )
+{
+    typedef typename Base<F>::type R;
+    const Grid& g = A.Grid();
+    DistMatrix<F> Q(g), QScaled(g);
+    Gaussian( n, n, Q );
+    ExplicitQR( Q );
+    QScaled = Q;
+    for( int j=0; j<n; ++j )
+    {
+        const R lambda = 
+            ( n == 1 ? R(1) : Pow( R(cond), -R(j)/R(n-1) ) );
+        DistMatrix<F> q(g);
+        View( q, QScaled, 0, j, n, 1 );
+        Scal( F(lambda), q );
+    }
+    Zeros( n, n, A );
+    Gemm( NORMAL, ADJOINT, F(1), QScaled, Q, F(0), A );
+}
+
+// A failed lower-precision factorization must not leave stale entries behind
+void CheckStackDepths( const StackDepths& depths, std::string routine )
+{
+    const StackDepths newDepths = GetStackDepths();
+    if( newDepths.callStack != depths.callStack ||
+        newDepths.profileRegions != depths.profileRegions ||
+        newDepths.blocksizeStack != depths.blocksizeStack ||
+        newDepths.tunedRoutines != depths.tunedRoutines )
+        throw std::logic_error
+        (routine+" left entries on the call, profile, or blocksize stacks");
+}
+
+template<typename F>
+void TestRefinedSolve
+( bool testCorrectness, bool print, int n, int numRhs, double cond, 
+  double scale, const Grid& g )
+{
+    typedef typename Base<F>::type R;
+    DistMatrix<F> A(g), B(g), X(g), ACopy(g);
+
+    // The HPD test matrix is also used for the LU-based solve so that the
+    // condition number, and therefore the convergence, can be controlled
+    MakeConditionedHPD( n, cond, A );
+    // A sufficiently small scaling flushes A to zero in the lower precision
+    Scal( F(scale), A );
+    Uniform( n, numRhs, B );
+    if( print )
+    {
+        A.Print("A");
+        B.Print("B");
+    }
+
+    if( g.Rank() == 0 )
+    {
+        cout << "  Starting RefinedGaussianElimination...";
+        cout.flush();
+    }
+    X = B;
+    mpi::Barrier( g.Comm() );
+    double startTime = mpi::Time();
+    StackDepths depths = GetStackDepths();
+    int numIts = RefinedGaussianElimination( A, X );
+    CheckStackDepths( depths, "RefinedGaussianElimination" );
+    mpi::Barrier( g.Comm() );
+    double runTime = mpi::Time() - startTime;
+    if( g.Rank() == 0 )
+        cout << "DONE.\n"
+             << "    refinement steps = " << numIts << "\n"
+             << "    time = " << runTime << " seconds" << endl;
+    if( testCorrectness )
+        TestCorrectness( A, X, B );
+
+    if( g.Rank() == 0 )
+    {
+        cout << "  Starting GaussianElimination...";
+        cout.flush();
+    }
+    X = B;
+    ACopy = A;
+    mpi::Barrier( g.Comm() );
+    startTime = mpi::Time();
+    GaussianElimination( ACopy, X );
+    mpi::Barrier( g.Comm() );
+    runTime = mpi::Time() - startTime;
+    if( g.Rank() == 0 )
+        cout << "DONE.\n"
+             << "    time = " << runTime << " seconds" << endl;
+    if( testCorrectness )
+        TestCorrectness( A, X, B );
+
+    if( g.Rank() == 0 )
+    {
+        cout << "  Starting RefinedCholeskySolve...";
+        cout.flush();
+    }
+    X = B;
+    mpi::Barrier( g.Comm() );
+    startTime = mpi::Time();
+    depths = GetStackDepths();
+    numIts = RefinedCholeskySolve( LOWER, A, X );
+    CheckStackDepths( depths, "RefinedCholeskySolve" );
+    mpi::Barrier( g.Comm() );
+    runTime = mpi::Time() - startTime;
+    if( g.Rank() == 0 )
+        cout << "DONE.\n"
+             << "    refinement steps = " << numIts << "\n"
+             << "    time = " << runTime << " seconds" << endl;
+    if( testCorrectness )
+        TestCorrectness( A, X, B );
+
+    if( g.Rank() == 0 )
+    {
+        cout << "  Starting CholeskySolve...";
+        cout.flush();
+    }
+    X = B;
+    ACopy = A;
+    mpi::Barrier( g.Comm() );
+    startTime = mpi::Time();
+    CholeskySolve( LOWER, ACopy, X );
+    mpi::Barrier( g.Comm() );
+    runTime = mpi::Time() - startTime;
+    if( g.Rank() == 0 )
+        cout << "DONE.\n"
+             << "    time = " << runTime << " seconds" << endl;
+    if( testCorrectness )
+        TestCorrectness( A, X, B );
+    if( print )
+        X.Print("X");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+    const int commSize = mpi::CommSize( comm );
+
+    try
+    {
+        int r = Input("--gridHeight","height of process grid",0);
+        const int n = Input("--height","height of matrix",300);
+        const int numRhs = Input("--numRhs","number of right-hand sides",10);
+        const double cond = Input("--cond","condition number of A",100.);
+        const double scale = Input("--scale","scaling of A",1.);
+        const int nb = Input("--nb","algorithmic blocksize",96);
+        const bool testCorrectness = Input
+            ("--correctness","test correctness?",true);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const int c = commSize / r;
+        const Grid g( comm, r, c );
+        SetBlocksize( nb );
+#ifndef RELEASE
+        if( commRank == 0 )
+        {
+            cout << "==========================================\n"
+                 << " In debug mode! Performance will be poor! \n"
+                 << "==========================================" << endl;
+        }
+#endif
+        if( commRank == 0 )
+            cout << "Will test mixed-precision solves" << endl;
+
+        if( commRank == 0 )
+        {
+            cout << "---------------------\n"
+                 << "Testing with doubles:\n"
+                 << "---------------------" << endl;
+        }
+        TestRefinedSolve<double>
+        ( testCorrectness, print, n, numRhs, cond, scale, g );
+
+        if( commRank == 0 )
+        {
+            cout << "--------------------------------------\n"
+                 << "Testing with double-precision complex:\n"
+                 << "--------------------------------------" << endl;
+        }
+        TestRefinedSolve<Complex<double> >
+        ( testCorrectness, print, n, numRhs, cond, scale, g );
+    }
+    catch( ArgException& e ) { }
+    catch( exception& e )
+    {
+        ostringstream os;
+        os << "Process " << commRank << " caught error message:\n" << e.what()
+           << endl;
+        cerr << os.str();
+#ifndef RELEASE
+        DumpCallStack();
+#endif
+    }
+    Finalize();
+    return 0;
+}
@@ -0,0 +1,214 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <ctime>
+#include "elemental.hpp"
+using namespace std;
+using namespace elem;
+
+template<typename F>
+void TestCorrectness
+( bool print,
+  const DistMatrix<F>& U,
+  const DistMatrix<typename Base<F>::type,VR,STAR>& s,
+  const DistMatrix<F>& V,
+  const DistMatrix<F>& AOrig )
+{
+    typedef typename Base<F>::type R;
+    const Grid& g = U.Grid();
+    const int m = AOrig.Height();
+    const int n = AOrig.Width();
+    const int k = std::min(m,n);
+
+    if( g.Rank() == 0 )
+        cout << "  Testing orthogonality of U and V..." << endl;
+
+    DistMatrix<F> UL(g), X(g);
+    LockedView( UL, U, 0, 0, m, k );
+    Identity( k, k, X );
+    Herk( LOWER, ADJOINT, F(-1), UL, F(1), X );
+    const R oneNormOfUError = HermitianNorm( LOWER, X, ONE_NORM );
+    const R frobNormOfUError = HermitianNorm( LOWER, X, FROBENIUS_NORM );
+    Identity( k, k, X );
+    Herk( LOWER, ADJOINT, F(-1), V, F(1), X );
+    const R oneNormOfVError = HermitianNorm( LOWER, X, ONE_NORM );
+    const R frobNormOfVError = HermitianNorm( LOWER, X, FROBENIUS_NORM );
+    if( g.Rank() == 0 )
+    {
+        cout << "    ||U^H U - I||_1  = " << oneNormOfUError << "\n"
+             << "    ||U^H U - I||_F  = " << frobNormOfUError << "\n"
+             << "    ||V^H V - I||_1  = " << oneNormOfVError << "\n"
+             << "    ||V^H V - I||_F  = " << frobNormOfVError << endl;
+    }
+
+    if( g.Rank() == 0 )
+        cout << "  Testing if A = U S V^H..." << endl;
+
+    // Form U S V^H - A
+    DistMatrix<F> US( UL );
+    DistMatrix<R,STAR,STAR> s_STAR_STAR( s );
+    for( int j=0; j<k; ++j )
+    {
+        DistMatrix<F> u(g);
+        View( u, US, 0, j, m, 1 );
+        Scal( F(s_STAR_STAR.GetLocal(j,0)), u );
+    }
+    DistMatrix<F> E( AOrig );
+    Gemm( NORMAL, ADJOINT, F(1), US, V, F(-1), E );
+
+    const R oneNormOfA = Norm( AOrig, ONE_NORM );
+    const R frobNormOfA = Norm( AOrig, FROBENIUS_NORM );
+    const R oneNormOfError = Norm( E, ONE_NORM );
+    const R frobNormOfError = Norm( E, FROBENIUS_NORM );
+    if( g.Rank() == 0 )
+    {
+        cout << "    ||A||_1              = " << oneNormOfA << "\n"
+             << "    ||A||_F              = " << frobNormOfA << "\n"
+             << "    ||A - U S V^H||_1    = " << oneNormOfError << "\n"
+             << "    ||A - U S V^H||_F    = " << frobNormOfError << endl;
+    }
+    if( print )
+        s.Print("s");
+}
+
+template<typename F>
+void TestSVD
+( bool testCorrectness, bool print, int m, int n, int rank, const Grid& g )
+{
+    typedef typename Base<F>::type R;
+    DistMatrix<F> A(g), AOrig(g), V(g);
+    DistMatrix<R,VR,STAR> s(g);
+    if( rank < std::min(m,n) )
+    {
+        // Form a rank-deficient matrix from the product of random factors
+        DistMatrix<F> X(g), Y(g);
+        Uniform( m, rank, X );
+        Uniform( rank, n, Y );
+        Zeros( m, n, A );
+        Gemm( NORMAL, NORMAL, F(1), X, Y, F(0), A );
+    }
+    else
+        Uniform( m, n, A );
+
+    if( testCorrectness )
+    {
+        if( g.Rank() == 0 )
+        {
+            cout << "  Making copy of original matrix...";
+            cout.flush();
+        }
+        AOrig = A;
+        if( g.Rank() == 0 )
+            cout << "DONE" << endl;
+    }
+    if( print )
+        A.Print("A");
+
+    if( g.Rank() == 0 )
+    {
+        cout << "  Starting SVD...";
+        cout.flush();
+    }
+    mpi::Barrier( g.Comm() );
+    const double startTime = mpi::Time();
+    SVD( A, s, V );
+    mpi::Barrier( g.Comm() );
+    const double runTime = mpi::Time() - startTime;
+    if( g.Rank() == 0 )
+    {
+        cout << "DONE. " << endl
+             << "  Time = " << runTime << " seconds." << endl;
+    }
+    if( print )
+    {
+        A.Print("U");
+        V.Print("V");
+    }
+    if( testCorrectness )
+        TestCorrectness( print, A, s, V, AOrig );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+    const int commSize = mpi::CommSize( comm );
+
+    try
+    {
+        int r = Input("--gridHeight","height of process grid",0);
+        const int m = Input("--height","height of matrix",100);
+        const int n = Input("--width","width of matrix",100);
+        int rank = Input("--rank","rank of matrix (0 for full rank)",0);
+        const int nb = Input("--nb","algorithmic blocksize",96);
+        const bool twoStage = Input
+            ("--twoStage","use the two-stage bidiagonalization?",false);
+        const int approach = Input
+            ("--approach",
+             "bidiagonal SVD: 0=QR, 1=MRRR, 2=divide and conquer, 3=default",
+             3);
+        const bool testCorrectness = Input
+            ("--correctness","test correctness?",true);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const int c = commSize / r;
+        const Grid g( comm, r, c );
+        SetBlocksize( nb );
+        if( rank == 0 )
+            rank = std::min(m,n);
+        if( approach < 0 || approach > 3 )
+            throw logic_error("Invalid bidiagonal SVD approach");
+        SetBidiagApproach( twoStage ? BIDIAG_TWO_STAGE : BIDIAG_NORMAL );
+        SetBidiagSVDApproach( BidiagSVDApproach(approach) );
+#ifndef RELEASE
+        if( commRank == 0 )
+        {
+            cout << "==========================================\n"
+                 << " In debug mode! Performance will be poor! \n"
+                 << "==========================================" << endl;
+        }
+#endif
+        if( commRank == 0 )
+            cout << "Will test SVD" << endl;
+
+        if( commRank == 0 )
+        {
+            cout << "---------------------\n"
+                 << "Testing with doubles:\n"
+                 << "---------------------" << endl;
+        }
+        TestSVD<double>( testCorrectness, print, m, n, rank, g );
+
+        if( commRank == 0 )
+        {
+            cout << "--------------------------------------\n"
+                 << "Testing with double-precision complex:\n"
+                 << "--------------------------------------" << endl;
+        }
+        TestSVD<Complex<double> >( testCorrectness, print, m, n, rank, g );
+    }
+    catch( ArgException& e ) { }
+    catch( exception& e )
+    {
+        ostringstream os;
+        os << "Process " << commRank << " caught error message:\n" << e.what()
+           << endl;
+        cerr << os.str();
+#ifndef RELEASE
+        DumpCallStack();
+#endif
+    }
+    Finalize();
+    return 0;
+}
@@ -0,0 +1,190 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <ctime>
+#include "elemental.hpp"
+using namespace std;
+using namespace elem;
+
+// Returns ||A - B||_F / ||B||_F
+template<typename F>
+typename Base<F>::type
+RelativeDifference( const Matrix<F>& A, const Matrix<F>& B )
+{
+    Matrix<F> E( A );
+    Axpy( F(-1), B, E );
+    return Norm( E, FROBENIUS_NORM ) / Norm( B, FROBENIUS_NORM );
+}
+
+// Factors A with both the blocked and tiled algorithms (through the public
+// interface, by changing the tile size) and reports the difference
+template<typename F,class Factorization>
+void TestFactorization
+( std::string name, const Matrix<F>& A, const Factorization& factor,
+  int tileSize, int commRank )
+{
+    typedef typename Base<F>::type R;
+    Matrix<F> ABlocked( A ), ATiled( A );
+
+    SetLocalTileSize( 0 );
+    double startTime = mpi::Time();
+    factor( ABlocked );
+    const double blockedTime = mpi::Time() - startTime;
+
+    SetLocalTileSize( tileSize );
+    startTime = mpi::Time();
+    factor( ATiled );
+    const double tiledTime = mpi::Time() - startTime;
+
+    const R diff = RelativeDifference( ATiled, ABlocked );
+    if( commRank == 0 )
+        cout << "  " << name << ":\n"
+             << "    blocked time = " << blockedTime << " seconds\n"
+             << "    tiled time   = " << tiledTime << " seconds\n"
+             << "    ||F_tiled - F_blocked||_F / ||F_blocked||_F = " << diff
+             << endl;
+    if( diff > 1e-8 )
+        throw std::logic_error("The tiled and blocked factors differ");
+}
+
+template<typename F>
+struct CholeskyFactor
+{
+    UpperOrLower uplo;
+    CholeskyFactor( UpperOrLower u ) : uplo(u) { }
+    void operator()( Matrix<F>& A ) const { Cholesky( uplo, A ); }
+};
+
+template<typename F>
+struct LUFactor
+{
+    void operator()( Matrix<F>& A ) const { LU( A ); }
+};
+
+template<typename R>
+struct QRFactor
+{
+    void operator()( Matrix<R>& A ) const { QR( A ); }
+};
+
+template<typename R>
+struct QRFactor<Complex<R> >
+{
+    void operator()( Matrix<Complex<R> >& A ) const
+    {
+        // Store the scalars below the factored matrix so that they are
+        // compared as well
+        const int m = A.Height();
+        const int n = A.Width();
+        Matrix<Complex<R> > ATop, t;
+        View( ATop, A, 0, 0, m-1, n );
+        QR( ATop, t );
+        for( int j=0; j<t.Height(); ++j )
+            A.Set( m-1, j, t.Get(j,0) );
+    }
+};
+
+template<typename F>
+void TestTiled( int m, int n, int tileSize, int commRank )
+{
+    // Diagonally dominant and HPD test matrices
+    Matrix<F> A, H;
+    Uniform( m, n, A );
+    for( int j=0; j<std::min(m,n); ++j )
+        A.Update( j, j, F(std::max(m,n)) );
+    Zeros( n, n, H );
+    Herk( LOWER, ADJOINT, F(1), A, F(0), H );
+    MakeHermitian( LOWER, H );
+
+    TestFactorization
+    ( "Cholesky (lower)", H, CholeskyFactor<F>(LOWER), tileSize, commRank );
+    TestFactorization
+    ( "Cholesky (upper)", H, CholeskyFactor<F>(UPPER), tileSize, commRank );
+    TestFactorization( "LU", A, LUFactor<F>(), tileSize, commRank );
+
+    Matrix<F> AWide;
+    Transpose( A, AWide );
+    TestFactorization( "LU (wide)", AWide, LUFactor<F>(), tileSize, commRank );
+    TestFactorization( "QR", A, QRFactor<F>(), tileSize, commRank );
+    TestFactorization
+    ( "QR (wide)", AWide, QRFactor<F>(), tileSize, commRank );
+
+    // A failure in any tile should be reported once all tasks are complete
+    H.Set( n-1, n-1, F(-1) );
+    bool caught = false;
+    try { Cholesky( LOWER, H ); }
+    catch( std::logic_error& e ) { caught = true; }
+    if( !caught )
+        throw std::logic_error("Cholesky did not report a non-HPD matrix");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+
+    try
+    {
+        const int m = Input("--height","height of matrix",500);
+        const int n = Input("--width","width of matrix",300);
+        const int tileSize = Input("--tileSize","size of tiles",64);
+        const int nb = Input("--nb","algorithmic blocksize",32);
+        ProcessInput();
+        PrintInputReport();
+
+        SetBlocksize( nb );
+#ifndef RELEASE
+        if( commRank == 0 )
+        {
+            cout << "==========================================\n"
+                 << " In debug mode! Performance will be poor! \n"
+                 << "==========================================" << endl;
+        }
+#endif
+        SetLocalTileSize( tileSize );
+        if( commRank == 0 )
+        {
+            if( internal::UseLocalTiles( m, n ) )
+                cout << "Will test tiled factorizations" << endl;
+            else
+                cout << "Tiled factorizations are not available, so will "
+                        "only test the blocked factorizations" << endl;
+        }
+
+        if( commRank == 0 )
+        {
+            cout << "---------------------\n"
+                 << "Testing with doubles:\n"
+                 << "---------------------" << endl;
+        }
+        TestTiled<double>( m, n, tileSize, commRank );
+
+        if( commRank == 0 )
+        {
+            cout << "--------------------------------------\n"
+                 << "Testing with double-precision complex:\n"
+                 << "--------------------------------------" << endl;
+        }
+        TestTiled<Complex<double> >( m, n, tileSize, commRank );
+    }
+    catch( ArgException& e ) { }
+    catch( exception& e )
+    {
+        ostringstream os;
+        os << "Process " << commRank << " caught error message:\n" << e.what()
+           << endl;
+        cerr << os.str();
+#ifndef RELEASE
+        DumpCallStack();
+#endif
+    }
+    Finalize();
+    return 0;
+}